@@ -2,12 +2,12 @@ CrawlerSrc = $(BkRoot)src/blinkit
 CrawlerFlags = -I$(CrawlerSrc) -I$(BkRoot)src/stub/icu -DBLINKIT_CRAWLER_ONLY $(CrFlags) -include _pc.h
 CrawlerObjects = app_constants.o app_impl.o posix_app.o \
 	local_frame_client_impl.o posix_task_runner.o posix_thread.o thread_impl.o url_loader_impl.o \
-	bk_http_header_map.o bk_url.o \
-	crawler_document.o crawler_element.o crawler_impl.o crawler_script_element.o \
-	curl_request.o request_impl.o response_impl.o \
+	bk_http_header_map.o bk_url.o bk_segmented_buffer.o \
+	crawler_document.o crawler_element.o crawler_impl.o crawler_script_element.o link_harvester.o bloom_filter.o crawl_queue_impl.o request_filter.o readiness_tracker.o crawler_metrics.o memory_budget.o \
+	curl_request.o request_impl.o response_impl.o request_backend.o request_archive.o \
 	context_impl.o js_value_impl.o \
 	http_loader_task.o loader_task.o \
-	buffer.o controller.o \
+	buffer.o controller.o memory_governor.o \
 	task_loop.o
 
 app_constants.o: $(CrawlerSrc)/app/app_constants.cpp
@@ -30,20 +30,40 @@ url_loader_impl.o: $(CrawlerSrc)/blink_impl/url_loader_impl.cpp
 
 bk_http_header_map.o: $(CrawlerSrc)/common/bk_http_header_map.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+bk_segmented_buffer.o: $(CrawlerSrc)/common/bk_segmented_buffer.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 bk_url.o: $(CrawlerSrc)/common/bk_url.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 
+bloom_filter.o: $(CrawlerSrc)/crawler/bloom_filter.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+crawl_queue_impl.o: $(CrawlerSrc)/crawler/crawl_queue_impl.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 crawler_document.o: $(CrawlerSrc)/crawler/crawler_document.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 crawler_element.o: $(CrawlerSrc)/crawler/crawler_element.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 crawler_impl.o: $(CrawlerSrc)/crawler/crawler_impl.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+crawler_metrics.o: $(CrawlerSrc)/crawler/crawler_metrics.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 crawler_script_element.o: $(CrawlerSrc)/crawler/crawler_script_element.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+link_harvester.o: $(CrawlerSrc)/crawler/link_harvester.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+memory_budget.o: $(CrawlerSrc)/crawler/memory_budget.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+readiness_tracker.o: $(CrawlerSrc)/crawler/readiness_tracker.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+request_filter.o: $(CrawlerSrc)/crawler/request_filter.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 
 curl_request.o: $(CrawlerSrc)/http/curl_request.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+request_archive.o: $(CrawlerSrc)/http/request_archive.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+request_backend.o: $(CrawlerSrc)/http/request_backend.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 request_impl.o: $(CrawlerSrc)/http/request_impl.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 response_impl.o: $(CrawlerSrc)/http/response_impl.cpp
@@ -63,6 +83,8 @@ buffer.o: $(CrawlerSrc)/misc/buffer.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 controller.o: $(CrawlerSrc)/misc/controller.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
+memory_governor.o: $(CrawlerSrc)/misc/memory_governor.cpp
+	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
 
 task_loop.o: $(CrawlerSrc)/posix/task_loop.cpp
 	$(CXX) -c $(CXXFLAGS) $(CrawlerFlags) $< -o $@
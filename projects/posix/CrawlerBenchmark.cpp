@@ -0,0 +1,414 @@
+// -------------------------------------------------
+// BlinKit - Benchmark Program
+// -------------------------------------------------
+//   File Name: CrawlerBenchmark.cpp
+// Description: Offline Crawler Benchmark
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+// Usage: CrawlerBenchmark <archive file> [iterations]
+// Crawls every page of a request archive (see PageArchive.h) the given times,
+// with all requests served by the replay backend without delay, so that no
+// network is involved, and reports the throughput and the latency percentiles of each stage. Then
+// runs the tree builder, selector query and JS eval microbenchmarks on the
+// loaded pages. The tokenizer is measured by TokenizerBenchmark.
+
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <vector>
+#include <bk_app.h>
+#include <bk_crawler.h>
+#include <bk_js.h>
+#include <BlinKit.hpp>
+#include "PageArchive.h"
+#include "base/single_thread_task_runner.h"
+#include "blinkit/crawler/crawler_impl.h"
+#include "blinkit/http/request_archive.h"
+#include "third_party/blink/public/platform/platform.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/document_fragment.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/dom/static_node_list.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
+#include "third_party/blink/renderer/platform/scheduler/public/thread.h"
+
+using namespace blink;
+using namespace BlinKit;
+
+typedef std::chrono::steady_clock Clock;
+
+static PageArchive g_archive;
+
+static double MillisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static double CPUSeconds(void)
+{
+    rusage u;
+    getrusage(RUSAGE_SELF, &u);
+    return u.ru_utime.tv_sec + u.ru_stime.tv_sec + (u.ru_utime.tv_usec + u.ru_stime.tv_usec) / 1e6;
+}
+
+static long PeakRSSInKB(void)
+{
+    rusage u;
+    getrusage(RUSAGE_SELF, &u);
+    return u.ru_maxrss;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Statistics
+
+class Samples
+{
+public:
+    void Add(double value) { m_values.push_back(value); }
+
+    void Print(const char *name)
+    {
+        if (m_values.empty())
+            return;
+
+        std::sort(m_values.begin(), m_values.end());
+        printf("  %-10s p50 %9.3f  p90 %9.3f  p99 %9.3f  max %9.3f ms\n", name, Percentile(0.5), Percentile(0.9),
+            Percentile(0.99), m_values.back());
+    }
+private:
+    // Nearest rank, on sorted values.
+    double Percentile(double p) const
+    {
+        size_t rank = static_cast<size_t>(p * m_values.size() + 0.5);
+        return m_values[std::min(std::max<size_t>(rank, 1), m_values.size()) - 1];
+    }
+
+    std::vector<double> m_values;
+};
+
+struct Microbenchmark {
+    const char *name;
+    const char *unit;
+    unsigned long long operations = 0;
+    double milliseconds = 0;
+
+    void Print(void) const
+    {
+        if (0 == operations)
+            return;
+        printf("  %-14s %12llu %s, %10.3f us per %s, %12.0f %ss/s\n", name, operations, unit,
+            milliseconds * 1000 / operations, unit, operations * 1000 / milliseconds, unit);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark
+
+static const char *Selectors[] = {
+    "a[href]", "div p", "ul > li", "[id]", ".nav a", "h1, h2, h3", "meta[name=\"description\"]", "li:nth-child(2n+1)",
+    "input[type=\"text\"]", "div:not([class])"
+};
+
+static const char *Scripts[] = {
+    "var s = 0; for (var i = 0; i < 1000; ++i) s += i * i; s;",
+    "var a = []; for (var i = 0; i < 100; ++i) a.push('item' + i); a.join(',');",
+    "JSON.stringify({ title: document.title, links: document.getElementsByTagName('a').length });",
+    "document.querySelectorAll('a').length;"
+};
+
+class Benchmark final : public BkCrawlerClientImpl
+{
+public:
+    Benchmark(int iterations) : m_iterations(iterations)
+    {
+        memset(&m_appClient, 0, sizeof(BkAppClient));
+        m_appClient.SizeOfStruct = sizeof(BkAppClient);
+        m_appClient.UserData = this;
+        m_appClient.Exit = Exit;
+    }
+
+    BkAppClient* GetAppClient(void) { return &m_appClient; }
+    void Start(void)
+    {
+        m_crawler = BkCreateCrawler(*this);
+        StartStage(Stage::kWarmUp);
+        Next();
+    }
+private:
+    enum class Stage { kWarmUp, kCrawl, kMicrobenchmarks };
+
+    static void BKAPI Exit(void *pThis)
+    {
+        BkDestroyCrawler(reinterpret_cast<Benchmark *>(pThis)->m_crawler);
+    }
+
+    std::string GetCrawlerConfig(int cfg) override { return std::string(); }
+    void DocumentReady(void) override;
+    void Error(int errorCode, const char *URL) override;
+
+    void StartStage(Stage stage);
+    void EndStage(void);
+    // Starts the next page, or the next stage when a pass is done.
+    void Next(void);
+    void PostNext(void);
+
+    void ProcessCrawledPage(void);
+    void RunMicrobenchmarks(Document &document, const std::string &html);
+
+    BkAppClient m_appClient;
+    BkCrawler m_crawler = nullptr;
+    bool m_crawlerUsed = false;
+    const int m_iterations;
+
+    Stage m_stage = Stage::kWarmUp;
+    int m_pass = 0;
+    size_t m_page = 0;
+    Clock::time_point m_pageStart, m_stageStart;
+    double m_stageCPUStart = 0;
+
+    unsigned m_pages = 0, m_errors = 0;
+    Samples m_load, m_extract, m_total, m_decode, m_parse, m_script, m_gc;
+    unsigned long long m_requests = 0, m_bytes = 0, m_cachedRequests = 0, m_peakDOMNodes = 0;
+
+    Microbenchmark m_treeBuilder = { "tree builder", "KB" };
+    Microbenchmark m_selectorQuery = { "selector query", "query" };
+    Microbenchmark m_eval = { "JS eval", "eval" };
+};
+
+void Benchmark::DocumentReady(void)
+{
+    switch (m_stage)
+    {
+        case Stage::kWarmUp:
+            break;
+        case Stage::kCrawl:
+            ProcessCrawledPage();
+            break;
+        case Stage::kMicrobenchmarks:
+        {
+            const std::string &URL = g_archive.Pages().at(m_page);
+            Document *document = m_crawler->GetDocument();
+            if (nullptr != document)
+                RunMicrobenchmarks(*document, g_archive.Find(URL)->body);
+            break;
+        }
+    }
+
+    ++m_page;
+    PostNext();
+}
+
+void Benchmark::EndStage(void)
+{
+    double elapsed = MillisecondsSince(m_stageStart) / 1000;
+    double CPUTime = CPUSeconds() - m_stageCPUStart;
+
+    switch (m_stage)
+    {
+        case Stage::kWarmUp:
+            printf("Warm-up: %.3f s\n", elapsed);
+            break;
+        case Stage::kCrawl:
+        {
+            printf("Crawl: %u pages, %u errors, %.3f s, %.2f pages/s, %.2f pages/s/core (%.3f s CPU)\n", m_pages,
+                m_errors, elapsed, m_pages / elapsed, m_pages / CPUTime, CPUTime);
+            m_total.Print("total");
+            m_load.Print("load");
+            m_extract.Print("extract");
+            m_decode.Print("decode");
+            m_parse.Print("parse");
+            m_script.Print("script");
+            m_gc.Print("gc");
+
+            if (0 != m_pages)
+            {
+                printf("  per page: %.1f requests, %.1f KB, %.1f from memory cache, %.1f DOM nodes at peak\n",
+                    static_cast<double>(m_requests) / m_pages, static_cast<double>(m_bytes) / 1024 / m_pages,
+                    static_cast<double>(m_cachedRequests) / m_pages, static_cast<double>(m_peakDOMNodes) / m_pages);
+            }
+            break;
+        }
+        case Stage::kMicrobenchmarks:
+            printf("Microbenchmarks: %.3f s\n", elapsed);
+            m_treeBuilder.Print();
+            m_selectorQuery.Print();
+            m_eval.Print();
+            break;
+    }
+    // ru_maxrss never goes down, so this is the peak up to the end of the
+    // stage.
+    printf("  peak RSS %ld KB\n", PeakRSSInKB());
+}
+
+void Benchmark::Error(int errorCode, const char *URL)
+{
+    fprintf(stderr, "Failed to load %s, error = %d.\n", URL, errorCode);
+    ++m_errors;
+    ++m_page;
+    PostNext();
+}
+
+void Benchmark::Next(void)
+{
+    const std::vector<std::string> &pages = g_archive.Pages();
+    if (pages.size() == m_page)
+    {
+        m_page = 0;
+        ++m_pass;
+
+        int passes = Stage::kCrawl == m_stage ? m_iterations : 1;
+        if (passes == m_pass)
+        {
+            EndStage();
+            if (Stage::kMicrobenchmarks == m_stage)
+            {
+                BkExitApp(EXIT_SUCCESS);
+                return;
+            }
+            StartStage(Stage::kWarmUp == m_stage ? Stage::kCrawl : Stage::kMicrobenchmarks);
+        }
+    }
+
+    const char *URL = pages.at(m_page).c_str();
+    m_pageStart = Clock::now();
+
+    // Recycling is how a crawler goes through a list of pages.
+    int r = m_crawlerUsed ? BkRecycleCrawler(m_crawler, URL) : BkRunCrawler(m_crawler, URL);
+    m_crawlerUsed = true;
+    if (BK_ERR_SUCCESS != r)
+        Error(r, URL);
+}
+
+void Benchmark::PostNext(void)
+{
+    // Callbacks come from inside the loader, so the next page has to wait
+    // until they return.
+    std::function<void()> task = std::bind(&Benchmark::Next, this);
+    Platform::Current()->CurrentThread()->GetTaskRunner()->PostTask(FROM_HERE, task);
+}
+
+void Benchmark::ProcessCrawledPage(void)
+{
+    double load = MillisecondsSince(m_pageStart);
+
+    Clock::time_point extractStart = Clock::now();
+    std::string text, links;
+    BkExtractText(m_crawler, nullptr, BK_TEXT_BLOCK_BOUNDARIES, BkMakeBuffer(text));
+    BkHarvestLinks(m_crawler, nullptr, BkMakeBuffer(links));
+    double extract = MillisecondsSince(extractStart);
+
+    BkCrawlerMetrics metrics;
+    metrics.SizeOfStruct = sizeof(BkCrawlerMetrics);
+    BkGetCrawlerMetrics(m_crawler, &metrics);
+
+    ++m_pages;
+    m_load.Add(load);
+    m_extract.Add(extract);
+    m_total.Add(load + extract);
+    m_decode.Add(metrics.DecodeTime);
+    m_parse.Add(metrics.ParseTime);
+    m_script.Add(metrics.ScriptTime);
+    m_gc.Add(metrics.GCTime);
+
+    const BkResourceMetrics *resources[] = {
+        &metrics.Document, &metrics.Scripts, &metrics.StyleSheets, &metrics.Images,
+        &metrics.Fonts, &metrics.Media, &metrics.XHR, &metrics.Others
+    };
+    for (const BkResourceMetrics *r : resources)
+    {
+        m_requests += r->Requests;
+        m_bytes += r->Bytes;
+    }
+    m_cachedRequests += metrics.CachedRequests;
+    m_peakDOMNodes += metrics.PeakDOMNodes;
+}
+
+void Benchmark::RunMicrobenchmarks(Document &document, const std::string &html)
+{
+    Element *body = document.body();
+    if (nullptr == body)
+        return;
+
+    const String source = String::FromUTF8(html.data(), html.length());
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < m_iterations; ++i)
+    {
+        DocumentFragment *fragment = DocumentFragment::Create(document);
+        fragment->ParseHTML(source, body, kDisallowScriptingAndPluginContent);
+    }
+    m_treeBuilder.milliseconds += MillisecondsSince(start);
+    m_treeBuilder.operations += html.length() * m_iterations / 1024;
+
+    size_t matches = 0;
+    start = Clock::now();
+    for (int i = 0; i < m_iterations; ++i)
+    {
+        for (const char *selector : Selectors)
+        {
+            TrackExceptionState exceptionState;
+            if (StaticElementList *list = document.querySelectorAll(AtomicString::FromUTF8(selector), exceptionState))
+                matches += list->length();
+        }
+    }
+    m_selectorQuery.milliseconds += MillisecondsSince(start);
+    m_selectorQuery.operations += std::size(Selectors) * m_iterations;
+
+    BkJSContext context = BkGetScriptContextFromCrawler(m_crawler);
+    start = Clock::now();
+    for (int i = 0; i < m_iterations; ++i)
+    {
+        for (const char *script : Scripts)
+            BkJSEvaluate(context, script, BK_EVAL_IGNORE_RETURN_VALUE);
+    }
+    m_eval.milliseconds += MillisecondsSince(start);
+    m_eval.operations += std::size(Scripts) * m_iterations;
+}
+
+void Benchmark::StartStage(Stage stage)
+{
+    m_stage = stage;
+    m_pass = 0;
+    m_stageStart = Clock::now();
+    m_stageCPUStart = CPUSeconds();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <archive file> [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int iterations = argc > 2 ? atoi(argv[2]) : 10;
+    if (iterations <= 0)
+        iterations = 1;
+
+    if (!g_archive.Load(argv[1]))
+        return EXIT_FAILURE;
+    if (g_archive.Pages().empty())
+    {
+        fprintf(stderr, "No pages recorded in %s.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    printf("%zu pages, %zu resources, %.2f MB, %d iterations\n", g_archive.Pages().size(), g_archive.Size(),
+        static_cast<double>(g_archive.Bytes()) / (1024 * 1024), iterations);
+    printf("Archive loaded, peak RSS %ld KB\n", PeakRSSInKB());
+
+    // Requests missing from the archive fail with BK_ERR_NOT_FOUND.
+    std::shared_ptr<ReplayBackend> backend = ReplayBackend::Create(argv[1], 0, 0);
+    if (!backend)
+        return EXIT_FAILURE;
+    RequestBackend::SetCurrent(backend);
+
+    Benchmark benchmark(iterations);
+    BkInitialize(BK_APP_MAINTHREAD_MODE, benchmark.GetAppClient());
+    benchmark.Start();
+    return BkRunApp();
+}
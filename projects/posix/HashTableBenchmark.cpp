@@ -0,0 +1,203 @@
+// -------------------------------------------------
+// BlinKit - Benchmark Program
+// -------------------------------------------------
+//   File Name: HashTableBenchmark.cpp
+// Description: Hash Table Microbenchmark
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+// Usage: HashTableBenchmark <archive file> [iterations]
+// Tokenizes every page of a request archive (see PageArchive.h), and records
+// the tag names, attribute names and attribute values of each as atomic
+// strings, which is what the parser hashes. The trace is then replayed against HashSet
+// and HashMap with HashTable and with SwissHashTable:
+//   lookup:  every name is looked up in a set of half the distinct names
+//   insert:  every name is inserted into a new set per page
+//   count:   every name is counted in a new map per page
+// and the time per operation of each is reported.
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <bk_app.h>
+#include "PageArchive.h"
+#include "third_party/blink/renderer/core/html/parser/html_parser_idioms.h"
+#include "third_party/blink/renderer/core/html/parser/html_parser_options.h"
+#include "third_party/blink/renderer/core/html/parser/html_token.h"
+#include "third_party/blink/renderer/core/html/parser/html_tokenizer.h"
+#include "third_party/blink/renderer/platform/text/segmented_string.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/hash_set.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+
+using namespace blink;
+
+typedef std::chrono::steady_clock Clock;
+
+typedef HashSet<StringImpl *> DefaultSet;
+typedef HashSet<StringImpl *, DefaultHash<StringImpl *>::Hash, SwissHashTraits<HashTraits<StringImpl *>>> SwissSet;
+typedef HashMap<AtomicString, unsigned> DefaultMap;
+typedef HashMap<AtomicString, unsigned, DefaultHash<AtomicString>::Hash, SwissHashTraits<HashTraits<AtomicString>>>
+    SwissMap;
+
+typedef std::vector<AtomicString> Trace;
+
+static Trace TracePage(const std::string &data)
+{
+    Trace trace;
+
+    HTMLParserOptions options;
+    std::unique_ptr<HTMLTokenizer> tokenizer = HTMLTokenizer::Create(options);
+
+    SegmentedString source(String::FromUTF8(data.data(), data.length()));
+    source.Close();
+
+    HTMLToken token;
+    while (tokenizer->NextToken(source, token))
+    {
+        if (token.GetType() == HTMLToken::kStartTag)
+        {
+            trace.emplace_back(AttemptStaticStringCreation(token.GetName(), kLikely8Bit));
+            tokenizer->UpdateStateFor(trace.back());
+            for (const HTMLToken::Attribute &attribute : token.Attributes())
+            {
+                trace.emplace_back(attribute.NameAsVector());
+                if (!attribute.ValueAsVector().IsEmpty())
+                    trace.emplace_back(attribute.ValueAsVector());
+            }
+        }
+        token.Clear();
+    }
+    return trace;
+}
+
+template <class Set>
+static double MeasureLookup(const std::vector<Trace> &traces, const std::vector<StringImpl *> &names, int iterations,
+    size_t &found)
+{
+    Set set;
+    for (size_t i = 0; i < names.size(); i += 2)
+        set.insert(names[i]);
+
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (const Trace &trace : traces)
+        {
+            for (const AtomicString &name : trace)
+                found += set.find(name.Impl()) != set.end();
+        }
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+template <class Set>
+static double MeasureInsert(const std::vector<Trace> &traces, int iterations, size_t &inserted)
+{
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (const Trace &trace : traces)
+        {
+            Set set;
+            for (const AtomicString &name : trace)
+                set.insert(name.Impl());
+            inserted += set.size();
+        }
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+template <class Map>
+static double MeasureCount(const std::vector<Trace> &traces, int iterations, size_t &counted)
+{
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (const Trace &trace : traces)
+        {
+            Map map;
+            for (const AtomicString &name : trace)
+                ++map.insert(name, 0).stored_value->value;
+            counted += map.size();
+        }
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void Report(const char *workload, double hashTable, double swissTable, double n)
+{
+    printf("%-8s HashTable: %6.1f ns, SwissHashTable: %6.1f ns per operation (%.2fx)\n", workload, hashTable / n,
+        swissTable / n, hashTable / swissTable);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <archive file> [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int iterations = argc > 2 ? atoi(argv[2]) : 20;
+    if (iterations <= 0)
+        iterations = 1;
+
+    BkInitialize(BK_APP_MAINTHREAD_MODE, nullptr);
+
+    PageArchive archive;
+    if (!archive.Load(argv[1]))
+        return EXIT_FAILURE;
+
+    std::vector<Trace> traces;
+    size_t operations = 0;
+    for (const std::string &URL : archive.Pages())
+    {
+        traces.emplace_back(TracePage(archive.Find(URL)->body));
+        operations += traces.back().size();
+    }
+    if (0 == operations)
+    {
+        fprintf(stderr, "No names found in %s.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    DefaultSet distinct;
+    std::vector<StringImpl *> names;
+    for (const Trace &trace : traces)
+    {
+        for (const AtomicString &name : trace)
+        {
+            if (distinct.insert(name.Impl()).is_new_entry)
+                names.push_back(name.Impl());
+        }
+    }
+
+    // The sums must match between the tables, and keep the loops from being
+    // optimized away.
+    size_t sums[2] = { 0 };
+    double lookup[2], insert[2], count[2];
+    lookup[0] = MeasureLookup<DefaultSet>(traces, names, iterations, sums[0]);
+    lookup[1] = MeasureLookup<SwissSet>(traces, names, iterations, sums[1]);
+    insert[0] = MeasureInsert<DefaultSet>(traces, iterations, sums[0]);
+    insert[1] = MeasureInsert<SwissSet>(traces, iterations, sums[1]);
+    count[0] = MeasureCount<DefaultMap>(traces, iterations, sums[0]);
+    count[1] = MeasureCount<SwissMap>(traces, iterations, sums[1]);
+    if (sums[0] != sums[1])
+    {
+        fprintf(stderr, "The tables disagree: %zu, %zu.\n", sums[0], sums[1]);
+        return EXIT_FAILURE;
+    }
+
+    const double n = static_cast<double>(operations) * iterations / 1e9;
+    printf("%zu pages, %zu names (%zu distinct) x %d iterations\n", traces.size(), operations, names.size(),
+        iterations);
+    Report("lookup", lookup[0], lookup[1], n);
+    Report("insert", insert[0], insert[1], n);
+    Report("count", count[0], count[1], n);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+// -------------------------------------------------
+// BlinKit - Benchmark Program
+// -------------------------------------------------
+//   File Name: PageArchive.cpp
+// Description: PageArchive Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "PageArchive.h"
+
+#include <cstdio>
+#include <cstring>
+#include <strings.h>
+#include "blinkit/http/request_archive.h"
+
+using namespace BlinKit;
+
+// The value of the first header of the name, in "Name: value\r\n" lines.
+static std::string HeaderValue(std::string_view headers, const char *name)
+{
+    const size_t l = strlen(name);
+    while (!headers.empty())
+    {
+        size_t eol = headers.find("\r\n");
+        std::string_view line = headers.substr(0, eol);
+        headers.remove_prefix(std::string_view::npos != eol ? eol + 2 : headers.length());
+
+        if (line.length() <= l || ':' != line[l] || 0 != strncasecmp(line.data(), name, l))
+            continue;
+
+        line.remove_prefix(l + 1);
+        while (!line.empty() && ' ' == line.front())
+            line.remove_prefix(1);
+        return std::string(line);
+    }
+    return std::string();
+}
+
+static bool IsHTML(const std::string &contentType)
+{
+    static const char *types[] = { "text/html", "application/xhtml+xml" };
+    for (const char *type : types)
+    {
+        size_t l = strlen(type);
+        if (0 == strncasecmp(contentType.c_str(), type, l) && (contentType.length() == l || ';' == contentType[l]))
+            return true;
+    }
+    return false;
+}
+
+const PageArchive::Entry* PageArchive::Find(const std::string &URL) const
+{
+    auto it = m_entries.find(URL);
+    return std::end(m_entries) != it ? &(it->second) : nullptr;
+}
+
+bool PageArchive::Load(const std::string &path)
+{
+    std::shared_ptr<ArchiveReader> reader = ArchiveReader::Open(path);
+    if (!reader)
+    {
+        fprintf(stderr, "%s is not a request archive.\n", path.c_str());
+        return false;
+    }
+
+    reader->ForEachRecord([this](const ArchiveRecord &record) {
+        if (BK_ERR_SUCCESS != record.errorCode || "GET" != record.method)
+            return;
+
+        std::string URL(record.URL);
+        if (std::end(m_entries) != m_entries.find(URL))
+            return;
+
+        Entry &entry = m_entries[URL];
+        entry.contentType = HeaderValue(record.headers, "Content-Type");
+        entry.body.assign(record.body.data(), record.body.length());
+        m_bytes += entry.body.length();
+        if (200 == record.statusCode && IsHTML(entry.contentType))
+            m_pages.emplace_back(URL);
+    });
+    return true;
+}
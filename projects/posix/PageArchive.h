@@ -0,0 +1,50 @@
+// -------------------------------------------------
+// BlinKit - Benchmark Program
+// -------------------------------------------------
+//   File Name: PageArchive.h
+// Description: PageArchive Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BENCHMARK_PAGE_ARCHIVE_H
+#define BLINKIT_BENCHMARK_PAGE_ARCHIVE_H
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// The pages of a request archive, recorded with BkSetRequestBackend in
+// BK_BACKEND_RECORD mode (see bk_http.h). The archive is read by the library
+// (ArchiveReader), so the benchmarks and the replay backend share one format.
+// Each URL maps to the first successful GET response recorded for it, which
+// is also the first one the replay backend serves. The pages to crawl are the
+// URLs whose response is HTML, in the order of recording.
+class PageArchive
+{
+public:
+    struct Entry {
+        std::string contentType;
+        std::string body;
+    };
+
+    // Returns false if the file is not a request archive.
+    bool Load(const std::string &path);
+
+    // Null if the URL was not recorded.
+    const Entry* Find(const std::string &URL) const;
+
+    const std::vector<std::string>& Pages(void) const { return m_pages; }
+    size_t Size(void) const { return m_entries.size(); }
+    size_t Bytes(void) const { return m_bytes; }
+private:
+    std::unordered_map<std::string, Entry> m_entries;
+    std::vector<std::string> m_pages;
+    size_t m_bytes = 0;
+};
+
+#endif // BLINKIT_BENCHMARK_PAGE_ARCHIVE_H
@@ -0,0 +1,154 @@
+// -------------------------------------------------
+// BlinKit - Benchmark Program
+// -------------------------------------------------
+//   File Name: TokenizerBenchmark.cpp
+// Description: HTML Tokenizer Microbenchmark
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+// Usage: TokenizerBenchmark <corpus directory | archive file> [iterations]
+// Tokenizes every saved page (*.htm, *.html) in the corpus directory, or
+// every page of a request archive (see PageArchive.h), as
+// HTMLPreloadScanner does, and reports the throughput.
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <bk_app.h>
+#include "PageArchive.h"
+#include "third_party/blink/renderer/core/html/parser/html_parser_idioms.h"
+#include "third_party/blink/renderer/core/html/parser/html_parser_options.h"
+#include "third_party/blink/renderer/core/html/parser/html_token.h"
+#include "third_party/blink/renderer/core/html/parser/html_tokenizer.h"
+#include "third_party/blink/renderer/platform/text/segmented_string.h"
+
+using namespace blink;
+
+static bool IsPage(const std::string &name)
+{
+    static const char *extensions[] = { ".htm", ".html" };
+    for (const char *ext : extensions)
+    {
+        size_t l = strlen(ext);
+        if (name.length() > l && 0 == name.compare(name.length() - l, l, ext))
+            return true;
+    }
+    return false;
+}
+
+static std::vector<String> LoadArchive(const char *path, size_t &bytes)
+{
+    std::vector<String> pages;
+
+    PageArchive archive;
+    if (!archive.Load(path))
+        return pages;
+
+    for (const std::string &URL : archive.Pages())
+    {
+        const std::string &data = archive.Find(URL)->body;
+        bytes += data.length();
+        pages.emplace_back(String::FromUTF8(data.data(), data.length()));
+    }
+    return pages;
+}
+
+static std::vector<String> LoadCorpus(const char *path, size_t &bytes)
+{
+    struct stat st;
+    if (0 == stat(path, &st) && S_ISREG(st.st_mode))
+        return LoadArchive(path, bytes);
+
+    std::vector<String> pages;
+
+    DIR *dir = opendir(path);
+    if (nullptr == dir)
+        return pages;
+
+    while (dirent *entry = readdir(dir))
+    {
+        std::string name(entry->d_name);
+        if (!IsPage(name))
+            continue;
+
+        std::ifstream file(std::string(path) + '/' + name, std::ios::binary);
+        std::stringstream ss;
+        ss << file.rdbuf();
+
+        std::string data = ss.str();
+        bytes += data.length();
+        pages.emplace_back(String::FromUTF8(data.data(), data.length()));
+    }
+    closedir(dir);
+    return pages;
+}
+
+static size_t Tokenize(const String &page)
+{
+    HTMLParserOptions options;
+    std::unique_ptr<HTMLTokenizer> tokenizer = HTMLTokenizer::Create(options);
+
+    SegmentedString source(page);
+    source.Close();
+
+    size_t tokens = 0;
+    HTMLToken token;
+    while (tokenizer->NextToken(source, token))
+    {
+        if (token.GetType() == HTMLToken::kStartTag)
+            tokenizer->UpdateStateFor(AttemptStaticStringCreation(token.GetName(), kLikely8Bit));
+        ++tokens;
+        token.Clear();
+    }
+    return tokens;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <corpus directory | archive file> [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int iterations = argc > 2 ? atoi(argv[2]) : 20;
+    if (iterations <= 0)
+        iterations = 1;
+
+    BkInitialize(BK_APP_MAINTHREAD_MODE, nullptr);
+
+    size_t bytes = 0;
+    std::vector<String> pages = LoadCorpus(argv[1], bytes);
+    if (pages.empty())
+    {
+        fprintf(stderr, "No pages found in %s.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    size_t tokens = 0;
+    // Warm up caches and the atomic string table first.
+    for (const String &page : pages)
+        tokens += Tokenize(page);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (const String &page : pages)
+            tokens += Tokenize(page);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    double mb = static_cast<double>(bytes) * iterations / (1024 * 1024);
+    printf("%zu pages, %.2f MB x %d iterations\n", pages.size(), static_cast<double>(bytes) / (1024 * 1024), iterations);
+    printf("%.3f s, %.2f MB/s, %.2f ms per pass (%zu tokens)\n", elapsed.count(), mb / elapsed.count(),
+        elapsed.count() * 1000 / iterations, tokens);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,237 @@
+// -------------------------------------------------
+// BlinKit - Benchmark Program
+// -------------------------------------------------
+//   File Name: URLBenchmark.cpp
+// Description: URL Resolution Microbenchmark
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+// Usage: URLBenchmark <archive file> [iterations]
+// Collects the href, src and action attributes of every page of a request
+// archive (see PageArchive.h), then resolves them against their page URLs with
+// BkURL::Resolve and with BkURLResolver, and reports the time per URL of each.
+// The results of the two are compared first, and any difference is an error.
+// <base> elements are not taken into account.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "PageArchive.h"
+#include "blinkit/common/bk_url.h"
+
+using namespace BlinKit;
+
+typedef std::chrono::steady_clock Clock;
+
+struct Page {
+    std::string URL;
+    std::vector<std::string> hrefs;
+};
+
+static bool IsSpace(char c)
+{
+    return ' ' == c || '\t' == c || '\n' == c || '\r' == c || '\f' == c;
+}
+
+static bool IsAttributeAt(const std::string &html, size_t pos, const char *name)
+{
+    size_t l = strlen(name);
+    if (pos == 0 || !IsSpace(html[pos - 1]) || pos + l >= html.length())
+        return false;
+    for (size_t i = 0; i < l; ++i)
+    {
+        if (tolower(static_cast<unsigned char>(html[pos + i])) != name[i])
+            return false;
+    }
+    return '=' == html[pos + l];
+}
+
+static std::string DecodeValue(const char *p, size_t length)
+{
+    std::string ret;
+    const char *end = p + length;
+    while (p < end && IsSpace(*p))
+        ++p;
+    while (end > p && IsSpace(end[-1]))
+        --end;
+    for (; p < end; ++p)
+    {
+        // The only character reference common in URLs.
+        if ('&' == *p && end - p >= 5 && 0 == strncmp(p, "&amp;", 5))
+            p += 4;
+        ret.push_back(*p);
+    }
+    return ret;
+}
+
+// Not an HTML parser, but finds the attributes of the usual markup.
+static void CollectHrefs(const std::string &html, std::vector<std::string> &dst)
+{
+    static const char *names[] = { "href", "src", "action" };
+
+    for (size_t pos = 0; pos < html.length(); ++pos)
+    {
+        size_t valueStart = std::string::npos;
+        for (const char *name : names)
+        {
+            if (IsAttributeAt(html, pos, name))
+            {
+                valueStart = pos + strlen(name) + 1;
+                break;
+            }
+        }
+        if (std::string::npos == valueStart)
+            continue;
+
+        size_t valueEnd;
+        char quote = html[valueStart];
+        if ('"' == quote || '\'' == quote)
+        {
+            ++valueStart;
+            valueEnd = html.find(quote, valueStart);
+            if (std::string::npos == valueEnd)
+                return;
+        }
+        else
+        {
+            valueEnd = valueStart;
+            while (valueEnd < html.length() && !IsSpace(html[valueEnd]) && '>' != html[valueEnd])
+                ++valueEnd;
+        }
+
+        dst.emplace_back(DecodeValue(html.data() + valueStart, valueEnd - valueStart));
+        pos = valueEnd;
+    }
+}
+
+static size_t Verify(const std::vector<Page> &pages)
+{
+    size_t differences = 0;
+    for (const Page &page : pages)
+    {
+        const BkURL base(page.URL);
+        const BkURLResolver resolver(base);
+        for (const std::string &href : page.hrefs)
+        {
+            BkURL expected = base.Resolve(href);
+            BkURL actual = resolver.Resolve(href);
+            if (expected.IsValid() == actual.IsValid() && expected == actual && expected.HostPiece() == actual.HostPiece()
+                && expected.PathPiece() == actual.PathPiece() && expected.QueryPiece() == actual.QueryPiece()
+                && expected.RefPiece() == actual.RefPiece())
+            {
+                continue;
+            }
+
+            if (differences++ < 10)
+            {
+                fprintf(stderr, "Different results for \"%s\" on %s: %s, %s\n", href.c_str(), page.URL.c_str(),
+                    expected.AsString().c_str(), actual.AsString().c_str());
+            }
+        }
+    }
+    return differences;
+}
+
+template <class Resolve>
+static double Measure(const std::vector<Page> &pages, int iterations, size_t &bytes, Resolve resolve)
+{
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (const Page &page : pages)
+            bytes += resolve(page);
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <archive file> [iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int iterations = argc > 2 ? atoi(argv[2]) : 20;
+    if (iterations <= 0)
+        iterations = 1;
+
+    PageArchive archive;
+    if (!archive.Load(argv[1]))
+        return EXIT_FAILURE;
+
+    std::vector<Page> pages;
+    size_t hrefs = 0;
+    for (const std::string &URL : archive.Pages())
+    {
+        Page page;
+        page.URL = URL;
+        CollectHrefs(archive.Find(URL)->body, page.hrefs);
+        hrefs += page.hrefs.size();
+        pages.emplace_back(std::move(page));
+    }
+    if (0 == hrefs)
+    {
+        fprintf(stderr, "No URLs found in %s.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    size_t differences = Verify(pages);
+    if (0 != differences)
+    {
+        fprintf(stderr, "%zu of %zu URLs resolved differently.\n", differences, hrefs);
+        return EXIT_FAILURE;
+    }
+
+    // Both include the parsing of the base, once per page as Document does.
+    size_t bytes = 0;
+    double canonicalizer = Measure(pages, iterations, bytes, [](const Page &page) {
+        size_t bytes = 0;
+        const BkURL base(page.URL);
+        for (const std::string &href : page.hrefs)
+            bytes += base.Resolve(href).AsString().length();
+        return bytes;
+    });
+    double resolver = Measure(pages, iterations, bytes, [](const Page &page) {
+        size_t bytes = 0;
+        const BkURLResolver resolver(BkURL(page.URL));
+        for (const std::string &href : page.hrefs)
+            bytes += resolver.Resolve(href).AsString().length();
+        return bytes;
+    });
+
+    // Component accessors, as used to filter the resolved URLs.
+    std::vector<BkURL> URLs;
+    for (const Page &page : pages)
+    {
+        const BkURLResolver resolver(BkURL(page.URL));
+        for (const std::string &href : page.hrefs)
+            URLs.emplace_back(resolver.Resolve(href));
+    }
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (const BkURL &URL : URLs)
+            bytes += URL.Host().length() + URL.Path().length();
+    }
+    double strings = std::chrono::duration<double>(Clock::now() - start).count();
+    start = Clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        for (const BkURL &URL : URLs)
+            bytes += URL.HostPiece().length() + URL.PathPiece().length();
+    }
+    double pieces = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const double n = static_cast<double>(hrefs) * iterations / 1e9;
+    printf("%zu pages, %zu URLs x %d iterations (%zu bytes)\n", pages.size(), hrefs, iterations, bytes);
+    printf("BkURL::Resolve:            %.1f ns per URL\n", canonicalizer / n);
+    printf("BkURLResolver:             %.1f ns per URL (%.2fx)\n", resolver / n, canonicalizer / resolver);
+    printf("Host() + Path():           %.1f ns per URL\n", strings / n);
+    printf("HostPiece() + PathPiece(): %.1f ns per URL (%.2fx)\n", pieces / n, strings / pieces);
+    return EXIT_SUCCESS;
+}
@@ -3,7 +3,8 @@ BaseFlags = -I$(BkRoot)src/base -I$(BaseSrc) $(CrFlags) -include _pc.h
 BaseObjects = base_location.o logging_posix.o task_runner.o \
 	string_number_conversions.o stringprintf.o string_split.o string_util.o string_util_constants.o utf_string_conversion_utils.o \
 	thread_local_storage_posix.o thread_local_storage.o \
-	time_posix.o base_time.o
+	time_posix.o base_time.o \
+	trace_log.o
 
 base_location.o: $(BaseSrc)/location.cc
 	$(CXX) -c $(CXXFLAGS) $(BaseFlags) $< -o $@
@@ -31,3 +32,5 @@ time_posix.o: $(BaseSrc)/time/time_posix.cpp
 	$(CXX) -c $(CXXFLAGS) $(BaseFlags) $< -o $@
 base_time.o: $(BaseSrc)/time/time.cpp
 	$(CXX) -c $(CXXFLAGS) $(BaseFlags) $< -o $@
+trace_log.o: $(BaseSrc)/trace_event/trace_log.cpp
+	$(CXX) -c $(CXXFLAGS) $(BaseFlags) $< -o $@
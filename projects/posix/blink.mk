@@ -1,6 +1,6 @@
 BlinkSrc = $(BkRoot)src/chromium/third_party/blink/renderer
 BlinkFlags = -I$(BkRoot)src/blink -I$(BkRoot)src/stub/icu -DBLINKIT_CRAWLER_ONLY $(CrFlags) -include _pc.h
-BlinkObjects = duk.o duk_attr.o duk_console.o duk_container_node.o duk_document.o duk_element.o duk_event.o duk_event_listener.o duk_event_target.o duk_exception_state.o duk_html_collection.o duk_location.o duk_named_node_map.o duk_navigator.o duk_node.o duk_node_list.o duk_script_element.o duk_script_object.o duk_window.o prototype_helper.o script_controller.o script_source_code.o script_streamer.o blink_initializer.o css_primitive_value_unit_trie.o css_selector.o css_selector_list.o css_parser.o css_parser_context.o css_parser_selector.o css_parser_token.o css_parser_token_range.o css_parser_token_stream.o css_selector_parser.o css_tokenizer.o css_tokenizer_input_stream.o selector_checker.o selector_query.o attr.o cdata_section.o character_data.o child_list_mutation_scope.o child_node_list.o class_collection.o comment.o container_node.o context_lifecycle_notifier.o context_lifecycle_observer.o decoded_data_document_parser.o document.o document_encoding_data.o document_fragment.o document_init.o document_lifecycle.o document_parser.o document_shutdown_notifier.o document_shutdown_observer.o document_type.o element.o element_data.o element_data_cache.o element_rare_data.o empty_node_list.o add_event_listener_options_resolved.o event.o event_dispatcher.o event_dispatch_forbidden_scope.o event_listener_map.o event_path.o event_target.o node_event_context.o registered_event_listener.o tree_scope_event_context.o window_event_context.o id_target_observer_registry.o live_node_list_base.o live_node_list_registry.o mutation_observer_interest_group.o mutation_record.o named_node_map.o node.o node_child_removal_tracker.o node_lists_node_data.o node_rare_data.o node_traversal.o nth_index_cache.o qualified_name.o range.o scriptable_document_parser.o space_split_string.o synchronous_mutation_notifier.o synchronous_mutation_observer.o tag_collection.o text.o tree_ordered_map.o tree_scope.o tree_scope_adopter.o editing_utilities.o markup_accumulator.o markup_formatter.o serialization.o event_type_names.o execution_context.o web_document_loader_impl.o dom_window.o frame.o frame_lifecycle.o local_dom_window.o local_frame.o location.o navigator.o navigator_id.o navigator_language.o html_collection.o html_document.o html_tag_collection.o atomic_html_token.o compact_html_token.o html_construction_site.o html_document_parser.o html_element_stack.o html_entity_parser.o html_entity_search.o html_formatting_element_list.o html_meta_charset_parser.o html_parser_idioms.o html_parser_options.o html_parser_reentry_permit.o html_preload_scanner.o html_resource_preloader.o html_source_tracker.o html_tokenizer.o html_tree_builder.o html_tree_builder_simulator.o preload_request.o resource_preloader.o text_resource_decoder.o html_element_lookup_trie.o html_entity_table.o html_names.o html_tokenizer_names.o base_fetch_context.o document_loader.o frame_fetch_context.o frame_loader.o frame_loader_state_machine.o frame_load_request.o navigation_scheduler.o script_resource.o text_resource.o scheduled_navigation.o text_resource_decoder_builder.o classic_pending_script.o classic_script.o fetch_client_settings_object_impl.o html_parser_script_runner.o pending_script.o script_element_base.o script_loader.o script_runner.o xlink_names.o xmlns_names.o xml_names.o exception_state.o gc_pool.o script_forbidden_scope.o script_wrappers.o platform.o language.o fetch_context.o fetch_parameters.o raw_resource.o resource.o resource_client.o resource_error.o resource_fetcher.o resource_loader.o resource_request.o resource_response.o source_keyed_cached_metadata_handler.o text_resource_decoder_options.o unique_identifier.o header_field_tokenizer.o http_names.o http_parsers.o content_type.o mime_type_registry.o parsed_content_header_field_parameters.o parsed_content_type.o server_timing_header.o frame_scheduler_impl.o shared_buffer.o segmented_string.o timer.o security_policy.o web_task_runner.o ascii_ctype.o decimal.o dtoa.o bignum-dtoa.o bignum.o cached-powers.o diy-fp.o double-conversion.o fast-dtoa.o fixed-dtoa.o strtod.o dynamic_annotations.o hash_table.o atomic_string.o atomic_string_table.o cstring.o string_builder.o string_concatenate.o string_impl.o string_statics.o string_to_number.o string_view.o text_codec.o text_codec_latin1.o text_codec_replacement.o text_codec_user_defined.o text_codec_user_defined_posix.o text_codec_utf16.o text_codec_utf8.o text_encoding.o text_encoding_registry.o text_position.o unicode_posix.o utf8.o wtf_string.o threading.o time.o wtf.o wtf_thread_data.o
+BlinkObjects = duk.o duk_attr.o duk_console.o duk_container_node.o duk_document.o duk_element.o duk_event.o duk_event_listener.o duk_event_target.o duk_exception_state.o duk_html_collection.o duk_location.o duk_named_node_map.o duk_navigator.o duk_node.o duk_node_list.o duk_script_element.o duk_script_object.o duk_window.o duk_xml_http_request.o prototype_helper.o script_controller.o script_source_code.o script_streamer.o script_streamer_thread.o blink_initializer.o css_primitive_value_unit_trie.o css_selector.o css_selector_list.o css_parser.o css_parser_context.o css_parser_selector.o css_parser_token.o css_parser_token_range.o css_parser_token_stream.o css_selector_parser.o css_tokenizer.o css_tokenizer_input_stream.o selector_checker.o selector_query.o attr.o cdata_section.o character_data.o child_list_mutation_scope.o child_node_list.o class_collection.o comment.o container_node.o context_lifecycle_notifier.o context_lifecycle_observer.o decoded_data_document_parser.o document.o document_encoding_data.o document_fragment.o document_init.o document_lifecycle.o document_parser.o document_shutdown_notifier.o document_shutdown_observer.o document_type.o element.o element_data.o element_data_cache.o element_rare_data.o empty_node_list.o add_event_listener_options_resolved.o event.o event_dispatcher.o event_dispatch_forbidden_scope.o event_listener_map.o event_path.o event_target.o node_event_context.o registered_event_listener.o tree_scope_event_context.o window_event_context.o id_target_observer_registry.o live_node_list_base.o live_node_list_registry.o mutation_observer_interest_group.o mutation_record.o named_node_map.o node.o node_child_removal_tracker.o node_lists_node_data.o node_rare_data.o node_traversal.o nth_index_cache.o qualified_name.o range.o scriptable_document_parser.o space_split_string.o synchronous_mutation_notifier.o synchronous_mutation_observer.o tag_collection.o text.o tree_ordered_map.o tree_scope.o tree_scope_adopter.o editing_utilities.o text_extractor.o markup_accumulator.o markup_formatter.o serialization.o streaming_markup_serializer.o event_type_names.o execution_context.o web_document_loader_impl.o dom_timer_coordinator.o dom_window.o frame.o frame_lifecycle.o local_dom_window.o local_frame.o location.o navigator.o navigator_id.o navigator_language.o html_collection.o html_document.o html_tag_collection.o atomic_html_token.o compact_html_token.o html_construction_site.o html_document_parser.o html_element_stack.o html_entity_parser.o html_entity_search.o html_formatting_element_list.o html_meta_charset_parser.o html_parser_idioms.o html_parser_options.o html_parser_reentry_permit.o html_preload_scanner.o html_resource_preloader.o html_source_tracker.o html_tokenizer.o html_tree_builder.o html_tree_builder_simulator.o preload_request.o resource_preloader.o text_resource_decoder.o html_element_lookup_trie.o html_entity_table.o html_entity_trie.o html_names.o html_tokenizer_names.o base_fetch_context.o document_loader.o frame_fetch_context.o frame_loader.o frame_loader_state_machine.o frame_load_request.o navigation_scheduler.o script_resource.o text_resource.o scheduled_navigation.o text_resource_decoder_builder.o classic_pending_script.o classic_script.o fetch_client_settings_object_impl.o html_parser_script_runner.o pending_script.o script_element_base.o script_loader.o script_runner.o xlink_names.o xml_http_request.o xmlns_names.o xml_names.o exception_state.o gc_pool.o script_forbidden_scope.o script_wrappers.o platform.o language.o fetch_context.o fetch_parameters.o memory_cache.o raw_resource.o resource.o resource_client.o resource_error.o resource_fetcher.o resource_loader.o resource_request.o resource_response.o source_keyed_cached_metadata_handler.o text_resource_decoder_options.o unique_identifier.o header_field_tokenizer.o http_names.o http_parsers.o content_type.o mime_type_registry.o parsed_content_header_field_parameters.o parsed_content_type.o server_timing_header.o frame_scheduler_impl.o shared_buffer.o segmented_string.o timer.o security_policy.o web_task_runner.o ascii_ctype.o decimal.o dtoa.o bignum-dtoa.o bignum.o cached-powers.o diy-fp.o double-conversion.o fast-dtoa.o fixed-dtoa.o strtod.o dynamic_annotations.o hash_table.o atomic_string.o atomic_string_table.o cstring.o string_builder.o string_concatenate.o string_impl.o string_statics.o string_to_number.o string_view.o text_codec.o text_codec_latin1.o text_codec_replacement.o text_codec_user_defined.o text_codec_user_defined_posix.o text_codec_utf16.o text_codec_utf8.o text_encoding.o text_encoding_registry.o text_position.o unicode_posix.o utf8.o wtf_string.o threading.o time.o wtf.o wtf_thread_data.o
 
 duk.o: $(BlinkSrc)/bindings/core/duk/duk.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
@@ -40,6 +40,8 @@ duk_script_object.o: $(BlinkSrc)/bindings/core/duk/duk_script_object.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 duk_window.o: $(BlinkSrc)/bindings/core/duk/duk_window.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+duk_xml_http_request.o: $(BlinkSrc)/bindings/core/duk/duk_xml_http_request.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 prototype_helper.o: $(BlinkSrc)/bindings/core/duk/prototype_helper.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 script_controller.o: $(BlinkSrc)/bindings/core/duk/script_controller.cpp
@@ -48,6 +50,8 @@ script_source_code.o: $(BlinkSrc)/bindings/core/duk/script_source_code.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 script_streamer.o: $(BlinkSrc)/bindings/core/duk/script_streamer.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+script_streamer_thread.o: $(BlinkSrc)/bindings/core/duk/script_streamer_thread.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 blink_initializer.o: $(BlinkSrc)/controller/blink_initializer.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 css_primitive_value_unit_trie.o: $(BlinkSrc)/core/css/css_primitive_value_unit_trie.cc
@@ -198,18 +202,24 @@ tree_scope_adopter.o: $(BlinkSrc)/core/dom/tree_scope_adopter.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 editing_utilities.o: $(BlinkSrc)/core/editing/editing_utilities.cc
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+text_extractor.o: $(BlinkSrc)/core/editing/text_extractor.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 markup_accumulator.o: $(BlinkSrc)/core/editing/serializers/markup_accumulator.cc
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 markup_formatter.o: $(BlinkSrc)/core/editing/serializers/markup_formatter.cc
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 serialization.o: $(BlinkSrc)/core/editing/serializers/serialization.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+streaming_markup_serializer.o: $(BlinkSrc)/core/editing/serializers/streaming_markup_serializer.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 event_type_names.o: $(BlinkSrc)/core/event_type_names.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 execution_context.o: $(BlinkSrc)/core/execution_context/execution_context.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 web_document_loader_impl.o: $(BlinkSrc)/core/exported/web_document_loader_impl.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+dom_timer_coordinator.o: $(BlinkSrc)/core/frame/dom_timer_coordinator.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 dom_window.o: $(BlinkSrc)/core/frame/dom_window.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 frame.o: $(BlinkSrc)/core/frame/frame.cpp
@@ -280,6 +290,8 @@ html_element_lookup_trie.o: $(BlinkSrc)/core/html_element_lookup_trie.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 html_entity_table.o: $(BlinkSrc)/core/html_entity_table.cc
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+html_entity_trie.o: $(BlinkSrc)/core/html_entity_trie.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 html_names.o: $(BlinkSrc)/core/html_names.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 html_tokenizer_names.o: $(BlinkSrc)/core/html_tokenizer_names.cpp
@@ -324,6 +336,8 @@ script_runner.o: $(BlinkSrc)/core/script/script_runner.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 xlink_names.o: $(BlinkSrc)/core/xlink_names.cc
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+xml_http_request.o: $(BlinkSrc)/core/xmlhttprequest/xml_http_request.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 xmlns_names.o: $(BlinkSrc)/core/xmlns_names.cc
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 xml_names.o: $(BlinkSrc)/core/xml_names.cc
@@ -344,6 +358,8 @@ fetch_context.o: $(BlinkSrc)/platform/loader/fetch/fetch_context.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 fetch_parameters.o: $(BlinkSrc)/platform/loader/fetch/fetch_parameters.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
+memory_cache.o: $(BlinkSrc)/platform/loader/fetch/memory_cache.cpp
+	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 raw_resource.o: $(BlinkSrc)/platform/loader/fetch/raw_resource.cpp
 	$(CXX) -c $(CXXFLAGS) $(BlinkFlags) $< -o $@
 resource.o: $(BlinkSrc)/platform/loader/fetch/resource.cpp
@@ -0,0 +1,138 @@
+<?php
+// The trie is built from the names in the generated entity table, so that
+// node entries always match the indices of staticEntityTable.
+$table = file_get_contents(dirname(__FILE__) . '/../src/chromium/third_party/blink/renderer/core/html_entity_table.cc');
+preg_match_all('/\}, \/\/ &(\S+)/', $table, $matches);
+$names = $matches[1];
+
+$nodes = array(array('character' => 0, 'entry' => -1, 'children' => array()));
+foreach ($names as $index => $name) {
+    $n = 0;
+    for ($i = 0; $i < strlen($name); ++$i) {
+        $c = ord($name[$i]);
+        if (!isset($nodes[$n]['children'][$c])) {
+            $nodes[] = array('character' => $c, 'entry' => -1, 'children' => array());
+            $nodes[$n]['children'][$c] = count($nodes) - 1;
+        }
+        $n = $nodes[$n]['children'][$c];
+    }
+    $nodes[$n]['entry'] = $index;
+}
+
+// Breadth-first order keeps the children of each node contiguous.
+$order = array(0);
+$ids = array(0 => 0);
+for ($i = 0; $i < count($order); ++$i) {
+    ksort($nodes[$order[$i]]['children']);
+    foreach ($nodes[$order[$i]]['children'] as $child) {
+        $ids[$child] = count($order);
+        $order[] = $child;
+    }
+}
+
+$common = array(
+    'amp;', 'lt;', 'gt;', 'quot;', 'apos;', 'nbsp;', 'copy;', 'reg;', 'trade;', 'times;',
+    'hellip;', 'mdash;', 'ndash;', 'lsquo;', 'rsquo;', 'ldquo;', 'rdquo;', 'laquo;', 'raquo;', 'middot;'
+);
+$hash_size = 32;
+
+function common_hash($name, $a, $b, $hash_size) {
+    $l = strlen($name);
+    return (ord($name[0]) * $a + ord($name[1]) * $b + ord($name[$l - 2]) + $l) & ($hash_size - 1);
+}
+
+$slots = null;
+for ($a = 1; null === $slots && $a < 256; ++$a) {
+    for ($b = 1; $b < 256; ++$b) {
+        $slots = array_fill(0, $hash_size, -1);
+        foreach ($common as $name) {
+            $h = common_hash($name, $a, $b, $hash_size);
+            if ($slots[$h] >= 0) {
+                $slots = null;
+                break;
+            }
+            $slots[$h] = array_search($name, $names);
+        }
+        if (null !== $slots) {
+            $hash_a = $a;
+            $hash_b = $b;
+            break;
+        }
+    }
+}
+?>// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: html_entity_trie.cpp
+// Description: HTMLEntityTrie Class
+//      Author: Ziming Li
+//     Created: <?php echo date('Y-m-d') . "\n"; ?>
+// -------------------------------------------------
+// Copyright (C) <?php echo date('Y'); ?> MingYang Software Technology.
+// -------------------------------------------------
+
+// THIS FILE IS GENERATED BY scripts/html_entity_trie.cpp.php.
+// DO NOT EDIT!
+
+#include "html_entity_trie.h"
+
+#include <cstring>
+
+namespace blink {
+
+static const HTMLEntityTrie::Node kNodes[<?php echo count($order); ?>] = {
+<?php
+foreach ($order as $n) {
+    $node = $nodes[$n];
+    $first_child = empty($node['children']) ? 0 : $ids[reset($node['children'])];
+    $character = 0 == $node['character'] ? '0' : "'" . chr($node['character']) . "'";
+    echo "    { $first_child, " . count($node['children']) . ", $character, " . $node['entry'] . " },\n";
+}
+?>};
+
+static const int16_t kCommonEntities[<?php echo $hash_size; ?>] = {
+<?php
+foreach ($slots as $slot) {
+    echo "    $slot,";
+    echo $slot >= 0 ? " // &" . $names[$slot] . "\n" : "\n";
+}
+?>};
+
+const HTMLEntityTrie::Node* HTMLEntityTrie::Child(const Node *node, UChar c)
+{
+    const Node *left = kNodes + node->firstChild;
+    const Node *right = left + node->childCount;
+    while (left < right)
+    {
+        const Node *probe = left + (right - left) / 2;
+        if (probe->character == c)
+            return probe;
+        if (probe->character < c)
+            left = probe + 1;
+        else
+            right = probe;
+    }
+    return nullptr;
+}
+
+const HTMLEntityTableEntry* HTMLEntityTrie::FindCommonEntity(const LChar *name, unsigned length)
+{
+    if (length < 3 || length > kMaxCommonEntityLength)
+        return nullptr;
+
+    unsigned h = (name[0] * <?php echo $hash_a; ?> + name[1] * <?php echo $hash_b; ?> + name[length - 2] + length) & <?php echo $hash_size - 1; ?>;
+    if (kCommonEntities[h] < 0)
+        return nullptr;
+
+    const HTMLEntityTableEntry *entry = HTMLEntityTable::FirstEntry() + kCommonEntities[h];
+    if (entry->length != static_cast<short>(length) || 0 != memcmp(HTMLEntityTable::EntityString(*entry), name, length))
+        return nullptr;
+    return entry;
+}
+
+const HTMLEntityTrie::Node* HTMLEntityTrie::Root(void)
+{
+    return kNodes;
+}
+
+} // namespace blink
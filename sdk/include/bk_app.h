@@ -57,6 +57,18 @@ BKEXPORT void BKAPI BkExitApp(int code);
 typedef void (BKAPI * BkBackgroundWorker)(void *);
 BKEXPORT bool_t BKAPI BkAppExecute(BkBackgroundWorker worker, void *userData);
 
+/**
+ * Tracing
+ *   Records spans of the hot paths (net, loader, parser, script, gc, dom) of all threads into per thread ring
+ *   buffers, the latest events are kept when a buffer is full.
+ *   categories: a comma separated list of the categories above, NULL for all.
+ *   eventsPerThread: capacity of each ring buffer, 0 for the default (65536).
+ *   BkStopTracing writes the events in the Chrome trace event JSON format, which may be opened by
+ *   chrome://tracing and the Perfetto UI. dst may be NULL to drop them.
+ */
+BKEXPORT void BKAPI BkStartTracing(const char *categories, size_t eventsPerThread);
+BKEXPORT void BKAPI BkStopTracing(struct BkBuffer *dst);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
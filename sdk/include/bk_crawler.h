@@ -20,11 +20,16 @@ extern "C" {
 #endif
 
 BK_DECLARE_HANDLE(BkCrawler, CrawlerImpl);
+BK_DECLARE_HANDLE(BkCrawlQueue, CrawlQueueImpl);
 
 enum BkCrawlerConfig {
     BK_CFG_OBJECT_SCRIPT = 0,
     BK_CFG_USER_AGENT,
-    BK_CFG_SCRIPT_DISABLED
+    BK_CFG_SCRIPT_DISABLED,
+    // Milliseconds of virtual time a page may consume. When set, timers fire
+    // as soon as the page is idle instead of waiting, and the ones beyond the
+    // budget are dropped. Empty for real time.
+    BK_CFG_VIRTUAL_TIME_BUDGET
 };
 
 struct BkCrawlerClient {
@@ -38,6 +43,112 @@ struct BkCrawlerClient {
     void (BKAPI * DocumentReady)(void *);
     void (BKAPI * Error)(int, const char *, void *);
     void (BKAPI * ConsoleMessage)(int type, const char *, void *);
+    // Called once after DocumentReady, when the page has settled, or when the
+    // readiness timeout expires, in which case the flag is true.
+    void (BKAPI * DocumentQuiescent)(bool_t, void *);
+};
+
+struct BkMemoryCacheStatistics {
+    size_t SizeOfStruct; // sizeof(BkMemoryCacheStatistics)
+    size_t Capacity, Size, Count;
+    unsigned long long Hits, Misses, Evictions;
+    unsigned long long Insertions;
+};
+
+enum BkSerializationFlags {
+    BK_SERIALIZE_STRIP_SCRIPTS  = 0x1,
+    BK_SERIALIZE_STRIP_STYLES   = 0x2,
+    BK_SERIALIZE_STRIP_COMMENTS = 0x4
+};
+
+enum BkTextExtractionFlags {
+    BK_TEXT_BLOCK_BOUNDARIES = 0x1, // Separates blocks with line breaks instead of spaces.
+    BK_TEXT_LINK_ANNOTATIONS = 0x2  // Appends " [URL]" to the text of each link.
+};
+
+enum BkLinkKinds {
+    BK_LINK_ANCHORS   = 0x1, // <a>, <area> and navigational <link>s.
+    BK_LINK_RESOURCES = 0x2, // src, srcset, poster and stylesheet/icon/preload <link>s.
+    BK_LINK_FORMS     = 0x4, // <form action>.
+    BK_LINK_REFRESHES = 0x8, // <meta http-equiv="refresh">.
+    BK_LINK_ALL       = 0xf
+};
+
+struct BkLinkHarvestOptions {
+    size_t SizeOfStruct; // sizeof(BkLinkHarvestOptions)
+    unsigned Kinds; // BK_LINK_* flags, 0 for BK_LINK_ALL.
+    bool_t SameHostOnly;
+    const char *Pattern; // ECMAScript regular expression which URLs must match, if not null.
+};
+
+enum BkResourceTypes {
+    BK_RESOURCE_SCRIPT     = 0x1,
+    BK_RESOURCE_STYLESHEET = 0x2,
+    BK_RESOURCE_IMAGE      = 0x4,
+    BK_RESOURCE_FONT       = 0x8,
+    BK_RESOURCE_MEDIA      = 0x10,
+    BK_RESOURCE_XHR        = 0x20,
+    BK_RESOURCE_OTHER      = 0x40,
+    BK_RESOURCE_ALL        = 0x7f
+};
+
+enum BkFilterAction {
+    BK_FILTER_BLOCK = 0,
+    BK_FILTER_ALLOW
+};
+
+struct BkRequestFilterRule {
+    size_t SizeOfStruct; // sizeof(BkRequestFilterRule)
+    int Action; // BK_FILTER_BLOCK or BK_FILTER_ALLOW.
+    unsigned ResourceTypes; // BK_RESOURCE_* flags, 0 for BK_RESOURCE_ALL.
+    const char *HostSuffix; // Matches the host and its subdomains, if not null.
+    const char *URLSubstring; // Case insensitive, if not null.
+};
+
+struct BkCrawlQueueOptions {
+    size_t SizeOfStruct; // sizeof(BkCrawlQueueOptions)
+    unsigned PolitenessDelay; // Milliseconds between two URLs of the same host.
+    size_t ExpectedURLs; // Sizes the seen set, 0 for 1M.
+    double FalsePositiveRate; // Of the seen set, 0 for 0.1%.
+    size_t MemoryLimit; // Bytes of URLs kept in memory before spilling, 0 for no limit.
+    const char *SpillPath; // File for the spilled URLs, which are kept in memory if null.
+};
+
+struct BkReadinessOptions {
+    size_t SizeOfStruct; // sizeof(BkReadinessOptions)
+    unsigned NetworkIdleTime; // Milliseconds without requests in flight, 0 for 500.
+    unsigned MutationWindow; // Milliseconds over which DOM mutations are counted, 0 for 500.
+    unsigned MaxMutations; // Mutations allowed in the window.
+    unsigned Timeout; // Milliseconds after DocumentReady, 0 for 30 seconds.
+};
+
+struct BkResourceMetrics {
+    unsigned Requests;
+    unsigned long long Bytes; // Of the bodies, after content decoding.
+};
+
+struct BkCrawlerMetrics {
+    size_t SizeOfStruct; // sizeof(BkCrawlerMetrics)
+    double TimeToFirstByte; // Milliseconds from the navigation to the first byte of the document body.
+    struct BkResourceMetrics Document, Scripts, StyleSheets, Images, Fonts, Media, XHR, Others;
+    unsigned BlockedRequests, CachedRequests;
+    double DecodeTime, ParseTime, ScriptTime, GCTime; // Milliseconds.
+    size_t PeakDOMNodes;
+    size_t JSHeapSize; // Bytes.
+};
+
+struct BkMemoryLimits {
+    size_t SizeOfStruct; // sizeof(BkMemoryLimits)
+    size_t ProcessLimit; // Bytes of all crawlers and the responses in flight, 0 for no limit.
+    size_t CrawlerLimit; // Bytes of each crawler, 0 for no limit.
+    size_t ResponseLimit; // Bytes of each response body, beyond which it is truncated, 0 for no limit.
+};
+
+struct BkSerializationOptions {
+    size_t SizeOfStruct; // sizeof(BkSerializationOptions)
+    const char *Selector; // Serializes the first matched element instead of the document, if not null.
+    unsigned Flags;
+    size_t ChunkSize; // 0 for the default size (64 KB).
 };
 
 BKEXPORT BkCrawler BKAPI BkCreateCrawler(struct BkCrawlerClient *client);
@@ -45,10 +156,139 @@ BKEXPORT void BKAPI BkDestroyCrawler(BkCrawler crawler);
 
 BKEXPORT int BKAPI BkRunCrawler(BkCrawler crawler, const char *URL);
 
+/**
+ * Starts a new job on a crawler which has finished or is still running the
+ * previous one, which is stopped. The new document gets a new global object,
+ * while the frame, the crawler object and the caches are kept, so recycling
+ * a crawler is much cheaper than destroying it and creating a new one.
+ */
+BKEXPORT int BKAPI BkRecycleCrawler(BkCrawler crawler, const char *URL);
+
 BKEXPORT BkJSContext BKAPI BkGetScriptContextFromCrawler(BkCrawler crawler);
 
 BKEXPORT void BKAPI BkHijackResponse(BkResponse response, const void *newBody, size_t length);
 
+/**
+ * Memory Cache
+ *
+ * Decoded scripts are shared by all crawlers in the process, as long as the
+ * responses are fresh and the crawlers do not hijack them.
+ */
+BKEXPORT void BKAPI BkSetMemoryCacheCapacity(size_t capacity);
+BKEXPORT void BKAPI BkGetMemoryCacheStatistics(struct BkMemoryCacheStatistics *statistics);
+
+/**
+ * Serialization
+ *
+ * The current document is serialized as UTF-8, and handed out in chunks of
+ * bounded size, so the memory used does not grow with the document. Options
+ * may be null for the defaults.
+ */
+typedef bool_t (BKAPI * BkSerializationSink)(const void *data, size_t size, void *userData);
+BKEXPORT int BKAPI BkSerializeDocument(BkCrawler crawler, const struct BkSerializationOptions *options,
+    BkSerializationSink sink, void *userData);
+BKEXPORT int BKAPI BkSerializeDocumentToBuffer(BkCrawler crawler, const struct BkSerializationOptions *options,
+    struct BkBuffer *dst);
+BKEXPORT int BKAPI BkSerializeDocumentToFile(BkCrawler crawler, const struct BkSerializationOptions *options, int fd);
+
+/**
+ * Link Harvesting
+ *
+ * Collects the HTTP(S) URLs referenced by the document, resolved against its
+ * base URL, without fragments and deduplicated. The URLs are written in
+ * document order, each followed by a '\n'. Options may be null for the
+ * defaults.
+ */
+BKEXPORT int BKAPI BkHarvestLinks(BkCrawler crawler, const struct BkLinkHarvestOptions *options, struct BkBuffer *dst);
+
+/**
+ * Text Extraction
+ *
+ * Extracts the visible text of the document, or the first element matched by
+ * the selector if it is not null. Scripts, styles, templates and hidden
+ * elements are skipped, and whitespace is collapsed.
+ */
+BKEXPORT int BKAPI BkExtractText(BkCrawler crawler, const char *selector, unsigned flags, struct BkBuffer *dst);
+
+/**
+ * Request Filtering
+ *
+ * Subresource requests are checked against the rules before anything is
+ * allocated for them, and blocked ones fail at once with BK_ERR_FORBIDDEN,
+ * without reaching the network or the HijackRequest callback. A rule matches
+ * if all its conditions do, and a request is blocked if a blocking rule
+ * matches and no allowing rule does. The main document is never filtered.
+ * Setting no rules removes the filter.
+ */
+BKEXPORT void BKAPI BkSetRequestFilter(BkCrawler crawler, const struct BkRequestFilterRule *rules, size_t count);
+
+/**
+ * Readiness
+ *
+ * DocumentReady comes as soon as the document is loaded, which is too early
+ * for pages built by scripts. DocumentQuiescent comes when, in addition, no
+ * request has been in flight for the network idle time, no timeout is due
+ * within that time, and the DOM has changed no more than the allowed times
+ * over the mutation window. Options may be null for the defaults.
+ */
+BKEXPORT void BKAPI BkSetReadinessOptions(BkCrawler crawler, const struct BkReadinessOptions *options);
+
+/**
+ * Metrics
+ *
+ * Counted for the current job since BkRunCrawler or BkRecycleCrawler, on the
+ * main thread. Requests are counted when they are sent, and bytes when the
+ * responses are complete. Blocked requests are those refused by the request
+ * filter, and cached ones are served from the memory cache without a request.
+ * Parse time does not include the scripts run by the parser, and GC time only
+ * counts the collections made by BlinKit, not the incremental ones of the
+ * script engine.
+ */
+BKEXPORT void BKAPI BkGetCrawlerMetrics(BkCrawler crawler, struct BkCrawlerMetrics *metrics);
+
+/**
+ * Memory Limits
+ *
+ * The usage of a crawler is the response bodies it received which are still
+ * alive, in its resources or in the memory cache, the DOM, which is estimated
+ * from the node count, and the script heap. Each body is counted once, by the
+ * HTTP stack until it is handed to the crawler, and by the crawler after. It is
+ * measured on the main thread when a request finishes, after each parser pump
+ * and after each script. A crawler over its limit has its garbage collected,
+ * and if it is still over, the job is stopped and the Error callback is called
+ * with BK_ERR_MEMORY_LIMIT. Stopping ends the parsing and drops the responses
+ * which arrive later, but transfers in flight are not cancelled, and run to
+ * their ends in the HTTP stack. The crawler should then be recycled or
+ * destroyed to release the memory. Besides, scripts fail to allocate beyond
+ * the crawler limit.
+ * The process usage adds up the crawlers and the response bodies still held by
+ * the HTTP stack. When it is over the process limit, the crawlers using more
+ * than their share of it are handled the same way. Responses beyond the
+ * response limit are truncated, see BkIsResponseTruncated. Limits may be null
+ * for no limits, and usage is reported for the process if the crawler is null.
+ */
+BKEXPORT void BKAPI BkSetMemoryLimits(const struct BkMemoryLimits *limits);
+BKEXPORT size_t BKAPI BkGetMemoryUsage(BkCrawler crawler);
+
+/**
+ * Crawl Queue
+ *
+ * The URL frontier, which hands out URLs by priority while keeping the
+ * politeness delay for each host. URLs are canonicalized and deduplicated, so
+ * pushing a seen URL fails with BK_ERR_FORBIDDEN. The seen set is a Bloom
+ * filter, which may take a few new URLs as seen, at the false positive rate.
+ * Queues may be used from any thread. Options may be null for the defaults.
+ *
+ * BkCrawlQueuePop returns false if no host is ready, and sets delay to the
+ * milliseconds until the next one is ready, or to 0 if the queue is empty.
+ */
+BKEXPORT BkCrawlQueue BKAPI BkCreateCrawlQueue(const struct BkCrawlQueueOptions *options);
+BKEXPORT void BKAPI BkDestroyCrawlQueue(BkCrawlQueue queue);
+
+BKEXPORT int BKAPI BkCrawlQueuePush(BkCrawlQueue queue, const char *URL, int priority);
+BKEXPORT bool_t BKAPI BkCrawlQueuePop(BkCrawlQueue queue, struct BkBuffer *URL, unsigned *delay);
+BKEXPORT size_t BKAPI BkCrawlQueueSize(BkCrawlQueue queue);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif // __cplusplus
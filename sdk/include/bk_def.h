@@ -65,7 +65,8 @@ enum BkError {
     BK_ERR_REFERENCE,
     BK_ERR_SYNTAX,
     BK_ERR_TYPE,
-    BK_ERR_URI
+    BK_ERR_URI,
+    BK_ERR_MEMORY_LIMIT
 };
 
 BK_DECLARE_HANDLE(BkJSContext, ContextImpl);
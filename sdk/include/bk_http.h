@@ -39,7 +39,41 @@ BKEXPORT void BKAPI BkSetRequestBody(BkRequest request, const void *data, size_t
 BKEXPORT void BKAPI BkSetRequestTimeout(BkRequest request, unsigned timeout /* in seconds */);
 BKEXPORT void BKAPI BkSetRequestProxy(BkRequest request, const char *proxy);
 
+/**
+ * Request Backends
+ *
+ * Requests go to the network by default. In record mode they still do, and
+ * each request with its response, or its error, and the time it took is
+ * appended to an archive file. In replay mode requests are served from such
+ * an archive without touching the network, matched by method, URL, body and
+ * the headers that select the content (Accept, Content-Type and Range), and
+ * the ones not recorded fail with BK_ERR_NOT_FOUND. A request recorded
+ * several times is served its records in the order they were recorded, and
+ * the last one again after that. Redirections are replayed to RequestRedirect
+ * as they were recorded. Replayed responses may be delayed to simulate the
+ * latency and bandwidth of a network.
+ * The backend is process wide, and applies to the requests created after it
+ * is set. Options may be null for the network.
+ */
+enum BkRequestBackendMode {
+    BK_BACKEND_NETWORK = 0,
+    BK_BACKEND_RECORD,
+    BK_BACKEND_REPLAY
+};
+
+struct BkRequestBackendOptions {
+    size_t SizeOfStruct; // sizeof(BkRequestBackendOptions)
+    int Mode; // BK_BACKEND_*
+    const char *ArchivePath; // Appended to in record mode, mapped in replay mode.
+    unsigned Latency; // Replay mode, milliseconds before each response.
+    unsigned long long Bandwidth; // Replay mode, bytes of the bodies per second, 0 for unlimited.
+};
+
+BKEXPORT int BKAPI BkSetRequestBackend(const struct BkRequestBackendOptions *options);
+
 BKEXPORT int BKAPI BkGetResponseStatusCode(BkResponse response);
+// Whether the body was cut at the response limit of BkSetMemoryLimits.
+BKEXPORT bool_t BKAPI BkIsResponseTruncated(BkResponse response);
 
 enum ResponseData {
     BK_RE_CURRENT_URL = 0,
@@ -49,6 +83,22 @@ enum ResponseData {
 
 BKEXPORT int BKAPI BkGetResponseData(BkResponse response, int data, struct BkBuffer *dst);
 
+/**
+ * Body View
+ *
+ * A read-only view of the response body which refers to the internal storage
+ * directly instead of copying it. The view keeps the data alive, even after
+ * the response is released, until BkReleaseBodyView is called.
+ */
+struct BkBodyView {
+    const void *Data;
+    size_t Length;
+    void *Handle;
+};
+
+BKEXPORT int BKAPI BkGetResponseBodyView(BkResponse response, struct BkBodyView *view);
+BKEXPORT void BKAPI BkReleaseBodyView(struct BkBodyView *view);
+
 BKEXPORT int BKAPI BkGetResponseHeader(BkResponse response, const char *name, struct BkBuffer *dst);
 
 BKEXPORT size_t BKAPI BkGetResponseCookiesCount(BkResponse response);
@@ -12,6 +12,7 @@
 #include "app_impl.h"
 
 #include "base/single_thread_task_runner.h"
+#include "base/trace_event/trace_log.h"
 #include "blinkit/app/app_constants.h"
 #include "blinkit/blink_impl/url_loader_impl.h"
 #include "third_party/blink/public/platform/web_thread_scheduler.h"
@@ -268,4 +269,20 @@ BKEXPORT int BKAPI BkRunApp(void)
     return EXIT_FAILURE;
 }
 
+BKEXPORT void BKAPI BkStartTracing(const char *categories, size_t eventsPerThread)
+{
+    base::trace_event::TraceLog::GetInstance()->Start(nullptr != categories ? categories : "", eventsPerThread);
+}
+
+BKEXPORT void BKAPI BkStopTracing(struct BkBuffer *dst)
+{
+    base::trace_event::TraceLog *log = base::trace_event::TraceLog::GetInstance();
+    log->Stop();
+    if (nullptr != dst)
+    {
+        std::string json = log->ExportJSON();
+        BkSetBufferData(dst, json.data(), json.length());
+    }
+}
+
 } // extern "C"
@@ -0,0 +1,128 @@
+// -------------------------------------------------
+// BlinKit - BkCommon Library
+// -------------------------------------------------
+//   File Name: bk_segmented_buffer.cpp
+// Description: BkSegmentedBuffer Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "bk_segmented_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace BlinKit {
+
+void BkSegmentedBuffer::Append(const void *data, size_t length)
+{
+    if (0 == length)
+        return;
+
+    std::string *tail = WritableTail(length);
+    if (nullptr != tail)
+    {
+        tail->append(reinterpret_cast<const char *>(data), length);
+    }
+    else
+    {
+        std::shared_ptr<std::string> segment = std::make_shared<std::string>();
+        size_t capacity = std::max(length, kSegmentSize);
+        if (m_reserved > m_size)
+            capacity = std::max(capacity, m_reserved - m_size);
+        segment->reserve(capacity);
+        segment->append(reinterpret_cast<const char *>(data), length);
+        m_segments.push_back(std::move(segment));
+    }
+    m_size += length;
+}
+
+void BkSegmentedBuffer::Append(std::string &&data)
+{
+    if (data.empty())
+        return;
+
+    m_size += data.length();
+    m_segments.push_back(std::make_shared<std::string>(std::move(data)));
+}
+
+void BkSegmentedBuffer::Append(const Segment &segment)
+{
+    if (!segment || segment->empty())
+        return;
+
+    m_size += segment->length();
+    m_segments.push_back(segment);
+}
+
+void BkSegmentedBuffer::Append(const BkSegmentedBuffer &other)
+{
+    m_segments.insert(m_segments.end(), other.m_segments.begin(), other.m_segments.end());
+    m_size += other.m_size;
+}
+
+void BkSegmentedBuffer::Clear(void)
+{
+    m_segments.clear();
+    m_size = m_reserved = 0;
+}
+
+void BkSegmentedBuffer::CopyTo(void *dst) const
+{
+    char *p = reinterpret_cast<char *>(dst);
+    for (const Segment &segment : m_segments)
+    {
+        memcpy(p, segment->data(), segment->length());
+        p += segment->length();
+    }
+}
+
+BkSegmentedBuffer::Segment BkSegmentedBuffer::Flatten(void)
+{
+    if (m_segments.size() > 1)
+    {
+        std::string data;
+        data.resize(m_size);
+        CopyTo(const_cast<char *>(data.data()));
+
+        m_segments.clear();
+        m_segments.push_back(std::make_shared<std::string>(std::move(data)));
+    }
+    return m_segments.empty() ? nullptr : m_segments.front();
+}
+
+void BkSegmentedBuffer::Reserve(size_t size)
+{
+    m_reserved = size;
+}
+
+std::string BkSegmentedBuffer::ToString(void) const
+{
+    if (1 == m_segments.size())
+        return *m_segments.front();
+
+    std::string ret;
+    ret.resize(m_size);
+    CopyTo(const_cast<char *>(ret.data()));
+    return ret;
+}
+
+std::string* BkSegmentedBuffer::WritableTail(size_t length)
+{
+    if (m_segments.empty())
+        return nullptr;
+
+    // A segment referenced by anyone else must stay unchanged.
+    const Segment &tail = m_segments.back();
+    if (1 != tail.use_count())
+        return nullptr;
+
+    const size_t limit = std::max(tail->capacity(), kSegmentSize);
+    if (tail->length() + length > limit)
+        return nullptr;
+    return const_cast<std::string *>(tail.get());
+}
+
+} // namespace BlinKit
@@ -0,0 +1,63 @@
+// -------------------------------------------------
+// BlinKit - BkCommon Library
+// -------------------------------------------------
+//   File Name: bk_segmented_buffer.h
+// Description: BkSegmentedBuffer Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BKCOMMON_BK_SEGMENTED_BUFFER_H
+#define BLINKIT_BKCOMMON_BK_SEGMENTED_BUFFER_H
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BlinKit {
+
+// A byte buffer made of refcounted segments. Once a segment is shared with
+// another buffer (or handed out by Flatten), it is never modified again, so
+// a body written once on the network thread can be passed to Blink resources
+// and SDK clients by reference.
+class BkSegmentedBuffer
+{
+public:
+    using Segment = std::shared_ptr<const std::string>;
+
+    bool IsEmpty(void) const { return 0 == m_size; }
+    size_t Size(void) const { return m_size; }
+    const std::vector<Segment>& Segments(void) const { return m_segments; }
+
+    void Clear(void);
+    // Hints the total size, so that appended data goes into a single segment.
+    void Reserve(size_t size);
+
+    void Append(const void *data, size_t length);
+    void Append(std::string &&data);
+    void Append(const Segment &segment);
+    void Append(const BkSegmentedBuffer &other);
+
+    // Merges all segments into one and returns it, so that the whole content
+    // can be viewed as a single block. Returns nullptr for empty buffers.
+    Segment Flatten(void);
+    void CopyTo(void *dst) const;
+    std::string ToString(void) const;
+private:
+    std::string* WritableTail(size_t length);
+
+    // Segments not exceeding this size are filled in place, to avoid tiny
+    // segments from small network reads.
+    static constexpr size_t kSegmentSize = 64 * 1024;
+
+    std::vector<Segment> m_segments;
+    size_t m_size = 0, m_reserved = 0;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BKCOMMON_BK_SEGMENTED_BUFFER_H
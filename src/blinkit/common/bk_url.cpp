@@ -53,7 +53,7 @@ std::string BkURL::PathForRequest(void) const
     return m_string.substr(m_parsed.path.begin, pathLen);
 }
 
-BkURL BkURL::Resolve(const std::string &relative) const
+BkURL BkURL::Resolve(std::string_view relative) const
 {
     // Not allowed for invalid URLs.
     if (!m_isValid)
@@ -128,11 +128,177 @@ std::string BkURL::StrippedForUseAsReferrer(void) const
 
 BkURL BkURL::StripFragmentIdentifier(void) const
 {
-    if (m_parsed.ref.is_nonempty())
+    if (!m_parsed.ref.is_valid())
+        return *this;
+
+    BkURL ret(*this);
+    ret.m_string.resize(m_parsed.ref.begin - 1); // Also drops the '#'.
+    ret.m_parsed.ref.reset();
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// The characters which the canonicalizer copies as they are, for each
+// component of a relative URL. Those that need escaping, '%' in paths (whose
+// escapes may be unescaped), ':' in paths (which may end a scheme) and '\'
+// (which becomes '/') are left to the canonicalizer, and so are whitespace and
+// non-ASCII characters.
+enum FastPathCharFlags {
+    kPathChar  = 0x1,
+    kQueryChar = 0x2,
+    kRefChar   = 0x4
+};
+
+class FastPathCharTable
+{
+public:
+    FastPathCharTable(void)
     {
-        assert(false); // BKTODO:
+        memset(m_flags, 0, sizeof(m_flags));
+        for (int c = 0x21; c < 0x7f; ++c)
+            m_flags[c] = kQueryChar | kRefChar;
+        for (const char *p = "\"#'<>"; '\0' != *p; ++p)
+            m_flags[static_cast<unsigned char>(*p)] &= ~kQueryChar;
+
+        for (int c = '0'; c <= '9'; ++c)
+            m_flags[c] |= kPathChar;
+        for (int c = 'A'; c <= 'Z'; ++c)
+            m_flags[c] |= kPathChar;
+        for (int c = 'a'; c <= 'z'; ++c)
+            m_flags[c] |= kPathChar;
+        for (const char *p = "!$&'()*+,-./;=@[]_~"; '\0' != *p; ++p)
+            m_flags[static_cast<unsigned char>(*p)] |= kPathChar;
+    }
+
+    bool Is(char c, FastPathCharFlags flag) const
+    {
+        return 0 != (m_flags[static_cast<unsigned char>(c)] & flag);
     }
-    return *this;
+private:
+    unsigned char m_flags[0x100];
+};
+
+const FastPathCharTable g_fastPathChars;
+
+} // namespace
+
+BkURLResolver::BkURLResolver(const BkURL &base) : m_base(base)
+{
+    // Relative URLs are resolved the same for HTTP(S) URLs with a path, which
+    // is true of all canonicalized ones.
+    const Parsed &parsed = m_base.m_parsed;
+    if (!m_base.IsValid() || !m_base.SchemeIsHTTPOrHTTPS() || parsed.path.len <= 0)
+        return;
+
+    const std::string &s = m_base.m_string;
+    if ('/' != s.at(parsed.path.begin))
+        return;
+
+    m_originEnd = parsed.path.begin;
+    m_directoryEnd = s.rfind('/', parsed.path.end() - 1) + 1;
+    m_pathEnd = parsed.path.end();
+    m_queryEnd = parsed.query.is_valid() ? parsed.query.end() : m_pathEnd;
+}
+
+bool BkURLResolver::FastResolve(std::string_view relative, BkURL &dst) const
+{
+    if (0 == m_originEnd)
+        return false;
+
+    size_t prefixLength = m_directoryEnd;
+    if (relative.empty())
+    {
+        prefixLength = m_queryEnd;
+    }
+    else
+    {
+        switch (relative.front())
+        {
+            case '#':
+                prefixLength = m_queryEnd;
+                break;
+            case '?':
+                prefixLength = m_pathEnd;
+                break;
+            case '/':
+                if (relative.length() > 1 && '/' == relative[1])
+                    return false; // Scheme-relative.
+                prefixLength = m_originEnd;
+                break;
+        }
+    }
+
+    const size_t length = relative.length();
+    size_t i = 0;
+    for (; i < length && '?' != relative[i] && '#' != relative[i]; ++i)
+    {
+        const char c = relative[i];
+        if (!g_fastPathChars.Is(c, kPathChar))
+            return false;
+        if ('.' == c && (0 == i || '/' == relative[i - 1]))
+            return false; // May be a dot segment.
+    }
+    const size_t pathLength = i;
+
+    size_t queryStart = std::string_view::npos;
+    if (i < length && '?' == relative[i])
+    {
+        queryStart = i++;
+        for (; i < length && '#' != relative[i]; ++i)
+        {
+            if (!g_fastPathChars.Is(relative[i], kQueryChar))
+                return false;
+        }
+    }
+    const size_t queryEnd = i;
+
+    size_t refStart = std::string_view::npos;
+    if (i < length)
+    {
+        refStart = i++;
+        for (; i < length; ++i)
+        {
+            if (!g_fastPathChars.Is(relative[i], kRefChar))
+                return false;
+        }
+    }
+
+    const Parsed &base = m_base.m_parsed;
+    dst.m_string.reserve(prefixLength + length);
+    dst.m_string.assign(m_base.m_string, 0, prefixLength);
+    dst.m_string.append(relative);
+
+    // The components before the path never change, nor do their offsets.
+    Parsed &parsed = dst.m_parsed;
+    parsed = base;
+    const int offset = static_cast<int>(prefixLength);
+    if (pathLength > 0)
+        parsed.path = MakeRange(base.path.begin, offset + static_cast<int>(pathLength));
+    if (pathLength > 0 || std::string_view::npos != queryStart)
+    {
+        if (std::string_view::npos != queryStart)
+            parsed.query = MakeRange(offset + static_cast<int>(queryStart) + 1, offset + static_cast<int>(queryEnd));
+        else
+            parsed.query.reset();
+    }
+    if (std::string_view::npos != refStart)
+        parsed.ref = MakeRange(offset + static_cast<int>(refStart) + 1, offset + static_cast<int>(length));
+    else
+        parsed.ref.reset();
+
+    dst.m_isValid = true;
+    return true;
+}
+
+BkURL BkURLResolver::Resolve(std::string_view relative) const
+{
+    BkURL ret;
+    if (!FastResolve(relative, ret))
+        ret = m_base.Resolve(relative);
+    return ret;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
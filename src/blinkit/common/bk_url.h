@@ -31,33 +31,43 @@ public:
     bool IsValid(void) const { return m_isValid; }
     const std::string& AsString(void) const { return m_string; }
 
+    // The *Piece accessors return views into AsString(), which are only valid
+    // as long as the URL is.
     std::string Scheme(void) const { return ComponentString(m_parsed.scheme); }
+    std::string_view SchemePiece(void) const { return ComponentStringView(m_parsed.scheme); }
     bool SchemeIs(std::string_view scheme) const;
     bool SchemeIsHTTPOrHTTPS(void) const;
     bool SchemeIsData(void) const;
     bool SchemeIsFile(void) const;
 
     std::string Host(void) const { return ComponentString(m_parsed.host); }
+    std::string_view HostPiece(void) const { return ComponentStringView(m_parsed.host); }
     std::string Username(void) const { return ComponentString(m_parsed.username); }
+    std::string_view UsernamePiece(void) const { return ComponentStringView(m_parsed.username); }
     std::string Password(void) const { return ComponentString(m_parsed.password); }
+    std::string_view PasswordPiece(void) const { return ComponentStringView(m_parsed.password); }
     int EffectiveIntPort(void) const;
     std::string Path(void) const { return ComponentString(m_parsed.path); }
+    std::string_view PathPiece(void) const { return ComponentStringView(m_parsed.path); }
+    std::string_view QueryPiece(void) const { return ComponentStringView(m_parsed.query); }
+    std::string_view RefPiece(void) const { return ComponentStringView(m_parsed.ref); }
     std::string PathForRequest(void) const;
     bool HasRef(void) const { return m_parsed.ref.is_nonempty(); }
 
-    BkURL Resolve(const std::string &relative) const;
+    BkURL Resolve(std::string_view relative) const;
 
     BkURL StripFragmentIdentifier(void) const;
     std::string StrippedForUseAsHref(void) const;
     std::string StrippedForUseAsReferrer(void) const;
 private:
+    friend class BkURLResolver;
     friend bool EqualIgnoringFragmentIdentifier(const BkURL &a, const BkURL &b);
 
     std::string ComponentString(const url::Component &comp) const {
         return comp.is_nonempty() ? std::string(m_string.data() + comp.begin, comp.len) : std::string();
     }
     std::string_view ComponentStringView(const url::Component &comp) const {
-        return comp.is_nonempty() ? std::string_view(m_string.data() + comp.begin, comp.len) : std::string();
+        return comp.is_nonempty() ? std::string_view(m_string.data() + comp.begin, comp.len) : std::string_view();
     }
 
     bool m_isValid = false;
@@ -67,6 +77,30 @@ private:
     static BkURL m_blank;
 };
 
+// Resolves relative URLs against a fixed base, for the many URLs of a document.
+// The common relative forms (same-directory, root-relative, query-only and
+// fragment-only) with nothing to escape or normalize are appended to prefixes
+// of the base worked out once, as the canonicalizer would copy them; others
+// fall back to BkURL::Resolve. Either way, the results are the same.
+class BkURLResolver
+{
+public:
+    BkURLResolver(void) = default;
+    explicit BkURLResolver(const BkURL &base);
+
+    const BkURL& Base(void) const { return m_base; }
+    BkURL Resolve(std::string_view relative) const;
+private:
+    bool FastResolve(std::string_view relative, BkURL &dst) const;
+
+    BkURL m_base;
+    // Ends of the prefixes of the base, all 0 if it has no fast path.
+    size_t m_originEnd = 0;    // Before the path.
+    size_t m_directoryEnd = 0; // After the last '/' of the path.
+    size_t m_pathEnd = 0;      // Before the query.
+    size_t m_queryEnd = 0;     // Before the fragment.
+};
+
 bool EqualIgnoringFragmentIdentifier(const BkURL &a, const BkURL &b);
 
 inline bool operator==(const BkURL &a, const BkURL &b) { return a.AsString() == b.AsString(); }
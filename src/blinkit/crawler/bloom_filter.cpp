@@ -0,0 +1,78 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: bloom_filter.cpp
+// Description: BloomFilter Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "bloom_filter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace BlinKit {
+
+static uint64_t Mix(uint64_t x)
+{
+    // The finalizer of SplitMix64, so that the second hash is independent of
+    // the first one.
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+BloomFilter::BloomFilter(size_t expectedCount, double falsePositiveRate)
+{
+    static const double ln2 = std::log(2.0);
+
+    double bits = -static_cast<double>(std::max<size_t>(expectedCount, 1)) * std::log(falsePositiveRate) / (ln2 * ln2);
+    m_bits.resize(static_cast<size_t>(bits / 64) + 1);
+    m_bitCount = m_bits.size() * 64;
+
+    double hashes = std::round(-std::log(falsePositiveRate) / ln2);
+    m_hashCount = std::max(1U, static_cast<unsigned>(hashes));
+}
+
+bool BloomFilter::Add(std::string_view key)
+{
+    bool added = false;
+    ForEachBit(key, [this, &added](uint64_t bit) {
+        uint64_t &word = m_bits[bit / 64];
+        const uint64_t mask = 1ULL << (bit % 64);
+        if (0 == (word & mask))
+        {
+            word |= mask;
+            added = true;
+        }
+    });
+    return added;
+}
+
+template <typename Callback>
+void BloomFilter::ForEachBit(std::string_view key, const Callback &callback) const
+{
+    // Double hashing, see Kirsch & Mitzenmacher, "Less Hashing, Same
+    // Performance: Building a Better Bloom Filter".
+    const uint64_t h1 = std::hash<std::string_view>()(key);
+    const uint64_t h2 = Mix(h1) | 1;
+    for (unsigned i = 0; i < m_hashCount; ++i)
+        callback((h1 + i * h2) % m_bitCount);
+}
+
+bool BloomFilter::MayContain(std::string_view key) const
+{
+    bool found = true;
+    ForEachBit(key, [this, &found](uint64_t bit) {
+        if (0 == (m_bits[bit / 64] & (1ULL << (bit % 64))))
+            found = false;
+    });
+    return found;
+}
+
+} // namespace BlinKit
@@ -0,0 +1,46 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: bloom_filter.h
+// Description: BloomFilter Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_BLOOM_FILTER_H
+#define BLINKIT_BLINKIT_BLOOM_FILTER_H
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace BlinKit {
+
+// A Bloom filter sized for |expectedCount| keys at the given false positive
+// rate, which takes about 1.8 bytes per key at 0.1%. Keys are never stored,
+// and a key may be reported as seen while it was not, but never the other way
+// round.
+class BloomFilter
+{
+public:
+    BloomFilter(size_t expectedCount, double falsePositiveRate);
+
+    // Returns false if |key| may have been added before.
+    bool Add(std::string_view key);
+    bool MayContain(std::string_view key) const;
+private:
+    template <typename Callback>
+    void ForEachBit(std::string_view key, const Callback &callback) const;
+
+    std::vector<uint64_t> m_bits;
+    uint64_t m_bitCount;
+    unsigned m_hashCount;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_BLOOM_FILTER_H
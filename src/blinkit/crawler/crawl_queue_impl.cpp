@@ -0,0 +1,352 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: crawl_queue_impl.cpp
+// Description: CrawlQueueImpl Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "crawl_queue_impl.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include "base/logging.h"
+#include "blinkit/common/bk_url.h"
+
+using namespace BlinKit;
+
+CrawlQueueImpl::CrawlQueueImpl(const BkCrawlQueueOptions &options)
+    : m_politenessDelay(base::TimeDelta::FromMilliseconds(options.PolitenessDelay))
+    , m_memoryLimit(options.MemoryLimit)
+    , m_spillPath(nullptr != options.SpillPath ? options.SpillPath : "")
+    , m_seen(options.ExpectedURLs, options.FalsePositiveRate)
+{
+}
+
+CrawlQueueImpl::~CrawlQueueImpl(void)
+{
+    if (nullptr != m_spillFile)
+    {
+        fclose(m_spillFile);
+        remove(m_spillPath.c_str());
+    }
+}
+
+void CrawlQueueImpl::Enqueue(const std::string &host, int priority, std::string &&URL, base::TimeTicks now)
+{
+    auto it = m_hosts.try_emplace(host).first;
+    HostQueue &q = it->second;
+
+    m_memoryUsage += EntrySize(URL);
+    ++m_count;
+
+    Entry entry = { priority, ++m_sequence, std::move(URL) };
+    const bool isFirst = q.entries.empty() || q.entries.top() < entry;
+    q.entries.push(std::move(entry));
+
+    switch (q.state)
+    {
+        case HostState::kIdle:
+            Schedule(&it->first, q, now);
+            break;
+        case HostState::kReady:
+            if (isFirst)
+            {
+                m_readyHosts.push({ priority, m_sequence, &it->first });
+                ++q.keys;
+            }
+            break;
+        default:
+            // Will be keyed when its politeness delay expires.
+            break;
+    }
+}
+
+void CrawlQueueImpl::EraseIfDone(HostMap::iterator it, base::TimeTicks now)
+{
+    const HostQueue &q = it->second;
+    if (q.entries.empty() && 0 == q.keys && q.nextAllowed <= now)
+        m_hosts.erase(it);
+}
+
+bool CrawlQueueImpl::Pop(std::string &URL, unsigned &delay)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    const base::TimeTicks now = base::TimeTicks::Now();
+    Refill(now);
+    PromoteWaitingHosts(now);
+
+    while (!m_readyHosts.empty())
+    {
+        const ReadyKey key = m_readyHosts.top();
+        m_readyHosts.pop();
+
+        auto it = m_hosts.find(*key.host);
+        HostQueue &q = it->second;
+        --q.keys;
+        if (HostState::kReady != q.state || q.entries.top().sequence != key.sequence)
+        {
+            // Stale key.
+            EraseIfDone(it, now);
+            continue;
+        }
+
+        URL = q.entries.top().URL;
+        q.entries.pop();
+        m_memoryUsage -= EntrySize(URL);
+        --m_count;
+
+        q.nextAllowed = now + m_politenessDelay;
+        if (q.entries.empty())
+        {
+            // Kept for later pushes until its politeness delay has passed.
+            q.state = HostState::kIdle;
+            if (q.nextAllowed > now)
+            {
+                m_idleHosts.push({ q.nextAllowed, key.host });
+                ++q.keys;
+            }
+            else
+            {
+                EraseIfDone(it, now);
+            }
+        }
+        else
+        {
+            Schedule(key.host, q, now);
+        }
+        return true;
+    }
+
+    delay = 0;
+    if (!m_waitingHosts.empty())
+    {
+        double ms = (m_waitingHosts.top().readyTime - now).InMillisecondsF();
+        delay = std::max(1U, static_cast<unsigned>(std::ceil(ms)));
+    }
+    return false;
+}
+
+void CrawlQueueImpl::PromoteWaitingHosts(base::TimeTicks now)
+{
+    while (!m_waitingHosts.empty() && m_waitingHosts.top().readyTime <= now)
+    {
+        const std::string *host = m_waitingHosts.top().host;
+        m_waitingHosts.pop();
+
+        HostQueue &q = m_hosts.find(*host)->second;
+        --q.keys;
+        Schedule(host, q, now);
+    }
+
+    while (!m_idleHosts.empty() && m_idleHosts.top().readyTime <= now)
+    {
+        auto it = m_hosts.find(*m_idleHosts.top().host);
+        m_idleHosts.pop();
+
+        --it->second.keys;
+        EraseIfDone(it, now);
+    }
+}
+
+int CrawlQueueImpl::Push(const char *URL, int priority)
+{
+    const std::string s(URL);
+    BkURL parsed(s);
+    if (!parsed.IsValid())
+        return BK_ERR_URI;
+
+    // Resolving an absolute URL against itself gives its canonical form.
+    BkURL canonical = parsed.Resolve(s);
+    if (!canonical.IsValid() || !canonical.SchemeIsHTTPOrHTTPS())
+        return BK_ERR_URI;
+    canonical = canonical.StripFragmentIdentifier();
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (!m_seen.Add(canonical.AsString()))
+        return BK_ERR_FORBIDDEN;
+
+    if (0 != m_memoryLimit && m_memoryUsage + EntrySize(canonical.AsString()) > m_memoryLimit)
+    {
+        if (Spill(priority, canonical.AsString()))
+            return BK_ERR_SUCCESS;
+    }
+
+    Enqueue(canonical.Host(), priority, std::string(canonical.AsString()), base::TimeTicks::Now());
+    return BK_ERR_SUCCESS;
+}
+
+static bool ReadLine(FILE *fp, std::string &dst)
+{
+    dst.clear();
+
+    char buf[1024];
+    while (nullptr != fgets(buf, sizeof(buf), fp))
+    {
+        dst.append(buf);
+        if ('\n' == dst.back())
+        {
+            dst.pop_back();
+            return true;
+        }
+    }
+    return !dst.empty();
+}
+
+void CrawlQueueImpl::Refill(base::TimeTicks now)
+{
+    if (0 == m_spilledCount || m_memoryUsage > m_memoryLimit / 2)
+        return;
+
+    fseek(m_spillFile, m_spillReadOffset, SEEK_SET);
+
+    std::string line;
+    while (m_spilledCount > 0 && m_memoryUsage < m_memoryLimit / 4 * 3 && ReadLine(m_spillFile, line))
+    {
+        --m_spilledCount;
+
+        size_t tab = line.find('\t');
+        if (std::string::npos == tab)
+        {
+            ASSERT(std::string::npos != tab);
+            continue;
+        }
+
+        int priority = atoi(line.c_str());
+        std::string URL = line.substr(tab + 1);
+        std::string host = BkURL(URL).Host();
+        Enqueue(host, priority, std::move(URL), now);
+    }
+    m_spillReadOffset = ftell(m_spillFile);
+
+    if (0 == m_spilledCount)
+    {
+        // Starts over, so that the file does not grow forever.
+        fclose(m_spillFile);
+        m_spillFile = nullptr;
+        m_spillReadOffset = 0;
+        remove(m_spillPath.c_str());
+    }
+}
+
+void CrawlQueueImpl::Schedule(const std::string *host, HostQueue &q, base::TimeTicks now)
+{
+    if (q.nextAllowed <= now)
+    {
+        q.state = HostState::kReady;
+        const Entry &first = q.entries.top();
+        m_readyHosts.push({ first.priority, first.sequence, host });
+    }
+    else
+    {
+        q.state = HostState::kWaiting;
+        m_waitingHosts.push({ q.nextAllowed, host });
+    }
+    ++q.keys;
+}
+
+size_t CrawlQueueImpl::Size(void) const
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_count + m_spilledCount;
+}
+
+bool CrawlQueueImpl::Spill(int priority, const std::string &URL)
+{
+    if (m_spillPath.empty())
+        return false;
+
+    if (nullptr == m_spillFile)
+    {
+        m_spillFile = fopen(m_spillPath.c_str(), "w+b");
+        if (nullptr == m_spillFile)
+        {
+            BKLOG("Failed to open spill file: %s", m_spillPath.c_str());
+            return false;
+        }
+    }
+
+    fseek(m_spillFile, 0, SEEK_END);
+    if (fprintf(m_spillFile, "%d\t%s\n", priority, URL.c_str()) < 0)
+        return false;
+
+    ++m_spilledCount;
+    return true;
+}
+
+bool CrawlQueueImpl::Entry::operator<(const Entry &o) const
+{
+    // Higher priorities first, then first in, first out.
+    if (priority != o.priority)
+        return priority < o.priority;
+    return sequence > o.sequence;
+}
+
+bool CrawlQueueImpl::ReadyKey::operator<(const ReadyKey &o) const
+{
+    if (priority != o.priority)
+        return priority < o.priority;
+    return sequence > o.sequence;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+extern "C" {
+
+BKEXPORT BkCrawlQueue BKAPI BkCreateCrawlQueue(const BkCrawlQueueOptions *options)
+{
+    BkCrawlQueueOptions o;
+    memset(&o, 0, sizeof(BkCrawlQueueOptions));
+    if (nullptr != options)
+    {
+        size_t size = sizeof(BkCrawlQueueOptions);
+        if (options->SizeOfStruct < size)
+            size = options->SizeOfStruct;
+        memcpy(&o, options, size);
+    }
+
+    if (0 == o.ExpectedURLs)
+        o.ExpectedURLs = 1000000;
+    if (o.FalsePositiveRate <= 0 || o.FalsePositiveRate >= 1)
+        o.FalsePositiveRate = 0.001;
+    return new CrawlQueueImpl(o);
+}
+
+BKEXPORT bool_t BKAPI BkCrawlQueuePop(BkCrawlQueue queue, BkBuffer *URL, unsigned *delay)
+{
+    std::string s;
+    unsigned d = 0;
+    if (!queue->Pop(s, d))
+    {
+        if (nullptr != delay)
+            *delay = d;
+        return false;
+    }
+
+    BkSetBufferData(URL, s.data(), s.length());
+    if (nullptr != delay)
+        *delay = 0;
+    return true;
+}
+
+BKEXPORT int BKAPI BkCrawlQueuePush(BkCrawlQueue queue, const char *URL, int priority)
+{
+    return queue->Push(URL, priority);
+}
+
+BKEXPORT size_t BKAPI BkCrawlQueueSize(BkCrawlQueue queue)
+{
+    return queue->Size();
+}
+
+BKEXPORT void BKAPI BkDestroyCrawlQueue(BkCrawlQueue queue)
+{
+    delete queue;
+}
+
+} // extern "C"
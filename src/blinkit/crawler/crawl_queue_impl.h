@@ -0,0 +1,105 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: crawl_queue_impl.h
+// Description: CrawlQueueImpl Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_CRAWL_QUEUE_IMPL_H
+#define BLINKIT_BLINKIT_CRAWL_QUEUE_IMPL_H
+
+#pragma once
+
+#include <cstdio>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include "base/time/time.h"
+#include "bk_crawler.h"
+#include "blinkit/crawler/bloom_filter.h"
+
+// The URL frontier. Each host has its own queue ordered by priority, and a
+// host is not handed out again until the politeness delay has passed since
+// its last URL. URLs are deduplicated by a Bloom filter over their canonical
+// forms, and when a memory limit is set, URLs beyond it are spilled to a file.
+class CrawlQueueImpl
+{
+public:
+    CrawlQueueImpl(const BkCrawlQueueOptions &options);
+    ~CrawlQueueImpl(void);
+
+    int Push(const char *URL, int priority);
+    bool Pop(std::string &URL, unsigned &delay);
+    size_t Size(void) const;
+private:
+    struct Entry {
+        int priority;
+        uint64_t sequence;
+        std::string URL;
+
+        bool operator<(const Entry &o) const;
+    };
+
+    enum class HostState { kIdle, kReady, kWaiting };
+    struct HostQueue {
+        std::priority_queue<Entry> entries;
+        base::TimeTicks nextAllowed;
+        HostState state = HostState::kIdle;
+        // The number of ready and waiting keys pointing at the host, stale
+        // ones included. A host is only erased once none is left.
+        unsigned keys = 0;
+    };
+    typedef std::unordered_map<std::string, HostQueue> HostMap;
+
+    // Ready hosts ordered by their first entries. Keys are not updated in
+    // place, so a key is stale once its entry is no longer the first one of
+    // a ready host.
+    struct ReadyKey {
+        int priority;
+        uint64_t sequence;
+        const std::string *host;
+
+        bool operator<(const ReadyKey &o) const;
+    };
+    struct WaitingKey {
+        base::TimeTicks readyTime;
+        const std::string *host;
+
+        bool operator<(const WaitingKey &o) const { return o.readyTime < readyTime; }
+    };
+
+    static size_t EntrySize(const std::string &URL) { return sizeof(Entry) + URL.length(); }
+
+    void Enqueue(const std::string &host, int priority, std::string &&URL, base::TimeTicks now);
+    // Erases an idle host once its politeness delay has passed, as it would
+    // then be scheduled the same way as a host never seen before.
+    void EraseIfDone(HostMap::iterator it, base::TimeTicks now);
+    void PromoteWaitingHosts(base::TimeTicks now);
+    void Schedule(const std::string *host, HostQueue &q, base::TimeTicks now);
+    bool Spill(int priority, const std::string &URL);
+    void Refill(base::TimeTicks now);
+
+    const base::TimeDelta m_politenessDelay;
+    const size_t m_memoryLimit;
+    const std::string m_spillPath;
+
+    mutable std::mutex m_lock;
+    BlinKit::BloomFilter m_seen;
+    HostMap m_hosts;
+    std::priority_queue<ReadyKey> m_readyHosts;
+    std::priority_queue<WaitingKey> m_waitingHosts;
+    // Hosts whose queues ran empty, until their politeness delays pass.
+    std::priority_queue<WaitingKey> m_idleHosts;
+    uint64_t m_sequence = 0;
+    size_t m_count = 0, m_memoryUsage = 0;
+
+    FILE *m_spillFile = nullptr;
+    long m_spillReadOffset = 0;
+    size_t m_spilledCount = 0;
+};
+
+#endif // BLINKIT_BLINKIT_CRAWL_QUEUE_IMPL_H
@@ -11,14 +11,34 @@
 
 #include "crawler_impl.h"
 
+#if OS_WIN
+#   include <io.h>
+#else
+#   include <errno.h>
+#   include <unistd.h>
+#endif
 #include "blinkit/common/bk_url.h"
+#include "blinkit/crawler/crawler_metrics.h"
+#include "blinkit/crawler/link_harvester.h"
+#include "blinkit/crawler/memory_budget.h"
+#include "blinkit/crawler/readiness_tracker.h"
+#include "blinkit/crawler/request_filter.h"
 #include "blinkit/http/response_impl.h"
 #include "blinkit/js/context_impl.h"
 #include "blinkit/misc/controller_impl.h"
+#include "blinkit/misc/memory_governor.h"
 #include "third_party/blink/renderer/bindings/core/duk/script_controller.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/document_parser.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/editing/serializers/streaming_markup_serializer.h"
+#include "third_party/blink/renderer/core/editing/text_extractor.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/core/loader/frame_load_request.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
 #include "third_party/blink/renderer/platform/bindings/gc_pool.h"
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_error.h"
 #if 0 // BKTODO:
 #include "app/app_impl.h"
@@ -28,9 +48,30 @@
 using namespace blink;
 using namespace BlinKit;
 
-CrawlerImpl::CrawlerImpl(const BkCrawlerClient &client) : m_client(client), m_frame(LocalFrame::Create(this))
+CrawlerImpl::CrawlerImpl(const BkCrawlerClient &client)
+    : m_frame(LocalFrame::Create(this)), m_jobAborted(std::make_shared<bool>(false))
 {
+    // Clients built against older headers may pass shorter structs.
+    memset(&m_client, 0, sizeof(BkCrawlerClient));
+    size_t size = sizeof(BkCrawlerClient);
+    if (client.SizeOfStruct < size)
+        size = client.SizeOfStruct;
+    memcpy(&m_client, &client, size);
+
+    m_metrics = std::make_unique<CrawlerMetrics>();
     m_frame->Init();
+
+    const auto abort = std::bind(&CrawlerImpl::AbortForMemory, this, std::placeholders::_1);
+    m_memoryBudget = std::make_unique<MemoryBudget>(*m_frame, *m_metrics, abort);
+
+    if (nullptr != m_client.DocumentQuiescent)
+    {
+        const auto callback = [this](bool timedOut)
+        {
+            m_client.DocumentQuiescent(timedOut, m_client.UserData);
+        };
+        m_readinessTracker = std::make_unique<ReadinessTracker>(*m_frame, callback);
+    }
 }
 
 CrawlerImpl::~CrawlerImpl(void)
@@ -38,6 +79,44 @@ CrawlerImpl::~CrawlerImpl(void)
     m_frame->Detach(FrameDetachType::kRemove);
 }
 
+void CrawlerImpl::AbortForMemory(size_t usage)
+{
+    std::string URL;
+    if (Document *document = m_frame->GetDocument())
+        URL = document->Url().AsString();
+    BKLOG("Crawler aborted for using %zu bytes: %s", usage, URL.c_str());
+
+    // Loaders cannot be stopped mid-load yet, so the parser is stopped, and
+    // the loader tasks drop whatever arrives for the job from now on.
+    *m_jobAborted = true;
+    if (Document *document = m_frame->GetDocument())
+    {
+        if (DocumentParser *parser = document->Parser())
+            parser->StopParsing();
+    }
+    if (m_readinessTracker)
+        m_readinessTracker->Stop();
+    if (nullptr != m_client.Error)
+        m_client.Error(BK_ERR_MEMORY_LIMIT, URL.c_str(), m_client.UserData);
+}
+
+bool CrawlerImpl::AllowsRequest(ResourceType type, const BkURL &URL) const
+{
+    if (!m_requestFilter)
+        return true;
+
+    if (m_requestFilter->Allows(RequestFilter::ResourceKindOf(type), URL))
+        return true;
+
+    m_metrics->DidBlockRequest();
+    return false;
+}
+
+bool CrawlerImpl::AllowsSharedCache(void) const
+{
+    return nullptr == m_client.HijackRequest && nullptr == m_client.HijackResponse;
+}
+
 bool CrawlerImpl::ApplyConsoleMessager(std::function<void(int, const char *)> &dst) const
 {
     if (nullptr == m_client.ConsoleMessage)
@@ -52,10 +131,44 @@ void CrawlerImpl::DispatchDidFailProvisionalLoad(const ResourceError &error)
     m_client.Error(error.ErrorCode(), URL.c_str(), m_client.UserData);
 }
 
+void CrawlerImpl::DidFinishRequest(void)
+{
+    if (m_readinessTracker)
+        m_readinessTracker->DidFinishRequest();
+    m_memoryBudget->Checkpoint();
+}
+
+void CrawlerImpl::DidStartRequest(void)
+{
+    if (m_readinessTracker)
+        m_readinessTracker->DidStartRequest();
+}
+
 void CrawlerImpl::DispatchDidFinishLoad(void)
 {
+    base::TimeTicks gcStart = base::TimeTicks::Now();
     m_frame->GetGCPool().CollectGarbage();
+    m_metrics->AddGCTime(base::TimeTicks::Now() - gcStart);
+
     m_client.DocumentReady(m_client.UserData);
+    if (m_readinessTracker)
+        m_readinessTracker->Start();
+}
+
+int CrawlerImpl::ExtractText(const char *selector, unsigned flags, std::string &dst)
+{
+    ContainerNode *node = nullptr;
+    int r = QueryContainer(selector, node);
+    if (BK_ERR_SUCCESS != r)
+        return r;
+
+    unsigned options = 0;
+    if (flags & BK_TEXT_BLOCK_BOUNDARIES)
+        options |= TextExtractor::kBlockBoundaries;
+    if (flags & BK_TEXT_LINK_ANNOTATIONS)
+        options |= TextExtractor::kLinkAnnotations;
+    dst = node->VisibleText(options).StdUtf8();
+    return BK_ERR_SUCCESS;
 }
 
 std::string CrawlerImpl::GetConfig(int cfg) const
@@ -66,11 +179,77 @@ std::string CrawlerImpl::GetConfig(int cfg) const
     return ret;
 }
 
+Document* CrawlerImpl::GetDocument(void) const
+{
+    return m_frame->GetDocument();
+}
+
+void CrawlerImpl::GetMetrics(BkCrawlerMetrics &dst) const
+{
+    m_metrics->Fill(dst);
+
+    dst.PeakDOMNodes = 0;
+    if (Document *document = m_frame->GetDocument())
+        dst.PeakDOMNodes = document->PeakNodeCount();
+
+    dst.JSHeapSize = 0;
+    if (ContextImpl *context = m_frame->GetScriptController().GetContext())
+        dst.JSHeapSize = context->HeapSize();
+}
+
 BkJSContext CrawlerImpl::GetScriptContext(void)
 {
     return &(m_frame->GetScriptController().EnsureContext());
 }
 
+int CrawlerImpl::HarvestLinks(const BkLinkHarvestOptions *options, std::string &dst)
+{
+    BkLinkHarvestOptions o;
+    memset(&o, 0, sizeof(BkLinkHarvestOptions));
+    if (nullptr != options)
+    {
+        size_t size = sizeof(BkLinkHarvestOptions);
+        if (options->SizeOfStruct < size)
+            size = options->SizeOfStruct;
+        memcpy(&o, options, size);
+    }
+
+    Document *document = m_frame->GetDocument();
+    if (nullptr == document)
+        return BK_ERR_NOT_FOUND;
+
+    std::regex pattern;
+    if (nullptr != o.Pattern)
+    {
+        try
+        {
+            pattern.assign(o.Pattern, std::regex::ECMAScript | std::regex::optimize);
+        }
+        catch (const std::regex_error &e)
+        {
+            BKLOG("Invalid pattern: %s, %s", o.Pattern, e.what());
+            return BK_ERR_SYNTAX;
+        }
+    }
+
+    if (0 == o.Kinds)
+        o.Kinds = BK_LINK_ALL;
+
+    unsigned kinds = 0;
+    if (o.Kinds & BK_LINK_ANCHORS)
+        kinds |= LinkHarvester::kAnchors;
+    if (o.Kinds & BK_LINK_RESOURCES)
+        kinds |= LinkHarvester::kResources;
+    if (o.Kinds & BK_LINK_FORMS)
+        kinds |= LinkHarvester::kForms;
+    if (o.Kinds & BK_LINK_REFRESHES)
+        kinds |= LinkHarvester::kRefreshes;
+
+    LinkHarvester harvester(kinds, o.SameHostOnly, nullptr != o.Pattern ? &pattern : nullptr);
+    dst = harvester.Harvest(*document);
+    return BK_ERR_SUCCESS;
+}
+
 bool CrawlerImpl::HijackRequest(const char *URL, std::string &dst) const
 {
     if (nullptr == m_client.HijackRequest)
@@ -124,6 +303,50 @@ int BKAPI CrawlerImpl::RegisterCrawlerFunction(const char *name, BkCallback &fun
 }
 #endif // 0
 
+int CrawlerImpl::QueryContainer(const char *selector, ContainerNode *&dst) const
+{
+    Document *document = m_frame->GetDocument();
+    if (nullptr == document)
+        return BK_ERR_NOT_FOUND;
+
+    if (nullptr == selector)
+    {
+        dst = document;
+        return BK_ERR_SUCCESS;
+    }
+
+    TrackExceptionState exceptionState;
+    Element *element = document->querySelector(AtomicString::FromUTF8(selector), exceptionState);
+    if (exceptionState.HadException())
+        return BK_ERR_SYNTAX;
+    if (nullptr == element)
+        return BK_ERR_NOT_FOUND;
+
+    dst = element;
+    return BK_ERR_SUCCESS;
+}
+
+int CrawlerImpl::Recycle(const char *URL)
+{
+    BkURL u(URL);
+    if (!u.SchemeIsHTTPOrHTTPS())
+    {
+        BKLOG("Invalid URL: %s", URL);
+        return BK_ERR_URI;
+    }
+
+    // The frame, the script heap with the crawler object and the caches are
+    // kept, only the previous job is dropped. The global object is replaced
+    // when the new document is installed.
+    m_frame->Loader().StopAllLoaders();
+    if (ContextImpl *context = m_frame->GetScriptController().GetContext())
+        context->CollectGarbage();
+    m_frame->GetGCPool().CollectGarbage();
+
+    StartNavigation(u);
+    return BK_ERR_SUCCESS;
+}
+
 int CrawlerImpl::Run(const char *URL)
 {
     BkURL u(URL);
@@ -133,11 +356,69 @@ int CrawlerImpl::Run(const char *URL)
         return BK_ERR_URI;
     }
 
-    FrameLoadRequest request(nullptr, ResourceRequest(u));
+    StartNavigation(u);
+    return BK_ERR_SUCCESS;
+}
+
+int CrawlerImpl::Serialize(const BkSerializationOptions *options, const std::function<bool(const char *, size_t)> &sink)
+{
+    BkSerializationOptions o;
+    memset(&o, 0, sizeof(BkSerializationOptions));
+    if (nullptr != options)
+    {
+        size_t size = sizeof(BkSerializationOptions);
+        if (options->SizeOfStruct < size)
+            size = options->SizeOfStruct;
+        memcpy(&o, options, size);
+    }
+
+    ContainerNode *node = nullptr;
+    int r = QueryContainer(o.Selector, node);
+    if (BK_ERR_SUCCESS != r)
+        return r;
+
+    unsigned flags = 0;
+    if (o.Flags & BK_SERIALIZE_STRIP_SCRIPTS)
+        flags |= StreamingMarkupSerializer::kStripScripts;
+    if (o.Flags & BK_SERIALIZE_STRIP_STYLES)
+        flags |= StreamingMarkupSerializer::kStripStyles;
+    if (o.Flags & BK_SERIALIZE_STRIP_COMMENTS)
+        flags |= StreamingMarkupSerializer::kStripComments;
+
+    size_t chunkSize = 0 != o.ChunkSize ? o.ChunkSize : StreamingMarkupSerializer::kDefaultChunkSize;
+    StreamingMarkupSerializer serializer(sink, flags, chunkSize);
+    EChildrenOnly childrenOnly = node->IsDocumentNode() ? kChildrenOnly : kIncludeNode;
+    return serializer.Serialize(*node, childrenOnly) ? BK_ERR_SUCCESS : BK_ERR_CANCELLED;
+}
+
+void CrawlerImpl::SetRequestFilter(const BkRequestFilterRule *rules, size_t count)
+{
+    if (0 == count)
+        m_requestFilter.reset();
+    else
+        m_requestFilter = std::make_unique<RequestFilter>(rules, count);
+}
+
+void CrawlerImpl::SetReadinessOptions(const BkReadinessOptions &options)
+{
+    if (m_readinessTracker)
+        m_readinessTracker->SetOptions(options);
+}
+
+void CrawlerImpl::StartNavigation(const BkURL &URL)
+{
+    if (m_readinessTracker)
+        m_readinessTracker->Stop();
+    m_metrics->DidStartNavigation();
+    m_memoryBudget->DidStartNavigation();
+    // The tasks of an aborted job keep the old flag.
+    if (*m_jobAborted)
+        m_jobAborted = std::make_shared<bool>(false);
+
+    FrameLoadRequest request(nullptr, ResourceRequest(URL));
     request.GetResourceRequest().SetCrawler(this);
     request.GetResourceRequest().SetHijackType(HijackType::kMainHTML);
     m_frame->Loader().StartNavigation(request);
-    return BK_ERR_SUCCESS;
 }
 
 void CrawlerImpl::TransitionToCommittedForNewPage(void)
@@ -157,8 +438,35 @@ String CrawlerImpl::UserAgent(void)
     return LocalFrameClientImpl::UserAgent();
 }
 
+base::TimeDelta CrawlerImpl::VirtualTimeBudget(void) const
+{
+    std::string s = GetConfig(BK_CFG_VIRTUAL_TIME_BUDGET);
+    if (s.empty())
+        return base::TimeDelta();
+    return base::TimeDelta::FromMilliseconds(strtoull(s.c_str(), nullptr, 10));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static bool WriteToFile(int fd, const char *data, size_t size)
+{
+    while (size > 0)
+    {
+#if OS_WIN
+        int n = _write(fd, data, static_cast<unsigned>(size));
+#else
+        ssize_t n = write(fd, data, size);
+        if (n < 0 && EINTR == errno)
+            continue;
+#endif
+        if (n <= 0)
+            return false;
+        data += n;
+        size -= n;
+    }
+    return true;
+}
+
 extern "C" {
 
 BKEXPORT BkCrawler BKAPI BkCreateCrawler(BkCrawlerClient *client)
@@ -171,19 +479,148 @@ BKEXPORT void BKAPI BkDestroyCrawler(BkCrawler crawler)
     delete crawler;
 }
 
+BKEXPORT int BKAPI BkExtractText(BkCrawler crawler, const char *selector, unsigned flags, BkBuffer *dst)
+{
+    std::string text;
+    int r = crawler->ExtractText(selector, flags, text);
+    if (BK_ERR_SUCCESS == r)
+        BkSetBufferData(dst, text.data(), text.length());
+    return r;
+}
+
+BKEXPORT void BKAPI BkGetMemoryCacheStatistics(BkMemoryCacheStatistics *statistics)
+{
+    MemoryCache::Statistics s = GetMemoryCache()->GetStatistics();
+
+    BkMemoryCacheStatistics st;
+    memset(&st, 0, sizeof(BkMemoryCacheStatistics));
+    st.SizeOfStruct = statistics->SizeOfStruct;
+    st.Capacity = s.capacity;
+    st.Size = s.size;
+    st.Count = s.count;
+    st.Hits = s.hits;
+    st.Misses = s.misses;
+    st.Evictions = s.evictions;
+    st.Insertions = s.insertions;
+
+    // Clients built against older headers may pass shorter structs.
+    size_t size = sizeof(BkMemoryCacheStatistics);
+    if (statistics->SizeOfStruct < size)
+        size = statistics->SizeOfStruct;
+    memcpy(statistics, &st, size);
+}
+
+BKEXPORT size_t BKAPI BkGetMemoryUsage(BkCrawler crawler)
+{
+    if (nullptr == crawler)
+        return MemoryGovernor::Shared().Usage();
+    return crawler->Memory().Usage();
+}
+
+BKEXPORT void BKAPI BkGetCrawlerMetrics(BkCrawler crawler, BkCrawlerMetrics *metrics)
+{
+    BkCrawlerMetrics m;
+    memset(&m, 0, sizeof(BkCrawlerMetrics));
+    crawler->GetMetrics(m);
+
+    // Clients built against older headers may pass shorter structs.
+    size_t size = sizeof(BkCrawlerMetrics);
+    if (metrics->SizeOfStruct < size)
+        size = metrics->SizeOfStruct;
+    m.SizeOfStruct = metrics->SizeOfStruct;
+    memcpy(metrics, &m, size);
+}
+
 BKEXPORT BkJSContext BKAPI BkGetScriptContextFromCrawler(BkCrawler crawler)
 {
     return crawler->GetScriptContext();
 }
 
+BKEXPORT int BKAPI BkHarvestLinks(BkCrawler crawler, const BkLinkHarvestOptions *options, BkBuffer *dst)
+{
+    std::string links;
+    int r = crawler->HarvestLinks(options, links);
+    if (BK_ERR_SUCCESS == r)
+        BkSetBufferData(dst, links.data(), links.length());
+    return r;
+}
+
 BKEXPORT void BKAPI BkHijackResponse(BkResponse response, const void *newBody, size_t length)
 {
     response->Hijack(newBody, length);
 }
 
+BKEXPORT int BKAPI BkRecycleCrawler(BkCrawler crawler, const char *URL)
+{
+    return crawler->Recycle(URL);
+}
+
 BKEXPORT int BKAPI BkRunCrawler(BkCrawler crawler, const char *URL)
 {
     return crawler->Run(URL);
 }
 
+BKEXPORT int BKAPI BkSerializeDocument(BkCrawler crawler, const BkSerializationOptions *options,
+    BkSerializationSink sink, void *userData)
+{
+    return crawler->Serialize(options, [sink, userData](const char *data, size_t size) {
+        return sink(data, size, userData);
+    });
+}
+
+BKEXPORT int BKAPI BkSerializeDocumentToBuffer(BkCrawler crawler, const BkSerializationOptions *options, BkBuffer *dst)
+{
+    std::string markup;
+    int r = crawler->Serialize(options, [&markup](const char *data, size_t size) {
+        markup.append(data, size);
+        return true;
+    });
+    if (BK_ERR_SUCCESS == r)
+        BkSetBufferData(dst, markup.data(), markup.length());
+    return r;
+}
+
+BKEXPORT int BKAPI BkSerializeDocumentToFile(BkCrawler crawler, const BkSerializationOptions *options, int fd)
+{
+    return crawler->Serialize(options, std::bind(WriteToFile, fd, std::placeholders::_1, std::placeholders::_2));
+}
+
+BKEXPORT void BKAPI BkSetMemoryCacheCapacity(size_t capacity)
+{
+    GetMemoryCache()->SetCapacity(capacity);
+}
+
+BKEXPORT void BKAPI BkSetMemoryLimits(const BkMemoryLimits *limits)
+{
+    BkMemoryLimits l;
+    memset(&l, 0, sizeof(BkMemoryLimits));
+    if (nullptr != limits)
+    {
+        size_t size = sizeof(BkMemoryLimits);
+        if (limits->SizeOfStruct < size)
+            size = limits->SizeOfStruct;
+        memcpy(&l, limits, size);
+    }
+    MemoryGovernor::Shared().SetLimits(l);
+}
+
+BKEXPORT void BKAPI BkSetReadinessOptions(BkCrawler crawler, const BkReadinessOptions *options)
+{
+    BkReadinessOptions o;
+    memset(&o, 0, sizeof(BkReadinessOptions));
+    if (nullptr != options)
+    {
+        size_t size = sizeof(BkReadinessOptions);
+        if (options->SizeOfStruct < size)
+            size = options->SizeOfStruct;
+        memcpy(&o, options, size);
+    }
+    crawler->SetReadinessOptions(o);
+}
+
+BKEXPORT void BKAPI BkSetRequestFilter(BkCrawler crawler, const BkRequestFilterRule *rules, size_t count)
+{
+    crawler->SetRequestFilter(rules, count);
+}
+
 } // extern "C"
@@ -15,9 +15,24 @@
 #pragma once
 
 #include <functional>
+#include "base/time/time.h"
 #include "bk_crawler.h"
 #include "blinkit/blink_impl/local_frame_client_impl.h"
 
+namespace blink {
+class ContainerNode;
+class Document;
+enum class ResourceType : uint8_t;
+}
+
+namespace BlinKit {
+class BkURL;
+class CrawlerMetrics;
+class MemoryBudget;
+class ReadinessTracker;
+class RequestFilter;
+}
+
 class CrawlerImpl final : public BlinKit::LocalFrameClientImpl
 {
 public:
@@ -31,11 +46,39 @@ public:
     void HijackResponse(BkResponse response);
     bool ApplyConsoleMessager(std::function<void(int, const char *)> &dst) const;
     void ProcessDocumentReset(void);
+    // Zero if timers run in real time.
+    base::TimeDelta VirtualTimeBudget(void) const;
+
+    // Hijacked bodies are private to the crawler, so they never go through
+    // the shared memory cache.
+    bool AllowsSharedCache(void) const;
+    // Checks subresource requests against the filter set by the client.
+    bool AllowsRequest(blink::ResourceType type, const BlinKit::BkURL &URL) const;
+    // Called on the main thread by HTTP loader tasks, for readiness tracking.
+    void DidStartRequest(void);
+    void DidFinishRequest(void);
+    // Counters of the current job, fed by the loaders, the parser and the
+    // script context.
+    BlinKit::CrawlerMetrics& Metrics(void) { return *m_metrics; }
+    BlinKit::MemoryBudget& Memory(void) { return *m_memoryBudget; }
+    // Set once the current job is stopped, e.g. for memory. The loader tasks
+    // of the job keep it, and drop their deliveries once it is set, since
+    // transfers in flight cannot be cancelled.
+    std::shared_ptr<const bool> JobAborted(void) const { return m_jobAborted; }
+    // Null before the first navigation is committed.
+    blink::Document* GetDocument(void) const;
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Exports
     int Run(const char *URL);
+    int Recycle(const char *URL);
     BkJSContext GetScriptContext(void);
+    int Serialize(const BkSerializationOptions *options, const std::function<bool(const char *, size_t)> &sink);
+    int ExtractText(const char *selector, unsigned flags, std::string &dst);
+    int HarvestLinks(const BkLinkHarvestOptions *options, std::string &dst);
+    void SetRequestFilter(const BkRequestFilterRule *rules, size_t count);
+    void SetReadinessOptions(const BkReadinessOptions &options);
+    void GetMetrics(BkCrawlerMetrics &dst) const;
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if 0 // BKTODO:
@@ -49,6 +92,11 @@ private:
     int BKAPI RegisterCrawlerFunction(const char *name, BkCallback &functionImpl) override;
     int BKAPI AccessCrawlerMember(const char *name, BkCallback &callback) override;
 #endif
+    void StartNavigation(const BlinKit::BkURL &URL);
+    void AbortForMemory(size_t usage);
+    // The document, or the first element matched by |selector| if it is not null.
+    int QueryContainer(const char *selector, blink::ContainerNode *&dst) const;
+
     // LocalFrameClient
     bool IsCrawler(void) const override { return true; }
     String UserAgent(void) override;
@@ -59,6 +107,11 @@ private:
 
     BkCrawlerClient m_client;
     std::unique_ptr<blink::LocalFrame> m_frame;
+    std::unique_ptr<BlinKit::RequestFilter> m_requestFilter;
+    std::unique_ptr<BlinKit::ReadinessTracker> m_readinessTracker;
+    std::unique_ptr<BlinKit::CrawlerMetrics> m_metrics;
+    std::unique_ptr<BlinKit::MemoryBudget> m_memoryBudget;
+    std::shared_ptr<bool> m_jobAborted;
 };
 
 DEFINE_TYPE_CASTS(CrawlerImpl, ::blink::LocalFrameClient, client, client->IsCrawler(), client.IsCrawler());
@@ -0,0 +1,111 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: crawler_metrics.cpp
+// Description: CrawlerMetrics Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "crawler_metrics.h"
+
+#include "blinkit/crawler/crawler_impl.h"
+#include "blinkit/crawler/request_filter.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource.h"
+
+using namespace blink;
+
+namespace BlinKit {
+
+CrawlerMetrics::CrawlerMetrics(void)
+{
+    DidStartNavigation();
+}
+
+void CrawlerMetrics::DidFinishRequest(ResourceType type, size_t bytes, base::TimeTicks firstByteTime)
+{
+    ResourceMetricsFor(type).Bytes += bytes;
+    if (ResourceType::kMainResource == type && m_timeToFirstByte.is_zero())
+        m_timeToFirstByte = firstByteTime - m_navigationStart;
+}
+
+void CrawlerMetrics::DidStartNavigation(void)
+{
+    m_navigationStart = base::TimeTicks::Now();
+    m_timeToFirstByte = base::TimeDelta();
+
+    memset(&m_document, 0, sizeof(BkResourceMetrics));
+    m_scripts = m_styleSheets = m_images = m_fonts = m_media = m_XHR = m_others = m_document;
+    m_blockedRequests = m_cachedRequests = 0;
+
+    m_decodeTime = m_parseTime = m_scriptTime = m_gcTime = base::TimeDelta();
+}
+
+void CrawlerMetrics::DidStartRequest(ResourceType type)
+{
+    ++ResourceMetricsFor(type).Requests;
+}
+
+void CrawlerMetrics::Fill(BkCrawlerMetrics &dst) const
+{
+    dst.TimeToFirstByte = m_timeToFirstByte.InMillisecondsF();
+    dst.Document = m_document;
+    dst.Scripts = m_scripts;
+    dst.StyleSheets = m_styleSheets;
+    dst.Images = m_images;
+    dst.Fonts = m_fonts;
+    dst.Media = m_media;
+    dst.XHR = m_XHR;
+    dst.Others = m_others;
+    dst.BlockedRequests = m_blockedRequests;
+    dst.CachedRequests = m_cachedRequests;
+    dst.DecodeTime = m_decodeTime.InMillisecondsF();
+    dst.ParseTime = m_parseTime.InMillisecondsF();
+    dst.ScriptTime = m_scriptTime.InMillisecondsF();
+    dst.GCTime = m_gcTime.InMillisecondsF();
+}
+
+CrawlerMetrics* CrawlerMetrics::From(const Document &document)
+{
+    LocalFrame *frame = document.GetFrame();
+    return nullptr != frame ? From(*frame) : nullptr;
+}
+
+CrawlerMetrics* CrawlerMetrics::From(const LocalFrame &frame)
+{
+    LocalFrameClient *client = frame.Client();
+    if (nullptr == client || !client->IsCrawler())
+        return nullptr;
+    return &ToCrawlerImpl(client)->Metrics();
+}
+
+BkResourceMetrics& CrawlerMetrics::ResourceMetricsFor(ResourceType type)
+{
+    if (ResourceType::kMainResource == type)
+        return m_document;
+
+    // The same classes as the request filter, see RequestFilter::ResourceKindOf.
+    switch (RequestFilter::ResourceKindOf(type))
+    {
+        case BK_RESOURCE_SCRIPT:
+            return m_scripts;
+        case BK_RESOURCE_STYLESHEET:
+            return m_styleSheets;
+        case BK_RESOURCE_IMAGE:
+            return m_images;
+        case BK_RESOURCE_FONT:
+            return m_fonts;
+        case BK_RESOURCE_MEDIA:
+            return m_media;
+        case BK_RESOURCE_XHR:
+            return m_XHR;
+        default:
+            return m_others;
+    }
+}
+
+} // namespace BlinKit
@@ -0,0 +1,66 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: crawler_metrics.h
+// Description: CrawlerMetrics Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_CRAWLER_METRICS_H
+#define BLINKIT_BLINKIT_CRAWLER_METRICS_H
+
+#pragma once
+
+#include "base/time/time.h"
+#include "bk_crawler.h"
+
+namespace blink {
+class Document;
+class LocalFrame;
+enum class ResourceType : uint8_t;
+}
+
+namespace BlinKit {
+
+// Counters of the current job of a crawler, fed from the loaders, the parser
+// and the script context. All of them run on the main thread, so plain
+// counters do.
+class CrawlerMetrics
+{
+public:
+    CrawlerMetrics(void);
+
+    // Null if the document or frame does not belong to a crawler.
+    static CrawlerMetrics* From(const blink::Document &document);
+    static CrawlerMetrics* From(const blink::LocalFrame &frame);
+
+    void DidStartNavigation(void);
+
+    void DidStartRequest(blink::ResourceType type);
+    void DidFinishRequest(blink::ResourceType type, size_t bytes, base::TimeTicks firstByteTime);
+    void DidBlockRequest(void) { ++m_blockedRequests; }
+    void DidLoadFromMemoryCache(void) { ++m_cachedRequests; }
+
+    void AddDecodeTime(base::TimeDelta t) { m_decodeTime = m_decodeTime + t; }
+    void AddParseTime(base::TimeDelta t) { m_parseTime = m_parseTime + t; }
+    void AddScriptTime(base::TimeDelta t) { m_scriptTime = m_scriptTime + t; }
+    void AddGCTime(base::TimeDelta t) { m_gcTime = m_gcTime + t; }
+
+    // Fills everything but the DOM and heap sizes, which are not counted here.
+    void Fill(BkCrawlerMetrics &dst) const;
+private:
+    BkResourceMetrics& ResourceMetricsFor(blink::ResourceType type);
+
+    base::TimeTicks m_navigationStart;
+    base::TimeDelta m_timeToFirstByte;
+    BkResourceMetrics m_document, m_scripts, m_styleSheets, m_images, m_fonts, m_media, m_XHR, m_others;
+    unsigned m_blockedRequests, m_cachedRequests;
+    base::TimeDelta m_decodeTime, m_parseTime, m_scriptTime, m_gcTime;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_CRAWLER_METRICS_H
@@ -0,0 +1,223 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: link_harvester.cpp
+// Description: LinkHarvester Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "link_harvester.h"
+
+#include <string_view>
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element_traversal.h"
+#include "third_party/blink/renderer/core/html/parser/html_parser_idioms.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/platform/network/http_parsers.h"
+
+using namespace blink;
+
+namespace BlinKit {
+
+static bool IsSpace(char c)
+{
+    return IsHTMLSpace<LChar>(static_cast<LChar>(c));
+}
+
+LinkHarvester::LinkHarvester(unsigned kinds, bool sameHostOnly, const std::regex *pattern)
+    : m_kinds(kinds)
+    , m_sameHostOnly(sameHostOnly)
+    , m_pattern(pattern)
+    , m_seen(0, SliceHash{ &m_result }, SliceEqual{ &m_result })
+{
+}
+
+void LinkHarvester::Add(std::string_view value)
+{
+    BkURL URL = m_resolver.Resolve(value);
+    if (!URL.IsValid() || !URL.SchemeIsHTTPOrHTTPS())
+        return;
+
+    URL = URL.StripFragmentIdentifier();
+    if (m_sameHostOnly && URL.HostPiece() != m_host)
+        return;
+
+    // Appended first, so that the lookup needs no temporary key.
+    const std::string &s = URL.AsString();
+    const Slice slice = { m_result.length(), s.length() };
+    m_result.append(s);
+
+    bool accepted = std::end(m_seen) == m_seen.find(slice);
+    if (accepted && nullptr != m_pattern)
+        accepted = std::regex_search(s, *m_pattern);
+
+    if (accepted)
+    {
+        m_seen.insert(slice);
+        m_result.push_back('\n');
+    }
+    else
+    {
+        m_result.resize(slice.offset);
+    }
+}
+
+void LinkHarvester::AddAttribute(const Element &element, const QualifiedName &name)
+{
+    const AtomicString &value = element.FastGetAttribute(name);
+    if (!value.IsEmpty())
+        Add(value.GetString().StdUtf8());
+}
+
+void LinkHarvester::AddSrcset(const String &srcset)
+{
+    // https://html.spec.whatwg.org/multipage/images.html#parse-a-srcset-attribute
+    const std::string s = srcset.StdUtf8();
+    const char *p = s.data();
+    const char *end = p + s.length();
+    while (p < end)
+    {
+        while (p < end && (IsSpace(*p) || ',' == *p))
+            ++p;
+
+        const char *URL = p;
+        while (p < end && !IsSpace(*p))
+            ++p;
+        const char *URLEnd = p;
+        if (URLEnd > URL && ',' == URLEnd[-1])
+        {
+            // A trailing comma ends the candidate, which has no descriptors.
+            while (URLEnd > URL && ',' == URLEnd[-1])
+                --URLEnd;
+        }
+        else
+        {
+            // Skips the descriptors, which may contain commas in parentheses.
+            bool inParens = false;
+            for (; p < end; ++p)
+            {
+                if ('(' == *p)
+                    inParens = true;
+                else if (')' == *p)
+                    inParens = false;
+                else if (',' == *p && !inParens)
+                    break;
+            }
+        }
+
+        if (URLEnd > URL)
+            Add(std::string_view(URL, URLEnd - URL));
+    }
+}
+
+std::string LinkHarvester::Harvest(const Document &document)
+{
+    m_resolver = BkURLResolver(document.BaseURL());
+    if (m_sameHostOnly)
+        m_host = document.Url().Host();
+
+    for (const Element *e = ElementTraversal::FirstWithin(document); nullptr != e; e = ElementTraversal::Next(*e))
+    {
+        if (e->IsHTMLElement())
+            ProcessElement(*e);
+    }
+    return std::move(m_result);
+}
+
+void LinkHarvester::ProcessElement(const Element &element)
+{
+    using namespace html_names;
+
+    if (element.HasTagName(kATag) || element.HasTagName(kAreaTag))
+    {
+        if (m_kinds & kAnchors)
+            AddAttribute(element, kHrefAttr);
+        return;
+    }
+
+    if (element.HasTagName(kLinkTag))
+    {
+        ProcessLink(element);
+        return;
+    }
+
+    if (m_kinds & kResources)
+    {
+        if (element.HasTagName(kImgTag) || element.HasTagName(kSourceTag))
+        {
+            AddAttribute(element, kSrcAttr);
+            const AtomicString &srcset = element.FastGetAttribute(kSrcsetAttr);
+            if (!srcset.IsEmpty())
+                AddSrcset(srcset);
+            return;
+        }
+
+        if (element.HasTagName(kScriptTag) || element.HasTagName(kIFrameTag) || element.HasTagName(kFrameTag)
+            || element.HasTagName(kEmbedTag) || element.HasTagName(kTrackTag))
+        {
+            AddAttribute(element, kSrcAttr);
+            return;
+        }
+
+        if (element.HasTagName(kVideoTag))
+        {
+            AddAttribute(element, kSrcAttr);
+            AddAttribute(element, kPosterAttr);
+            return;
+        }
+    }
+
+    if (element.HasTagName(kFormTag))
+    {
+        if (m_kinds & kForms)
+            AddAttribute(element, kActionAttr);
+        return;
+    }
+
+    if (element.HasTagName(kMetaTag) && (m_kinds & kRefreshes))
+    {
+        if (!EqualIgnoringASCIICase(element.FastGetAttribute(kHttpEquivAttr), "refresh"))
+            return;
+
+        double delay;
+        String URL;
+        if (ParseHTTPRefresh(element.FastGetAttribute(kContentAttr), IsHTMLSpace<UChar>, delay, URL) && !URL.IsEmpty())
+            Add(URL.StdUtf8());
+    }
+}
+
+void LinkHarvester::ProcessLink(const Element &element)
+{
+    static const char *kResourceRelations[] = {
+        "icon", "manifest", "prefetch", "preload", "stylesheet"
+    };
+
+    const AtomicString &rel = element.FastGetAttribute(html_names::kRelAttr);
+    unsigned kind = kAnchors;
+    for (const char *relation : kResourceRelations)
+    {
+        if (kNotFound != rel.FindIgnoringASCIICase(relation))
+        {
+            kind = kResources;
+            break;
+        }
+    }
+
+    if (m_kinds & kind)
+        AddAttribute(element, html_names::kHrefAttr);
+}
+
+size_t LinkHarvester::SliceHash::operator()(const Slice &s) const
+{
+    return std::hash<std::string_view>()(std::string_view(result->data() + s.offset, s.length));
+}
+
+bool LinkHarvester::SliceEqual::operator()(const Slice &a, const Slice &b) const
+{
+    return a.length == b.length && 0 == result->compare(a.offset, a.length, *result, b.offset, b.length);
+}
+
+} // namespace BlinKit
@@ -0,0 +1,79 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: link_harvester.h
+// Description: LinkHarvester Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_LINK_HARVESTER_H
+#define BLINKIT_BLINKIT_LINK_HARVESTER_H
+
+#pragma once
+
+#include <regex>
+#include <unordered_set>
+#include "blinkit/common/bk_url.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+
+namespace blink {
+class Document;
+class Element;
+class QualifiedName;
+}
+
+namespace BlinKit {
+
+// Collects the URLs referenced by a document in one walk. URLs are resolved
+// against the document base URL, stripped of fragments and deduplicated. Only
+// HTTP(S) URLs are collected.
+class LinkHarvester
+{
+public:
+    enum Kinds {
+        kAnchors   = 0x1, // <a>, <area> and navigational <link>s.
+        kResources = 0x2, // src, srcset, poster and stylesheet/icon/preload <link>s.
+        kForms     = 0x4, // <form action>.
+        kRefreshes = 0x8, // <meta http-equiv="refresh">.
+    };
+
+    LinkHarvester(unsigned kinds, bool sameHostOnly, const std::regex *pattern);
+
+    // Returns the URLs in document order, each followed by a '\n'.
+    std::string Harvest(const blink::Document &document);
+private:
+    void ProcessElement(const blink::Element &element);
+    void ProcessLink(const blink::Element &element);
+    void AddAttribute(const blink::Element &element, const blink::QualifiedName &name);
+    void AddSrcset(const String &srcset);
+    void Add(std::string_view value);
+
+    const unsigned m_kinds;
+    const bool m_sameHostOnly;
+    const std::regex *m_pattern;
+
+    BkURLResolver m_resolver;
+    std::string m_host;
+
+    // Entries are slices of m_result, so each URL is only stored once.
+    struct Slice {
+        size_t offset, length;
+    };
+    struct SliceHash {
+        const std::string *result;
+        size_t operator()(const Slice &s) const;
+    };
+    struct SliceEqual {
+        const std::string *result;
+        bool operator()(const Slice &a, const Slice &b) const;
+    };
+    std::string m_result;
+    std::unordered_set<Slice, SliceHash, SliceEqual> m_seen;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_LINK_HARVESTER_H
@@ -0,0 +1,150 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: memory_budget.cpp
+// Description: MemoryBudget Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "memory_budget.h"
+
+#include <algorithm>
+#include "blinkit/common/bk_segmented_buffer.h"
+#include "blinkit/crawler/crawler_impl.h"
+#include "blinkit/crawler/crawler_metrics.h"
+#include "blinkit/js/context_impl.h"
+#include "blinkit/misc/memory_governor.h"
+#include "third_party/blink/renderer/bindings/core/duk/script_controller.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/platform/bindings/gc_pool.h"
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache.h"
+
+using namespace blink;
+
+namespace BlinKit {
+
+// Nodes are not allocated through a hook of their own, so the DOM is estimated
+// from the node count, with a rough average of a node and its attributes.
+static const size_t BytesPerNode = 256;
+
+MemoryBudget::MemoryBudget(LocalFrame &frame, CrawlerMetrics &metrics, const std::function<void(size_t)> &callback)
+    : m_frame(frame)
+    , m_metrics(metrics)
+    , m_callback(callback)
+    , m_pressureTimer(frame.GetTaskRunner(TaskType::kInternalDefault), this, &MemoryBudget::PressureTimerFired)
+{
+    MemoryGovernor::Shared().AddCrawler();
+}
+
+MemoryBudget::~MemoryBudget(void)
+{
+    MemoryGovernor &governor = MemoryGovernor::Shared();
+    governor.Update(m_usage, 0);
+    governor.RemoveCrawler();
+}
+
+void MemoryBudget::Checkpoint(void)
+{
+    if (m_exceeded)
+        return;
+
+    UpdateUsage();
+    if (IsOverLimit() && !m_pressureTimer.IsActive())
+        m_pressureTimer.StartOneShot(TimeDelta(), FROM_HERE);
+}
+
+void MemoryBudget::DidReceiveBody(const BkSegmentedBuffer &body)
+{
+    for (const BkSegmentedBuffer::Segment &segment : body.Segments())
+        m_bodySegments.emplace_back(segment, segment->length());
+}
+
+void MemoryBudget::CollectGarbage(void)
+{
+    TimeTicks start = TimeTicks::Now();
+
+    if (ContextImpl *context = m_frame.GetScriptController().GetContext())
+        context->CollectGarbage();
+    // Pooled nodes may still be referred to by the parser.
+    Document *document = m_frame.GetDocument();
+    if (nullptr == document || !document->Parsing())
+        m_frame.GetGCPool().CollectGarbage();
+    // Decoded copies in the cache are not counted for any crawler, but the
+    // process pays for them all the same.
+    if (MemoryGovernor::Shared().IsOverProcessLimit())
+        GetMemoryCache()->EvictResources();
+
+    m_metrics.AddGCTime(TimeTicks::Now() - start);
+}
+
+MemoryBudget* MemoryBudget::From(const Document &document)
+{
+    LocalFrame *frame = document.GetFrame();
+    return nullptr != frame ? From(*frame) : nullptr;
+}
+
+MemoryBudget* MemoryBudget::From(const LocalFrame &frame)
+{
+    LocalFrameClient *client = frame.Client();
+    if (nullptr == client || !client->IsCrawler())
+        return nullptr;
+    return &ToCrawlerImpl(client)->Memory();
+}
+
+bool MemoryBudget::IsOverLimit(void) const
+{
+    const MemoryGovernor &governor = MemoryGovernor::Shared();
+
+    const size_t crawlerLimit = governor.CrawlerLimit();
+    if (0 != crawlerLimit && m_usage > crawlerLimit)
+        return true;
+
+    return governor.IsOverProcessLimit() && m_usage > governor.FairShare();
+}
+
+size_t MemoryBudget::Measure(void)
+{
+    size_t ret = 0;
+    auto released = [&ret](const std::pair<std::weak_ptr<const std::string>, size_t> &segment) {
+        if (segment.first.expired())
+            return true;
+        ret += segment.second;
+        return false;
+    };
+    m_bodySegments.erase(std::remove_if(m_bodySegments.begin(), m_bodySegments.end(), released),
+        m_bodySegments.end());
+
+    if (Document *document = m_frame.GetDocument())
+        ret += document->NodeCount() * BytesPerNode;
+    if (ContextImpl *context = m_frame.GetScriptController().GetContext())
+        ret += context->HeapSize();
+    return ret;
+}
+
+void MemoryBudget::PressureTimerFired(TimerBase *)
+{
+    UpdateUsage();
+    if (!IsOverLimit())
+        return;
+
+    CollectGarbage();
+    UpdateUsage();
+    if (!IsOverLimit())
+        return;
+
+    m_exceeded = true;
+    m_callback(m_usage);
+}
+
+void MemoryBudget::UpdateUsage(void)
+{
+    size_t usage = Measure();
+    MemoryGovernor::Shared().Update(m_usage, usage);
+    m_usage = usage;
+}
+
+} // namespace BlinKit
@@ -0,0 +1,79 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: memory_budget.h
+// Description: MemoryBudget Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_MEMORY_BUDGET_H
+#define BLINKIT_BLINKIT_MEMORY_BUDGET_H
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include "third_party/blink/renderer/platform/timer.h"
+
+namespace blink {
+class Document;
+class LocalFrame;
+}
+
+namespace BlinKit {
+
+class BkSegmentedBuffer;
+class CrawlerMetrics;
+
+// Keeps the memory of a crawler within the limits of the governor. The usage
+// is the response bodies received which are still alive, the DOM and the
+// script heap, measured at checkpoints: when a request finishes, after each
+// parser pump and after each script. Going over a limit is handled on a new
+// task, where garbage is collected first, and the callback is called if that
+// does not help. Under process pressure, only the crawlers over their fair
+// share are collected and aborted.
+class MemoryBudget
+{
+public:
+    // |callback| takes the usage in bytes.
+    MemoryBudget(blink::LocalFrame &frame, CrawlerMetrics &metrics, const std::function<void(size_t)> &callback);
+    ~MemoryBudget(void);
+
+    // Null if the document or frame does not belong to a crawler.
+    static MemoryBudget* From(const blink::Document &document);
+    static MemoryBudget* From(const blink::LocalFrame &frame);
+
+    size_t Usage(void) const { return m_usage; }
+
+    void DidStartNavigation(void) { m_exceeded = false; }
+    // The body is counted for as long as anything refers to it, the resources
+    // of the crawler or the memory cache alike.
+    void DidReceiveBody(const BkSegmentedBuffer &body);
+    void Checkpoint(void);
+private:
+    size_t Measure(void);
+    void UpdateUsage(void);
+    bool IsOverLimit(void) const;
+    void CollectGarbage(void);
+    void PressureTimerFired(blink::TimerBase *);
+
+    blink::LocalFrame &m_frame;
+    CrawlerMetrics &m_metrics;
+    const std::function<void(size_t)> m_callback;
+
+    // The segments of the bodies received, dropped once they are released.
+    std::vector<std::pair<std::weak_ptr<const std::string>, size_t>> m_bodySegments;
+
+    size_t m_usage = 0;
+    // Set when the callback is called, until the next navigation.
+    bool m_exceeded = false;
+    blink::TaskRunnerTimer<MemoryBudget> m_pressureTimer;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_MEMORY_BUDGET_H
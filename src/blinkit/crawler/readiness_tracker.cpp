@@ -0,0 +1,117 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: readiness_tracker.cpp
+// Description: ReadinessTracker Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "readiness_tracker.h"
+
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/frame/dom_timer_coordinator.h"
+#include "third_party/blink/renderer/core/frame/local_dom_window.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+
+using namespace blink;
+
+namespace BlinKit {
+
+static const TimeDelta PollInterval = TimeDelta::FromMilliseconds(50);
+
+ReadinessTracker::ReadinessTracker(LocalFrame &frame, const std::function<void(bool)> &callback)
+    : m_frame(frame)
+    , m_callback(callback)
+    , m_pollTimer(frame.GetTaskRunner(TaskType::kInternalDefault), this, &ReadinessTracker::PollTimerFired)
+{
+    BkReadinessOptions defaultOptions = { 0 };
+    SetOptions(defaultOptions);
+}
+
+void ReadinessTracker::DidFinishRequest(void)
+{
+    ASSERT(m_requestsInFlight > 0);
+    --m_requestsInFlight;
+    m_lastNetworkActivity = TimeTicks::Now();
+}
+
+void ReadinessTracker::DidStartRequest(void)
+{
+    ++m_requestsInFlight;
+    m_lastNetworkActivity = TimeTicks::Now();
+}
+
+bool ReadinessTracker::IsQuiescent(TimeTicks now)
+{
+    if (m_requestsInFlight > 0 || now - m_lastNetworkActivity < m_networkIdleTime)
+        return false;
+
+    LocalDOMWindow *window = m_frame.DomWindow();
+    if (nullptr == window || nullptr == window->document())
+        return false;
+
+    // The oldest sample kept is the last one at or before the window start.
+    m_mutationSamples.emplace_back(now, window->document()->MutationCount());
+    while (m_mutationSamples.size() > 1 && now - m_mutationSamples[1].first >= m_mutationWindow)
+        m_mutationSamples.pop_front();
+    if (now - m_mutationSamples.front().first < m_mutationWindow)
+        return false; // Not watched for a whole window yet.
+    if (m_mutationSamples.back().second - m_mutationSamples.front().second > m_maxMutations)
+        return false;
+
+    return !window->Timers().HasTimeoutDueWithin(m_networkIdleTime);
+}
+
+void ReadinessTracker::PollTimerFired(TimerBase *)
+{
+    if (!m_watching)
+        return;
+
+    const TimeTicks now = TimeTicks::Now();
+    const bool quiescent = IsQuiescent(now);
+    if (quiescent || now - m_startTime >= m_timeout)
+    {
+        m_watching = false;
+        m_mutationSamples.clear();
+        m_callback(!quiescent);
+        return;
+    }
+
+    m_pollTimer.StartOneShot(PollInterval, FROM_HERE);
+}
+
+void ReadinessTracker::SetOptions(const BkReadinessOptions &options)
+{
+    m_networkIdleTime = TimeDelta::FromMilliseconds(0 != options.NetworkIdleTime ? options.NetworkIdleTime : 500);
+    m_mutationWindow = TimeDelta::FromMilliseconds(0 != options.MutationWindow ? options.MutationWindow : 500);
+    m_maxMutations = options.MaxMutations;
+    m_timeout = TimeDelta::FromMilliseconds(0 != options.Timeout ? options.Timeout : 30000);
+}
+
+void ReadinessTracker::Start(void)
+{
+    m_watching = true;
+    m_startTime = TimeTicks::Now();
+
+    m_mutationSamples.clear();
+    if (LocalDOMWindow *window = m_frame.DomWindow())
+    {
+        if (Document *document = window->document())
+            m_mutationSamples.emplace_back(m_startTime, document->MutationCount());
+    }
+
+    // A poll still pending from the last document serves this one as well.
+    if (!m_pollTimer.IsActive())
+        m_pollTimer.StartOneShot(PollInterval, FROM_HERE);
+}
+
+void ReadinessTracker::Stop(void)
+{
+    m_watching = false;
+    m_mutationSamples.clear();
+}
+
+} // namespace BlinKit
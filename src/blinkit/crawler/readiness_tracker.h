@@ -0,0 +1,67 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: readiness_tracker.h
+// Description: ReadinessTracker Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_READINESS_TRACKER_H
+#define BLINKIT_BLINKIT_READINESS_TRACKER_H
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include "bk_crawler.h"
+#include "third_party/blink/renderer/platform/timer.h"
+
+namespace blink {
+class LocalFrame;
+}
+
+namespace BlinKit {
+
+// Tells when a loaded page has settled: the network has been idle for a
+// while, no timeout is about to fire, and the DOM has almost stopped changing.
+// Requests are counted all the time, while the rest is sampled only between
+// Start and Stop.
+class ReadinessTracker
+{
+public:
+    // |callback| takes whether the timeout expired.
+    ReadinessTracker(blink::LocalFrame &frame, const std::function<void(bool)> &callback);
+
+    void SetOptions(const BkReadinessOptions &options);
+
+    void DidStartRequest(void);
+    void DidFinishRequest(void);
+
+    void Start(void);
+    void Stop(void);
+private:
+    void PollTimerFired(blink::TimerBase *);
+    bool IsQuiescent(TimeTicks now);
+
+    blink::LocalFrame &m_frame;
+    const std::function<void(bool)> m_callback;
+
+    TimeDelta m_networkIdleTime, m_mutationWindow, m_timeout;
+    uint64_t m_maxMutations = 0;
+
+    int m_requestsInFlight = 0;
+    TimeTicks m_lastNetworkActivity;
+
+    bool m_watching = false;
+    TimeTicks m_startTime;
+    // Mutation counts of the document, sampled at each poll.
+    std::deque<std::pair<TimeTicks, uint64_t>> m_mutationSamples;
+    blink::TaskRunnerTimer<ReadinessTracker> m_pollTimer;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_READINESS_TRACKER_H
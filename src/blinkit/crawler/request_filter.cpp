@@ -0,0 +1,249 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: request_filter.cpp
+// Description: RequestFilter Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "request_filter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <queue>
+#include "blinkit/common/bk_url.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource.h"
+
+using namespace blink;
+
+namespace BlinKit {
+
+static std::string ToLowerASCII(const char *s)
+{
+    std::string ret(s);
+    for (char &ch : ret)
+    {
+        if ('A' <= ch && ch <= 'Z')
+            ch += 'a' - 'A';
+    }
+    return ret;
+}
+
+RequestFilter::RequestFilter(const BkRequestFilterRule *rules, size_t count)
+{
+    std::vector<std::pair<std::string, uint32_t>> substrings;
+    for (size_t i = 0; i < count; ++i)
+    {
+        BkRequestFilterRule r;
+        memset(&r, 0, sizeof(BkRequestFilterRule));
+        size_t size = sizeof(BkRequestFilterRule);
+        if (rules[i].SizeOfStruct < size)
+            size = rules[i].SizeOfStruct;
+        memcpy(&r, rules + i, size);
+
+        const uint32_t index = static_cast<uint32_t>(m_rules.size());
+
+        Rule rule;
+        rule.allow = BK_FILTER_ALLOW == r.Action;
+        rule.resourceTypes = 0 != r.ResourceTypes ? r.ResourceTypes : BK_RESOURCE_ALL;
+        rule.hasHost = nullptr != r.HostSuffix && '\0' != *r.HostSuffix;
+        rule.hasSubstring = nullptr != r.URLSubstring && '\0' != *r.URLSubstring;
+        m_rules.push_back(rule);
+
+        if (rule.hasHost)
+        {
+            const char *host = r.HostSuffix;
+            if ('.' == *host)
+                ++host;
+            m_hostSuffixes.emplace_back(ToLowerASCII(host));
+            m_rulesByHostSuffix[m_hostSuffixes.back()].push_back(index);
+        }
+        if (rule.hasSubstring)
+            substrings.emplace_back(ToLowerASCII(r.URLSubstring), index);
+        if (!rule.hasHost && !rule.hasSubstring)
+            m_unconditionalRules.push_back(index);
+    }
+
+    m_matchStamps.resize(m_rules.size(), 0);
+    BuildAutomaton(substrings);
+}
+
+unsigned RequestFilter::ResourceKindOf(ResourceType type)
+{
+    switch (type)
+    {
+        case ResourceType::kScript:
+            return BK_RESOURCE_SCRIPT;
+        case ResourceType::kCSSStyleSheet:
+        case ResourceType::kXSLStyleSheet:
+            return BK_RESOURCE_STYLESHEET;
+        case ResourceType::kImage:
+            return BK_RESOURCE_IMAGE;
+        case ResourceType::kFont:
+            return BK_RESOURCE_FONT;
+        case ResourceType::kAudio:
+        case ResourceType::kVideo:
+        case ResourceType::kTextTrack:
+            return BK_RESOURCE_MEDIA;
+        case ResourceType::kRaw:
+            return BK_RESOURCE_XHR;
+        default:
+            return BK_RESOURCE_OTHER;
+    }
+}
+
+bool RequestFilter::Allows(unsigned resourceType, const BkURL &URL) const
+{
+    Decision decision = Decision::kNone;
+
+    const std::string &s = URL.AsString();
+    if (m_outputs.size() > 0)
+    {
+        if (0 == ++m_stamp)
+        {
+            std::fill(m_matchStamps.begin(), m_matchStamps.end(), 0);
+            m_stamp = 1;
+        }
+
+        int32_t state = 0;
+        for (char ch : s)
+        {
+            state = m_transitions[state * m_classCount + m_classes[static_cast<uint8_t>(ch)]];
+            for (uint32_t i = m_outputOffsets[state]; i < m_outputOffsets[state + 1]; ++i)
+            {
+                const uint32_t ruleIndex = m_outputs[i];
+                m_matchStamps[ruleIndex] = m_stamp;
+                if (!m_rules[ruleIndex].hasHost)
+                    decision = Apply(ruleIndex, resourceType, decision);
+            }
+        }
+        if (Decision::kAllow == decision)
+            return true;
+    }
+
+    if (!m_rulesByHostSuffix.empty())
+    {
+        // Canonical hosts are in lower case already.
+        std::string_view host = URL.HostPiece();
+        while (!host.empty())
+        {
+            auto it = m_rulesByHostSuffix.find(host);
+            if (std::end(m_rulesByHostSuffix) != it)
+            {
+                for (uint32_t ruleIndex : it->second)
+                {
+                    if (!m_rules[ruleIndex].hasSubstring || m_stamp == m_matchStamps[ruleIndex])
+                        decision = Apply(ruleIndex, resourceType, decision);
+                }
+                if (Decision::kAllow == decision)
+                    return true;
+            }
+
+            size_t dot = host.find('.');
+            if (std::string_view::npos == dot)
+                break;
+            host.remove_prefix(dot + 1);
+        }
+    }
+
+    for (uint32_t ruleIndex : m_unconditionalRules)
+        decision = Apply(ruleIndex, resourceType, decision);
+    return Decision::kBlock != decision;
+}
+
+RequestFilter::Decision RequestFilter::Apply(uint32_t ruleIndex, unsigned resourceType, Decision current) const
+{
+    const Rule &rule = m_rules[ruleIndex];
+    if (0 == (rule.resourceTypes & resourceType))
+        return current;
+    // Allowing rules always win.
+    if (rule.allow)
+        return Decision::kAllow;
+    return Decision::kNone == current ? Decision::kBlock : current;
+}
+
+void RequestFilter::BuildAutomaton(const std::vector<std::pair<std::string, uint32_t>> &substrings)
+{
+    memset(m_classes, 0, sizeof(m_classes));
+    for (const auto &it : substrings)
+    {
+        for (char ch : it.first)
+        {
+            uint8_t &c = m_classes[static_cast<uint8_t>(ch)];
+            if (0 == c)
+                c = m_classCount++;
+        }
+    }
+    // Matches are case insensitive.
+    for (int ch = 'A'; ch <= 'Z'; ++ch)
+        m_classes[ch] = m_classes[ch - 'A' + 'a'];
+
+    // Builds the trie.
+    std::vector<std::vector<uint32_t>> outputs(1);
+    m_transitions.assign(m_classCount, -1);
+    for (const auto &it : substrings)
+    {
+        int32_t state = 0;
+        for (char ch : it.first)
+        {
+            int32_t &next = m_transitions[state * m_classCount + m_classes[static_cast<uint8_t>(ch)]];
+            if (next < 0)
+            {
+                next = static_cast<int32_t>(outputs.size());
+                outputs.emplace_back();
+                m_transitions.resize(m_transitions.size() + m_classCount, -1);
+            }
+            state = m_transitions[state * m_classCount + m_classes[static_cast<uint8_t>(ch)]];
+        }
+        outputs[state].push_back(it.second);
+    }
+
+    // Turns the trie into a DFA in breadth first order, so the failure state
+    // of each state is complete before the state itself.
+    std::vector<int32_t> failures(outputs.size(), 0);
+    std::queue<int32_t> q;
+    for (unsigned c = 0; c < m_classCount; ++c)
+    {
+        int32_t &next = m_transitions[c];
+        if (next < 0)
+            next = 0;
+        else
+            q.push(next);
+    }
+    while (!q.empty())
+    {
+        const int32_t state = q.front();
+        q.pop();
+
+        const std::vector<uint32_t> &inherited = outputs[failures[state]];
+        outputs[state].insert(outputs[state].end(), inherited.begin(), inherited.end());
+
+        for (unsigned c = 0; c < m_classCount; ++c)
+        {
+            int32_t &next = m_transitions[state * m_classCount + c];
+            const int32_t fallback = m_transitions[failures[state] * m_classCount + c];
+            if (next < 0)
+            {
+                next = fallback;
+            }
+            else
+            {
+                failures[next] = fallback;
+                q.push(next);
+            }
+        }
+    }
+
+    m_outputOffsets.reserve(outputs.size() + 1);
+    for (const std::vector<uint32_t> &o : outputs)
+    {
+        m_outputOffsets.push_back(static_cast<uint32_t>(m_outputs.size()));
+        m_outputs.insert(m_outputs.end(), o.begin(), o.end());
+    }
+    m_outputOffsets.push_back(static_cast<uint32_t>(m_outputs.size()));
+}
+
+} // namespace BlinKit
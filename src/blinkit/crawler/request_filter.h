@@ -0,0 +1,79 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: request_filter.h
+// Description: RequestFilter Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_REQUEST_FILTER_H
+#define BLINKIT_BLINKIT_REQUEST_FILTER_H
+
+#pragma once
+
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "bk_crawler.h"
+
+namespace blink {
+enum class ResourceType : uint8_t;
+}
+
+namespace BlinKit {
+
+class BkURL;
+
+// A compiled set of BkRequestFilterRules. Host suffixes are looked up in a
+// hash table, one label at a time, and URL substrings are matched all at once
+// by an Aho-Corasick automaton, so checking a request neither allocates nor
+// depends on the number of rules.
+class RequestFilter
+{
+public:
+    RequestFilter(const BkRequestFilterRule *rules, size_t count);
+
+    // The BK_RESOURCE_* flag of a Blink resource type. Main resources are
+    // BK_RESOURCE_OTHER.
+    static unsigned ResourceKindOf(blink::ResourceType type);
+
+    // |resourceType| is one of the BK_RESOURCE_* flags.
+    bool Allows(unsigned resourceType, const BkURL &URL) const;
+private:
+    struct Rule {
+        bool allow;
+        unsigned resourceTypes;
+        bool hasHost, hasSubstring;
+    };
+
+    enum class Decision { kNone, kBlock, kAllow };
+    Decision Apply(uint32_t ruleIndex, unsigned resourceType, Decision current) const;
+
+    void BuildAutomaton(const std::vector<std::pair<std::string, uint32_t>> &substrings);
+
+    std::vector<Rule> m_rules;
+    std::vector<uint32_t> m_unconditionalRules;
+
+    // Keys are views of the strings in m_hostSuffixes, which never move.
+    std::deque<std::string> m_hostSuffixes;
+    std::unordered_map<std::string_view, std::vector<uint32_t>> m_rulesByHostSuffix;
+
+    // The automaton runs on character classes instead of bytes, which keeps
+    // the transition table small. Class 0 is for characters in no substring.
+    uint8_t m_classes[256];
+    unsigned m_classCount = 1;
+    std::vector<int32_t> m_transitions;
+    std::vector<uint32_t> m_outputOffsets, m_outputs;
+
+    // Stamps of the rules whose substrings matched the current request.
+    mutable std::vector<uint32_t> m_matchStamps;
+    mutable uint32_t m_stamp = 0;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_REQUEST_FILTER_H
@@ -24,8 +24,13 @@ class AppleRequest final : public RequestImpl
 public:
     AppleRequest(const char *URL, const BkRequestClient &client);
     ~AppleRequest(void) override;
+
+    // Called by the delegate of the session.
+    void DidReceiveResponse(NSURLResponse *response);
+    // Returns false once the body is truncated, to cancel the task.
+    bool DidReceiveData(NSData *data);
+    void DidComplete(NSError *error);
 private:
-    void RequestComplete(NSData *data, NSURLResponse *response, NSError *error);
 
     // RequestImpl
     int Perform(void) override;
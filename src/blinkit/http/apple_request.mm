@@ -11,11 +11,91 @@
 
 #include "apple_request.h"
 
+#include <mutex>
+#include <unordered_map>
 #include "blinkit/app/app_constants.h"
 #include "blinkit/apple/ns.h"
 #include "blinkit/common/bk_url.h"
+#include "blinkit/http/request_backend.h"
 #include "blinkit/http/response_impl.h"
 
+// The delegate of the session shared by all requests, which hands the events
+// of each task to its request.
+@interface BkAppleSessionDelegate : NSObject <NSURLSessionDataDelegate>
+- (void)addTask: (NSURLSessionTask *)task forRequest: (BlinKit::AppleRequest *)request;
+@end
+
+@implementation BkAppleSessionDelegate {
+    std::mutex _lock;
+    std::unordered_map<NSUInteger, BlinKit::AppleRequest *> _requests;
+}
+
+- (void)addTask: (NSURLSessionTask *)task forRequest: (BlinKit::AppleRequest *)request
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _requests[task.taskIdentifier] = request;
+}
+
+- (BlinKit::AppleRequest *)requestForTask: (NSURLSessionTask *)task remove: (BOOL)remove
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    auto it = _requests.find(task.taskIdentifier);
+    if (std::end(_requests) == it)
+        return nullptr;
+
+    BlinKit::AppleRequest *ret = it->second;
+    if (remove)
+        _requests.erase(it);
+    return ret;
+}
+
+- (void)URLSession: (NSURLSession *)session
+          dataTask: (NSURLSessionDataTask *)dataTask
+didReceiveResponse: (NSURLResponse *)response
+ completionHandler: (void (^)(NSURLSessionResponseDisposition))completionHandler
+{
+    if (BlinKit::AppleRequest *request = [self requestForTask: dataTask remove: NO])
+        request->DidReceiveResponse(response);
+    completionHandler(NSURLSessionResponseAllow);
+}
+
+- (void)URLSession: (NSURLSession *)session
+          dataTask: (NSURLSessionDataTask *)dataTask
+    didReceiveData: (NSData *)data
+{
+    // Cancels the transfer once the body is truncated.
+    BlinKit::AppleRequest *request = [self requestForTask: dataTask remove: NO];
+    if (nullptr != request && !request->DidReceiveData(data))
+        [dataTask cancel];
+}
+
+- (void)URLSession: (NSURLSession *)session
+                    task: (NSURLSessionTask *)task
+    didCompleteWithError: (NSError *)error
+{
+    if (BlinKit::AppleRequest *request = [self requestForTask: task remove: YES])
+        request->DidComplete(error);
+}
+
+@end
+
+// Keeps the connections alive across requests. The default configuration
+// shares the cookie storage and the URL cache of the process, as the shared
+// session does, which cannot have a delegate.
+static NSURLSession *g_session = nil;
+static BkAppleSessionDelegate *g_sessionDelegate = nil;
+
+static void EnsureSession(void)
+{
+    static dispatch_once_t s_once;
+    dispatch_once(&s_once, ^{
+        g_sessionDelegate = [[BkAppleSessionDelegate alloc] init];
+        g_session = [NSURLSession sessionWithConfiguration: [NSURLSessionConfiguration defaultSessionConfiguration]
+                                                  delegate: g_sessionDelegate
+                                             delegateQueue: nil];
+    });
+}
+
 namespace BlinKit {
 
 AppleRequest::AppleRequest(const char *URL, const BkRequestClient &client) : RequestImpl(URL, client)
@@ -30,6 +110,49 @@ void AppleRequest::Cancel(void)
     ASSERT(false); // BKTODO:
 }
 
+void AppleRequest::DidComplete(NSError *error)
+{
+    // The task is cancelled for a truncated body, which is still complete.
+    if (!m_response || (nil != error && !m_response->IsTruncated()))
+        m_client.RequestFailed(BK_ERR_NETWORK, m_client.UserData);
+    else
+        m_client.RequestComplete(m_response.get(), m_client.UserData);
+    RequestImpl::Release();
+}
+
+bool AppleRequest::DidReceiveData(NSData *data)
+{
+    // No response to take the data, which fails the request.
+    if (!m_response)
+        return false;
+
+    __block bool ret = true;
+    [data enumerateByteRangesUsingBlock: ^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        if (!m_response->AppendData(bytes, byteRange.length))
+        {
+            ret = false;
+            *stop = YES;
+        }
+    }];
+    return ret;
+}
+
+void AppleRequest::DidReceiveResponse(NSURLResponse *response)
+{
+    m_response = std::make_shared<ResponseImpl>(m_URL);
+
+    NSHTTPURLResponse *repo = static_cast<NSHTTPURLResponse *>(response);
+    m_response->SetCurrentURL(NS::StringToStd(repo.URL.absoluteString));
+    m_response->SetStatusCode(repo.statusCode);
+    for (NSString *key in repo.allHeaderFields)
+    {
+        NSString *val = repo.allHeaderFields[key];
+        m_response->AppendHeader(key.UTF8String, val.UTF8String);
+    }
+    if (repo.expectedContentLength > 0)
+        m_response->PrepareBody(repo.expectedContentLength);
+}
+
 ControllerImpl* AppleRequest::GetController(void)
 {
     ASSERT(false); // BKTODO:
@@ -67,13 +190,11 @@ int AppleRequest::Perform(void)
             [req setHTTPBody: body];
         }
 
-        NSURLSession *session = [NSURLSession sharedSession];
-        id handler = ^(NSData *data, NSURLResponse *response, NSError *error)
-        {
-            RequestComplete(data, response, error);
-            RequestImpl::Release();
-        };
-        NSURLSessionDataTask *task = [session dataTaskWithRequest: req completionHandler: handler];
+        // The data is taken as it arrives, so that the task can be cancelled
+        // once the body is truncated.
+        EnsureSession();
+        NSURLSessionDataTask *task = [g_session dataTaskWithRequest: req];
+        [g_sessionDelegate addTask: task forRequest: this];
         [task resume];
         return BK_ERR_SUCCESS;
     } while (false);
@@ -83,34 +204,9 @@ int AppleRequest::Perform(void)
     return err;
 }
 
-void AppleRequest::RequestComplete(NSData *data, NSURLResponse *response, NSError *error)
+RequestImpl* CreateNativeRequest(const char *URL, const BkRequestClient &client)
 {
-    if (nil != error)
-    {
-        m_client.RequestFailed(BK_ERR_NETWORK, m_client.UserData);
-        return;
-    }
-
-    m_response = std::make_unique<ResponseImpl>(m_URL);
-
-    NSHTTPURLResponse *repo = static_cast<NSHTTPURLResponse *>(response);
-    m_response->SetCurrentURL(NS::StringToStd(repo.URL.absoluteString));
-    m_response->SetStatusCode(repo.statusCode);
-    for (NSString *key in repo.allHeaderFields)
-    {
-        NSString *val = repo.allHeaderFields[key];
-        m_response->AppendHeader(key.UTF8String, val.UTF8String);
-    }
-    m_response->AppendData(data.bytes, data.length);
-
-    m_client.RequestComplete(m_response.get(), m_client.UserData);
+    return new AppleRequest(URL, client);
 }
 
 } // namespace BlinKit
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-extern "C" BkRequest BKAPI BkCreateRequest(const char *URL, BkRequestClient *client)
-{
-    return new BlinKit::AppleRequest(URL, *client);
-}
@@ -13,6 +13,7 @@
 
 #include "base/strings/string_util.h"
 #include "blinkit/common/bk_url.h"
+#include "blinkit/http/request_backend.h"
 #include "blinkit/http/response_impl.h"
 
 namespace BlinKit {
@@ -55,7 +56,7 @@ void* CURLRequest::DoThreadWork(void)
     curl_easy_setopt(m_curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
 
     CURLcode code = curl_easy_perform(m_curl);
-    if (CURLE_OK == code)
+    if (CURLE_OK == code || (CURLE_WRITE_ERROR == code && m_response->IsTruncated()))
     {
         m_response->ParseHeaders(headers);
         m_client.RequestComplete(m_response.get(), m_client.UserData);
@@ -152,19 +153,13 @@ CURLoption CURLRequest::TranslateOption(const std::string &name)
 size_t CURLRequest::WriteCallback(char *ptr, size_t, size_t nmemb, void *userData)
 {
     ResponseImpl *response = reinterpret_cast<ResponseImpl *>(userData);
-    response->AppendData(ptr, nmemb);
-    return nmemb;
+    // Fails the transfer once the body is truncated.
+    return response->AppendData(ptr, nmemb) ? nmemb : 0;
 }
 
-} // namespace BlinKit
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-extern "C" {
-
-BKEXPORT BkRequest BKAPI BkCreateRequest(const char *URL, BkRequestClient *client)
+RequestImpl* CreateNativeRequest(const char *URL, const BkRequestClient &client)
 {
-    return new BlinKit::CURLRequest(URL, *client);
+    return new CURLRequest(URL, client);
 }
 
-} // extern "C"
+} // namespace BlinKit
@@ -0,0 +1,658 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: request_archive.cpp
+// Description: Record & Replay Backends
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "request_archive.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#ifndef OS_WIN
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+#include "base/time/time.h"
+#include "blinkit/http/request_impl.h"
+#include "blinkit/http/response_impl.h"
+
+namespace BlinKit {
+
+static const char ArchiveMagic[] = "BKARCH03";
+static const size_t ArchiveMagicSize = sizeof(ArchiveMagic) - 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Recording
+
+class ArchiveWriter
+{
+public:
+    ~ArchiveWriter(void) { fclose(m_file); }
+
+    static std::shared_ptr<ArchiveWriter> Open(const std::string &path);
+
+    // May be called on any thread. The record goes in with a single write.
+    void Append(const std::string &record);
+private:
+    ArchiveWriter(FILE *file) : m_file(file) {}
+
+    std::mutex m_lock;
+    FILE *m_file;
+};
+
+std::shared_ptr<ArchiveWriter> ArchiveWriter::Open(const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "a+b");
+    if (nullptr == file)
+    {
+        BKLOG("Failed to open archive: %s", path.c_str());
+        return nullptr;
+    }
+
+    char magic[ArchiveMagicSize];
+    fseek(file, 0, SEEK_SET);
+    size_t n = fread(magic, 1, ArchiveMagicSize, file);
+    if (0 == n)
+    {
+        fwrite(ArchiveMagic, 1, ArchiveMagicSize, file);
+        fflush(file);
+    }
+    else if (ArchiveMagicSize != n || 0 != memcmp(magic, ArchiveMagic, ArchiveMagicSize))
+    {
+        BKLOG("Not an archive: %s", path.c_str());
+        fclose(file);
+        return nullptr;
+    }
+
+    return std::shared_ptr<ArchiveWriter>(new ArchiveWriter(file));
+}
+
+void ArchiveWriter::Append(const std::string &record)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    fwrite(record.data(), 1, record.length(), m_file);
+    fflush(m_file);
+}
+
+template <typename T>
+static void AppendInteger(std::string &dst, T value)
+{
+    dst.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static void AppendField(std::string &dst, std::string_view field)
+{
+    AppendInteger<uint32_t>(dst, field.length());
+    dst.append(field.data(), field.length());
+}
+
+// The request headers which select the content, then the body. See
+// ArchiveRecord.
+static std::string RequestKeyOf(const BkHTTPHeaderMap &headers, const std::vector<unsigned char> &body)
+{
+    static const char *names[] = { "Accept", "Content-Type", "Range" };
+
+    std::string ret;
+    for (const char *name : names)
+    {
+        std::string value = headers.Get(name);
+        if (!value.empty())
+            ret.append(name).append(": ").append(value).append("\r\n");
+    }
+    ret.append("\r\n");
+    ret.append(reinterpret_cast<const char *>(body.data()), body.size());
+    return ret;
+}
+
+// "Name: value\r\n" each, cookies included.
+static std::string HeadersOf(const ResponseImpl &response)
+{
+    std::string ret;
+    for (const auto &it : response.Headers().GetRawMap())
+        ret.append(it.first).append(": ").append(it.second).append("\r\n");
+    for (size_t i = 0; i < response.CookiesCount(); ++i)
+    {
+        std::string cookie;
+        response.GetCookie(i, BkMakeBuffer(cookie));
+        ret.append("Set-Cookie: ").append(cookie).append("\r\n");
+    }
+    return ret;
+}
+
+// Hands the request to the network backend with a client of its own, which
+// records the result before passing it on.
+class RecordingRequest final : public RequestImpl
+{
+public:
+    RecordingRequest(const char *URL, const BkRequestClient &client, const std::shared_ptr<ArchiveWriter> &writer)
+        : RequestImpl(URL, client), m_writer(writer)
+    {
+    }
+private:
+    int Perform(void) override;
+    void Cancel(void) override;
+
+    void Record(int errorCode, const ResponseImpl *response);
+    // Called before the client is, the network request releases itself after.
+    void DetachRequest(void);
+
+    static void BKAPI RequestCompleteImpl(BkResponse response, void *userData);
+    static void BKAPI RequestFailedImpl(int errorCode, void *userData);
+    static bool_t BKAPI RequestRedirectImpl(BkResponse response, void *userData);
+
+    std::shared_ptr<ArchiveWriter> m_writer;
+    std::recursive_mutex m_requestLock; // The network request may fail in Cancel.
+    RequestImpl *m_request = nullptr; // Releases itself when done.
+    base::TimeTicks m_startTime;
+    std::string m_redirects; // See ArchiveRecord.
+};
+
+void RecordingRequest::Cancel(void)
+{
+    // Null before Perform, and once the network request is done.
+    std::unique_lock<std::recursive_mutex> lock(m_requestLock);
+    if (nullptr != m_request)
+        m_request->Cancel();
+}
+
+void RecordingRequest::DetachRequest(void)
+{
+    std::unique_lock<std::recursive_mutex> lock(m_requestLock);
+    m_request = nullptr;
+}
+
+int RecordingRequest::Perform(void)
+{
+    BkRequestClient client = { 0 };
+    client.SizeOfStruct = sizeof(BkRequestClient);
+    client.UserData = this;
+    client.RequestComplete = RequestCompleteImpl;
+    client.RequestFailed = RequestFailedImpl;
+    client.RequestRedirect = RequestRedirectImpl;
+
+    RequestImpl *request = CreateNativeRequest(m_URL.c_str(), client);
+    request->SetMethod(m_method);
+    request->SetHeaders(m_headers);
+    if (!m_body.empty())
+        request->SetBody(m_body.data(), m_body.size());
+    request->SetTimeout(TimeoutInMs() / 1000);
+    if (HasProxy())
+        request->SetProxy(Proxy().c_str());
+
+    m_startTime = base::TimeTicks::Now();
+    {
+        std::unique_lock<std::recursive_mutex> lock(m_requestLock);
+        m_request = request;
+    }
+
+    // The network request deletes itself if it fails to start.
+    int r = request->Perform();
+    if (BK_ERR_SUCCESS != r)
+        DetachRequest();
+    return r;
+}
+
+void RecordingRequest::Record(int errorCode, const ResponseImpl *response)
+{
+    std::string record;
+    AppendInteger<uint32_t>(record, 0); // Filled at last.
+    AppendInteger<int32_t>(record, errorCode);
+    AppendInteger<uint32_t>(record, (base::TimeTicks::Now() - m_startTime).InMilliseconds());
+    AppendInteger<int32_t>(record, nullptr != response ? response->StatusCode() : 0);
+    AppendField(record, m_method);
+    AppendField(record, m_URL);
+    AppendField(record, RequestKeyOf(m_headers, m_body));
+    AppendField(record, m_redirects);
+
+    if (nullptr != response)
+    {
+        AppendField(record, response->CurrentURL());
+        AppendField(record, HeadersOf(*response));
+
+        const BkSegmentedBuffer &body = response->Body();
+        record.reserve(record.length() + sizeof(uint32_t) + body.Size());
+        AppendInteger<uint32_t>(record, body.Size());
+        for (const BkSegmentedBuffer::Segment &segment : body.Segments())
+            record.append(*segment);
+    }
+    else
+    {
+        AppendField(record, std::string_view());
+        AppendField(record, std::string_view());
+        AppendField(record, std::string_view());
+    }
+
+    uint32_t size = record.length() - sizeof(uint32_t);
+    memcpy(&record[0], &size, sizeof(uint32_t));
+    m_writer->Append(record);
+}
+
+void BKAPI RecordingRequest::RequestCompleteImpl(BkResponse response, void *userData)
+{
+    RecordingRequest *This = reinterpret_cast<RecordingRequest *>(userData);
+    This->DetachRequest();
+    This->Record(BK_ERR_SUCCESS, response);
+    This->m_client.RequestComplete(response, This->m_client.UserData);
+    This->Release();
+}
+
+void BKAPI RecordingRequest::RequestFailedImpl(int errorCode, void *userData)
+{
+    RecordingRequest *This = reinterpret_cast<RecordingRequest *>(userData);
+    This->DetachRequest();
+    This->Record(errorCode, nullptr);
+    This->m_client.RequestFailed(errorCode, This->m_client.UserData);
+    This->Release();
+}
+
+bool_t BKAPI RecordingRequest::RequestRedirectImpl(BkResponse response, void *userData)
+{
+    RecordingRequest *This = reinterpret_cast<RecordingRequest *>(userData);
+    AppendInteger<int32_t>(This->m_redirects, response->StatusCode());
+    AppendField(This->m_redirects, response->CurrentURL());
+    AppendField(This->m_redirects, HeadersOf(*response));
+
+    if (nullptr == This->m_client.RequestRedirect)
+        return true;
+    return This->m_client.RequestRedirect(response, This->m_client.UserData);
+}
+
+std::shared_ptr<RecordingBackend> RecordingBackend::Create(const std::string &path)
+{
+    std::shared_ptr<ArchiveWriter> writer = ArchiveWriter::Open(path);
+    if (!writer)
+        return nullptr;
+    return std::shared_ptr<RecordingBackend>(new RecordingBackend(writer));
+}
+
+RequestImpl* RecordingBackend::CreateRequest(const char *URL, const BkRequestClient &client)
+{
+    return new RecordingRequest(URL, client, m_writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Replaying
+
+ArchiveReader::~ArchiveReader(void)
+{
+#ifdef OS_WIN
+    if (nullptr != m_data)
+        UnmapViewOfFile(m_data);
+    if (nullptr != m_mapping)
+        CloseHandle(m_mapping);
+    if (INVALID_HANDLE_VALUE != m_file)
+        CloseHandle(m_file);
+#else
+    if (nullptr != m_data)
+        munmap(const_cast<char *>(m_data), m_size);
+#endif
+}
+
+void ArchiveReader::BuildIndex(void)
+{
+    Scan([this](const char *p, const ArchiveRecord &record) {
+        m_index[IndexKey(record.method, record.URL, record.request)].records.push_back(p);
+    });
+}
+
+void ArchiveReader::ForEachRecord(const RecordCallback &callback) const
+{
+    Scan([&callback](const char *, const ArchiveRecord &record) {
+        callback(record);
+    });
+}
+
+std::string ArchiveReader::IndexKey(std::string_view method, std::string_view URL, std::string_view request)
+{
+    std::string ret;
+    ret.reserve(method.length() + URL.length() + request.length() + 2);
+    ret.append(method.data(), method.length()).append(1, ' ');
+    ret.append(URL.data(), URL.length()).append(1, '\n');
+    ret.append(request.data(), request.length());
+    return ret;
+}
+
+bool ArchiveReader::Take(std::string_view method, std::string_view URL, std::string_view request,
+    ArchiveRecord &dst)
+{
+    const char *p;
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        auto it = m_index.find(IndexKey(method, URL, request));
+        if (std::end(m_index) == it)
+            return false;
+
+        Records &r = it->second;
+        p = r.records[r.next];
+        if (r.next + 1 < r.records.size())
+            ++r.next;
+    }
+    return ParseRecord(p, m_data + m_size, dst);
+}
+
+bool ArchiveReader::Map(const std::string &path)
+{
+#ifdef OS_WIN
+    m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == m_file)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size) || 0 == size.QuadPart)
+        return false;
+
+    m_mapping = CreateFileMapping(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (nullptr == m_mapping)
+        return false;
+
+    m_data = reinterpret_cast<const char *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (nullptr == m_data)
+        return false;
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (0 != fstat(fd, &st) || 0 == st.st_size)
+    {
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data)
+        return false;
+
+    m_data = reinterpret_cast<const char *>(data);
+    m_size = st.st_size;
+#endif
+    return true;
+}
+
+std::shared_ptr<ArchiveReader> ArchiveReader::Open(const std::string &path)
+{
+    std::shared_ptr<ArchiveReader> ret(new ArchiveReader);
+    if (!ret->Map(path))
+    {
+        BKLOG("Failed to map archive: %s", path.c_str());
+        return nullptr;
+    }
+
+    if (ret->m_size < ArchiveMagicSize || 0 != memcmp(ret->m_data, ArchiveMagic, ArchiveMagicSize))
+    {
+        BKLOG("Not an archive: %s", path.c_str());
+        return nullptr;
+    }
+
+    ret->BuildIndex();
+    return ret;
+}
+
+bool ArchiveReader::ParseRecord(const char *p, const char *end, ArchiveRecord &dst)
+{
+    const char *const begin = p;
+    auto readInteger = [&p, end](auto &value) -> bool {
+        if (end - p < static_cast<ptrdiff_t>(sizeof(value)))
+            return false;
+        memcpy(&value, p, sizeof(value));
+        p += sizeof(value);
+        return true;
+    };
+    auto readField = [&p, end, &readInteger](std::string_view &field) -> bool {
+        uint32_t length;
+        if (!readInteger(length) || end - p < static_cast<ptrdiff_t>(length))
+            return false;
+        field = std::string_view(p, length);
+        p += length;
+        return true;
+    };
+
+    uint32_t size, elapsed;
+    int32_t errorCode, statusCode;
+    if (!readInteger(size) || !readInteger(errorCode) || !readInteger(elapsed) || !readInteger(statusCode))
+        return false;
+    end = begin + sizeof(uint32_t) + size;
+
+    dst.errorCode = errorCode;
+    dst.elapsed = elapsed;
+    dst.statusCode = statusCode;
+    return readField(dst.method) && readField(dst.URL) && readField(dst.request) && readField(dst.redirects)
+        && readField(dst.currentURL) && readField(dst.headers) && readField(dst.body);
+}
+
+void ArchiveReader::Scan(const std::function<void(const char *, const ArchiveRecord &)> &callback) const
+{
+    const char *end = m_data + m_size;
+    const char *p = m_data + ArchiveMagicSize;
+    while (end - p >= static_cast<ptrdiff_t>(sizeof(uint32_t)))
+    {
+        uint32_t size;
+        memcpy(&size, p, sizeof(uint32_t));
+        const char *next = p + sizeof(uint32_t) + size;
+        if (next > end)
+            break; // Torn by a crash while recording.
+
+        ArchiveRecord record;
+        if (ParseRecord(p, next, record))
+            callback(p, record);
+        p = next;
+    }
+}
+
+// Runs the deliveries of all replay backends when they are due.
+class ReplayThread
+{
+public:
+    static ReplayThread& Shared(void);
+
+    typedef std::function<void()> Task;
+    void PostTask(std::chrono::steady_clock::time_point due, Task &&task);
+private:
+    ReplayThread(void) : m_thread(&ReplayThread::ThreadMain, this) {}
+    ~ReplayThread(void);
+
+    void ThreadMain(void);
+
+    std::mutex m_lock;
+    std::condition_variable m_condition;
+    std::multimap<std::chrono::steady_clock::time_point, Task> m_tasks;
+    bool m_quit = false;
+    std::thread m_thread;
+};
+
+ReplayThread::~ReplayThread(void)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_quit = true;
+    }
+    m_condition.notify_one();
+    m_thread.join();
+}
+
+void ReplayThread::PostTask(std::chrono::steady_clock::time_point due, Task &&task)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_tasks.emplace(due, std::move(task));
+    }
+    m_condition.notify_one();
+}
+
+ReplayThread& ReplayThread::Shared(void)
+{
+    static ReplayThread s_instance;
+    return s_instance;
+}
+
+void ReplayThread::ThreadMain(void)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    while (!m_quit)
+    {
+        if (m_tasks.empty())
+        {
+            m_condition.wait(lock);
+            continue;
+        }
+
+        auto it = m_tasks.begin();
+        if (std::chrono::steady_clock::now() < it->first)
+        {
+            m_condition.wait_until(lock, it->first);
+            continue;
+        }
+
+        Task task = std::move(it->second);
+        m_tasks.erase(it);
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+template <typename T>
+static bool TakeInteger(std::string_view &src, T &dst)
+{
+    if (src.length() < sizeof(T))
+        return false;
+    memcpy(&dst, src.data(), sizeof(T));
+    src.remove_prefix(sizeof(T));
+    return true;
+}
+
+static bool TakeField(std::string_view &src, std::string_view &dst)
+{
+    uint32_t length;
+    if (!TakeInteger(src, length) || src.length() < length)
+        return false;
+    dst = src.substr(0, length);
+    src.remove_prefix(length);
+    return true;
+}
+
+class ReplayRequest final : public RequestImpl
+{
+public:
+    ReplayRequest(const char *URL, const BkRequestClient &client, const std::shared_ptr<ArchiveReader> &reader,
+        unsigned latency, unsigned long long bandwidth)
+        : RequestImpl(URL, client), m_reader(reader), m_latency(latency), m_bandwidth(bandwidth)
+    {
+    }
+private:
+    int Perform(void) override;
+    // The delivery still comes, but only to release the request.
+    void Cancel(void) override { m_cancelled = true; }
+
+    std::shared_ptr<ResponseImpl> CreateResponse(int statusCode, std::string_view currentURL,
+        std::string_view headers) const;
+    void Deliver(const ArchiveRecord &record);
+
+    std::shared_ptr<ArchiveReader> m_reader; // Keeps the record mapped.
+    const unsigned m_latency;
+    const unsigned long long m_bandwidth;
+    std::atomic<bool> m_cancelled{ false };
+};
+
+std::shared_ptr<ResponseImpl> ReplayRequest::CreateResponse(int statusCode, std::string_view currentURL,
+    std::string_view headers) const
+{
+    std::shared_ptr<ResponseImpl> ret = std::make_shared<ResponseImpl>(m_URL);
+
+    std::string rawHeaders("HTTP/1.1 ");
+    rawHeaders.append(std::to_string(statusCode)).append("\r\n");
+    rawHeaders.append(headers.data(), headers.length());
+    ret->ParseHeaders(rawHeaders);
+    if (!currentURL.empty())
+        ret->SetCurrentURL(std::string(currentURL));
+    return ret;
+}
+
+void ReplayRequest::Deliver(const ArchiveRecord &record)
+{
+    if (m_cancelled)
+    {
+        RequestImpl::Release();
+        return;
+    }
+
+    if (BK_ERR_SUCCESS != record.errorCode)
+    {
+        m_client.RequestFailed(record.errorCode, m_client.UserData);
+        RequestImpl::Release();
+        return;
+    }
+
+    // Like the network backends, a client which declines a redirection takes
+    // the request over, and hears no more of it.
+    std::string_view redirects = record.redirects;
+    int32_t statusCode;
+    std::string_view currentURL, headers;
+    while (TakeInteger(redirects, statusCode) && TakeField(redirects, currentURL) && TakeField(redirects, headers))
+    {
+        if (nullptr == m_client.RequestRedirect)
+            continue;
+
+        m_response = CreateResponse(statusCode, currentURL, headers);
+        if (!m_client.RequestRedirect(m_response.get(), m_client.UserData) || m_cancelled)
+        {
+            RequestImpl::Release();
+            return;
+        }
+    }
+
+    m_response = CreateResponse(record.statusCode, record.currentURL, record.headers);
+    m_response->PrepareBody(record.body.length());
+    m_response->AppendData(record.body.data(), record.body.length());
+
+    m_client.RequestComplete(m_response.get(), m_client.UserData);
+    RequestImpl::Release();
+}
+
+int ReplayRequest::Perform(void)
+{
+    ArchiveRecord record = { BK_ERR_NOT_FOUND };
+    if (!m_reader->Take(m_method, m_URL, RequestKeyOf(m_headers, m_body), record))
+        record.errorCode = BK_ERR_NOT_FOUND;
+
+    auto due = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_latency);
+    if (0 != m_bandwidth)
+        due += std::chrono::microseconds(record.body.length() * 1000000 / m_bandwidth);
+
+    ReplayThread::Shared().PostTask(due, std::bind(&ReplayRequest::Deliver, this, record));
+    return BK_ERR_SUCCESS;
+}
+
+std::shared_ptr<ReplayBackend> ReplayBackend::Create(const std::string &path, unsigned latency,
+    unsigned long long bandwidth)
+{
+    std::shared_ptr<ArchiveReader> reader = ArchiveReader::Open(path);
+    if (!reader)
+        return nullptr;
+    return std::shared_ptr<ReplayBackend>(new ReplayBackend(reader, latency, bandwidth));
+}
+
+RequestImpl* ReplayBackend::CreateRequest(const char *URL, const BkRequestClient &client)
+{
+    return new ReplayRequest(URL, client, m_reader, m_latency, m_bandwidth);
+}
+
+} // namespace BlinKit
@@ -0,0 +1,128 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: request_archive.h
+// Description: Record & Replay Backends
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_REQUEST_ARCHIVE_H
+#define BLINKIT_BLINKIT_REQUEST_ARCHIVE_H
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "blinkit/http/request_backend.h"
+
+namespace BlinKit {
+
+class ArchiveWriter;
+
+// An archive is a magic followed by records, which are only ever appended, so
+// an archive may be recorded by several runs, and a record torn by a crash
+// only loses itself. All integers are in the byte order of the machine.
+//
+//   Record:
+//     uint32 size of the rest of the record
+//     int32  error code, BK_ERR_SUCCESS for responses
+//     uint32 milliseconds from sending the request to the whole response
+//     int32  status code
+//     Fields, each an uint32 length followed by the bytes:
+//       method, URL, request, redirects, current URL,
+//       headers ("Name: value\r\n" each), body
+//   where request is the request headers that select the content, each as
+//   "Name: value\r\n", then "\r\n" and the request body, and redirects is
+//   the redirections offered to the client in order, each an int32 status
+//   code followed by the current URL and headers fields.
+struct ArchiveRecord {
+    int errorCode;
+    unsigned elapsed;
+    int statusCode;
+    std::string_view method, URL, request, redirects, currentURL, headers, body;
+};
+
+// Sends the requests to the network, and records them as they complete.
+class RecordingBackend final : public RequestBackend
+{
+public:
+    // Null if the archive cannot be opened, or is not an archive.
+    static std::shared_ptr<RecordingBackend> Create(const std::string &path);
+
+    RequestImpl* CreateRequest(const char *URL, const BkRequestClient &client) override;
+private:
+    RecordingBackend(const std::shared_ptr<ArchiveWriter> &writer) : m_writer(writer) {}
+
+    std::shared_ptr<ArchiveWriter> m_writer;
+};
+
+// A read-only mapping of an archive, with the records indexed by request.
+// Records are read in place.
+class ArchiveReader
+{
+public:
+    ~ArchiveReader(void);
+
+    // Null if the archive cannot be mapped, or is not an archive.
+    static std::shared_ptr<ArchiveReader> Open(const std::string &path);
+
+    // The next record of the request in the order of recording, or the last
+    // one once all were taken, if any. May be called on any thread.
+    bool Take(std::string_view method, std::string_view URL, std::string_view request, ArchiveRecord &dst);
+    // Every record in the order of recording, for tools which read archives
+    // as a whole.
+    typedef std::function<void(const ArchiveRecord &)> RecordCallback;
+    void ForEachRecord(const RecordCallback &callback) const;
+private:
+    ArchiveReader(void) = default;
+
+    bool Map(const std::string &path);
+    void BuildIndex(void);
+    void Scan(const std::function<void(const char *, const ArchiveRecord &)> &callback) const;
+    static bool ParseRecord(const char *p, const char *end, ArchiveRecord &dst);
+    static std::string IndexKey(std::string_view method, std::string_view URL, std::string_view request);
+
+    const char *m_data = nullptr;
+    size_t m_size = 0;
+#ifdef OS_WIN
+    HANDLE m_file = INVALID_HANDLE_VALUE, m_mapping = nullptr;
+#endif
+    struct Records {
+        std::vector<const char *> records; // In the order of recording.
+        size_t next = 0;
+    };
+    std::mutex m_lock;
+    std::unordered_map<std::string, Records> m_index;
+};
+
+// Serves the requests from an archive, on a thread of its own like the
+// network backends.
+class ReplayBackend final : public RequestBackend
+{
+public:
+    // |bandwidth| is in bytes per second, 0 for unlimited.
+    static std::shared_ptr<ReplayBackend> Create(const std::string &path, unsigned latency,
+        unsigned long long bandwidth);
+
+    RequestImpl* CreateRequest(const char *URL, const BkRequestClient &client) override;
+private:
+    ReplayBackend(const std::shared_ptr<ArchiveReader> &reader, unsigned latency, unsigned long long bandwidth)
+        : m_reader(reader), m_latency(latency), m_bandwidth(bandwidth)
+    {
+    }
+
+    std::shared_ptr<ArchiveReader> m_reader;
+    const unsigned m_latency;
+    const unsigned long long m_bandwidth;
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_REQUEST_ARCHIVE_H
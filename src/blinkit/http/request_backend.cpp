@@ -0,0 +1,83 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: request_backend.cpp
+// Description: RequestBackend Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "request_backend.h"
+
+#include <algorithm>
+#include <mutex>
+#include "blinkit/http/request_archive.h"
+#include "blinkit/http/request_impl.h"
+
+namespace BlinKit {
+
+static std::mutex s_backendLock;
+static std::shared_ptr<RequestBackend> s_backend;
+
+std::shared_ptr<RequestBackend> RequestBackend::Current(void)
+{
+    std::unique_lock<std::mutex> lock(s_backendLock);
+    return s_backend;
+}
+
+void RequestBackend::SetCurrent(const std::shared_ptr<RequestBackend> &backend)
+{
+    std::unique_lock<std::mutex> lock(s_backendLock);
+    s_backend = backend;
+}
+
+} // namespace BlinKit
+
+using namespace BlinKit;
+
+extern "C" {
+
+BKEXPORT BkRequest BKAPI BkCreateRequest(const char *URL, BkRequestClient *client)
+{
+    std::shared_ptr<RequestBackend> backend = RequestBackend::Current();
+    if (backend)
+        return backend->CreateRequest(URL, *client);
+    return CreateNativeRequest(URL, *client);
+}
+
+BKEXPORT int BKAPI BkSetRequestBackend(const BkRequestBackendOptions *options)
+{
+    BkRequestBackendOptions o = { 0 };
+    if (nullptr != options)
+        memcpy(&o, options, std::min(options->SizeOfStruct, sizeof(BkRequestBackendOptions)));
+
+    std::shared_ptr<RequestBackend> backend;
+    switch (o.Mode)
+    {
+        case BK_BACKEND_NETWORK:
+            break;
+        case BK_BACKEND_RECORD:
+            if (nullptr == o.ArchivePath)
+                return BK_ERR_UNKNOWN;
+            backend = RecordingBackend::Create(o.ArchivePath);
+            if (!backend)
+                return BK_ERR_NOT_FOUND;
+            break;
+        case BK_BACKEND_REPLAY:
+            if (nullptr == o.ArchivePath)
+                return BK_ERR_UNKNOWN;
+            backend = ReplayBackend::Create(o.ArchivePath, o.Latency, o.Bandwidth);
+            if (!backend)
+                return BK_ERR_NOT_FOUND;
+            break;
+        default:
+            return BK_ERR_UNKNOWN;
+    }
+
+    RequestBackend::SetCurrent(backend);
+    return BK_ERR_SUCCESS;
+}
+
+} // extern "C"
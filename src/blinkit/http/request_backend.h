@@ -0,0 +1,47 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: request_backend.h
+// Description: RequestBackend Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_REQUEST_BACKEND_H
+#define BLINKIT_BLINKIT_REQUEST_BACKEND_H
+
+#pragma once
+
+#include <memory>
+#include "bk_http.h"
+
+class RequestImpl;
+
+namespace BlinKit {
+
+// Creates the requests of BkCreateRequest. Without a backend set, requests go
+// to the network through the HTTP stack of the platform.
+class RequestBackend
+{
+public:
+    virtual ~RequestBackend(void) = default;
+
+    // Null for the network.
+    static std::shared_ptr<RequestBackend> Current(void);
+    // Requests created before keep working with the backend they came from,
+    // so a backend must stay valid for as long as its requests do.
+    static void SetCurrent(const std::shared_ptr<RequestBackend> &backend);
+
+    virtual RequestImpl* CreateRequest(const char *URL, const BkRequestClient &client) = 0;
+protected:
+    RequestBackend(void) = default;
+};
+
+// Defined with the request class of each platform.
+RequestImpl* CreateNativeRequest(const char *URL, const BkRequestClient &client);
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_REQUEST_BACKEND_H
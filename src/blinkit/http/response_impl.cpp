@@ -16,6 +16,7 @@
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "blinkit/common/bk_url.h"
+#include "blinkit/misc/memory_governor.h"
 
 using namespace BlinKit;
 
@@ -24,11 +25,31 @@ ResponseImpl::ResponseImpl(const std::string &URL) : m_originURL(URL), m_URL(URL
     // Nothing
 }
 
-void ResponseImpl::AppendData(const void *data, size_t cb)
+ResponseImpl::~ResponseImpl(void)
 {
-    size_t n = m_body.size();
-    m_body.resize(n + cb);
-    memcpy(m_body.data() + n, data, cb);
+    MemoryGovernor::Shared().Update(m_countedSize, 0);
+}
+
+bool ResponseImpl::AppendData(const void *data, size_t cb)
+{
+    if (m_firstByteTime.is_null())
+        m_firstByteTime = base::TimeTicks::Now();
+
+    bool ret = true;
+    const size_t limit = MemoryGovernor::Shared().ResponseLimit();
+    if (0 != limit && m_body.Size() + cb > limit)
+    {
+        cb = limit > m_body.Size() ? limit - m_body.Size() : 0;
+        m_truncated = true;
+        ret = false;
+    }
+
+    if (cb > 0)
+    {
+        m_body.Append(data, cb);
+        UpdateCountedSize();
+    }
+    return ret;
 }
 
 void ResponseImpl::AppendHeader(const char *name, const char *val)
@@ -36,6 +57,23 @@ void ResponseImpl::AppendHeader(const char *name, const char *val)
     m_headers.Set(name, val);
 }
 
+int ResponseImpl::GetBodyView(BkBodyView *view)
+{
+    BkSegmentedBuffer::Segment body = m_body.Flatten();
+    if (!body)
+    {
+        view->Data = nullptr;
+        view->Length = 0;
+        view->Handle = nullptr;
+        return BK_ERR_SUCCESS;
+    }
+
+    view->Data = body->data();
+    view->Length = body->length();
+    view->Handle = new BkSegmentedBuffer::Segment(body);
+    return BK_ERR_SUCCESS;
+}
+
 int ResponseImpl::GetCookie(size_t index, BkBuffer *dst) const
 {
     if (m_cookies.size() <= index)
@@ -60,7 +98,7 @@ int ResponseImpl::GetData(int data, BkBuffer *dst) const
             BkSetBufferData(dst, m_originURL.data(), m_originURL.length());
             break;
         case BK_RE_BODY:
-            BkSetBufferData(dst, m_body.data(), m_body.size());
+            m_body.CopyTo(dst->Allocator(m_body.Size(), dst->UserData));
             break;
         default:
             NOTREACHED();
@@ -85,8 +123,6 @@ void ResponseImpl::GZipInflate(void)
     char buf[BufSize];
 
     z_stream stm = { 0 };
-    stm.next_in = m_body.data();
-    stm.avail_in = m_body.size();
 
     int err = inflateInit2(&stm, MAX_WBITS + 32);
     if (Z_OK != err)
@@ -96,32 +132,67 @@ void ResponseImpl::GZipInflate(void)
         return;
     }
 
-    std::string uncompressedData;
-    do {
-        stm.next_out = reinterpret_cast<Bytef *>(buf);
-        stm.avail_out = BufSize;
-        err = inflate(&stm, Z_SYNC_FLUSH);
-        if (err < 0)
-        {
-            BKLOG("inflate failed, code = %d", err);
-            ASSERT(err >= 0);
-            return;
-        }
+    // Bombs are cut at the response limit, like the bodies on the wire.
+    const size_t limit = MemoryGovernor::Shared().ResponseLimit();
+    BkSegmentedBuffer uncompressedData;
+    for (const BkSegmentedBuffer::Segment &segment : m_body.Segments())
+    {
+        stm.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(segment->data()));
+        stm.avail_in = segment->length();
+        do {
+            stm.next_out = reinterpret_cast<Bytef *>(buf);
+            stm.avail_out = BufSize;
+            err = inflate(&stm, Z_SYNC_FLUSH);
+            if (err < 0)
+            {
+                BKLOG("inflate failed, code = %d", err);
+                ASSERT(err >= 0);
+                inflateEnd(&stm);
+                return;
+            }
+
+            size_t cb = BufSize - stm.avail_out;
+            if (0 != limit && uncompressedData.Size() + cb > limit)
+            {
+                cb = limit - uncompressedData.Size();
+                m_truncated = true;
+            }
+            uncompressedData.Append(buf, cb);
+        } while ((stm.avail_in > 0 || 0 == stm.avail_out) && Z_STREAM_END != err && !m_truncated);
+
+        if (m_truncated)
+            break;
+    }
+    inflateEnd(&stm);
 
-        uncompressedData.append(buf, BufSize - stm.avail_out);
-    } while (stm.avail_in > 0);
+    ASSERT(Z_STREAM_END == err || m_truncated);
+    m_body = std::move(uncompressedData);
+    UpdateCountedSize();
+}
 
-    ASSERT(Z_STREAM_END == err);
-    m_body.assign(uncompressedData.begin(), uncompressedData.end());
+void ResponseImpl::HandOverBody(void)
+{
+    m_bodyHandedOver = true;
+    UpdateCountedSize();
 }
 
 void ResponseImpl::Hijack(const void *newBody, size_t length)
 {
-    m_body.resize(length);
+    m_body.Clear();
     if (nullptr != newBody)
-        memcpy(m_body.data(), newBody, length);
+        m_body.Append(newBody, length);
     else
         ASSERT(0 == length);
+    m_truncated = false;
+    UpdateCountedSize();
+}
+
+void ResponseImpl::Hijack(std::string &&newBody)
+{
+    m_body.Clear();
+    m_body.Append(std::move(newBody));
+    m_truncated = false;
+    UpdateCountedSize();
 }
 
 void ResponseImpl::ParseHeaders(const std::string &rawHeaders)
@@ -159,13 +230,22 @@ void ResponseImpl::ParseHeaders(const std::string &rawHeaders)
     }
 }
 
+void ResponseImpl::PrepareBody(size_t cb)
+{
+    const size_t limit = MemoryGovernor::Shared().ResponseLimit();
+    m_body.Reserve(0 != limit ? std::min(cb, limit) : cb);
+}
+
 void ResponseImpl::ResetForRedirection(void)
 {
     m_errorCode = BK_ERR_SUCCESS;
     m_statusCode = 0;
     m_headers.Clear();
     m_cookies.clear();
-    m_body.clear();
+    m_body.Clear();
+    m_firstByteTime = base::TimeTicks();
+    m_truncated = false;
+    UpdateCountedSize();
 }
 
 std::string ResponseImpl::ResolveRedirection(void)
@@ -182,10 +262,22 @@ std::string ResponseImpl::ResolveRedirection(void)
     return ret;
 }
 
+void ResponseImpl::UpdateCountedSize(void)
+{
+    const size_t size = m_bodyHandedOver ? 0 : m_body.Size();
+    MemoryGovernor::Shared().Update(m_countedSize, size);
+    m_countedSize = size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 extern "C" {
 
+BKEXPORT int BKAPI BkGetResponseBodyView(BkResponse response, BkBodyView *view)
+{
+    return response->GetBodyView(view);
+}
+
 BKEXPORT int BKAPI BkGetResponseCookie(BkResponse response, size_t index, BkBuffer *dst)
 {
     return response->GetCookie(index, dst);
@@ -211,4 +303,17 @@ BKEXPORT int BKAPI BkGetResponseStatusCode(BkResponse response)
     return response->StatusCode();
 }
 
+BKEXPORT bool_t BKAPI BkIsResponseTruncated(BkResponse response)
+{
+    return response->IsTruncated();
+}
+
+BKEXPORT void BKAPI BkReleaseBodyView(BkBodyView *view)
+{
+    delete reinterpret_cast<BkSegmentedBuffer::Segment *>(view->Handle);
+    view->Data = nullptr;
+    view->Length = 0;
+    view->Handle = nullptr;
+}
+
 } // extern "C"
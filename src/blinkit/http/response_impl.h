@@ -15,22 +15,28 @@
 #pragma once
 
 #include <atomic>
+#include "base/time/time.h"
 #include "bk_http.h"
 #include "blinkit/common/bk_http_header_map.h"
+#include "blinkit/common/bk_segmented_buffer.h"
 
 class ResponseImpl final : public std::enable_shared_from_this<ResponseImpl>
 {
 public:
     ResponseImpl(const std::string &URL);
+    ~ResponseImpl(void);
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Exports
     int StatusCode(void) const { return m_statusCode; }
+    bool IsTruncated(void) const { return m_truncated; }
     int GetData(int data, BkBuffer *dst) const;
+    int GetBodyView(BkBodyView *view);
     int GetHeader(const char *name, BkBuffer *dst) const;
     size_t CookiesCount(void) const { return m_cookies.size(); }
     int GetCookie(size_t index, BkBuffer *dst) const;
     void Hijack(const void *newBody, size_t length);
+    void Hijack(std::string &&newBody);
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ResetForRedirection(void);
@@ -41,8 +47,9 @@ public:
     BlinKit::BkHTTPHeaderMap& MutableHeaders(void) { return m_headers; }
     const BlinKit::BkHTTPHeaderMap& Headers(void) const { return m_headers; }
 
-    const char* BodyData(void) const { return m_body.empty() ? nullptr : reinterpret_cast<const char *>(m_body.data()); }
-    int BodyLength(void) const { return m_body.size(); }
+    const BlinKit::BkSegmentedBuffer& Body(void) const { return m_body; }
+    // Null if the body is empty.
+    base::TimeTicks FirstByteTime(void) const { return m_firstByteTime; }
 
     const std::string& CurrentURL(void) const { return m_URL; }
     void SetCurrentURL(const std::string &URL) { m_URL = URL; }
@@ -52,15 +59,27 @@ public:
 
     void ParseHeaders(const std::string &rawHeaders);
     std::string ResolveRedirection(void);
-    void PrepareBody(size_t cb) { m_body.reserve(cb); }
-    void AppendData(const void *data, size_t cb);
+    void PrepareBody(size_t cb);
+    // Returns false once the body reaches the response limit, beyond which
+    // data is dropped.
+    bool AppendData(const void *data, size_t cb);
     void GZipInflate(void);
+    // The body is no longer counted by the memory governor, once it is handed
+    // to a crawler which counts it instead.
+    void HandOverBody(void);
 private:
+    // Keeps the usage of the memory governor in step with the body.
+    void UpdateCountedSize(void);
+
     std::string m_originURL, m_URL;
     int m_errorCode = BK_ERR_SUCCESS, m_statusCode = 0;
     BlinKit::BkHTTPHeaderMap m_headers;
     std::vector<std::string> m_cookies;
-    std::vector<unsigned char> m_body;
+    BlinKit::BkSegmentedBuffer m_body;
+    base::TimeTicks m_firstByteTime;
+    bool m_truncated = false;
+    size_t m_countedSize = 0;
+    bool m_bodyHandedOver = false;
 };
 
 #endif // BLINKIT_BLINKIT_RESPONSE_IMPL_H
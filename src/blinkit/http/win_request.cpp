@@ -16,6 +16,7 @@
 #include "url/url_constants.h"
 
 #include "app/app_constants.h"
+#include "http/request_backend.h"
 #include "http/response_impl.h"
 
 namespace BlinKit {
@@ -222,9 +223,8 @@ int WinRequest::ReceiveData(void)
                 return m_response->ErrorCode();
         }
 
-        if (ib.dwBufferLength > 0)
-            m_response->AppendData(buf, ib.dwBufferLength);
-        else
+        // Stops reading once the body is truncated.
+        if (0 == ib.dwBufferLength || !m_response->AppendData(buf, ib.dwBufferLength))
             done = true;
     }
 
@@ -407,11 +407,9 @@ int WinRequest::WaitForIOPending(void)
     return BK_ERR_SUCCESS;
 }
 
-} // namespace BlinKit
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-extern "C" BkRequest BKAPI BkCreateRequest(const char *URL, BkRequestClient *client)
+RequestImpl* CreateNativeRequest(const char *URL, const BkRequestClient &client)
 {
-    return new BlinKit::WinRequest(URL, *client);
+    return new WinRequest(URL, client);
 }
+
+} // namespace BlinKit
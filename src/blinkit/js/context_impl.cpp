@@ -11,9 +11,16 @@
 
 #include "context_impl.h"
 
+#include <cstddef>
+#include <cstdlib>
 #include "base/strings/string_util.h"
+#include "base/trace_event/trace_event.h"
 #include "blinkit/crawler/crawler_impl.h"
+#include "blinkit/crawler/crawler_metrics.h"
+#include "blinkit/crawler/memory_budget.h"
 #include "blinkit/js/js_value_impl.h"
+#include "blinkit/misc/memory_governor.h"
+#include "third_party/blink/renderer/bindings/core/duk/duk.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_attr.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_console.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_document.h"
@@ -22,6 +29,7 @@
 #include "third_party/blink/renderer/bindings/core/duk/duk_navigator.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_script_element.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_window.h"
+#include "third_party/blink/renderer/bindings/core/duk/duk_xml_http_request.h"
 #include "third_party/blink/renderer/bindings/core/duk/script_controller.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 
@@ -30,16 +38,51 @@ using namespace BlinKit;
 
 static const char CrawlerObject[] = "crawlerObject";
 static const char Globals[] = "globals";
-static const char NativeContext[] = "nativeContext";
 
 static void DefaultConsoleOutput(int type, const char *msg)
 {
     BkLog("%s", msg);
 }
 
+// Times the outermost script run by a context, scripts may nest through the
+// crawler object or event listeners.
+class ContextImpl::ScriptTimer
+{
+public:
+    ScriptTimer(ContextImpl &context) : m_context(context)
+    {
+        if (0 == m_context.m_scriptNesting++)
+            m_start = base::TimeTicks::Now();
+    }
+    ~ScriptTimer(void)
+    {
+        if (0 != --m_context.m_scriptNesting)
+            return;
+        if (CrawlerMetrics *metrics = CrawlerMetrics::From(m_context.m_frame))
+            metrics->AddScriptTime(base::TimeTicks::Now() - m_start);
+        if (MemoryBudget *budget = MemoryBudget::From(m_context.m_frame))
+            budget->Checkpoint();
+    }
+private:
+    ContextImpl &m_context;
+    base::TimeTicks m_start;
+};
+
+// Each block is prefixed with its size, so that the heap size can be tracked
+// without asking the system allocator.
+static const size_t BlockHeaderSize = alignof(std::max_align_t);
+
+// The heap alone may not take more than the crawler limit. A failed allocation
+// makes Duktape collect its garbage and retry, and then throw a RangeError.
+static bool ExceedsHeapLimit(size_t heapSize, size_t growth)
+{
+    const size_t limit = MemoryGovernor::Shared().CrawlerLimit();
+    return 0 != limit && heapSize + growth > limit;
+}
+
 ContextImpl::ContextImpl(const LocalFrame &frame)
     : m_frame(frame)
-    , m_ctx(duk_create_heap_default())
+    , m_ctx(duk_create_heap(Alloc, Realloc, Free, this, nullptr))
     , m_consoleMessager(std::bind(DefaultConsoleOutput, std::placeholders::_1, std::placeholders::_2))
 #ifdef BLINKIT_CRAWLER_ONLY
     , m_prototypeMap(DukElement::PrototypeMapForCrawler())
@@ -54,6 +97,20 @@ ContextImpl::~ContextImpl(void)
     duk_destroy_heap(m_ctx);
 }
 
+void* ContextImpl::Alloc(void *udata, duk_size_t size)
+{
+    if (ExceedsHeapLimit(reinterpret_cast<ContextImpl *>(udata)->m_heapSize, size))
+        return nullptr;
+
+    char *block = reinterpret_cast<char *>(malloc(BlockHeaderSize + size));
+    if (nullptr == block)
+        return nullptr;
+
+    *reinterpret_cast<size_t *>(block) = size;
+    reinterpret_cast<ContextImpl *>(udata)->m_heapSize += size;
+    return block + BlockHeaderSize;
+}
+
 bool ContextImpl::AccessCrawler(const Callback &worker)
 {
     const duk_idx_t top = duk_get_top(m_ctx);
@@ -69,6 +126,15 @@ bool ContextImpl::AccessCrawler(const Callback &worker)
     return ret;
 }
 
+void ContextImpl::CollectGarbage(void)
+{
+    TRACE_EVENT0("gc", "ContextImpl::CollectGarbage");
+
+    // The second pass frees the objects resurrected by finalizers.
+    duk_gc(m_ctx, 0);
+    duk_gc(m_ctx, 0);
+}
+
 void ContextImpl::CreateCrawlerObject(const CrawlerImpl &crawler)
 {
     do {
@@ -112,21 +178,28 @@ void ContextImpl::CreateCrawlerObject(const CrawlerImpl &crawler)
 
 void ContextImpl::Eval(const std::string_view code, const Callback &callback, const char *fileName)
 {
+    ScriptTimer timer(*this);
     const duk_idx_t top = duk_get_top(m_ctx);
 
     int r;
-    if (nullptr == fileName || '\0' == *fileName)
-    {
-        r = duk_pcompile_lstring(m_ctx, 0, code.data(), code.length());
-    }
-    else
     {
-        duk_push_string(m_ctx, fileName);
-        r = duk_pcompile_lstring_filename(m_ctx, 0, code.data(), code.length());
+        TRACE_EVENT1("script", "ContextImpl::Compile", "bytes", code.length());
+        if (nullptr == fileName || '\0' == *fileName)
+        {
+            r = duk_pcompile_lstring(m_ctx, 0, code.data(), code.length());
+        }
+        else
+        {
+            duk_push_string(m_ctx, fileName);
+            r = duk_pcompile_lstring_filename(m_ctx, 0, code.data(), code.length());
+        }
     }
 
     if (DUK_EXEC_SUCCESS == r)
+    {
+        TRACE_EVENT0("script", "ContextImpl::Execute");
         r = duk_pcall(m_ctx, 0);
+    }
     callback(m_ctx);
 
     duk_set_top(m_ctx, top);
@@ -150,16 +223,23 @@ void ContextImpl::ExposeGlobals(duk_context *ctx, duk_idx_t dst)
     duk_set_top(ctx, top);
 }
 
-ContextImpl* ContextImpl::From(duk_context *ctx)
+void ContextImpl::Free(void *udata, void *ptr)
 {
-    ContextImpl *ret = nullptr;
+    if (nullptr == ptr)
+        return;
 
-    duk_push_heap_stash(ctx);
-    duk_get_prop_string(ctx, -1, NativeContext);
-    ret = reinterpret_cast<ContextImpl *>(duk_get_pointer(ctx, -1));
-    duk_pop_2(ctx);
+    char *block = reinterpret_cast<char *>(ptr) - BlockHeaderSize;
+    reinterpret_cast<ContextImpl *>(udata)->m_heapSize -= *reinterpret_cast<size_t *>(block);
+    free(block);
+}
 
-    return ret;
+ContextImpl* ContextImpl::From(duk_context *ctx)
+{
+    // The heap is created with the context as its user data, which is much
+    // cheaper to get than a stash property.
+    duk_memory_functions functions;
+    duk_get_memory_functions(ctx, &functions);
+    return reinterpret_cast<ContextImpl *>(functions.udata);
 }
 
 ContextImpl* ContextImpl::From(ExecutionContext *executionContext)
@@ -181,10 +261,9 @@ GCPool& ContextImpl::GetGCPool(void)
 
 void ContextImpl::InitializeHeapStash(void)
 {
-    duk_push_heap_stash(m_ctx);
+    m_nameCache = std::make_unique<Duk::NameCache>(m_ctx);
 
-    duk_push_pointer(m_ctx, this);
-    duk_put_prop_string(m_ctx, -2, NativeContext);
+    duk_push_heap_stash(m_ctx);
 
     duk_push_global_object(m_ctx);
     duk_put_prop_string(m_ctx, -2, Globals);
@@ -237,6 +316,27 @@ void ContextImpl::RegisterPrototypesForCrawler(duk_context *ctx)
     DukNode::RegisterPrototype(helper, ProtoNames::Text);
     DukScriptElement::RegisterPrototypeForCrawler(helper);
     DukWindow::RegisterPrototypeForCrawler(helper);
+    DukXMLHttpRequest::RegisterPrototype(helper);
+}
+
+void* ContextImpl::Realloc(void *udata, void *ptr, duk_size_t size)
+{
+    if (nullptr == ptr)
+        return Alloc(udata, size);
+
+    char *block = reinterpret_cast<char *>(ptr) - BlockHeaderSize;
+    const size_t oldSize = *reinterpret_cast<size_t *>(block);
+    ContextImpl *context = reinterpret_cast<ContextImpl *>(udata);
+    if (size > oldSize && ExceedsHeapLimit(context->m_heapSize, size - oldSize))
+        return nullptr;
+
+    block = reinterpret_cast<char *>(realloc(block, BlockHeaderSize + size));
+    if (nullptr == block)
+        return nullptr;
+
+    *reinterpret_cast<size_t *>(block) = size;
+    context->m_heapSize = context->m_heapSize - oldSize + size;
+    return block + BlockHeaderSize;
 }
 
 void ContextImpl::Reset(void)
@@ -255,6 +355,34 @@ void ContextImpl::Reset(void)
     ToCrawlerImpl(m_frame.Client())->ProcessDocumentReset();
 }
 
+void ContextImpl::Run(const std::string &bytecode, const Callback &callback)
+{
+    ScriptTimer timer(*this);
+    const duk_idx_t top = duk_get_top(m_ctx);
+
+    // The bytecode buffer is only read while loading, no need to copy it.
+    duk_push_external_buffer(m_ctx);
+    duk_config_buffer(m_ctx, -1, const_cast<char *>(bytecode.data()), bytecode.length());
+
+    const auto loader = [](duk_context *ctx, void *) -> duk_ret_t {
+        duk_load_function(ctx);
+        return 1;
+    };
+    int r;
+    {
+        TRACE_EVENT1("script", "ContextImpl::LoadBytecode", "bytes", bytecode.length());
+        r = duk_safe_call(m_ctx, loader, nullptr, 1, 1);
+    }
+    if (DUK_EXEC_SUCCESS == r)
+    {
+        TRACE_EVENT0("script", "ContextImpl::Execute");
+        r = duk_pcall(m_ctx, 0);
+    }
+    callback(m_ctx);
+
+    duk_set_top(m_ctx, top);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 extern "C" {
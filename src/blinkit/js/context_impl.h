@@ -15,6 +15,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string_view>
 #include <unordered_map>
 #include "bk_js.h"
@@ -27,6 +28,9 @@ class LocalFrame;
 
 namespace BlinKit {
 class GCPool;
+namespace Duk {
+class NameCache;
+}
 }
 
 class CrawlerImpl;
@@ -41,26 +45,43 @@ public:
     static ContextImpl* From(blink::ExecutionContext *executionContext);
 
     void Reset(void);
+    // Runs a full mark-and-sweep, so that wrappers in reference cycles are
+    // finalized now instead of on the next periodic collection.
+    void CollectGarbage(void);
 
     const char* LookupPrototypeName(const std::string &tagName) const;
 
     typedef std::function<void(duk_context *)> Callback;
     bool AccessCrawler(const Callback &worker);
     void Eval(const std::string_view code, const Callback &callback, const char *fileName = "eval");
+    // Like Eval, but runs a program dumped by duk_dump_function, which must
+    // come from the same build of duktape.
+    void Run(const std::string &bytecode, const Callback &callback);
     void ConsoleOutput(int type, const char *msg) { m_consoleMessager(type, msg); }
 
     BlinKit::GCPool& GetGCPool(void);
+    BlinKit::Duk::NameCache& GetNameCache(void) { return *m_nameCache; }
     duk_context* GetRawContext(void) const { return m_ctx; }
+    // Bytes allocated by the heap, excluding the allocator overhead.
+    size_t HeapSize(void) const { return m_heapSize; }
 private:
+    static void* Alloc(void *udata, duk_size_t size);
+    static void* Realloc(void *udata, void *ptr, duk_size_t size);
+    static void Free(void *udata, void *ptr);
+
+    class ScriptTimer;
     void InitializeHeapStash(void);
     static void RegisterPrototypesForCrawler(duk_context *ctx);
     void CreateCrawlerObject(const CrawlerImpl &crawler);
     static void ExposeGlobals(duk_context *ctx, duk_idx_t dst);
 
     const blink::LocalFrame &m_frame;
+    size_t m_heapSize = 0; // Must be ready before the heap is created.
+    unsigned m_scriptNesting = 0;
     duk_context *m_ctx;
     std::function<void(int, const char *)> m_consoleMessager;
     const std::unordered_map<std::string, const char *> &m_prototypeMap;
+    std::unique_ptr<BlinKit::Duk::NameCache> m_nameCache;
 };
 
 #endif // BLINKIT_BLINKIT_CONTEXT_IMPL_H
@@ -13,7 +13,10 @@
 
 #include "base/auto_reset.h"
 #include "base/single_thread_task_runner.h"
+#include "base/trace_event/trace_event.h"
 #include "blinkit/crawler/crawler_impl.h"
+#include "blinkit/crawler/crawler_metrics.h"
+#include "blinkit/crawler/memory_budget.h"
 #include "blinkit/http/request_impl.h"
 #include "blinkit/http/response_impl.h"
 #include "net/http/http_util.h"
@@ -29,6 +32,7 @@ namespace BlinKit {
 HTTPLoaderTask::HTTPLoaderTask(BkCrawler crawler, const std::shared_ptr<base::SingleThreadTaskRunner> &taskRunner, WebURLLoaderClient *client)
     : LoaderTask(taskRunner, client)
     , m_crawler(crawler)
+    , m_jobAborted(crawler->JobAborted())
 {
 }
 
@@ -61,22 +65,37 @@ void HTTPLoaderTask::DoCancel(void)
 void HTTPLoaderTask::DoContinue(void)
 {
     ASSERT(IsMainThread());
+    if (DropIfAborted())
+        return;
 
     ResourceResponse response(BkURL(m_response->CurrentURL()));
     PopulateResourceResponse(response);
     m_client->DidReceiveResponse(response);
-    m_client->DidReceiveData(m_response->BodyData(), m_response->BodyLength());
+    m_response->HandOverBody();
+    m_crawler->Memory().DidReceiveBody(m_response->Body());
+    m_client->DidReceiveBuffer(m_response->Body());
     m_client->DidFinishLoading();
+    m_crawler->DidFinishRequest();
     delete this;
 }
 
+bool HTTPLoaderTask::DropIfAborted(void)
+{
+    if (!*m_jobAborted)
+        return false;
+
+    m_crawler->DidFinishRequest();
+    delete this;
+    return true;
+}
+
 AtomicString HTTPLoaderTask::GetResponseHeader(const AtomicString &name) const
 {
     std::string ret = m_response->Headers().Get(name.StdUtf8());
     return ret.empty() ? g_null_atom : AtomicString::FromStdUTF8(ret);
 }
 
-void HTTPLoaderTask::PopulateHijackedResponse(const std::string &URL, const std::string &hijack)
+void HTTPLoaderTask::PopulateHijackedResponse(const std::string &URL, std::string &&hijack)
 {
     ASSERT(!m_response);
     m_response = std::make_shared<ResponseImpl>(URL);
@@ -94,12 +113,13 @@ void HTTPLoaderTask::PopulateHijackedResponse(const std::string &URL, const std:
         default: NOTREACHED();
     }
 
-    m_response->Hijack(hijack.data(), hijack.length());
+    m_response->Hijack(std::move(hijack));
 }
 
 void HTTPLoaderTask::PopulateResourceResponse(ResourceResponse &response) const
 {
     response.SetHTTPStatusCode(m_response->StatusCode());
+    response.SetHTTPHeaderFields(m_response->Headers());
 
     bool hasCharset = false;
     std::string mimeType, charset;
@@ -119,7 +139,7 @@ bool HTTPLoaderTask::ProcessHijackRequest(const std::string &URL)
     if (!m_crawler->HijackRequest(URL.c_str(), hijack))
         return false;
 
-    PopulateHijackedResponse(URL, hijack);
+    PopulateHijackedResponse(URL, std::move(hijack));
     return true;
 }
 
@@ -134,6 +154,14 @@ bool HTTPLoaderTask::ProcessHijackResponse(void)
 void HTTPLoaderTask::ProcessRequestComplete(void)
 {
     ASSERT(m_response);
+    if (DropIfAborted())
+        return;
+
+    base::TimeTicks firstByteTime = m_response->FirstByteTime();
+    if (firstByteTime.is_null())
+        firstByteTime = base::TimeTicks::Now();
+    m_crawler->Metrics().DidFinishRequest(m_resourceType, m_response->Body().Size(), firstByteTime);
+
     do {
         if (ProcessHijackResponse())
             break;
@@ -156,6 +184,7 @@ void HTTPLoaderTask::ProcessRequestComplete(void)
 
 void HTTPLoaderTask::RequestComplete(BkResponse response)
 {
+    TRACE_EVENT_NESTABLE_ASYNC_END0("net", "HTTPLoaderTask::Wait", this);
     m_response = response->shared_from_this();
 
     std::function<void()> callback = std::bind(&HTTPLoaderTask::ProcessRequestComplete, this);
@@ -165,7 +194,20 @@ void HTTPLoaderTask::RequestComplete(BkResponse response)
 void HTTPLoaderTask::RequestFailed(int errorCode)
 {
     BKLOG("HTTPLoaderTask::RequestFailed: %d.", errorCode);
-    LoaderTask::ReportError(m_client, m_taskRunner.get(), errorCode, m_url);
+    // May be called on a network thread.
+    TRACE_EVENT_NESTABLE_ASYNC_END0("net", "HTTPLoaderTask::Wait", this);
+    BkCrawler crawler = m_crawler;
+    std::shared_ptr<const bool> jobAborted = m_jobAborted;
+    std::shared_ptr<base::SingleThreadTaskRunner> taskRunner = m_taskRunner;
+    WebURLLoaderClient *client = m_client;
+    BkURL URL = m_url;
+    std::function<void()> callback = [crawler, jobAborted, taskRunner, client, errorCode, URL] {
+        crawler->DidFinishRequest();
+        // Dropped for an aborted job, like the responses.
+        if (!*jobAborted)
+            LoaderTask::ReportError(client, taskRunner.get(), errorCode, URL);
+    };
+    m_taskRunner->PostTask(FROM_HERE, callback);
     delete this;
 }
 
@@ -173,6 +215,16 @@ int HTTPLoaderTask::Run(const ResourceRequest &request)
 {
     m_url = request.Url();
     m_hijackType = request.GetHijackType();
+    m_resourceType = request.GetResourceType();
+
+    // An aborted job sends nothing more.
+    if (*m_jobAborted)
+    {
+        delete this;
+        return BK_ERR_SUCCESS;
+    }
+
+    m_crawler->DidStartRequest();
 
     const std::string URL = m_url.AsString();
     if (ProcessHijackRequest(URL))
@@ -186,18 +238,26 @@ int HTTPLoaderTask::Run(const ResourceRequest &request)
     if (nullptr == req)
     {
         ASSERT(nullptr != req);
+        m_crawler->DidFinishRequest();
         return BK_ERR_UNKNOWN;
     }
 
     req->SetMethod(request.HttpMethod().StdUtf8());
     req->SetHeaders(request.AllHeaders());
-    BKLOG("// BKTODO: Add body.");
+    if (const std::shared_ptr<const std::string> &body = request.HttpBodyData())
+        req->SetBody(body->data(), body->length());
+
+    m_crawler->Metrics().DidStartRequest(m_resourceType);
 
+    // Spans the time from sending the request to the whole response received.
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN0("net", "HTTPLoaderTask::Wait", this);
     int r = req->Perform();
     if (BK_ERR_SUCCESS != r)
     {
         ASSERT(BK_ERR_SUCCESS == r);
+        TRACE_EVENT_NESTABLE_ASYNC_END0("net", "HTTPLoaderTask::Wait", this);
         delete req;
+        m_crawler->DidFinishRequest();
     }
     return r;
 }
@@ -40,10 +40,12 @@ private:
     bool ProcessHijackRequest(const std::string &URL);
     bool ProcessHijackResponse(void);
     void ProcessRequestComplete(void);
-    void PopulateHijackedResponse(const std::string &URL, const std::string &hijack);
+    void PopulateHijackedResponse(const std::string &URL, std::string &&hijack);
     void PopulateResourceResponse(blink::ResourceResponse &response) const;
     void DoContinue(void);
     void DoCancel(void);
+    // Deletes the task if its job was aborted.
+    bool DropIfAborted(void);
 
     // LoaderTask
     int Run(const blink::ResourceRequest &request) override;
@@ -56,8 +58,10 @@ private:
     int CancelWork(void) override;
 
     BkCrawler m_crawler;
+    std::shared_ptr<const bool> m_jobAborted;
     BkURL m_url;
     blink::HijackType m_hijackType = blink::HijackType::kOther;
+    blink::ResourceType m_resourceType {};
     std::shared_ptr<ResponseImpl> m_response;
 
     bool m_callingCrawler = false;
@@ -0,0 +1,43 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: memory_governor.cpp
+// Description: MemoryGovernor Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "memory_governor.h"
+
+#include <algorithm>
+
+namespace BlinKit {
+
+size_t MemoryGovernor::FairShare(void) const
+{
+    const unsigned crawlers = m_crawlers;
+    return m_processLimit / std::max(crawlers, 1u);
+}
+
+bool MemoryGovernor::IsOverProcessLimit(void) const
+{
+    const size_t limit = m_processLimit;
+    return 0 != limit && m_usage > limit;
+}
+
+void MemoryGovernor::SetLimits(const BkMemoryLimits &limits)
+{
+    m_processLimit = limits.ProcessLimit;
+    m_crawlerLimit = limits.CrawlerLimit;
+    m_responseLimit = limits.ResponseLimit;
+}
+
+MemoryGovernor& MemoryGovernor::Shared(void)
+{
+    static MemoryGovernor s_instance;
+    return s_instance;
+}
+
+} // namespace BlinKit
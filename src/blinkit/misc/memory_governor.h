@@ -0,0 +1,55 @@
+// -------------------------------------------------
+// BlinKit - BlinKit Library
+// -------------------------------------------------
+//   File Name: memory_governor.h
+// Description: MemoryGovernor Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINKIT_MEMORY_GOVERNOR_H
+#define BLINKIT_BLINKIT_MEMORY_GOVERNOR_H
+
+#pragma once
+
+#include <atomic>
+#include "bk_crawler.h"
+
+namespace BlinKit {
+
+// The memory limits of the process, and the usage counted against them: the
+// bodies of the responses still held by the HTTP stack, and the last measured
+// usage of each crawler. Usage is counted from any thread, so everything here
+// is atomic. A limit of 0 means no limit.
+class MemoryGovernor
+{
+public:
+    static MemoryGovernor& Shared(void);
+
+    void SetLimits(const BkMemoryLimits &limits);
+    size_t ProcessLimit(void) const { return m_processLimit; }
+    size_t CrawlerLimit(void) const { return m_crawlerLimit; }
+    size_t ResponseLimit(void) const { return m_responseLimit; }
+
+    size_t Usage(void) const { return m_usage; }
+    bool IsOverProcessLimit(void) const;
+    // The part of the process limit for each crawler, 0 if there is no limit.
+    size_t FairShare(void) const;
+
+    void AddCrawler(void) { ++m_crawlers; }
+    void RemoveCrawler(void) { --m_crawlers; }
+    // Replaces |oldBytes| counted before by |newBytes|.
+    void Update(size_t oldBytes, size_t newBytes) { m_usage += newBytes - oldBytes; }
+private:
+    MemoryGovernor(void) = default;
+
+    std::atomic<size_t> m_processLimit{ 0 }, m_crawlerLimit{ 0 }, m_responseLimit{ 0 };
+    std::atomic<size_t> m_usage{ 0 };
+    std::atomic<unsigned> m_crawlers{ 0 };
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINKIT_MEMORY_GOVERNOR_H
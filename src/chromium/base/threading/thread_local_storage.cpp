@@ -64,6 +64,53 @@ static TlsVectorEntry* EnsureTlsVector(void)
     return reinterpret_cast<TlsVectorEntry *>(p);
 }
 
+static void OnThreadExitInternal(TlsVectorEntry *vectorData)
+{
+    // Destructors may use TLS, keep the vector reachable while they run.
+    PlatformThreadLocalStorage::SetTLSValue(g_nativeTlsKey, vectorData);
+
+    TlsMetadata metadata[kThreadLocalStorageSize];
+    {
+        std::lock_guard<std::mutex> lock(g_metadataLock);
+        memcpy(metadata, g_tlsMetadata, sizeof(metadata));
+    }
+
+    for (int slot = 0; slot < kThreadLocalStorageSize; ++slot)
+    {
+        void *value = vectorData[slot].data;
+        if (nullptr == value || TlsStatus::FREE == metadata[slot].status
+            || metadata[slot].version != vectorData[slot].version)
+        {
+            continue;
+        }
+
+        vectorData[slot].data = nullptr;
+        if (nullptr != metadata[slot].destructor)
+            metadata[slot].destructor(value);
+    }
+
+    PlatformThreadLocalStorage::SetTLSValue(g_nativeTlsKey, kUninitialized);
+    delete[] vectorData;
+}
+
+#if defined(OS_WIN)
+void PlatformThreadLocalStorage::OnThreadExit(void)
+{
+    if (TLS_KEY_OUT_OF_INDEXES == g_nativeTlsKey)
+        return;
+
+    void *value = GetTLSValue(g_nativeTlsKey);
+    if (kUninitialized == value || kDestroyed == value)
+        return;
+    OnThreadExitInternal(reinterpret_cast<TlsVectorEntry *>(value));
+}
+#elif defined(OS_POSIX)
+void PlatformThreadLocalStorage::OnThreadExit(void *value)
+{
+    OnThreadExitInternal(reinterpret_cast<TlsVectorEntry *>(value));
+}
+#endif
+
 ThreadLocalStorage::Slot::Slot(TLSDestructorFunc destructor)
 {
     static std::once_flag s_flag;
@@ -53,7 +53,11 @@ public:
     static void FreeTLS(TLSKey key);
     static void* GetTLSValue(TLSKey key);
     static void SetTLSValue(TLSKey key, void *value);
-#if defined(OS_POSIX)
+#if defined(OS_WIN)
+    // Destroys the TLS of the calling thread. Called from the TLS callback of
+    // the module, which Windows runs as each thread exits.
+    static void OnThreadExit(void);
+#elif defined(OS_POSIX)
     // |Value| is the data stored in TLS slot, The implementation can't use
     // GetTLSValue() to retrieve the value of slot as it has already been reset
     // in Posix.
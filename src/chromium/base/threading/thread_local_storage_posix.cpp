@@ -34,11 +34,6 @@ void* PlatformThreadLocalStorage::GetTLSValue(TLSKey key)
     return pthread_getspecific(key);
 }
 
-void PlatformThreadLocalStorage::OnThreadExit(void *value)
-{
-    assert(false); // BKTODO:
-}
-
 void PlatformThreadLocalStorage::SetTLSValue(TLSKey key, void *value)
 {
     int ret = pthread_setspecific(key, value);
@@ -41,3 +41,36 @@ void PlatformThreadLocalStorage::SetTLSValue(TLSKey key, void *value)
 
 } // namespace internal
 } // namespace base
+
+// Windows has no destructor for TLS keys, so the TLS of each thread is
+// destroyed from a TLS callback of the module, which runs as threads exit.
+static void NTAPI OnThreadExit(PVOID module, DWORD reason, PVOID reserved)
+{
+    if (DLL_THREAD_DETACH == reason || DLL_PROCESS_DETACH == reason)
+        base::internal::PlatformThreadLocalStorage::OnThreadExit();
+}
+
+// Keeps the linker from dropping the TLS directory and the callback, which
+// nothing refers to.
+#ifdef _WIN64
+#   pragma comment(linker, "/INCLUDE:_tls_used")
+#   pragma comment(linker, "/INCLUDE:p_thread_callback_base")
+#else
+#   pragma comment(linker, "/INCLUDE:__tls_used")
+#   pragma comment(linker, "/INCLUDE:_p_thread_callback_base")
+#endif
+
+// The callbacks are picked up from the .CRT$XL? sections in alphabetical
+// order, between .CRT$XLA and .CRT$XLZ of the CRT.
+extern "C" {
+#ifdef _WIN64
+#   pragma const_seg(".CRT$XLB")
+extern const PIMAGE_TLS_CALLBACK p_thread_callback_base;
+const PIMAGE_TLS_CALLBACK p_thread_callback_base = OnThreadExit;
+#   pragma const_seg()
+#else
+#   pragma data_seg(".CRT$XLB")
+PIMAGE_TLS_CALLBACK p_thread_callback_base = OnThreadExit;
+#   pragma data_seg()
+#endif
+}
@@ -15,6 +15,7 @@
 
 #include "time.h"
 
+#include <chrono>
 #include "base/numerics/checked_math.h"
 
 namespace base {
@@ -48,32 +49,75 @@ int64_t SaturatedSub(TimeDelta delta, int64_t value)
 
 bool Time::FromExploded(bool isLocal, const Exploded &exploded, Time *time)
 {
-    assert(false); // BKTODO:
-    return false;
+    int64_t seconds;
+    if (isLocal)
+    {
+        struct tm timeStruct = { 0 };
+        timeStruct.tm_sec = exploded.second;
+        timeStruct.tm_min = exploded.minute;
+        timeStruct.tm_hour = exploded.hour;
+        timeStruct.tm_mday = exploded.day_of_month;
+        timeStruct.tm_mon = exploded.month - 1;
+        timeStruct.tm_year = exploded.year - 1900;
+        timeStruct.tm_isdst = -1;
+        time_t t = mktime(&timeStruct);
+        if (-1 == t)
+        {
+            *time = Time();
+            return false;
+        }
+        seconds = t;
+    }
+    else
+    {
+        // Days from civil, see http://howardhinnant.github.io/date_algorithms.html
+        int64_t y = exploded.year - (exploded.month <= 2 ? 1 : 0);
+        int64_t era = (y >= 0 ? y : y - 399) / 400;
+        int64_t yoe = y - era * 400;
+        int64_t doy = (153 * (exploded.month + (exploded.month > 2 ? -3 : 9)) + 2) / 5 + exploded.day_of_month - 1;
+        int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        int64_t days = era * 146097 + doe - 719468;
+        seconds = days * 86400 + exploded.hour * 3600 + exploded.minute * 60 + exploded.second;
+    }
+
+    CheckedNumeric<int64_t> us(seconds);
+    us *= kMicrosecondsPerSecond;
+    us += exploded.millisecond * kMicrosecondsPerMillisecond;
+    us += kTimeTToMicrosecondsOffset;
+    if (!us.IsValid())
+    {
+        *time = Time();
+        return false;
+    }
+
+    *time = Time(us.ValueOrDie());
+    return true;
 }
 
 Time Time::Now(void)
 {
-    assert(false); // BKTODO:
-    return Time();
+    using namespace std::chrono;
+    int64_t us = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+    return Time(us + kTimeTToMicrosecondsOffset);
 }
 
 double Time::ToDoubleT(void) const
 {
-    assert(false); // BKTODO:
-    return 0;
+    if (is_null())
+        return 0;
+    return (since_origin() - TimeDelta::FromMicroseconds(kTimeTToMicrosecondsOffset)).InSecondsF();
 }
 
 time_t Time::ToTimeT(void) const
 {
-    assert(false); // BKTODO:
-    return 0;
+    if (is_null())
+        return 0;
+    return static_cast<time_t>(ToDoubleT());
 }
 
 TimeDelta TimeDelta::FromMicroseconds(int64_t us)
 {
-    assert(false); // BKTODO:
-    return TimeDelta();
+    return TimeDelta(us);
 }
 
 TimeDelta TimeDelta::FromMilliseconds(int64_t ms)
@@ -98,8 +142,12 @@ TimeDelta TimeDelta::FromSeconds(int64_t secs)
 
 TimeDelta TimeDelta::FromSecondsD(double secs)
 {
-    assert(false); // BKTODO:
-    return TimeDelta();
+    double us = secs * Time::kMicrosecondsPerSecond;
+    if (us >= static_cast<double>(std::numeric_limits<int64_t>::max()))
+        return Max();
+    if (us <= static_cast<double>(std::numeric_limits<int64_t>::min()))
+        return Min();
+    return TimeDelta(static_cast<int64_t>(us));
 }
 
 int64_t TimeDelta::InMilliseconds(void) const
@@ -109,14 +157,16 @@ int64_t TimeDelta::InMilliseconds(void) const
 
 double TimeDelta::InMillisecondsF(void) const
 {
-    assert(false); // BKTODO:
-    return 0;
+    if (is_max())
+        return std::numeric_limits<double>::infinity();
+    return static_cast<double>(m_delta) / Time::kMicrosecondsPerMillisecond;
 }
 
 double TimeDelta::InSecondsF(void) const
 {
-    assert(false); // BKTODO:
-    return 0;
+    if (is_max())
+        return std::numeric_limits<double>::infinity();
+    return static_cast<double>(m_delta) / Time::kMicrosecondsPerSecond;
 }
 
 }  // namespace base
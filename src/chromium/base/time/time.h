@@ -61,12 +61,23 @@ public:
     constexpr bool is_max(void) const { return std::numeric_limits<int64_t>::max() == m_delta; }
     constexpr bool is_min(void) const { return std::numeric_limits<int64_t>::min() == m_delta; }
 
+    TimeDelta operator+(TimeDelta other) const {
+        return TimeDelta(time_internal::SaturatedAdd(*this, other.m_delta));
+    }
     TimeDelta operator-(TimeDelta other) const {
         return TimeDelta(time_internal::SaturatedSub(*this, other.m_delta));
     }
     constexpr TimeDelta operator%(TimeDelta a) const {
         return TimeDelta(m_delta % a.m_delta);
     }
+
+    // Comparison operators
+    constexpr bool operator==(TimeDelta other) const { return m_delta == other.m_delta; }
+    constexpr bool operator!=(TimeDelta other) const { return m_delta != other.m_delta; }
+    constexpr bool operator<(TimeDelta other) const { return m_delta < other.m_delta; }
+    constexpr bool operator<=(TimeDelta other) const { return m_delta <= other.m_delta; }
+    constexpr bool operator>(TimeDelta other) const { return m_delta > other.m_delta; }
+    constexpr bool operator>=(TimeDelta other) const { return m_delta >= other.m_delta; }
 private:
     friend int64_t time_internal::SaturatedAdd(TimeDelta delta, int64_t value);
     friend int64_t time_internal::SaturatedSub(TimeDelta delta, int64_t value);
@@ -160,6 +171,10 @@ public:
         bool HasValidValues(void) const;
     };
 
+    // Offset of UNIX epoch (1970-01-01 00:00:00 UTC) from Windows FILETIME epoch
+    // (1601-01-01 00:00:00 UTC), in microseconds.
+    static constexpr int64_t kTimeTToMicrosecondsOffset = INT64_C(11644473600000000);
+
     Time(void) : TimeBase(0) {}
 
     static Time Now(void);
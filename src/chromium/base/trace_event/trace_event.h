@@ -0,0 +1,52 @@
+// -------------------------------------------------
+// BlinKit - base Library
+// -------------------------------------------------
+//   File Name: trace_event.h
+// Description: Trace Macros
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BASE_TRACE_EVENT_H
+#define BLINKIT_BASE_TRACE_EVENT_H
+
+#pragma once
+
+#include "base/trace_event/trace_log.h"
+
+// Categories and names must be string literals, events keep the pointers.
+// The flag of a category is looked up once per call site, after that a
+// disabled span costs a load and a branch.
+
+#define TRACE_EVENT_CATEGORY_ENABLED(category)                                          \
+    [] {                                                                                \
+        static const std::atomic<bool> *s_enabled =                                     \
+            ::base::trace_event::TraceLog::GetInstance()->GetCategoryEnabled(category); \
+        return s_enabled;                                                               \
+    }()
+
+#define TRACE_EVENT_UID_CAT(a, b)   a##b
+#define TRACE_EVENT_UID(a, b)       TRACE_EVENT_UID_CAT(a, b)
+
+// Traces the enclosing scope, through a tracer which may be given arguments.
+#define TRACE_EVENT_NAMED0(tracer, category, name) \
+    ::base::trace_event::ScopedTracer tracer(TRACE_EVENT_CATEGORY_ENABLED(category), category, name)
+
+#define TRACE_EVENT0(category, name) \
+    TRACE_EVENT_NAMED0(TRACE_EVENT_UID(_traceScope, __LINE__), category, name)
+
+#define TRACE_EVENT1(category, name, arg1Name, arg1Value)                                                   \
+    TRACE_EVENT0(category, name);                                                                           \
+    if (TRACE_EVENT_UID(_traceScope, __LINE__).IsActive())                                                  \
+        TRACE_EVENT_UID(_traceScope, __LINE__).SetArg(0, arg1Name, static_cast<uint64_t>(arg1Value))
+
+// Spans which may end in another function or thread, matched by |id|.
+#define TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(category, name, id) \
+    ::base::trace_event::AddAsyncEvent(TRACE_EVENT_CATEGORY_ENABLED(category), category, name, 'b', id)
+
+#define TRACE_EVENT_NESTABLE_ASYNC_END0(category, name, id) \
+    ::base::trace_event::AddAsyncEvent(TRACE_EVENT_CATEGORY_ENABLED(category), category, name, 'e', id)
+
+#endif // BLINKIT_BASE_TRACE_EVENT_H
@@ -0,0 +1,240 @@
+// -------------------------------------------------
+// BlinKit - base Library
+// -------------------------------------------------
+//   File Name: trace_log.cpp
+// Description: TraceLog Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "trace_log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+namespace base {
+namespace trace_event {
+
+static const size_t kDefaultEventsPerThread = 64 * 1024;
+
+TraceLog::TraceLog(void) : m_threadBuffer(OnThreadExit)
+{
+    Now(); // Fix the origin of the timestamps.
+}
+
+TraceLog::~TraceLog(void) = default;
+
+void TraceLog::AddEvent(const TraceEvent &event)
+{
+    ThreadBuffer *buffer = GetThreadBuffer();
+    if (nullptr == buffer)
+        return;
+
+    // Only this thread writes to the buffer, so the count may be read and
+    // written without a lock. The release store publishes the event.
+    size_t count = buffer->count.load(std::memory_order_relaxed);
+    buffer->events[count % buffer->events.size()] = event;
+    buffer->count.store(count + 1, std::memory_order_release);
+}
+
+static void AppendJSONString(std::string &dst, const char *s)
+{
+    dst.push_back('"');
+    for (; '\0' != *s; ++s)
+    {
+        if ('"' == *s || '\\' == *s)
+            dst.push_back('\\');
+        dst.push_back(*s);
+    }
+    dst.push_back('"');
+}
+
+std::string TraceLog::ExportJSON(void) const
+{
+    std::string ret("{\"traceEvents\":[");
+
+    char buf[128];
+    bool first = true;
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    const unsigned session = m_session.load(std::memory_order_relaxed);
+    for (const auto &buffer : m_buffers)
+    {
+        if (buffer->session != session)
+            continue;
+
+        const size_t capacity = buffer->events.size();
+        const size_t count = buffer->count.load(std::memory_order_acquire);
+        for (size_t i = count > capacity ? count - capacity : 0; i < count; ++i)
+        {
+            const TraceEvent &e = buffer->events[i % capacity];
+
+            if (!first)
+                ret.push_back(',');
+            first = false;
+
+            ret.append("{\"cat\":");
+            AppendJSONString(ret, e.category);
+            ret.append(",\"name\":");
+            AppendJSONString(ret, e.name);
+            snprintf(buf, sizeof(buf), ",\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64,
+                e.phase, buffer->threadId, e.timestamp);
+            ret.append(buf);
+            if ('X' == e.phase)
+                snprintf(buf, sizeof(buf), ",\"dur\":%" PRIu64, e.duration);
+            else
+                snprintf(buf, sizeof(buf), ",\"id\":\"0x%" PRIx64 "\"", e.id);
+            ret.append(buf);
+
+            ret.append(",\"args\":{");
+            for (unsigned j = 0; j < 2 && nullptr != e.argNames[j]; ++j)
+            {
+                if (j > 0)
+                    ret.push_back(',');
+                AppendJSONString(ret, e.argNames[j]);
+                snprintf(buf, sizeof(buf), ":%" PRIu64, e.argValues[j]);
+                ret.append(buf);
+            }
+            ret.append("}}");
+        }
+    }
+
+    ret.append("],\"displayTimeUnit\":\"ms\"}");
+    return ret;
+}
+
+const std::atomic<bool>* TraceLog::GetCategoryEnabled(const char *category)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    for (const Category &c : m_categories)
+    {
+        if (c.name == category)
+            return &c.enabled;
+    }
+
+    m_categories.emplace_back();
+
+    Category &c = m_categories.back();
+    c.name = category;
+    if (0 != m_eventsPerThread)
+        c.enabled.store(MatchesFilter(c.name), std::memory_order_relaxed);
+    return &c.enabled;
+}
+
+TraceLog* TraceLog::GetInstance(void)
+{
+    // Leaked on purpose, threads may still trace while the process exits.
+    static TraceLog *s_instance = new TraceLog;
+    return s_instance;
+}
+
+TraceLog::ThreadBuffer* TraceLog::GetThreadBuffer(void)
+{
+    const unsigned session = m_session.load(std::memory_order_acquire);
+
+    ThreadBuffer *buffer = reinterpret_cast<ThreadBuffer *>(m_threadBuffer.Get());
+    if (nullptr == buffer)
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (0 == m_eventsPerThread)
+            return nullptr;
+
+        m_buffers.emplace_back(std::make_unique<ThreadBuffer>());
+        buffer = m_buffers.back().get();
+        buffer->threadId = m_nextThreadId++;
+        buffer->session = session;
+        buffer->events.resize(m_eventsPerThread);
+        m_threadBuffer.Set(buffer);
+        return buffer;
+    }
+
+    if (buffer->session != session)
+    {
+        // Tracing was restarted since this thread last traced.
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (0 == m_eventsPerThread)
+            return nullptr;
+        buffer->events.resize(m_eventsPerThread);
+        buffer->count.store(0, std::memory_order_relaxed);
+        buffer->session = session;
+    }
+    return buffer;
+}
+
+bool TraceLog::MatchesFilter(const std::string &category) const
+{
+    if (m_filter.empty())
+        return true;
+    return std::find(m_filter.begin(), m_filter.end(), category) != m_filter.end();
+}
+
+uint64_t TraceLog::Now(void)
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point s_origin = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - s_origin).count();
+}
+
+void TraceLog::OnThreadExit(void *buffer)
+{
+    reinterpret_cast<ThreadBuffer *>(buffer)->threadExited.store(true, std::memory_order_release);
+}
+
+void TraceLog::Start(const std::string &categories, size_t eventsPerThread)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    m_filter.clear();
+    size_t b = 0;
+    while (b < categories.length())
+    {
+        size_t e = categories.find(',', b);
+        if (std::string::npos == e)
+            e = categories.length();
+        if (e > b)
+            m_filter.emplace_back(categories.substr(b, e - b));
+        b = e + 1;
+    }
+
+    // Buffers of the threads gone are only kept for the export of the last
+    // session.
+    auto isGone = [](const std::unique_ptr<ThreadBuffer> &buffer) {
+        return buffer->threadExited.load(std::memory_order_acquire);
+    };
+    m_buffers.erase(std::remove_if(m_buffers.begin(), m_buffers.end(), isGone), m_buffers.end());
+
+    m_eventsPerThread = 0 != eventsPerThread ? eventsPerThread : kDefaultEventsPerThread;
+    m_session.fetch_add(1, std::memory_order_release);
+    for (Category &c : m_categories)
+        c.enabled.store(MatchesFilter(c.name), std::memory_order_relaxed);
+}
+
+void TraceLog::Stop(void)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    for (Category &c : m_categories)
+        c.enabled.store(false, std::memory_order_relaxed);
+    m_eventsPerThread = 0;
+}
+
+void AddAsyncEvent(const std::atomic<bool> *categoryEnabled, const char *category, const char *name, char phase,
+    const void *id)
+{
+    if (!categoryEnabled->load(std::memory_order_relaxed))
+        return;
+
+    TraceEvent event = {};
+    event.category = category;
+    event.name = name;
+    event.phase = phase;
+    event.timestamp = TraceLog::Now();
+    event.id = reinterpret_cast<uintptr_t>(id);
+    TraceLog::GetInstance()->AddEvent(event);
+}
+
+} // namespace trace_event
+} // namespace base
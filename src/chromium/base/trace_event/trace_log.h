@@ -0,0 +1,137 @@
+// -------------------------------------------------
+// BlinKit - base Library
+// -------------------------------------------------
+//   File Name: trace_log.h
+// Description: TraceLog Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BASE_TRACE_LOG_H
+#define BLINKIT_BASE_TRACE_LOG_H
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "base/macros.h"
+#include "base/threading/thread_local_storage.h"
+
+namespace base {
+namespace trace_event {
+
+struct TraceEvent
+{
+    const char *category;
+    const char *name;
+    char phase; // 'X' for complete events, 'b' and 'e' for async ones.
+    uint64_t timestamp; // Microseconds since the log was created.
+    uint64_t duration;  // Complete events only.
+    uint64_t id;        // Async events only.
+    const char *argNames[2];
+    uint64_t argValues[2];
+};
+
+// Records events into a ring buffer per thread, so that writing an event takes
+// no lock and a long trace keeps the latest events. Categories are checked
+// through flags which never move, so a disabled span costs one load.
+class TraceLog
+{
+public:
+    static TraceLog* GetInstance(void);
+
+    const std::atomic<bool>* GetCategoryEnabled(const char *category);
+
+    // |categories| is a comma separated list, empty for all.
+    void Start(const std::string &categories, size_t eventsPerThread);
+    void Stop(void);
+
+    static uint64_t Now(void);
+    void AddEvent(const TraceEvent &event);
+
+    // Writes the events recorded since the last start as Chrome trace event
+    // JSON. Should be called after stopping, or the latest events of the
+    // running threads may be torn.
+    std::string ExportJSON(void) const;
+private:
+    TraceLog(void);
+    ~TraceLog(void);
+
+    struct Category {
+        std::string name;
+        std::atomic<bool> enabled { false };
+    };
+    bool MatchesFilter(const std::string &category) const;
+
+    struct ThreadBuffer {
+        unsigned threadId;
+        unsigned session = 0;
+        std::vector<TraceEvent> events;
+        std::atomic<size_t> count { 0 };
+        std::atomic<bool> threadExited { false };
+    };
+    ThreadBuffer* GetThreadBuffer(void);
+    static void OnThreadExit(void *buffer);
+
+    mutable std::mutex m_lock;
+    std::deque<Category> m_categories;
+    std::vector<std::string> m_filter;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    unsigned m_nextThreadId = 1;
+
+    std::atomic<unsigned> m_session { 0 };
+    size_t m_eventsPerThread = 0;
+    ThreadLocalStorage::Slot m_threadBuffer;
+
+    DISALLOW_COPY_AND_ASSIGN(TraceLog);
+};
+
+// Records a complete event for its scope, if the category was enabled when the
+// scope began.
+class ScopedTracer
+{
+public:
+    ScopedTracer(const std::atomic<bool> *categoryEnabled, const char *category, const char *name)
+    {
+        if (categoryEnabled->load(std::memory_order_relaxed))
+        {
+            m_event.category = category;
+            m_event.name = name;
+            m_event.timestamp = TraceLog::Now();
+        }
+    }
+    ~ScopedTracer(void)
+    {
+        if (nullptr == m_event.category)
+            return;
+        m_event.phase = 'X';
+        m_event.duration = TraceLog::Now() - m_event.timestamp;
+        TraceLog::GetInstance()->AddEvent(m_event);
+    }
+
+    bool IsActive(void) const { return nullptr != m_event.category; }
+    void SetArg(unsigned i, const char *name, uint64_t value)
+    {
+        m_event.argNames[i] = name;
+        m_event.argValues[i] = value;
+    }
+private:
+    TraceEvent m_event = {};
+
+    DISALLOW_COPY_AND_ASSIGN(ScopedTracer);
+};
+
+void AddAsyncEvent(const std::atomic<bool> *categoryEnabled, const char *category, const char *name, char phase,
+    const void *id);
+
+} // namespace trace_event
+} // namespace base
+
+#endif // BLINKIT_BASE_TRACE_LOG_H
@@ -44,6 +44,8 @@
 
 #pragma once
 
+#include "blinkit/common/bk_segmented_buffer.h"
+
 namespace blink {
 
 class ResourceError;
@@ -61,6 +63,13 @@ public:
     // HTTP headers and framing if relevant. It is 0 if the response was served
     // from cache, and -1 if this information is unavailable.
     virtual void DidReceiveData(const char *data, int dataLength) {}
+    // Called when the whole body is available as a segmented buffer. Clients
+    // which are able to keep the segments override this to avoid copying.
+    virtual void DidReceiveBuffer(const BlinKit::BkSegmentedBuffer &data)
+    {
+        for (const auto &segment : data.Segments())
+            DidReceiveData(segment->data(), segment->length());
+    }
 
     // Called when the load completes successfully.
     virtual void DidFinishLoading(void) {}
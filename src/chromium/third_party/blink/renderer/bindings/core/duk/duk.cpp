@@ -11,17 +11,91 @@
 
 #include "duk.h"
 
+#include "blinkit/js/context_impl.h"
+#include "third_party/blink/renderer/platform/wtf/text/ascii_fast_path.h"
+#include "third_party/blink/renderer/platform/wtf/text/utf8.h"
+
+using namespace WTF;
+
 namespace BlinKit {
 namespace Duk {
 
+static const char NameCacheHolder[] = "nameCache";
+
+// Strings up to this size in UTF-8 are transcoded on the stack.
+static const size_t StackBufferSize = 1024;
+
+static size_t ConvertToUTF8(const LChar *characters, unsigned length, char *dst, size_t capacity)
+{
+    char *p = dst;
+    Unicode::ConversionResult result = Unicode::ConvertLatin1ToUTF8(&characters, characters + length, &p, dst + capacity);
+    ASSERT(Unicode::kConversionOK == result);
+    return p - dst;
+}
+
+static size_t ConvertToUTF8(const UChar *characters, unsigned length, char *dst, size_t capacity)
+{
+    const UChar *end = characters + length;
+    char *p = dst;
+    Unicode::ConversionResult result = Unicode::ConvertUTF16ToUTF8(&characters, end, &p, dst + capacity, false);
+    if (Unicode::kSourceExhausted == result)
+    {
+        // An unpaired high surrogate at the end, encoded as it is, the same
+        // as WTF::String::Utf8 does in lenient mode.
+        ASSERT(characters + 1 == end);
+        UChar c = *characters;
+        *p++ = static_cast<char>(((c >> 12) & 0x0F) | 0xE0);
+        *p++ = static_cast<char>(((c >> 6) & 0x3F) | 0x80);
+        *p++ = static_cast<char>((c & 0x3F) | 0x80);
+    }
+    return p - dst;
+}
+
+template <typename CharType>
+static const char* PushUTF8(duk_context *ctx, const CharType *characters, unsigned length)
+{
+    // Latin-1 characters take up to 2 bytes in UTF-8, UTF-16 ones up to 3.
+    const size_t capacity = static_cast<size_t>(length) * (sizeof(CharType) + 1);
+    if (capacity <= StackBufferSize)
+    {
+        char buffer[StackBufferSize];
+        return duk_push_lstring(ctx, buffer, ConvertToUTF8(characters, length, buffer, capacity));
+    }
+
+    char *buffer = reinterpret_cast<char *>(duk_push_dynamic_buffer(ctx, capacity));
+    duk_resize_buffer(ctx, -1, ConvertToUTF8(characters, length, buffer, capacity));
+    return duk_buffer_to_string(ctx, -1);
+}
+
 const char* PushString(duk_context *ctx, const std::string &s)
 {
     return duk_push_lstring(ctx, s.data(), s.length());
 }
 
-const char* PushString(duk_context *ctx, const WTF::String &s)
+const char* PushString(duk_context *ctx, const String &s)
+{
+    const unsigned length = s.length();
+    if (0 == length)
+        return duk_push_lstring(ctx, "", 0);
+
+    if (s.Is8Bit())
+    {
+        const LChar *characters = s.Characters8();
+        if (CharactersAreAllASCII(characters, length))
+            return duk_push_lstring(ctx, reinterpret_cast<const char *>(characters), length);
+        return PushUTF8(ctx, characters, length);
+    }
+    return PushUTF8(ctx, s.Characters16(), length);
+}
+
+void PushName(duk_context *ctx, const AtomicString &name)
+{
+    ContextImpl::From(ctx)->GetNameCache().Push(ctx, name);
+}
+
+AtomicString ToName(duk_context *ctx, duk_idx_t idx)
 {
-    return PushString(ctx, s.StdUtf8());
+    return ContextImpl::From(ctx)->GetNameCache().To(ctx, idx);
 }
 
 bool TryToArrayIndex(duk_context *ctx, duk_idx_t idx, duk_uarridx_t &dst)
@@ -43,5 +117,66 @@ bool TryToArrayIndex(duk_context *ctx, duk_idx_t idx, duk_uarridx_t &dst)
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+NameCache::NameCache(duk_context *ctx)
+{
+    duk_push_heap_stash(ctx);
+    duk_push_array(ctx);
+    m_holder = duk_get_heapptr(ctx, -1);
+    duk_put_prop_string(ctx, -2, NameCacheHolder);
+    duk_pop(ctx);
+}
+
+void NameCache::Add(duk_context *ctx, duk_idx_t idx, const AtomicString &name)
+{
+    if (m_names.size() >= kMaxEntries)
+        return;
+
+    idx = duk_normalize_index(ctx, idx);
+    void *heapPtr = duk_get_heapptr(ctx, idx);
+    if (!m_names.emplace(heapPtr, name).second)
+        return;
+    m_strings.emplace(name.Impl(), heapPtr);
+
+    duk_push_heapptr(ctx, m_holder);
+    duk_dup(ctx, idx);
+    duk_put_prop_index(ctx, -2, m_names.size() - 1);
+    duk_pop(ctx);
+}
+
+void NameCache::Push(duk_context *ctx, const AtomicString &name)
+{
+    if (name.IsNull())
+    {
+        PushString(ctx, name.GetString());
+        return;
+    }
+
+    auto it = m_strings.find(name.Impl());
+    if (std::end(m_strings) != it)
+    {
+        duk_push_heapptr(ctx, it->second);
+        return;
+    }
+
+    PushString(ctx, name.GetString());
+    Add(ctx, -1, name);
+}
+
+AtomicString NameCache::To(duk_context *ctx, duk_idx_t idx)
+{
+    if (!duk_is_string(ctx, idx))
+        return Duk::To<AtomicString>(ctx, idx);
+
+    auto it = m_names.find(duk_get_heapptr(ctx, idx));
+    if (std::end(m_names) != it)
+        return it->second;
+
+    AtomicString name = Duk::To<AtomicString>(ctx, idx);
+    Add(ctx, idx, name);
+    return name;
+}
+
 } // namespace Duk
 } // namespace BlinKit
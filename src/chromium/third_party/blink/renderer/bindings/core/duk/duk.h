@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <unordered_map>
 #include "duktape/duktape.h"
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 
@@ -49,8 +50,34 @@ inline WTF::String To<WTF::String>(duk_context *ctx, duk_idx_t idx)
 bool TryToArrayIndex(duk_context *ctx, duk_idx_t idx, duk_uarridx_t &dst);
 
 const char* PushString(duk_context *ctx, const std::string &s);
+// Transcodes directly into duktape, ASCII strings are pushed as they are.
 const char* PushString(duk_context *ctx, const WTF::String &s);
 
+// Tag, attribute and event names go through the NameCache of the context.
+void PushName(duk_context *ctx, const WTF::AtomicString &name);
+WTF::AtomicString ToName(duk_context *ctx, duk_idx_t idx);
+
+// Both AtomicString and duktape strings are interned, so a name converted
+// once can be mapped by pointers afterwards, without transcoding or hashing
+// its characters again. Each ContextImpl owns one.
+class NameCache
+{
+public:
+    NameCache(duk_context *ctx);
+
+    void Push(duk_context *ctx, const WTF::AtomicString &name);
+    WTF::AtomicString To(duk_context *ctx, duk_idx_t idx);
+private:
+    void Add(duk_context *ctx, duk_idx_t idx, const WTF::AtomicString &name);
+
+    // Names are a small set in practice, anything beyond is not cached.
+    static constexpr size_t kMaxEntries = 1024;
+
+    void *m_holder; // A stash array, keeps the cached duktape strings alive.
+    std::unordered_map<WTF::StringImpl *, void *> m_strings;
+    std::unordered_map<void *, WTF::AtomicString> m_names;
+};
+
 } // namespace Duk
 } // namespace BlinKit
 
@@ -16,6 +16,7 @@
 #include "third_party/blink/renderer/bindings/core/duk/duk_html_collection.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_node_list.h"
 #include "third_party/blink/renderer/core/dom/static_node_list.h"
+#include "third_party/blink/renderer/core/editing/text_extractor.h"
 
 using namespace blink;
 
@@ -23,9 +24,29 @@ namespace BlinKit {
 
 namespace Impl {
 
+static duk_ret_t ExtractText(duk_context *ctx)
+{
+    unsigned options = 0;
+    if (duk_is_object(ctx, 0))
+    {
+        duk_get_prop_string(ctx, 0, "blocks");
+        if (duk_to_boolean(ctx, -1))
+            options |= TextExtractor::kBlockBoundaries;
+        duk_get_prop_string(ctx, 0, "links");
+        if (duk_to_boolean(ctx, -1))
+            options |= TextExtractor::kLinkAnnotations;
+    }
+
+    duk_push_this(ctx);
+    ContainerNode *node = DukScriptObject::To<ContainerNode>(ctx, -1);
+
+    Duk::PushString(ctx, node->VisibleText(options));
+    return 1;
+}
+
 static duk_ret_t GetElementsByTagName(duk_context *ctx)
 {
-    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+    const AtomicString name = Duk::ToName(ctx, 0);
 
     duk_push_this(ctx);
     ContainerNode *node = DukScriptObject::To<ContainerNode>(ctx, -1);
@@ -78,6 +99,7 @@ static duk_ret_t QuerySelectorAll(duk_context *ctx)
 void DukContainerNode::FillPrototypeEntry(PrototypeEntry &entry)
 {
     static const PrototypeEntry::Method Methods[] = {
+        { "extractText",            Impl::ExtractText,            1 },
         { "getElementsByTagName",   Impl::GetElementsByTagName,   1 },
         { "querySelector",          Impl::QuerySelector,          1 },
         { "querySelectorAll",       Impl::QuerySelectorAll,       1 },
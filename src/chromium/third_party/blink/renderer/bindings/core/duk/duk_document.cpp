@@ -62,7 +62,7 @@ static duk_ret_t CreateDocumentFragment(duk_context *ctx)
 
 static duk_ret_t CreateElement(duk_context *ctx)
 {
-    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+    const AtomicString name = Duk::ToName(ctx, 0);
 
     duk_push_this(ctx);
     Document *document = DukScriptObject::To<Document>(ctx, -1);
@@ -40,7 +40,7 @@ static duk_ret_t AttributesGetter(duk_context *ctx)
 
 static duk_ret_t GetAttribute(duk_context *ctx)
 {
-    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+    const AtomicString name = Duk::ToName(ctx, 0);
 
     duk_push_this(ctx);
     Element *element = DukScriptObject::To<Element>(ctx, -1);
@@ -72,7 +72,7 @@ static duk_ret_t InnerHTMLSetter(duk_context *ctx)
 
 static duk_ret_t SetAttribute(duk_context *ctx)
 {
-    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+    const AtomicString name = Duk::ToName(ctx, 0);
     const AtomicString value = Duk::To<AtomicString>(ctx, 1);
 
     duk_push_this(ctx);
@@ -89,7 +89,7 @@ static duk_ret_t TagNameGetter(duk_context *ctx)
 {
     duk_push_this(ctx);
     Element *element = DukScriptObject::To<Element>(ctx, -1);
-    Duk::PushString(ctx, element->tagName());
+    Duk::PushName(ctx, AtomicString(element->tagName()));
     return 1;
 }
 
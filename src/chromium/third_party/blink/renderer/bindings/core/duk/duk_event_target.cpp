@@ -33,7 +33,7 @@ static duk_ret_t AddEventListener(duk_context *ctx)
             return 0;
     }
 
-    const AtomicString type = Duk::To<AtomicString>(ctx, 0);
+    const AtomicString type = Duk::ToName(ctx, 0);
     bool useCapture = false;
     switch (argc)
     {
@@ -65,7 +65,7 @@ static duk_ret_t RemoveEventListener(duk_context *ctx)
             return 0;
     }
 
-    const AtomicString type = Duk::To<AtomicString>(ctx, 0);
+    const AtomicString type = Duk::ToName(ctx, 0);
     bool useCapture = false;
     switch (argc)
     {
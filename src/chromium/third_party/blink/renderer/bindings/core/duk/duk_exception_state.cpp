@@ -21,6 +21,12 @@ DukExceptionState::DukExceptionState(duk_context *ctx) : m_ctx(ctx)
 
 void DukExceptionState::ThrowException(void)
 {
+    if (static_cast<ExceptionCode>(ESErrorType::kTypeError) == m_exceptionCode)
+    {
+        duk_type_error(m_ctx, "%s", m_message.c_str());
+        return;
+    }
+
     DOMExceptionCode code = static_cast<DOMExceptionCode>(m_exceptionCode);
     switch (code)
     {
@@ -28,7 +34,9 @@ void DukExceptionState::ThrowException(void)
             duk_syntax_error(m_ctx, "%s", m_message.c_str());
             break;
         default:
-            ASSERT(false); // BKTODO:
+            // There is no DOMException in scripts, so the others are thrown
+            // as plain errors.
+            duk_error(m_ctx, DUK_ERR_ERROR, "%s", m_message.c_str());
     }
 }
 
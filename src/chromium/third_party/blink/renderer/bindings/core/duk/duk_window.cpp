@@ -11,10 +11,15 @@
 
 #include "duk_window.h"
 
+#include "base/strings/string_number_conversions.h"
+#include "blinkit/js/context_impl.h"
+#include "third_party/blink/renderer/bindings/core/duk/duk.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_console.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_document.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_location.h"
 #include "third_party/blink/renderer/bindings/core/duk/duk_navigator.h"
+#include "third_party/blink/renderer/bindings/core/duk/duk_xml_http_request.h"
+#include "third_party/blink/renderer/core/frame/dom_timer_coordinator.h"
 
 using namespace blink;
 
@@ -22,6 +27,16 @@ namespace BlinKit {
 
 const char DukWindow::ProtoName[] = "Window";
 
+// Timer callbacks and their arguments are kept in arrays on the global object,
+// so that they stay reachable until the timers are done.
+static const char TimerPrefix[] = DUK_HIDDEN_SYMBOL("timer_");
+
+// Roughly a frame at 60 Hz. There is nothing to render, so animation frames
+// are only paced like the ones in a browser.
+static const int64_t AnimationFrameInterval = 16;
+
+using TimerType = DOMTimerCoordinator::Type;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace Crawler {
@@ -34,6 +49,135 @@ static duk_ret_t GetComputedStyle(duk_context *ctx)
 
 } // namespace Crawler
 
+namespace Timers {
+
+static std::string Key(int timeoutID)
+{
+    std::string ret(TimerPrefix);
+    ret += base::IntToString(timeoutID);
+    return ret;
+}
+
+static void ReportError(ContextImpl *ctxImpl, duk_context *ctx)
+{
+#ifndef NDEBUG
+    duk_get_prop_string(ctx, -1, "stack");
+#endif
+    std::string str = Duk::To<std::string>(ctx, -1);
+    ctxImpl->ConsoleOutput(BK_CONSOLE_ERROR, str.c_str());
+}
+
+static void Fire(LocalDOMWindow *window, TimerType type, int timeoutID)
+{
+    ContextImpl *ctxImpl = ContextImpl::From(window->document());
+    if (nullptr == ctxImpl)
+        return;
+
+    duk_context *ctx = ctxImpl->GetRawContext();
+    const duk_idx_t top = duk_get_top(ctx);
+
+    const std::string key = Key(timeoutID);
+    duk_push_global_object(ctx);
+    if (!duk_get_prop_lstring(ctx, -1, key.data(), key.length()))
+    {
+        duk_set_top(ctx, top);
+        return;
+    }
+
+    const duk_idx_t entry = duk_normalize_index(ctx, -1);
+    if (TimerType::kInterval != type)
+        duk_del_prop_lstring(ctx, -2, key.data(), key.length());
+
+    duk_get_prop_index(ctx, entry, 0);
+    if (duk_is_function(ctx, -1))
+    {
+        duk_idx_t argc = 0;
+        if (TimerType::kAnimationFrame == type)
+        {
+            duk_push_number(ctx, window->Timers().NowInMilliseconds());
+            argc = 1;
+        }
+        else
+        {
+            const duk_size_t length = duk_get_length(ctx, entry);
+            for (duk_size_t i = 1; i < length; ++i)
+                duk_get_prop_index(ctx, entry, static_cast<duk_uarridx_t>(i));
+            argc = static_cast<duk_idx_t>(length - 1);
+        }
+
+        if (DUK_EXEC_SUCCESS != duk_pcall(ctx, argc))
+            ReportError(ctxImpl, ctx);
+    }
+    else
+    {
+        const std::string code = Duk::To<std::string>(ctx, -1);
+        duk_set_top(ctx, top);
+
+        const auto callback = [ctxImpl](duk_context *ctx)
+        {
+            if (duk_is_error(ctx, -1))
+                ReportError(ctxImpl, ctx);
+        };
+        ctxImpl->Eval(code, callback, "timer");
+    }
+
+    duk_set_top(ctx, top);
+}
+
+static duk_ret_t Install(duk_context *ctx, TimerType type)
+{
+    const duk_idx_t argc = duk_get_top(ctx);
+    if (TimerType::kAnimationFrame == type)
+        duk_require_function(ctx, 0);
+    else if (0 == argc)
+        duk_push_undefined(ctx);
+
+    int64_t ms = AnimationFrameInterval;
+    if (TimerType::kAnimationFrame != type)
+    {
+        // Like browsers, delays that do not fit in 32 bits are treated as zero.
+        double d = argc > 1 ? duk_to_number(ctx, 1) : 0;
+        ms = d >= 1 && d <= INT32_MAX ? static_cast<int64_t>(d) : 0;
+    }
+
+    duk_push_global_object(ctx);
+    LocalDOMWindow *window = DukScriptObject::To<LocalDOMWindow>(ctx, -1);
+    const auto action = std::bind(Fire, window, type, std::placeholders::_1);
+    const int timeoutID = window->Timers().InstallNewTimeout(action, TimeDelta::FromMilliseconds(ms), type);
+
+    // [callback, arguments...]
+    duk_push_array(ctx);
+    duk_dup(ctx, 0);
+    duk_put_prop_index(ctx, -2, 0);
+    for (duk_idx_t i = 2; i < argc; ++i)
+    {
+        duk_dup(ctx, i);
+        duk_put_prop_index(ctx, -2, static_cast<duk_uarridx_t>(i - 1));
+    }
+    const std::string key = Key(timeoutID);
+    duk_put_prop_lstring(ctx, -2, key.data(), key.length());
+
+    duk_push_int(ctx, timeoutID);
+    return 1;
+}
+
+static duk_ret_t Remove(duk_context *ctx)
+{
+    const int timeoutID = duk_to_int(ctx, 0);
+    if (timeoutID <= 0)
+        return 0;
+
+    duk_push_global_object(ctx);
+    LocalDOMWindow *window = DukScriptObject::To<LocalDOMWindow>(ctx, -1);
+    window->Timers().RemoveTimeoutByID(timeoutID);
+
+    const std::string key = Key(timeoutID);
+    duk_del_prop_lstring(ctx, -1, key.data(), key.length());
+    return 0;
+}
+
+} // namespace Timers
+
 namespace Impl {
 
 static duk_ret_t AToB(duk_context *ctx)
@@ -52,6 +196,21 @@ static duk_ret_t BToA(duk_context *ctx)
     return 1;
 }
 
+static duk_ret_t CancelAnimationFrame(duk_context *ctx)
+{
+    return Timers::Remove(ctx);
+}
+
+static duk_ret_t ClearInterval(duk_context *ctx)
+{
+    return Timers::Remove(ctx);
+}
+
+static duk_ret_t ClearTimeout(duk_context *ctx)
+{
+    return Timers::Remove(ctx);
+}
+
 static duk_ret_t ConsoleGetter(duk_context *ctx)
 {
     DukScriptObject::Create<DukConsole>(ctx);
@@ -88,6 +247,21 @@ static duk_ret_t NavigatorGetter(duk_context *ctx)
     return 1;
 }
 
+static duk_ret_t RequestAnimationFrame(duk_context *ctx)
+{
+    return Timers::Install(ctx, TimerType::kAnimationFrame);
+}
+
+static duk_ret_t SetInterval(duk_context *ctx)
+{
+    return Timers::Install(ctx, TimerType::kInterval);
+}
+
+static duk_ret_t SetTimeout(duk_context *ctx)
+{
+    return Timers::Install(ctx, TimerType::kTimeout);
+}
+
 static duk_ret_t WindowGetter(duk_context *ctx)
 {
     duk_push_this(ctx);
@@ -101,9 +275,17 @@ static duk_ret_t WindowGetter(duk_context *ctx)
 void DukWindow::FillPrototypeEntryForCrawler(PrototypeEntry &entry)
 {
     static const PrototypeEntry::Method Methods[] = {
-        { "atob",             Impl::AToB,                1           },
-        { "btoa",             Impl::BToA,                1           },
-        { "getComputedStyle", Crawler::GetComputedStyle, 2           },
+        { "atob",                  Impl::AToB,                   1           },
+        { "btoa",                  Impl::BToA,                   1           },
+        { "cancelAnimationFrame",  Impl::CancelAnimationFrame,   1           },
+        { "clearInterval",         Impl::ClearInterval,          1           },
+        { "clearTimeout",          Impl::ClearTimeout,           1           },
+        { "fetch",                 DukXMLHttpRequest::Fetch,     2           },
+        { "getComputedStyle",      Crawler::GetComputedStyle,    2           },
+        { "requestAnimationFrame", Impl::RequestAnimationFrame,  1           },
+        { "setInterval",           Impl::SetInterval,            DUK_VARARGS },
+        { "setTimeout",            Impl::SetTimeout,             DUK_VARARGS },
+        { "XMLHttpRequest",        DukXMLHttpRequest::Construct, 0           },
     };
     static const PrototypeEntry::Property Properties[] = {
         { "console",   Impl::ConsoleGetter,   nullptr              },
@@ -0,0 +1,903 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: duk_xml_http_request.cpp
+// Description: DukXMLHttpRequest Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "duk_xml_http_request.h"
+
+#include "base/memory/ptr_util.h"
+#include "base/strings/stringprintf.h"
+#include "blinkit/js/context_impl.h"
+#include "third_party/blink/renderer/bindings/core/duk/duk.h"
+#include "third_party/blink/renderer/bindings/core/duk/duk_event_listener.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/events/event.h"
+#include "third_party/blink/renderer/core/event_type_names.h"
+#include "third_party/blink/renderer/core/frame/local_dom_window.h"
+#include "third_party/blink/renderer/platform/shared_buffer.h"
+
+using namespace blink;
+
+namespace BlinKit {
+
+const char DukXMLHttpRequest::ProtoName[] = "XMLHttpRequest";
+
+// Requests on the way are kept on the global object, so that they are not
+// collected before their events are fired.
+static const char PendingPrefix[] = DUK_HIDDEN_SYMBOL("xhr_");
+
+static const char HandlerPrefix[] = DUK_HIDDEN_SYMBOL("handler_");
+static const char ResponseTypeKey[] = DUK_HIDDEN_SYMBOL("responseType");
+static const char ResponseKey[] = DUK_HIDDEN_SYMBOL("response");
+static const char ResponseGenerationKey[] = DUK_HIDDEN_SYMBOL("responseGeneration");
+
+static const char InputKey[] = DUK_HIDDEN_SYMBOL("input");
+static const char InitKey[] = DUK_HIDDEN_SYMBOL("init");
+static const char ResolveKey[] = DUK_HIDDEN_SYMBOL("resolve");
+static const char RejectKey[] = DUK_HIDDEN_SYMBOL("reject");
+static const char RequestKey[] = DUK_HIDDEN_SYMBOL("request");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Listeners of the bindings themselves, invisible to scripts.
+class NativeListener final : public EventListener
+{
+public:
+    using Callback = void (*)(duk_context *, XMLHttpRequest &, Event &);
+    static std::shared_ptr<NativeListener> Create(Callback callback)
+    {
+        return base::WrapShared(new NativeListener(callback));
+    }
+private:
+    explicit NativeListener(Callback callback) : m_callback(callback) {}
+
+    // EventListener
+    bool operator==(const EventListener &other) const override { return this == &other; }
+    void handleEvent(ExecutionContext *executionContext, Event *event) override
+    {
+        ContextImpl *ctxImpl = ContextImpl::From(executionContext);
+        if (nullptr == ctxImpl)
+            return;
+
+        XMLHttpRequest *xhr = static_cast<XMLHttpRequest *>(event->currentTarget());
+        m_callback(ctxImpl->GetRawContext(), *xhr, *event);
+    }
+
+    const Callback m_callback;
+};
+
+} // namespace
+
+namespace Pending {
+
+static std::string Key(const XMLHttpRequest *xhr)
+{
+    std::string ret(PendingPrefix);
+    ret += base::StringPrintf("%p", xhr);
+    return ret;
+}
+
+static void Hold(duk_context *ctx, duk_idx_t idx, const XMLHttpRequest *xhr)
+{
+    idx = duk_normalize_index(ctx, idx);
+
+    const std::string key = Key(xhr);
+    duk_push_global_object(ctx);
+    duk_dup(ctx, idx);
+    duk_put_prop_lstring(ctx, -2, key.data(), key.length());
+    duk_pop(ctx);
+}
+
+static void Release(duk_context *ctx, const XMLHttpRequest *xhr)
+{
+    const std::string key = Key(xhr);
+    duk_push_global_object(ctx);
+    duk_del_prop_lstring(ctx, -1, key.data(), key.length());
+    duk_pop(ctx);
+}
+
+static void OnLoadEnd(duk_context *ctx, XMLHttpRequest &xhr, Event &)
+{
+    if (!xhr.HasPendingActivity())
+        Release(ctx, &xhr);
+}
+
+// Creates a request for the document of the context, and pushes its script
+// object.
+static XMLHttpRequest* CreateRequest(duk_context *ctx)
+{
+    duk_push_global_object(ctx);
+    LocalDOMWindow *window = DukScriptObject::To<LocalDOMWindow>(ctx, -1);
+    duk_pop(ctx);
+
+    Document *document = window->document();
+    if (nullptr == document)
+    {
+        duk_error(ctx, DUK_ERR_TYPE_ERROR, "The document is detached.");
+        return nullptr;
+    }
+
+    XMLHttpRequest *xhr = XMLHttpRequest::Create(*document);
+    std::shared_ptr<NativeListener> listener = NativeListener::Create(OnLoadEnd);
+    xhr->addEventListener(event_type_names::kLoadend, listener.get(), false);
+
+    DukScriptObject::Push<DukXMLHttpRequest>(ctx, xhr);
+    return xhr;
+}
+
+} // namespace Pending
+
+namespace Body {
+
+static const char UTF8BOM[] = "\xEF\xBB\xBF";
+
+static void PushText(duk_context *ctx, const XMLHttpRequest &xhr)
+{
+    std::shared_ptr<const SharedBuffer> body = xhr.ResponseBody();
+    if (!body || 0 == body->size())
+    {
+        duk_push_string(ctx, "");
+        return;
+    }
+
+    const BkSegmentedBuffer &segments = body->Segments();
+    const WTF::TextEncoding encoding = xhr.ResponseEncoding();
+    if (WTF::UTF8Encoding() != encoding)
+    {
+        const std::string data = segments.ToString();
+        Duk::PushString(ctx, encoding.Decode(data.data(), data.length()));
+        return;
+    }
+
+    // UTF-8 goes into duktape as it is.
+    const char *data;
+    size_t length = segments.Size();
+    if (1 == segments.Segments().size())
+    {
+        data = segments.Segments().front()->data();
+    }
+    else
+    {
+        void *buffer = duk_push_fixed_buffer(ctx, length);
+        segments.CopyTo(buffer);
+        data = reinterpret_cast<const char *>(buffer);
+    }
+
+    if (length >= 3 && 0 == memcmp(data, UTF8BOM, 3))
+    {
+        data += 3;
+        length -= 3;
+    }
+    duk_push_lstring(ctx, data, length);
+    if (1 != segments.Segments().size())
+        duk_remove(ctx, -2);
+}
+
+static void PushArrayBuffer(duk_context *ctx, const XMLHttpRequest &xhr)
+{
+    std::shared_ptr<const SharedBuffer> body = xhr.ResponseBody();
+    const size_t length = body ? body->size() : 0;
+
+    // Copied, as scripts may write to array buffers, while the segments are
+    // shared with the memory cache.
+    void *buffer = duk_push_fixed_buffer(ctx, length);
+    if (length > 0)
+        body->Segments().CopyTo(buffer);
+    duk_push_buffer_object(ctx, -1, 0, length, DUK_BUFOBJ_ARRAYBUFFER);
+    duk_remove(ctx, -2);
+}
+
+static duk_ret_t DecodeJSON(duk_context *ctx, void *)
+{
+    duk_json_decode(ctx, -1);
+    return 1;
+}
+
+// Leaves the parsed value, or the error on failure.
+static bool PushJSON(duk_context *ctx, const XMLHttpRequest &xhr)
+{
+    PushText(ctx, xhr);
+    return DUK_EXEC_SUCCESS == duk_safe_call(ctx, DecodeJSON, nullptr, 1, 1);
+}
+
+// Request bodies are strings, or anything backed by a buffer.
+static std::shared_ptr<const std::string> From(duk_context *ctx, duk_idx_t idx)
+{
+    if (duk_is_null_or_undefined(ctx, idx))
+        return nullptr;
+
+    if (duk_is_buffer_data(ctx, idx))
+    {
+        duk_size_t size = 0;
+        const char *data = reinterpret_cast<const char *>(duk_get_buffer_data(ctx, idx, &size));
+        return std::make_shared<std::string>(data, size);
+    }
+
+    return std::make_shared<std::string>(Duk::To<std::string>(ctx, idx));
+}
+
+} // namespace Body
+
+namespace Handlers {
+
+// Sorted like the properties of the prototype.
+static const char *Names[] = {
+    "onabort", "onerror", "onload", "onloadend", "onloadstart", "onprogress", "onreadystatechange", "ontimeout"
+};
+
+static std::string Key(const char *name)
+{
+    std::string ret(HandlerPrefix);
+    ret += name;
+    return ret;
+}
+
+template <int N>
+static duk_ret_t Getter(duk_context *ctx)
+{
+    const std::string key = Key(Names[N]);
+
+    duk_push_this(ctx);
+    if (!duk_get_prop_lstring(ctx, -1, key.data(), key.length()))
+        duk_push_null(ctx);
+    return 1;
+}
+
+template <int N>
+static duk_ret_t Setter(duk_context *ctx)
+{
+    const std::string key = Key(Names[N]);
+    const AtomicString type = AtomicString::FromUTF8(Names[N] + 2);
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+
+    if (duk_get_prop_lstring(ctx, -1, key.data(), key.length()))
+    {
+        if (EventListener *listener = DukEventListener::From(ctx, -1, xhr, type))
+            xhr->removeEventListener(type, listener, false);
+    }
+    duk_pop(ctx);
+
+    if (duk_is_function(ctx, 0))
+    {
+        std::shared_ptr<DukEventListener> listener = DukEventListener::Create(ctx, 0, xhr, type);
+        xhr->addEventListener(type, listener.get(), false);
+        duk_dup(ctx, 0);
+        duk_put_prop_lstring(ctx, -2, key.data(), key.length());
+    }
+    else
+    {
+        duk_del_prop_lstring(ctx, -1, key.data(), key.length());
+    }
+    return 0;
+}
+
+} // namespace Handlers
+
+namespace Impl {
+
+template <XMLHttpRequest::State S>
+static duk_ret_t StateConstantGetter(duk_context *ctx)
+{
+    duk_push_uint(ctx, S);
+    return 1;
+}
+
+static duk_ret_t Abort(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    xhr->abort();
+    if (!xhr->HasPendingActivity())
+        Pending::Release(ctx, xhr);
+    return 0;
+}
+
+static duk_ret_t GetAllResponseHeaders(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    Duk::PushString(ctx, xhr->getAllResponseHeaders());
+    return 1;
+}
+
+static duk_ret_t GetResponseHeader(duk_context *ctx)
+{
+    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+
+    const AtomicString value = xhr->getResponseHeader(name);
+    if (value.IsNull())
+        duk_push_null(ctx);
+    else
+        Duk::PushString(ctx, value.GetString());
+    return 1;
+}
+
+static duk_ret_t Open(duk_context *ctx)
+{
+    const duk_idx_t argc = duk_get_top(ctx);
+    if (argc < 2)
+    {
+        duk_error(ctx, DUK_ERR_TYPE_ERROR, "Invalid argument count: %d", argc);
+        return 0;
+    }
+
+    const AtomicString method = Duk::To<AtomicString>(ctx, 0);
+    const String url = Duk::To<String>(ctx, 1);
+    const bool async = argc > 2 ? duk_to_boolean(ctx, 2) : true;
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+
+    DukExceptionState exceptionState(ctx);
+    xhr->open(method, url, async, exceptionState);
+    if (!xhr->HasPendingActivity())
+        Pending::Release(ctx, xhr);
+    exceptionState.ThrowIfNeeded();
+    return 0;
+}
+
+static duk_ret_t OverrideMimeType(duk_context *ctx)
+{
+    const AtomicString mimeType = Duk::To<AtomicString>(ctx, 0);
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+
+    DukExceptionState exceptionState(ctx);
+    xhr->overrideMimeType(mimeType, exceptionState);
+    exceptionState.ThrowIfNeeded();
+    return 0;
+}
+
+static duk_ret_t ReadyStateGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    duk_push_uint(ctx, xhr->readyState());
+    return 1;
+}
+
+static std::string ResponseType(duk_context *ctx, duk_idx_t thisIdx)
+{
+    std::string ret;
+    if (duk_get_prop_string(ctx, thisIdx, ResponseTypeKey))
+        ret = Duk::To<std::string>(ctx, -1);
+    duk_pop(ctx);
+    return ret;
+}
+
+static duk_ret_t ResponseGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    const duk_idx_t thisIdx = duk_normalize_index(ctx, -1);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, thisIdx);
+
+    const std::string responseType = ResponseType(ctx, thisIdx);
+    if (responseType.empty() || "text" == responseType)
+    {
+        if (XMLHttpRequest::kLoading == xhr->readyState() || XMLHttpRequest::kDone == xhr->readyState())
+            Body::PushText(ctx, *xhr);
+        else
+            duk_push_string(ctx, "");
+        return 1;
+    }
+
+    if (XMLHttpRequest::kDone != xhr->readyState() || !xhr->ResponseBody())
+    {
+        duk_push_null(ctx);
+        return 1;
+    }
+
+    // Parsed once per request, so that `xhr.response === xhr.response`.
+    duk_get_prop_string(ctx, thisIdx, ResponseGenerationKey);
+    const bool cached = duk_is_number(ctx, -1) && duk_get_uint(ctx, -1) == xhr->RequestGeneration();
+    duk_pop(ctx);
+    if (cached)
+    {
+        duk_get_prop_string(ctx, thisIdx, ResponseKey);
+        return 1;
+    }
+
+    if ("json" == responseType)
+    {
+        if (!Body::PushJSON(ctx, *xhr))
+        {
+            duk_pop(ctx);
+            duk_push_null(ctx);
+        }
+    }
+    else
+    {
+        Body::PushArrayBuffer(ctx, *xhr);
+    }
+
+    duk_dup(ctx, -1);
+    duk_put_prop_string(ctx, thisIdx, ResponseKey);
+    duk_push_uint(ctx, xhr->RequestGeneration());
+    duk_put_prop_string(ctx, thisIdx, ResponseGenerationKey);
+    return 1;
+}
+
+static duk_ret_t ResponseTextGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    const duk_idx_t thisIdx = duk_normalize_index(ctx, -1);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, thisIdx);
+
+    const std::string responseType = ResponseType(ctx, thisIdx);
+    if (!responseType.empty() && "text" != responseType)
+    {
+        DukExceptionState exceptionState(ctx);
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError,
+            "The value is only accessible if the object's 'responseType' is '' or 'text'.");
+        exceptionState.ThrowIfNeeded();
+        return 0;
+    }
+
+    if (XMLHttpRequest::kLoading == xhr->readyState() || XMLHttpRequest::kDone == xhr->readyState())
+        Body::PushText(ctx, *xhr);
+    else
+        duk_push_string(ctx, "");
+    return 1;
+}
+
+static duk_ret_t ResponseTypeGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    const std::string responseType = ResponseType(ctx, -1);
+    duk_push_lstring(ctx, responseType.data(), responseType.length());
+    return 1;
+}
+
+static duk_ret_t ResponseTypeSetter(duk_context *ctx)
+{
+    const std::string responseType = Duk::To<std::string>(ctx, 0);
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    if (XMLHttpRequest::kLoading == xhr->readyState() || XMLHttpRequest::kDone == xhr->readyState())
+    {
+        DukExceptionState exceptionState(ctx);
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError,
+            "The response type cannot be set if the object's state is LOADING or DONE.");
+        exceptionState.ThrowIfNeeded();
+        return 0;
+    }
+
+    // Like browsers, unsupported types ("blob" and "document" here) are
+    // ignored.
+    if (!responseType.empty() && "text" != responseType && "json" != responseType && "arraybuffer" != responseType)
+        return 0;
+
+    duk_dup(ctx, 0);
+    duk_put_prop_string(ctx, -2, ResponseTypeKey);
+    return 0;
+}
+
+static duk_ret_t ResponseURLGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    Duk::PushString(ctx, xhr->responseURL());
+    return 1;
+}
+
+static duk_ret_t Send(duk_context *ctx)
+{
+    std::shared_ptr<const std::string> body;
+    if (duk_get_top(ctx) > 0)
+        body = Body::From(ctx, 0);
+
+    duk_push_this(ctx);
+    const duk_idx_t thisIdx = duk_normalize_index(ctx, -1);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, thisIdx);
+
+    Pending::Hold(ctx, thisIdx, xhr);
+
+    DukExceptionState exceptionState(ctx);
+    xhr->send(body, exceptionState);
+    if (!xhr->HasPendingActivity())
+        Pending::Release(ctx, xhr);
+    exceptionState.ThrowIfNeeded();
+    return 0;
+}
+
+static duk_ret_t SetRequestHeader(duk_context *ctx)
+{
+    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+    const AtomicString value = Duk::To<AtomicString>(ctx, 1);
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+
+    DukExceptionState exceptionState(ctx);
+    xhr->setRequestHeader(name, value, exceptionState);
+    exceptionState.ThrowIfNeeded();
+    return 0;
+}
+
+static duk_ret_t StatusGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    duk_push_int(ctx, xhr->status());
+    return 1;
+}
+
+static duk_ret_t StatusTextGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    Duk::PushString(ctx, xhr->statusText());
+    return 1;
+}
+
+static duk_ret_t TimeoutGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    duk_push_uint(ctx, xhr->timeout());
+    return 1;
+}
+
+static duk_ret_t TimeoutSetter(duk_context *ctx)
+{
+    const unsigned timeout = duk_to_uint32(ctx, 0);
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+
+    DukExceptionState exceptionState(ctx);
+    xhr->setTimeout(timeout, exceptionState);
+    exceptionState.ThrowIfNeeded();
+    return 0;
+}
+
+static duk_ret_t WithCredentialsGetter(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+    duk_push_boolean(ctx, xhr->withCredentials());
+    return 1;
+}
+
+static duk_ret_t WithCredentialsSetter(duk_context *ctx)
+{
+    const bool value = duk_to_boolean(ctx, 0);
+
+    duk_push_this(ctx);
+    XMLHttpRequest *xhr = DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+
+    DukExceptionState exceptionState(ctx);
+    xhr->setWithCredentials(value, exceptionState);
+    exceptionState.ThrowIfNeeded();
+    return 0;
+}
+
+} // namespace Impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace FetchAPI {
+
+// Response objects are plain objects over the requests, which stay
+// reachable through them.
+static XMLHttpRequest* RequestOfThis(duk_context *ctx)
+{
+    duk_push_this(ctx);
+    if (!duk_get_prop_string(ctx, -1, RequestKey))
+    {
+        duk_error(ctx, DUK_ERR_TYPE_ERROR, "Illegal invocation");
+        return nullptr;
+    }
+    return DukScriptObject::To<XMLHttpRequest>(ctx, -1);
+}
+
+// Leaves `Promise[method](value)`, with the value on the stack top.
+static void SettleWith(duk_context *ctx, const char *method)
+{
+    duk_push_global_object(ctx);
+    duk_get_prop_string(ctx, -1, "Promise");
+    duk_push_string(ctx, method);
+    duk_dup(ctx, -4);
+    duk_call_prop(ctx, -3, 1);
+}
+
+static duk_ret_t ArrayBuffer(duk_context *ctx)
+{
+    XMLHttpRequest *xhr = RequestOfThis(ctx);
+    Body::PushArrayBuffer(ctx, *xhr);
+    SettleWith(ctx, "resolve");
+    return 1;
+}
+
+static duk_ret_t JSON(duk_context *ctx)
+{
+    XMLHttpRequest *xhr = RequestOfThis(ctx);
+    SettleWith(ctx, Body::PushJSON(ctx, *xhr) ? "resolve" : "reject");
+    return 1;
+}
+
+static duk_ret_t Text(duk_context *ctx)
+{
+    XMLHttpRequest *xhr = RequestOfThis(ctx);
+    Body::PushText(ctx, *xhr);
+    SettleWith(ctx, "resolve");
+    return 1;
+}
+
+static duk_ret_t HeadersGet(duk_context *ctx)
+{
+    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+    XMLHttpRequest *xhr = RequestOfThis(ctx);
+
+    const AtomicString value = xhr->getResponseHeader(name);
+    if (value.IsNull())
+        duk_push_null(ctx);
+    else
+        Duk::PushString(ctx, value.GetString());
+    return 1;
+}
+
+static duk_ret_t HeadersHas(duk_context *ctx)
+{
+    const AtomicString name = Duk::To<AtomicString>(ctx, 0);
+    XMLHttpRequest *xhr = RequestOfThis(ctx);
+    duk_push_boolean(ctx, !xhr->getResponseHeader(name).IsNull());
+    return 1;
+}
+
+static void PutMethods(duk_context *ctx, const PrototypeEntry::Method *methods, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        duk_push_c_function(ctx, methods[i].impl, methods[i].argc);
+        duk_put_prop_string(ctx, -2, methods[i].name);
+    }
+}
+
+static void PushResponse(duk_context *ctx, duk_idx_t xhrIdx, const XMLHttpRequest &xhr)
+{
+    static const PrototypeEntry::Method HeadersMethods[] = {
+        { "get", HeadersGet, 1 },
+        { "has", HeadersHas, 1 },
+    };
+    static const PrototypeEntry::Method ResponseMethods[] = {
+        { "arrayBuffer", ArrayBuffer, 0 },
+        { "json",        JSON,        0 },
+        { "text",        Text,        0 },
+    };
+
+    xhrIdx = duk_normalize_index(ctx, xhrIdx);
+
+    const int status = xhr.status();
+    duk_push_object(ctx);
+    duk_dup(ctx, xhrIdx);
+    duk_put_prop_string(ctx, -2, RequestKey);
+    duk_push_int(ctx, status);
+    duk_put_prop_string(ctx, -2, "status");
+    Duk::PushString(ctx, xhr.statusText());
+    duk_put_prop_string(ctx, -2, "statusText");
+    duk_push_boolean(ctx, 200 <= status && status <= 299);
+    duk_put_prop_string(ctx, -2, "ok");
+    Duk::PushString(ctx, xhr.responseURL());
+    duk_put_prop_string(ctx, -2, "url");
+    duk_push_string(ctx, "basic");
+    duk_put_prop_string(ctx, -2, "type");
+
+    duk_push_object(ctx);
+    duk_dup(ctx, xhrIdx);
+    duk_put_prop_string(ctx, -2, RequestKey);
+    PutMethods(ctx, HeadersMethods, std::size(HeadersMethods));
+    duk_put_prop_string(ctx, -2, "headers");
+
+    PutMethods(ctx, ResponseMethods, std::size(ResponseMethods));
+}
+
+static void OnSettled(duk_context *ctx, XMLHttpRequest &xhr, Event &event)
+{
+    const duk_idx_t top = duk_get_top(ctx);
+
+    DukScriptObject::Push<DukXMLHttpRequest>(ctx, &xhr);
+    const duk_idx_t xhrIdx = duk_normalize_index(ctx, -1);
+
+    const bool succeeded = event_type_names::kLoad == event.type();
+    if (duk_get_prop_string(ctx, xhrIdx, succeeded ? ResolveKey : RejectKey))
+    {
+        if (succeeded)
+            PushResponse(ctx, xhrIdx, xhr);
+        else
+            duk_push_error_object(ctx, DUK_ERR_TYPE_ERROR, "Failed to fetch");
+        if (DUK_EXEC_SUCCESS != duk_pcall(ctx, 1))
+        {
+#ifndef NDEBUG
+            duk_get_prop_string(ctx, -1, "stack");
+#endif
+            std::string str = Duk::To<std::string>(ctx, -1);
+            ContextImpl::From(ctx)->ConsoleOutput(BK_CONSOLE_ERROR, str.c_str());
+        }
+    }
+
+    duk_del_prop_string(ctx, xhrIdx, ResolveKey);
+    duk_del_prop_string(ctx, xhrIdx, RejectKey);
+    duk_set_top(ctx, top);
+}
+
+static void SetHeaders(duk_context *ctx, duk_idx_t idx, XMLHttpRequest *xhr, ExceptionState &exceptionState)
+{
+    idx = duk_normalize_index(ctx, idx);
+
+    if (duk_is_array(ctx, idx))
+    {
+        // [[name, value], ...]
+        const duk_size_t length = duk_get_length(ctx, idx);
+        for (duk_size_t i = 0; i < length && !exceptionState.HadException(); ++i)
+        {
+            duk_get_prop_index(ctx, idx, static_cast<duk_uarridx_t>(i));
+            duk_get_prop_index(ctx, -1, 0);
+            duk_get_prop_index(ctx, -2, 1);
+            xhr->setRequestHeader(Duk::To<AtomicString>(ctx, -2), Duk::To<AtomicString>(ctx, -1), exceptionState);
+            duk_pop_3(ctx);
+        }
+        return;
+    }
+
+    duk_enum(ctx, idx, DUK_ENUM_OWN_PROPERTIES_ONLY);
+    while (!exceptionState.HadException() && duk_next(ctx, -1, true))
+    {
+        xhr->setRequestHeader(Duk::To<AtomicString>(ctx, -2), Duk::To<AtomicString>(ctx, -1), exceptionState);
+        duk_pop_2(ctx);
+    }
+    duk_pop(ctx);
+}
+
+// The executor of the promise: (resolve, reject)
+static duk_ret_t Executor(duk_context *ctx)
+{
+    duk_push_current_function(ctx);
+    duk_get_prop_string(ctx, -1, InputKey);
+    const duk_idx_t inputIdx = duk_normalize_index(ctx, -1);
+    duk_get_prop_string(ctx, -2, InitKey);
+    const duk_idx_t initIdx = duk_normalize_index(ctx, -1);
+    const bool hasInit = duk_is_object(ctx, initIdx);
+
+    // Request-like objects are taken by their URLs.
+    if (duk_is_object(ctx, inputIdx) && duk_get_prop_string(ctx, inputIdx, "url"))
+        duk_replace(ctx, inputIdx);
+    const String url = Duk::To<String>(ctx, inputIdx);
+
+    AtomicString method("GET");
+    if (hasInit && duk_get_prop_string(ctx, initIdx, "method") && !duk_is_undefined(ctx, -1))
+        method = Duk::To<AtomicString>(ctx, -1);
+
+    XMLHttpRequest *xhr = Pending::CreateRequest(ctx);
+    const duk_idx_t xhrIdx = duk_normalize_index(ctx, -1);
+
+    DukExceptionState exceptionState(ctx);
+    xhr->open(method, url, true, exceptionState);
+    if (hasInit && !exceptionState.HadException() && duk_get_prop_string(ctx, initIdx, "headers")
+        && duk_is_object(ctx, -1))
+    {
+        SetHeaders(ctx, -1, xhr, exceptionState);
+    }
+    if (exceptionState.ThrowIfNeeded())
+        return 0;
+
+    std::shared_ptr<const std::string> body;
+    if (hasInit && duk_get_prop_string(ctx, initIdx, "body"))
+        body = Body::From(ctx, -1);
+
+    duk_dup(ctx, 0);
+    duk_put_prop_string(ctx, xhrIdx, ResolveKey);
+    duk_dup(ctx, 1);
+    duk_put_prop_string(ctx, xhrIdx, RejectKey);
+
+    std::shared_ptr<NativeListener> listener = NativeListener::Create(OnSettled);
+    for (const AtomicString *type : { &event_type_names::kAbort, &event_type_names::kError, &event_type_names::kLoad,
+        &event_type_names::kTimeout })
+    {
+        xhr->addEventListener(*type, listener.get(), false);
+    }
+
+    Pending::Hold(ctx, xhrIdx, xhr);
+    xhr->send(body, exceptionState);
+    if (!xhr->HasPendingActivity())
+        Pending::Release(ctx, xhr);
+    exceptionState.ThrowIfNeeded();
+    return 0;
+}
+
+} // namespace FetchAPI
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+duk_ret_t DukXMLHttpRequest::Construct(duk_context *ctx)
+{
+    if (!duk_is_constructor_call(ctx))
+    {
+        duk_error(ctx, DUK_ERR_TYPE_ERROR, "Please use the 'new' operator.");
+        return 0;
+    }
+
+    Pending::CreateRequest(ctx);
+    return 1;
+}
+
+duk_ret_t DukXMLHttpRequest::Fetch(duk_context *ctx)
+{
+    duk_push_global_object(ctx);
+    if (!duk_get_prop_string(ctx, -1, "Promise") || !duk_is_function(ctx, -1))
+    {
+        duk_error(ctx, DUK_ERR_TYPE_ERROR, "fetch is not available without Promise.");
+        return 0;
+    }
+
+    duk_push_c_function(ctx, FetchAPI::Executor, 2);
+    duk_dup(ctx, 0);
+    duk_put_prop_string(ctx, -2, InputKey);
+    duk_dup(ctx, 1);
+    duk_put_prop_string(ctx, -2, InitKey);
+    duk_new(ctx, 1);
+    return 1;
+}
+
+void DukXMLHttpRequest::FillPrototypeEntry(PrototypeEntry &entry)
+{
+    static const PrototypeEntry::Method Methods[] = {
+        { "abort",                 Impl::Abort,                 0           },
+        { "getAllResponseHeaders", Impl::GetAllResponseHeaders, 0           },
+        { "getResponseHeader",     Impl::GetResponseHeader,     1           },
+        { "open",                  Impl::Open,                  DUK_VARARGS },
+        { "overrideMimeType",      Impl::OverrideMimeType,      1           },
+        { "send",                  Impl::Send,                  DUK_VARARGS },
+        { "setRequestHeader",      Impl::SetRequestHeader,      2           },
+    };
+    static const PrototypeEntry::Property Properties[] = {
+        { "DONE",               Impl::StateConstantGetter<XMLHttpRequest::kDone>,            nullptr                     },
+        { "HEADERS_RECEIVED",   Impl::StateConstantGetter<XMLHttpRequest::kHeadersReceived>, nullptr                     },
+        { "LOADING",            Impl::StateConstantGetter<XMLHttpRequest::kLoading>,         nullptr                     },
+        { "OPENED",             Impl::StateConstantGetter<XMLHttpRequest::kOpened>,          nullptr                     },
+        { "UNSENT",             Impl::StateConstantGetter<XMLHttpRequest::kUnsent>,          nullptr                     },
+        { "onabort",            Handlers::Getter<0>,                                         Handlers::Setter<0>         },
+        { "onerror",            Handlers::Getter<1>,                                         Handlers::Setter<1>         },
+        { "onload",             Handlers::Getter<2>,                                         Handlers::Setter<2>         },
+        { "onloadend",          Handlers::Getter<3>,                                         Handlers::Setter<3>         },
+        { "onloadstart",        Handlers::Getter<4>,                                         Handlers::Setter<4>         },
+        { "onprogress",         Handlers::Getter<5>,                                         Handlers::Setter<5>         },
+        { "onreadystatechange", Handlers::Getter<6>,                                         Handlers::Setter<6>         },
+        { "ontimeout",          Handlers::Getter<7>,                                         Handlers::Setter<7>         },
+        { "readyState",         Impl::ReadyStateGetter,                                      nullptr                     },
+        { "response",           Impl::ResponseGetter,                                        nullptr                     },
+        { "responseText",       Impl::ResponseTextGetter,                                    nullptr                     },
+        { "responseType",       Impl::ResponseTypeGetter,                                    Impl::ResponseTypeSetter    },
+        { "responseURL",        Impl::ResponseURLGetter,                                     nullptr                     },
+        { "status",             Impl::StatusGetter,                                          nullptr                     },
+        { "statusText",         Impl::StatusTextGetter,                                      nullptr                     },
+        { "timeout",            Impl::TimeoutGetter,                                         Impl::TimeoutSetter         },
+        { "withCredentials",    Impl::WithCredentialsGetter,                                 Impl::WithCredentialsSetter },
+    };
+
+    DukEventTarget::FillPrototypeEntry(entry);
+    entry.Add(Methods, std::size(Methods));
+    entry.Add(Properties, std::size(Properties));
+}
+
+void DukXMLHttpRequest::RegisterPrototype(PrototypeHelper &helper)
+{
+    helper.Register(ProtoName, FillPrototypeEntry);
+}
+
+} // namespace BlinKit
@@ -0,0 +1,39 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: duk_xml_http_request.h
+// Description: DukXMLHttpRequest Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_DUK_XML_HTTP_REQUEST_H
+#define BLINKIT_BLINK_DUK_XML_HTTP_REQUEST_H
+
+#pragma once
+
+#include "third_party/blink/renderer/bindings/core/duk/duk_event_target.h"
+#include "third_party/blink/renderer/core/xmlhttprequest/xml_http_request.h"
+
+namespace BlinKit {
+
+class DukXMLHttpRequest final : public DukEventTarget
+{
+public:
+    static const char ProtoName[];
+    static void RegisterPrototype(PrototypeHelper &helper);
+
+    // Constructor of `XMLHttpRequest` on the window.
+    static duk_ret_t Construct(duk_context *ctx);
+    // `window.fetch`, built on top of XMLHttpRequest. Returns promises, so it
+    // needs a `Promise` implementation in the global object.
+    static duk_ret_t Fetch(duk_context *ctx);
+private:
+    static void FillPrototypeEntry(PrototypeEntry &entry);
+};
+
+} // namespace BlinKit
+
+#endif // BLINKIT_BLINK_DUK_XML_HTTP_REQUEST_H
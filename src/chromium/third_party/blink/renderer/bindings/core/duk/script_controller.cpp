@@ -102,7 +102,10 @@ void ScriptController::ExecuteScriptInMainWorld(const ScriptSourceCode &sourceCo
 {
     ContextImpl &ctx = EnsureContext();
     const ContextImpl::Callback callback = std::bind(CommonCallback, &ctx, std::placeholders::_1);
-    ctx.Eval(sourceCode.Source(), callback, sourceCode.FileName().c_str());
+    if (const std::shared_ptr<const std::string> &bytecode = sourceCode.Bytecode())
+        ctx.Run(*bytecode, callback);
+    else
+        ctx.Eval(sourceCode.Source(), callback, sourceCode.FileName().c_str());
 }
 
 bool ScriptController::ScriptEnabled(void)
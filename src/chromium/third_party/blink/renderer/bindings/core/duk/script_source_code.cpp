@@ -36,13 +36,15 @@ ScriptSourceCode::ScriptSourceCode(
     , m_URL(resource->GetResponse().Url().StripFragmentIdentifier())
 {
     ASSERT(!streamer == (reason != ScriptStreamer::NotStreamingReason::kInvalid));
+    if (nullptr != streamer)
+        m_bytecode = streamer->Bytecode();
 }
 
 ScriptSourceCode::~ScriptSourceCode(void) = default;
 
-std::string ScriptSourceCode::FileName(void) const
+std::string ScriptSourceCode::FileName(const BlinKit::BkURL &url)
 {
-    std::string ret = m_URL.Path();
+    std::string ret = url.Path();
     size_t p = ret.rfind('/');
     if (std::string::npos != p)
         ret = ret.substr(p + 1);
@@ -72,10 +72,14 @@ public:
 
     const std::string& Source(void) const { return m_source; }
     const BlinKit::BkURL &Url(void) const { return m_URL; }
-    std::string FileName(void) const;
+    std::string FileName(void) const { return FileName(m_URL); }
+    static std::string FileName(const BlinKit::BkURL &url);
+    // Compiled by the streamer, null if the source has to be compiled.
+    const std::shared_ptr<const std::string>& Bytecode(void) const { return m_bytecode; }
 private:
     const std::string m_source;
     const BlinKit::BkURL m_URL;
+    std::shared_ptr<const std::string> m_bytecode;
 };
 
 } // namespace blink
@@ -16,6 +16,9 @@
 #include "script_streamer.h"
 
 #include "base/memory/ptr_util.h"
+#include "base/single_thread_task_runner.h"
+#include "third_party/blink/renderer/bindings/core/duk/script_source_code.h"
+#include "third_party/blink/renderer/bindings/core/duk/script_streamer_thread.h"
 #include "third_party/blink/renderer/core/script/classic_pending_script.h"
 #include "third_party/blink/renderer/platform/shared_buffer.h"
 #include "third_party/blink/renderer/platform/wtf/wtf.h"
@@ -28,14 +31,28 @@ ScriptStreamer::ScriptStreamer(ClassicPendingScript *script, std::shared_ptr<bas
     : m_pendingScript(script)
     // BKTODO:, m_encoding("UTF-8")
     , m_loadingTaskRunner(loadingTaskRunner)
+    , m_isAlive(std::make_shared<std::atomic<bool>>(true))
 {
 }
 
-ScriptStreamer::~ScriptStreamer(void) = default;
+ScriptStreamer::~ScriptStreamer(void)
+{
+    *m_isAlive = false;
+}
 
 void ScriptStreamer::Cancel(void)
 {
     ASSERT(IsMainThread());
+    *m_isAlive = false;
+}
+
+void ScriptStreamer::CompilingFinished(const std::shared_ptr<const std::string> &bytecode)
+{
+    ASSERT(IsMainThread());
+    ASSERT(!m_parsingFinished);
+    m_bytecode = bytecode;
+    m_parsingFinished = true;
+    NotifyFinishedToClient();
 }
 
 bool ScriptStreamer::HasEnoughDataForStreaming(size_t resourceBufferSize)
@@ -91,113 +108,33 @@ void ScriptStreamer::NotifyAppendData(ScriptResource *resource)
                 m_encoding.assign(encoding);
         }
 #endif
-
-        m_parsingFinished = true;
-#if 0 // BKTODO: Check if necessary.
-        if (!RuntimeEnabledFeatures::ScheduledScriptStreamingEnabled() &&
-            ScriptStreamerThread::Shared()->IsRunningTask()) {
-            // If scheduled script streaming is disabled, we only have one thread for
-            // running the tasks. A new task shouldn't be queued before the running
-            // task completes, because the running task can block and wait for data
-            // from the network.
-            SuppressStreaming(kThreadBusy);
-            return;
-        }
-
-        ASSERT(!m_stream);
-        ASSERT(!m_source);
-        m_stream = new SourceStream;
-        // m_source takes ownership of m_stream.
-        source_ = std::make_unique<v8::ScriptCompiler::StreamedSource>(stream_,
-            encoding_);
-
-        std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask>
-            script_streaming_task(
-                base::WrapUnique(v8::ScriptCompiler::StartStreamingScript(
-                    V8PerIsolateData::MainThreadIsolate(), source_.get(),
-                    compile_options_)));
-        if (!script_streaming_task) {
-            // V8 cannot stream the script.
-            SuppressStreaming(kV8CannotStream);
-            stream_ = nullptr;
-            source_.reset();
-            return;
-        }
-
-        if (RuntimeEnabledFeatures::ScheduledScriptStreamingEnabled()) {
-            // Script streaming tasks are high priority, as they can block the parser,
-            // and they can (and probably will) block during their own execution as
-            // they wait for more input.
-            //
-            // Pass through the atomic cancellation token which is set to true by the
-            // task when it is started, or set to true by the streamer if it wants to
-            // cancel the task.
-            //
-            // TODO(leszeks): Decrease the priority of these tasks where possible.
-            BackgroundScheduler::PostOnBackgroundThreadWithTraits(
-                FROM_HERE, { base::TaskPriority::USER_BLOCKING, base::MayBlock() },
-                CrossThreadBind(RunBlockingScriptStreamingTask,
-                    WTF::Passed(std::move(script_streaming_task)),
-                    WrapCrossThreadPersistent(this),
-                    WTF::CrossThreadUnretained(
-                        &blocking_task_started_or_cancelled_)));
-        }
-        else {
-            blocking_task_started_or_cancelled_.test_and_set();
-            ScriptStreamerThread::Shared()->PostTask(
-                CrossThreadBind(&ScriptStreamerThread::RunScriptStreamingTask,
-                    WTF::Passed(std::move(script_streaming_task)),
-                    WrapCrossThreadPersistent(this)));
-        }
-#endif
     }
-#if 0 // BKTODO: Check if necessary.
-    if (m_stream)
-        m_stream->DidReceiveData(resource, this);
-#endif
 }
 
 void ScriptStreamer::NotifyFinished(void)
 {
     ASSERT(IsMainThread());
-    // A special case: empty and small scripts. We didn't receive enough data to
-    // start the streaming before this notification. In that case, there won't
-    // be a "parsing complete" notification either, and we should not wait for
-    // it.
-    if (!m_haveEnoughDataForStreaming)
-        SuppressStreaming(kScriptTooSmall);
-
-#if 0 // BKTODO: Check if necessary
-    if (stream_) {
-        // Mark the stream as finished loading before potentially re-posting the
-        // task to avoid a race between this finish and the task's first read.
-        stream_->DidFinishLoading();
-
-        // If the corresponding blocking task hasn't started yet, cancel it and post
-        // a non-blocking task, since we know now that all the data is received and
-        // we will no longer block.
-        //
-        // TODO(874080): Once we have mutable task traits, simply unmark the
-        // existing task as no longer MayBlock.
-        if (RuntimeEnabledFeatures::ScheduledScriptStreamingEnabled() &&
-            !blocking_task_started_or_cancelled_.test_and_set()) {
-            std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask>
-                script_streaming_task(
-                    base::WrapUnique(v8::ScriptCompiler::StartStreamingScript(
-                        V8PerIsolateData::MainThreadIsolate(), source_.get(),
-                        compile_options_)));
-
-            // The task creation shouldn't fail, since it didn't fail before during
-            // NotifyAppendData.
-            CHECK(script_streaming_task);
-            BackgroundScheduler::PostOnBackgroundThreadWithTraits(
-                FROM_HERE, { base::TaskPriority::USER_BLOCKING },
-                CrossThreadBind(RunNonBlockingScriptStreamingTask,
-                    WTF::Passed(std::move(script_streaming_task)),
-                    WrapCrossThreadPersistent(this)));
+    if (!m_streamingSuppressed)
+    {
+        ScriptResource *resource = ToScriptResource(m_pendingScript->GetResource());
+        if (resource->ErrorOccurred())
+        {
+            SuppressStreaming(kErrorOccurred);
+        }
+        else if (!m_haveEnoughDataForStreaming && !HasEnoughDataForStreaming(resource->SourceText().length()))
+        {
+            // A special case: empty and small scripts. We didn't receive
+            // enough data to start the streaming before this notification
+            // (which is also the case of memory cache hits), and the whole
+            // script is still too small to be worth a thread hop.
+            SuppressStreaming(kScriptTooSmall);
+        }
+        else
+        {
+            StartCompiling(resource);
         }
     }
-#endif
+
     m_loadingFinished = true;
 
     NotifyFinishedToClient();
@@ -206,11 +143,9 @@ void ScriptStreamer::NotifyFinished(void)
 void ScriptStreamer::NotifyFinishedToClient(void)
 {
     ASSERT(IsMainThread());
-    // Usually, the loading will be finished first, and V8 will still need some
-    // time to catch up. But the other way is possible too: if V8 detects a
-    // parse error, the V8 side can complete before loading has finished. Send
-    // the notification after both loading and V8 side operations have
-    // completed.
+    // The compiling starts after the loading has finished, so usually the
+    // notification is sent when the compiling task reports back. Send it
+    // after both of them have completed.
     if (!IsFinished())
         return;
 
@@ -252,16 +187,17 @@ void ScriptStreamer::StartStreaming(
     // async callbacks generated by the cache hit.
     if (script->IsReady())
     {
-        ASSERT(false); // BKTODO:
-#if 0
         ASSERT(resource->IsLoaded());
-        streamer->NotifyAppendData(resource);
-        if (streamer->StreamingSuppressed())
+        if (resource->ErrorOccurred())
         {
-            *not_streaming_reason = streamer->StreamingSuppressedReason();
+            *notStreamingReason = kErrorOccurred;
+            return;
+        }
+        if (!HasEnoughDataForStreaming(resource->SourceText().length()))
+        {
+            *notStreamingReason = kScriptTooSmall;
             return;
         }
-#endif
     }
 
     ScriptStreamer *tmp = streamer.get();
@@ -274,6 +210,32 @@ void ScriptStreamer::StartStreaming(
         tmp->NotifyFinished();
 }
 
+void ScriptStreamer::StartCompiling(ScriptResource *resource)
+{
+    ASSERT(IsMainThread());
+    ASSERT(!m_parsingFinished);
+
+    // The source text is shared with the resource, which keeps its decoded
+    // text for the memory cache anyway.
+    std::shared_ptr<const std::string> sourceText = resource->SharedSourceText();
+    std::string fileName = ScriptSourceCode::FileName(resource->GetResponse().Url());
+
+    std::shared_ptr<std::atomic<bool>> isAlive = m_isAlive;
+    std::shared_ptr<base::SingleThreadTaskRunner> taskRunner = m_loadingTaskRunner;
+    auto task = [this, isAlive, taskRunner, sourceText, fileName](duk_context *ctx) {
+        if (!*isAlive)
+            return;
+
+        std::shared_ptr<const std::string> bytecode = ScriptStreamerThread::Compile(ctx, *sourceText, fileName);
+        auto callback = [this, isAlive, bytecode] {
+            if (*isAlive)
+                CompilingFinished(bytecode);
+        };
+        taskRunner->PostTask(FROM_HERE, callback);
+    };
+    ScriptStreamerThread::Shared()->PostTask(task);
+}
+
 void ScriptStreamer::SuppressStreaming(NotStreamingReason reason)
 {
     ASSERT(IsMainThread());
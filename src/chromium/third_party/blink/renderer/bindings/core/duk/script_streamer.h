@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include "third_party/blink/renderer/platform/heap/handle.h"
 #include "third_party/blink/renderer/platform/wtf/noncopyable.h"
@@ -31,13 +32,14 @@ namespace blink {
 class ClassicPendingScript;
 class ScriptResource;
 
-// ScriptStreamer streams incomplete script data to V8 so that it can be parsed
-// while it's loaded. ClassicPendingScript holds a reference to ScriptStreamer.
-// At the moment, ScriptStreamer is only used for parser blocking scripts; this
-// means that the Document stays stable and no other scripts are executing
-// while we're streaming. It is possible, though, that Document and the
-// ClassicPendingScript are destroyed while the streaming is in progress, and
-// ScriptStreamer handles it gracefully.
+// ScriptStreamer compiles large scripts into duktape bytecode on a
+// ScriptStreamerThread, so that the main thread only has to load and run
+// them. Duktape cannot compile incomplete input, so the compiling starts once
+// the script has been loaded; it still runs in parallel with parsing and with
+// the loading of other scripts. ClassicPendingScript holds a reference to
+// ScriptStreamer. It is possible that Document and the ClassicPendingScript
+// are destroyed while the compiling is in progress, and ScriptStreamer
+// handles it gracefully.
 class ScriptStreamer final : public GarbageCollectedFinalized<ScriptStreamer>
 {
     WTF_MAKE_NONCOPYABLE(ScriptStreamer);
@@ -103,11 +105,17 @@ public:
     // Called by ClassicPendingScript when data arrives from the network.
     void NotifyAppendData(ScriptResource *resource);
     void NotifyFinished(void);
+
+    // The compiled script, null if it could not be compiled off the main
+    // thread. Only valid after the streaming has finished.
+    const std::shared_ptr<const std::string>& Bytecode(void) const { return m_bytecode; }
 private:
     ScriptStreamer(ClassicPendingScript *script, std::shared_ptr<base::SingleThreadTaskRunner> &loadingTaskRunner);
 
+    void StartCompiling(ScriptResource *resource);
+    void CompilingFinished(const std::shared_ptr<const std::string> &bytecode);
     void NotifyFinishedToClient(void);
-    bool HasEnoughDataForStreaming(size_t resourceBufferSize);
+    static bool HasEnoughDataForStreaming(size_t resourceBufferSize);
 
     // Scripts whose first data chunk is smaller than this constant won't be
     // streamed. Non-const for testing.
@@ -118,7 +126,7 @@ private:
     Member<ClassicPendingScript> m_pendingScript;
 
     bool m_loadingFinished = false;  // Whether loading from the network is done.
-    bool m_parsingFinished = false;  // Whether the V8 side processing is done.
+    bool m_parsingFinished = false;  // Whether the compiling is done.
     // Whether we have received enough data to start the streaming.
     bool m_haveEnoughDataForStreaming = false;
 
@@ -131,6 +139,9 @@ private:
     // BKTODO: std::string m_encoding;
 
     std::shared_ptr<base::SingleThreadTaskRunner> m_loadingTaskRunner;
+    // Shared with the compiling task, which is dropped once this is cleared.
+    std::shared_ptr<std::atomic<bool>> m_isAlive;
+    std::shared_ptr<const std::string> m_bytecode;
 };
 
 } // namespace blink
@@ -0,0 +1,115 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: script_streamer_thread.cpp
+// Description: ScriptStreamerThread Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "script_streamer_thread.h"
+
+#include <algorithm>
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
+
+namespace blink {
+
+ScriptStreamerThread::ScriptStreamerThread(unsigned threadCount)
+{
+    for (unsigned i = 0; i < threadCount; ++i)
+        m_threads.emplace_back(&ScriptStreamerThread::ThreadMain, this);
+}
+
+ScriptStreamerThread::~ScriptStreamerThread(void)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_quit = true;
+        m_tasks.clear();
+    }
+    m_condition.notify_all();
+
+    for (std::thread &thread : m_threads)
+        thread.join();
+}
+
+std::shared_ptr<const std::string> ScriptStreamerThread::Compile(
+    duk_context *ctx,
+    const std::string &source,
+    const std::string &fileName)
+{
+    TRACE_EVENT1("script", "ScriptStreamerThread::Compile", "bytes", source.length());
+
+    std::shared_ptr<const std::string> ret;
+
+    int r;
+    if (fileName.empty())
+    {
+        r = duk_pcompile_lstring(ctx, 0, source.data(), source.length());
+    }
+    else
+    {
+        duk_push_string(ctx, fileName.c_str());
+        r = duk_pcompile_lstring_filename(ctx, 0, source.data(), source.length());
+    }
+
+    if (DUK_EXEC_SUCCESS == r)
+    {
+        duk_dump_function(ctx);
+
+        duk_size_t size = 0;
+        const char *data = reinterpret_cast<const char *>(duk_get_buffer_data(ctx, -1, &size));
+        ret = std::make_shared<const std::string>(data, size);
+    }
+
+    duk_set_top(ctx, 0);
+    return ret;
+}
+
+void ScriptStreamerThread::PostTask(const Task &task)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_tasks.push_back(task);
+    }
+    m_condition.notify_one();
+}
+
+ScriptStreamerThread* ScriptStreamerThread::Shared(void)
+{
+    // Leave a core to the main thread, scripts are executed there.
+    static ScriptStreamerThread s_instance([] {
+        unsigned n = std::thread::hardware_concurrency();
+        return n > 2 ? std::min(n - 1, 4U) : 1U;
+    }());
+    return &s_instance;
+}
+
+void ScriptStreamerThread::ThreadMain(void)
+{
+    duk_context *ctx = nullptr;
+    for (;;)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_condition.wait(lock, [this] { return m_quit || !m_tasks.empty(); });
+            if (m_quit)
+                break;
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        // Threads which never get a task do not pay for a heap.
+        if (nullptr == ctx)
+            ctx = duk_create_heap_default();
+        task(ctx);
+    }
+
+    if (nullptr != ctx)
+        duk_destroy_heap(ctx);
+}
+
+} // namespace blink
@@ -0,0 +1,62 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: script_streamer_thread.h
+// Description: ScriptStreamerThread Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_SCRIPT_STREAMER_THREAD_H
+#define BLINKIT_BLINK_SCRIPT_STREAMER_THREAD_H
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "duktape/duktape.h"
+
+namespace blink {
+
+// A small pool of threads compiling scripts for ScriptStreamer. Each thread
+// owns a scratch duktape heap, which is only used to compile scripts and dump
+// them as bytecode, so that the page contexts only have to load and run them.
+class ScriptStreamerThread
+{
+public:
+    static ScriptStreamerThread* Shared(void);
+
+    // Tasks run on one of the threads, with the heap of that thread. The
+    // stack of the heap is empty when a task begins.
+    typedef std::function<void(duk_context *)> Task;
+    void PostTask(const Task &task);
+
+    // Compiles |source| as a program and dumps it. Returns nullptr if the
+    // script could not be compiled; it will be compiled again on the main
+    // thread then, to report the error.
+    static std::shared_ptr<const std::string> Compile(duk_context *ctx, const std::string &source,
+        const std::string &fileName);
+private:
+    explicit ScriptStreamerThread(unsigned threadCount);
+    ~ScriptStreamerThread(void);
+
+    void ThreadMain(void);
+
+    std::mutex m_lock;
+    std::condition_variable m_condition;
+    std::deque<Task> m_tasks;
+    bool m_quit = false;
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace blink
+
+#endif // BLINKIT_BLINK_SCRIPT_STREAMER_THREAD_H
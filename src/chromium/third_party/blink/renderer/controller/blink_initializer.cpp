@@ -31,7 +31,7 @@ static void InitializeCommon(Platform *platform)
 
     StringImpl::ReserveStaticStringsCapacityForSize(kCoreStaticStringsCount + StringImpl::AllStaticStrings().size());
     QualifiedName::InitAndReserveCapacityForSize(kQualifiedNamesCount);
-    AtomicStringTable::Instance().ReserveCapacity(kCoreStaticStringsCount);
+    AtomicStringTable::ReserveCapacity(kCoreStaticStringsCount + kQualifiedNamesCount);
 
     // BKTODO:
     html_names::Init();
@@ -42,6 +42,8 @@ static void InitializeCommon(Platform *platform)
     event_type_names::Init();
     html_tokenizer_names::Init();
     http_names::Init();
+
+    AtomicStringTable::FreezeStaticStrings();
 }
 
 void Initialize(Platform *platform, scheduler::WebThreadScheduler* mainThreadScheduler)
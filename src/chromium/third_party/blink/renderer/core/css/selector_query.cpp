@@ -46,6 +46,7 @@
 #include "third_party/blink/renderer/core/dom/static_node_list.h"
 #include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/platform/bindings/exception_state.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 
 namespace blink {
 
@@ -329,6 +330,7 @@ void SelectorQuery::FindTraverseRootsAndExecute(ContainerNode &rootNode, typenam
 
 StaticElementList* SelectorQuery::QueryAll(ContainerNode &rootNode) const
 {
+    TRACE_EVENT0("dom", "SelectorQuery::QueryAll");
     NthIndexCache nthIndexCache(rootNode.GetDocument());
     std::vector<Element *> result;
     Execute<AllElementsSelectorQueryTrait>(rootNode, result);
@@ -337,6 +339,7 @@ StaticElementList* SelectorQuery::QueryAll(ContainerNode &rootNode) const
 
 Element* SelectorQuery::QueryFirst(ContainerNode &rootNode) const
 {
+    TRACE_EVENT0("dom", "SelectorQuery::QueryFirst");
     NthIndexCache nthIndexCache(rootNode.GetDocument());
     Element *matchedElement = nullptr;
     Execute<SingleElementSelectorQueryTrait>(rootNode, matchedElement);
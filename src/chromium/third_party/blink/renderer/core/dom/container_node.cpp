@@ -45,6 +45,7 @@
 #include "third_party/blink/renderer/core/dom/node_traversal.h"
 #include "third_party/blink/renderer/core/dom/static_node_list.h"
 #include "third_party/blink/renderer/core/dom/tree_ordered_map.h"
+#include "third_party/blink/renderer/core/editing/text_extractor.h"
 #include "third_party/blink/renderer/core/html_element_type_helpers.h"
 #include "third_party/blink/renderer/core/html/html_tag_collection.h"
 #include "third_party/blink/renderer/platform/bindings/exception_state.h"
@@ -1078,6 +1079,11 @@ void ContainerNode::SetRestyleFlag(DynamicRestyleFlags mask)
     EnsureRareData().SetRestyleFlag(mask);
 }
 
+String ContainerNode::VisibleText(unsigned options) const
+{
+    return TextExtractor(options).Extract(*this);
+}
+
 void ContainerNode::WillRemoveChild(Node &child)
 {
     ASSERT(child.parentNode() == this);
@@ -89,6 +89,9 @@ public:
     Element* querySelector(const AtomicString &selectors, ExceptionState &exceptionState);
     StaticElementList* querySelectorAll(const AtomicString &selectors, ExceptionState &exceptionState);
 
+    // The rendered text of the subtree, see TextExtractor::Options for |options|.
+    String VisibleText(unsigned options = 0) const;
+
     Node* FirstChild(void) const { return m_firstChild; }
     Node* LastChild(void) const { return m_lastChild; }
     Node* RemoveChild(Node *oldChild, ExceptionState &exceptionState);
@@ -26,9 +26,11 @@
 #include "third_party/blink/renderer/core/dom/decoded_data_document_parser.h"
 
 #include <memory>
+#include "blinkit/crawler/crawler_metrics.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/document_encoding_data.h"
 #include "third_party/blink/renderer/core/html/parser/text_resource_decoder.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 
 namespace blink {
 
@@ -64,7 +66,15 @@ void DecodedDataDocumentParser::AppendBytes(const char* data, size_t length) {
   if (IsDetached())
     return;
 
-  String decoded = decoder_->Decode(data, length);
+  String decoded;
+  {
+    TRACE_EVENT1("loader", "DecodedDataDocumentParser::Decode", "bytes", length);
+    base::TimeTicks start = base::TimeTicks::Now();
+    decoded = decoder_->Decode(data, length);
+    if (BlinKit::CrawlerMetrics* metrics =
+            BlinKit::CrawlerMetrics::From(*GetDocument()))
+      metrics->AddDecodeTime(base::TimeTicks::Now() - start);
+  }
   UpdateDocument(decoded);
 }
 
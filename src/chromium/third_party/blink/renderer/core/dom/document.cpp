@@ -573,21 +573,29 @@ Node* Document::Clone(Document &factory, CloneChildrenFlag flag) const
     return nullptr;
 }
 
+// |resolver| is a BkURL or a BkURLResolver, which resolve the same.
+template <typename Resolver>
+static BkURL CompleteURLWithResolver(const String &url, const Resolver &resolver)
+{
+    // Always return a null URL when passed a null string.
+    // FIXME: Should we change the KURL constructor to have this behavior?
+    // See also [CSS]StyleSheet::completeURL(const String&)
+    if (url.IsNull())
+        return BkURL();
+    return resolver.Resolve(url.StdUtf8()); // BKTODO: Resolve with encoding.
+}
+
 BkURL Document::CompleteURL(const String &url) const
 {
-    return CompleteURLWithOverride(url, m_baseURL);
+    // Same as CompleteURLWithOverride(url, m_baseURL), but through the
+    // resolver kept for the base URL.
+    return CompleteURLWithResolver(url, m_baseURLResolver);
 }
 
 BkURL Document::CompleteURLWithOverride(const String &url, const BkURL &baseUrlOverride) const
 {
     ASSERT(baseUrlOverride.IsEmpty() || baseUrlOverride.IsValid());
-
-    // Always return a null URL when passed a null string.
-    // FIXME: Should we change the KURL constructor to have this behavior?
-    // See also [CSS]StyleSheet::completeURL(const String&)
-    if (url.IsNull())
-        return BkURL();
-    return baseUrlOverride.Resolve(url.StdUtf8()); // BKTODO: Resolve with encoding.
+    return CompleteURLWithResolver(url, baseUrlOverride);
 }
 
 Document* Document::ContextDocument(void) const
@@ -828,9 +836,9 @@ void Document::FinishedParsing(void)
     // on a timer.
     m_elementDataCacheClearTimer.StartOneShot(TimeDelta::FromSeconds(10), FROM_HERE);
 
-#if 0 // BKTODO: Check if necesary.
     // Parser should have picked up all preloads by now
-    fetcher_->ClearPreloads(ResourceFetcher::kClearSpeculativeMarkupPreloads);
+    m_fetcher->ClearPreloads();
+#if 0 // BKTODO: Check if necesary.
     if (!frame_ || frame_->GetSettings()->GetSavePreviousDocumentResources() ==
         SavePreviousDocumentResources::kUntilOnDOMContentLoaded) {
         fetcher_->ClearResourcesFromPreviousFetcher();
@@ -1571,6 +1579,7 @@ void Document::UpdateBaseURL(void)
 
     if (!m_baseURL.IsValid())
         m_baseURL = BkURL();
+    m_baseURLResolver = BkURLResolver(m_baseURL);
 
 #ifndef BLINKIT_CRAWLER_ONLY
     if (ForCrawler())
@@ -120,7 +120,10 @@ public:
     {
         ASSERT(m_lifecycle.StateAllowsTreeMutations());
         m_domTreeVersion = ++m_globalTreeVersion;
+        ++m_mutationCount;
     }
+    // Tree and attribute changes since the document was created.
+    uint64_t MutationCount(void) const { return m_mutationCount; }
 
     LocalDOMWindow* domWindow(void) const { return m_domWindow; }
     void ClearDOMWindow(void) { m_domWindow = nullptr; }
@@ -192,7 +195,12 @@ public:
     bool HasMutationObserversOfType(MutationType type) const { return 0 != (m_mutationObserverTypes & type); }
 
     int NodeCount(void) const { return m_nodeCount; }
-    void IncrementNodeCount(void) { ++m_nodeCount; }
+    int PeakNodeCount(void) const { return m_peakNodeCount; }
+    void IncrementNodeCount(void)
+    {
+        if (++m_nodeCount > m_peakNodeCount)
+            m_peakNodeCount = m_nodeCount;
+    }
     void DecrementNodeCount(void)
     {
         ASSERT(m_nodeCount > 0);
@@ -365,6 +373,7 @@ private:
 
     static uint64_t m_globalTreeVersion;
     uint64_t m_domTreeVersion;
+    uint64_t m_mutationCount = 0;
 
     DocumentLifecycle m_lifecycle;
     Member<LocalFrame> m_frame;
@@ -391,6 +400,7 @@ private:
     // Document URLs.
     BlinKit::BkURL m_URL;  // Document.URL: The URL from which this document was retrieved.
     BlinKit::BkURL m_baseURL;  // Node.baseURI: The URL to use when resolving relative URLs.
+    BlinKit::BkURLResolver m_baseURLResolver;  // Resolves against m_baseURL for CompleteURL.
     BlinKit::BkURL m_baseURLOverride;
     BlinKit::BkURL m_baseElementURL;  // The URL set by the <base> element.
 
@@ -427,7 +437,7 @@ private:
     // the cache object's references will be traced by a stack walk.
     NthIndexCache *m_nthIndexCache = nullptr;
 
-    int m_nodeCount = 0;
+    int m_nodeCount = 0, m_peakNodeCount = 0;
     std::unordered_set<const LiveNodeListBase *> m_listsInvalidatedAtDocument;
     LiveNodeListRegistry m_nodeLists;
 
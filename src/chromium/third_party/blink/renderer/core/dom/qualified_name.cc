@@ -56,8 +56,11 @@ static_assert(sizeof(QualifiedName::QualifiedNameImpl) ==
                   sizeof(SameSizeAsQualifiedNameImpl),
               "QualifiedNameImpl should stay small");
 
+// Looked up for every element and attribute created by the parser.
 using QualifiedNameCache =
-    HashSet<QualifiedName::QualifiedNameImpl*, QualifiedNameHash>;
+    HashSet<QualifiedName::QualifiedNameImpl*,
+            QualifiedNameHash,
+            SwissHashTraits<HashTraits<QualifiedName::QualifiedNameImpl*>>>;
 
 static QualifiedNameCache& GetQualifiedNameCache() {
   // This code is lockless and thus assumes it all runs on one thread!
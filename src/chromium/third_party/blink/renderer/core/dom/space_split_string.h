@@ -103,7 +103,12 @@ class CORE_EXPORT SpaceSplitString {
     AtomicString key_string_;
     Vector<AtomicString, 4> vector_;
   };
-  typedef HashMap<AtomicString, Data*> DataMap;
+  // Looked up for every class attribute which is set.
+  typedef HashMap<AtomicString,
+                  Data*,
+                  DefaultHash<AtomicString>::Hash,
+                  SwissHashTraits<HashTraits<AtomicString>>>
+      DataMap;
 
   static DataMap& SharedDataMap();
 
@@ -0,0 +1,165 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: streaming_markup_serializer.cpp
+// Description: StreamingMarkupSerializer Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "streaming_markup_serializer.h"
+
+#include <algorithm>
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/platform/wtf/text/utf8.h"
+
+namespace blink {
+
+using namespace WTF::Unicode;
+
+// Large enough for any UTF-8 sequence.
+static constexpr size_t kMinChunkSize = 16;
+
+static ConversionResult ConvertToUTF8(const LChar **source, const LChar *sourceEnd, char **target, char *targetEnd)
+{
+    return ConvertLatin1ToUTF8(source, sourceEnd, target, targetEnd);
+}
+
+static ConversionResult ConvertToUTF8(const UChar **source, const UChar *sourceEnd, char **target, char *targetEnd)
+{
+    return ConvertUTF16ToUTF8(source, sourceEnd, target, targetEnd, false);
+}
+
+StreamingMarkupSerializer::StreamingMarkupSerializer(const Sink &sink, unsigned options, size_t chunkSize)
+    : MarkupAccumulator(kDoNotResolveURLs)
+    , m_sink(sink)
+    , m_options(options)
+    , m_chunk(std::max(chunkSize, kMinChunkSize))
+{
+}
+
+void StreamingMarkupSerializer::AppendEndTag(const Element &element)
+{
+    AppendEndMarkup(m_markup, element);
+    Flush();
+}
+
+void StreamingMarkupSerializer::AppendStartTag(Node &node, Namespaces *namespaces)
+{
+    if (Node::kCommentNode == node.getNodeType() && (m_options & kStripComments))
+        return;
+
+    AppendStartMarkup(m_markup, node, namespaces);
+    Flush();
+}
+
+void StreamingMarkupSerializer::Drain(void)
+{
+    if (0 == m_chunkLength)
+        return;
+    if (!m_stopped)
+        m_stopped = !m_sink(m_chunk.data(), m_chunkLength);
+    m_chunkLength = 0;
+}
+
+void StreamingMarkupSerializer::Flush(void)
+{
+    if (!m_stopped && !m_markup.IsEmpty())
+    {
+        if (m_markup.Is8Bit())
+            Transcode(m_markup.Characters8(), m_markup.length());
+        else
+            Transcode(m_markup.Characters16(), m_markup.length());
+    }
+    m_markup.Clear();
+}
+
+bool StreamingMarkupSerializer::Serialize(Node &node, EChildrenOnly childrenOnly)
+{
+    SerializeNodes<EditingStrategy>(*this, node, childrenOnly);
+    Drain();
+    return !m_stopped;
+}
+
+bool StreamingMarkupSerializer::ShouldIgnoreAttribute(const Element &element, const Attribute &attribute) const
+{
+    if (m_options & kStripScripts)
+    {
+        if (attribute.GetName().NamespaceURI().IsNull() && attribute.LocalName().StartsWithIgnoringASCIICase("on"))
+            return true;
+    }
+    if (m_options & kStripStyles)
+    {
+        if (attribute.GetName() == html_names::kStyleAttr)
+            return true;
+    }
+    return false;
+}
+
+bool StreamingMarkupSerializer::ShouldIgnoreElement(const Element &element) const
+{
+    // Skips the remaining subtrees once the sink gives up.
+    if (m_stopped)
+        return true;
+
+    if (m_options & kStripScripts)
+    {
+        if (element.HasTagName(html_names::kScriptTag))
+            return true;
+    }
+    if (m_options & kStripStyles)
+    {
+        if (element.HasTagName(html_names::kStyleTag))
+            return true;
+        if (element.HasTagName(html_names::kLinkTag)
+            && kNotFound != element.FastGetAttribute(html_names::kRelAttr).FindIgnoringASCIICase("stylesheet"))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename CharType>
+void StreamingMarkupSerializer::Transcode(const CharType *characters, unsigned length)
+{
+    const CharType *end = characters + length;
+    while (characters < end && !m_stopped)
+    {
+        char *target = m_chunk.data() + m_chunkLength;
+        char *targetEnd = m_chunk.data() + m_chunk.size();
+        ConversionResult result = ConvertToUTF8(&characters, end, &target, targetEnd);
+        m_chunkLength = target - m_chunk.data();
+
+        switch (result)
+        {
+            case kTargetExhausted:
+                Drain();
+                break;
+            case kSourceExhausted:
+            {
+                // An unpaired high surrogate at the end, encoded as it is, the
+                // same as WTF::String::Utf8 does in lenient mode.
+                ASSERT(characters + 1 == end);
+                if (targetEnd - target < 3)
+                {
+                    Drain();
+                    target = m_chunk.data();
+                }
+                UChar c = *characters++;
+                *target++ = static_cast<char>(((c >> 12) & 0x0F) | 0xE0);
+                *target++ = static_cast<char>(((c >> 6) & 0x3F) | 0x80);
+                *target++ = static_cast<char>((c & 0x3F) | 0x80);
+                m_chunkLength = target - m_chunk.data();
+                break;
+            }
+            default:
+                ASSERT(kConversionOK == result);
+        }
+    }
+}
+
+} // namespace blink
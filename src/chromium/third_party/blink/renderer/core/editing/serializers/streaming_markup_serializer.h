@@ -0,0 +1,67 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: streaming_markup_serializer.h
+// Description: StreamingMarkupSerializer Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_STREAMING_MARKUP_SERIALIZER_H
+#define BLINKIT_BLINK_STREAMING_MARKUP_SERIALIZER_H
+
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "third_party/blink/renderer/core/editing/serializers/markup_accumulator.h"
+
+namespace blink {
+
+// Serializes a DOM tree as UTF-8, in chunks of at most |chunkSize| bytes.
+// Unlike CreateMarkup, the whole markup is never held in memory: each node is
+// formatted and transcoded into a chunk, which is handed to the sink as soon
+// as it is full.
+class StreamingMarkupSerializer final : private MarkupAccumulator
+{
+public:
+    // Returns false to stop the serialization.
+    using Sink = std::function<bool(const char *, size_t)>;
+
+    enum Options {
+        kStripScripts  = 0x1, // <script> elements and event handler attributes.
+        kStripStyles   = 0x2, // <style>, <link rel=stylesheet> and style attributes.
+        kStripComments = 0x4,
+    };
+
+    static constexpr size_t kDefaultChunkSize = 64 * 1024;
+
+    StreamingMarkupSerializer(const Sink &sink, unsigned options, size_t chunkSize = kDefaultChunkSize);
+
+    // Returns false if the sink stopped the serialization.
+    bool Serialize(Node &node, EChildrenOnly childrenOnly);
+private:
+    void Flush(void);
+    void Drain(void);
+    template <typename CharType>
+    void Transcode(const CharType *characters, unsigned length);
+
+    // MarkupAccumulator
+    void AppendStartTag(Node &node, Namespaces *namespaces) override;
+    void AppendEndTag(const Element &element) override;
+    bool ShouldIgnoreAttribute(const Element &element, const Attribute &attribute) const override;
+    bool ShouldIgnoreElement(const Element &element) const override;
+
+    const Sink &m_sink;
+    const unsigned m_options;
+    bool m_stopped = false;
+    StringBuilder m_markup;
+    std::vector<char> m_chunk;
+    size_t m_chunkLength = 0;
+};
+
+} // namespace blink
+
+#endif // BLINKIT_BLINK_STREAMING_MARKUP_SERIALIZER_H
@@ -0,0 +1,216 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: text_extractor.cpp
+// Description: TextExtractor Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "text_extractor.h"
+
+#include <unordered_map>
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/dom/text.h"
+#include "third_party/blink/renderer/core/html/parser/html_parser_idioms.h"
+#include "third_party/blink/renderer/core/html_names.h"
+
+namespace blink {
+
+namespace {
+
+enum class ElementKind { kSkipped, kBlock, kLineBreak, kPreformatted, kLink };
+
+class ElementKinds
+{
+public:
+    ElementKinds(void)
+    {
+        using namespace html_names;
+
+        static const HTMLQualifiedName *kSkippedTags[] = {
+            &kHeadTag, &kIFrameTag, &kNoembedTag, &kNoframesTag, &kNoscriptTag, &kScriptTag, &kStyleTag,
+            &kTemplateTag,
+        };
+        for (const HTMLQualifiedName *tag : kSkippedTags)
+            Add(*tag, ElementKind::kSkipped);
+
+        static const HTMLQualifiedName *kBlockTags[] = {
+            &kAddressTag, &kArticleTag, &kAsideTag, &kBlockquoteTag, &kBodyTag, &kCaptionTag, &kDdTag, &kDetailsTag,
+            &kDivTag, &kDlTag, &kDtTag, &kFieldsetTag, &kFigcaptionTag, &kFigureTag, &kFooterTag, &kFormTag,
+            &kH1Tag, &kH2Tag, &kH3Tag, &kH4Tag, &kH5Tag, &kH6Tag, &kHeaderTag, &kHrTag, &kLiTag, &kMainTag,
+            &kNavTag, &kOlTag, &kPTag, &kSectionTag, &kSummaryTag, &kTableTag, &kTdTag, &kThTag, &kTrTag,
+            &kUlTag,
+        };
+        for (const HTMLQualifiedName *tag : kBlockTags)
+            Add(*tag, ElementKind::kBlock);
+
+        Add(kBrTag, ElementKind::kLineBreak);
+        Add(kListingTag, ElementKind::kPreformatted);
+        Add(kPlaintextTag, ElementKind::kPreformatted);
+        Add(kPreTag, ElementKind::kPreformatted);
+        Add(kTextareaTag, ElementKind::kPreformatted);
+        Add(kXmpTag, ElementKind::kPreformatted);
+        Add(kATag, ElementKind::kLink);
+    }
+
+    const ElementKind* Find(const Element &element) const
+    {
+        auto it = m_kinds.find(element.localName().Impl());
+        return std::end(m_kinds) != it ? &it->second : nullptr;
+    }
+private:
+    void Add(const HTMLQualifiedName &tag, ElementKind kind) { m_kinds[tag.LocalName().Impl()] = kind; }
+
+    std::unordered_map<StringImpl *, ElementKind> m_kinds;
+};
+
+} // namespace
+
+String TextExtractor::Extract(const ContainerNode &root)
+{
+    TraverseChildren(root);
+    return m_text.ToString();
+}
+
+void TextExtractor::AppendLinkAnnotation(const Element &element)
+{
+    const AtomicString &href = element.FastGetAttribute(html_names::kHrefAttr);
+    if (href.IsEmpty())
+        return;
+
+    BlinKit::BkURL URL = element.GetDocument().CompleteURL(href);
+    if (!URL.IsValid())
+        return;
+
+    AddSeparator(Separator::kSpace);
+    FlushSeparator();
+    m_text.Append('[');
+    m_text.Append(String::FromStdUTF8(URL.AsString()));
+    m_text.Append(']');
+}
+
+template <typename CharType>
+void TextExtractor::AppendCollapsedText(const CharType *characters, unsigned length)
+{
+    const CharType *end = characters + length;
+    while (characters < end)
+    {
+        if (IsHTMLSpace<CharType>(*characters))
+        {
+            AddSeparator(Separator::kSpace);
+            ++characters;
+            continue;
+        }
+
+        const CharType *run = characters;
+        do {
+            ++characters;
+        } while (characters < end && !IsHTMLSpace<CharType>(*characters));
+
+        FlushSeparator();
+        m_text.Append(run, characters - run);
+    }
+}
+
+void TextExtractor::AppendText(const String &text)
+{
+    if (text.IsEmpty())
+        return;
+
+    if (m_preformattedDepth > 0)
+    {
+        FlushSeparator();
+        m_text.Append(text);
+    }
+    else if (text.Is8Bit())
+    {
+        AppendCollapsedText(text.Characters8(), text.length());
+    }
+    else
+    {
+        AppendCollapsedText(text.Characters16(), text.length());
+    }
+}
+
+void TextExtractor::FlushSeparator(void)
+{
+    // Separators are never leading, and trailing ones are dropped as they
+    // are never flushed.
+    if (!m_text.IsEmpty())
+    {
+        switch (m_separator)
+        {
+            case Separator::kSpace:
+                m_text.Append(' ');
+                break;
+            case Separator::kLineBreak:
+                m_text.Append('\n');
+                break;
+            default:
+                break;
+        }
+    }
+    m_separator = Separator::kNone;
+}
+
+void TextExtractor::ProcessElement(const Element &element)
+{
+    if (element.FastHasAttribute(html_names::kHiddenAttr))
+        return;
+
+    const ElementKind *kind = nullptr;
+    if (element.IsHTMLElement())
+    {
+        static const ElementKinds s_kinds;
+        kind = s_kinds.Find(element);
+    }
+
+    if (nullptr == kind)
+    {
+        TraverseChildren(element);
+        return;
+    }
+
+    switch (*kind)
+    {
+        case ElementKind::kSkipped:
+            break;
+        case ElementKind::kBlock:
+            AddBlockBoundary();
+            TraverseChildren(element);
+            AddBlockBoundary();
+            break;
+        case ElementKind::kLineBreak:
+            AddBlockBoundary();
+            break;
+        case ElementKind::kPreformatted:
+            AddBlockBoundary();
+            ++m_preformattedDepth;
+            TraverseChildren(element);
+            --m_preformattedDepth;
+            AddBlockBoundary();
+            break;
+        case ElementKind::kLink:
+            TraverseChildren(element);
+            if (m_options & kLinkAnnotations)
+                AppendLinkAnnotation(element);
+            break;
+    }
+}
+
+void TextExtractor::TraverseChildren(const ContainerNode &container)
+{
+    for (const Node *child = container.firstChild(); nullptr != child; child = child->nextSibling())
+    {
+        if (child->IsTextNode())
+            AppendText(ToText(child)->data());
+        else if (child->IsElementNode())
+            ProcessElement(ToElement(*child));
+    }
+}
+
+} // namespace blink
@@ -0,0 +1,65 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: text_extractor.h
+// Description: TextExtractor Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_TEXT_EXTRACTOR_H
+#define BLINKIT_BLINK_TEXT_EXTRACTOR_H
+
+#pragma once
+
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+class ContainerNode;
+class Element;
+
+// Extracts the visible text of a subtree in a single pass. Subtrees which are
+// never rendered (scripts, styles, templates, hidden elements and so on) are
+// skipped, and whitespace is collapsed as it goes, except in preformatted
+// elements.
+class TextExtractor final
+{
+    STACK_ALLOCATED();
+public:
+    enum Options {
+        kBlockBoundaries = 0x1, // Separates blocks with line breaks instead of spaces.
+        kLinkAnnotations = 0x2, // Appends " [URL]" to the text of each link.
+    };
+
+    explicit TextExtractor(unsigned options) : m_options(options) {}
+
+    String Extract(const ContainerNode &root);
+private:
+    enum class Separator { kNone, kSpace, kLineBreak };
+
+    void TraverseChildren(const ContainerNode &container);
+    void ProcessElement(const Element &element);
+    void AppendText(const String &text);
+    template <typename CharType>
+    void AppendCollapsedText(const CharType *characters, unsigned length);
+    void AppendLinkAnnotation(const Element &element);
+
+    void AddSeparator(Separator separator) { m_separator = std::max(m_separator, separator); }
+    void AddBlockBoundary(void)
+    {
+        AddSeparator((m_options & kBlockBoundaries) ? Separator::kLineBreak : Separator::kSpace);
+    }
+    void FlushSeparator(void);
+
+    const unsigned m_options;
+    StringBuilder m_text;
+    Separator m_separator = Separator::kNone;
+    unsigned m_preformattedDepth = 0;
+};
+
+} // namespace blink
+
+#endif // BLINKIT_BLINK_TEXT_EXTRACTOR_H
@@ -25,14 +25,18 @@ const AtomicString &kDOMNodeInsertedIntoDocument = reinterpret_cast<AtomicString
 const AtomicString &kDOMNodeRemoved = reinterpret_cast<AtomicString *>(&names_storage)[4];
 const AtomicString &kDOMNodeRemovedFromDocument = reinterpret_cast<AtomicString *>(&names_storage)[5];
 const AtomicString &kDOMSubtreeModified = reinterpret_cast<AtomicString *>(&names_storage)[6];
-const AtomicString &kBeforeunload = reinterpret_cast<AtomicString *>(&names_storage)[7];
-const AtomicString &kError = reinterpret_cast<AtomicString *>(&names_storage)[8];
-const AtomicString &kLoad = reinterpret_cast<AtomicString *>(&names_storage)[9];
-const AtomicString &kMousewheel = reinterpret_cast<AtomicString *>(&names_storage)[10];
-const AtomicString &kReadystatechange = reinterpret_cast<AtomicString *>(&names_storage)[11];
-const AtomicString &kScroll = reinterpret_cast<AtomicString *>(&names_storage)[12];
-const AtomicString &kUnload = reinterpret_cast<AtomicString *>(&names_storage)[13];
-const AtomicString &kWheel = reinterpret_cast<AtomicString *>(&names_storage)[14];
+const AtomicString &kAbort = reinterpret_cast<AtomicString *>(&names_storage)[7];
+const AtomicString &kBeforeunload = reinterpret_cast<AtomicString *>(&names_storage)[8];
+const AtomicString &kError = reinterpret_cast<AtomicString *>(&names_storage)[9];
+const AtomicString &kLoad = reinterpret_cast<AtomicString *>(&names_storage)[10];
+const AtomicString &kLoadend = reinterpret_cast<AtomicString *>(&names_storage)[11];
+const AtomicString &kLoadstart = reinterpret_cast<AtomicString *>(&names_storage)[12];
+const AtomicString &kMousewheel = reinterpret_cast<AtomicString *>(&names_storage)[13];
+const AtomicString &kReadystatechange = reinterpret_cast<AtomicString *>(&names_storage)[14];
+const AtomicString &kScroll = reinterpret_cast<AtomicString *>(&names_storage)[15];
+const AtomicString &kTimeout = reinterpret_cast<AtomicString *>(&names_storage)[16];
+const AtomicString &kUnload = reinterpret_cast<AtomicString *>(&names_storage)[17];
+const AtomicString &kWheel = reinterpret_cast<AtomicString *>(&names_storage)[18];
 
 void Init(void)
 {
@@ -55,12 +59,16 @@ void Init(void)
         { "DOMNodeRemoved", 15338285, 14 },
         { "DOMNodeRemovedFromDocument", 16284219, 26 },
         { "DOMSubtreeModified", 6084203, 18 },
+        { "abort", 15390287, 5 },
         { "beforeunload", 16009443, 12 },
         { "error", 6654137, 5 },
         { "load", 8207817, 4 },
+        { "loadend", 15911784, 7 },
+        { "loadstart", 5495169, 9 },
         { "mousewheel", 15891108, 10 },
         { "readystatechange", 11011948, 16 },
         { "scroll", 7626286, 6 },
+        { "timeout", 5983938, 7 },
         { "unload", 4411490, 6 },
         { "wheel", 5389519, 5 },
     };
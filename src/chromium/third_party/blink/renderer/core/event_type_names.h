@@ -26,16 +26,20 @@ extern const WTF::AtomicString &kDOMNodeInsertedIntoDocument;
 extern const WTF::AtomicString &kDOMNodeRemoved;
 extern const WTF::AtomicString &kDOMNodeRemovedFromDocument;
 extern const WTF::AtomicString &kDOMSubtreeModified;
+extern const WTF::AtomicString &kAbort;
 extern const WTF::AtomicString &kBeforeunload;
 extern const WTF::AtomicString &kError;
 extern const WTF::AtomicString &kLoad;
+extern const WTF::AtomicString &kLoadend;
+extern const WTF::AtomicString &kLoadstart;
 extern const WTF::AtomicString &kMousewheel;
 extern const WTF::AtomicString &kReadystatechange;
 extern const WTF::AtomicString &kScroll;
+extern const WTF::AtomicString &kTimeout;
 extern const WTF::AtomicString &kUnload;
 extern const WTF::AtomicString &kWheel;
 
-constexpr unsigned kNamesCount = 15;
+constexpr unsigned kNamesCount = 19;
 
 void Init(void);
 
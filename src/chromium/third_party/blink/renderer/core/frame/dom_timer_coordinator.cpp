@@ -0,0 +1,203 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: dom_timer_coordinator.cpp
+// Description: DOMTimerCoordinator Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "dom_timer_coordinator.h"
+
+#include "base/location.h"
+#include "base/logging.h"
+#include "base/single_thread_task_runner.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/frame/local_dom_window.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
+
+namespace blink {
+
+// Same as the HTML standard.
+static const int kMaxTimerNestingLevel = 5;
+static const TimeDelta kMinimumInterval = TimeDelta::FromMilliseconds(4);
+
+// How often virtual time checks whether the blocking loads are done.
+static const TimeDelta kLoadingPollInterval = TimeDelta::FromMilliseconds(10);
+
+DOMTimerCoordinator::DOMTimerCoordinator(
+    LocalDOMWindow &window,
+    const std::shared_ptr<base::SingleThreadTaskRunner> &taskRunner,
+    TimeDelta virtualTimeBudget)
+    : m_window(window)
+    , m_taskRunner(taskRunner)
+    , m_isAlive(std::make_shared<bool>(true))
+    , m_origin(TimeTicks::Now())
+    , m_virtualTimeBudget(virtualTimeBudget)
+{
+}
+
+DOMTimerCoordinator::~DOMTimerCoordinator(void)
+{
+    *m_isAlive = false;
+}
+
+void DOMTimerCoordinator::AdvanceVirtualTime(void)
+{
+    m_advanceScheduled = false;
+
+    while (!m_pendingFires.empty() && 0 == m_timers.count(m_pendingFires.top().timeoutID))
+        m_pendingFires.pop(); // Removed.
+    if (m_pendingFires.empty())
+        return;
+
+    // Responses arrive in real time, and pages usually expect them before
+    // their timers, so the clock stands still until they are done.
+    if (ResourceFetcher *fetcher = m_window.document()->Fetcher())
+    {
+        if (fetcher->BlockingRequestCount() > 0)
+        {
+            ScheduleVirtualTimeAdvance(kLoadingPollInterval);
+            return;
+        }
+    }
+
+    const PendingFire next = m_pendingFires.top();
+    if (next.fireTime > m_virtualTimeBudget)
+    {
+        BKLOG("Virtual time budget (%lld ms) exhausted, %zu timer(s) dropped.",
+            static_cast<long long>(m_virtualTimeBudget.InMilliseconds()), m_timers.size());
+        m_timers.clear();
+        m_pendingFires = std::priority_queue<PendingFire>();
+        return;
+    }
+
+    m_pendingFires.pop();
+    if (m_virtualNow < next.fireTime)
+        m_virtualNow = next.fireTime;
+    Run(next.timeoutID);
+
+    if (!m_pendingFires.empty())
+        ScheduleVirtualTimeAdvance(TimeDelta());
+}
+
+bool DOMTimerCoordinator::HasTimeoutDueWithin(TimeDelta horizon) const
+{
+    const TimeDelta deadline = Now() + horizon;
+    for (const auto &it : m_timers)
+    {
+        const Timer &timer = it.second;
+        if (Type::kTimeout != timer.type)
+            continue;
+        if (UsesVirtualTime() || timer.dueTime <= deadline)
+            return true;
+    }
+    return false;
+}
+
+int DOMTimerCoordinator::InstallNewTimeout(const Action &action, TimeDelta timeout, Type type)
+{
+    if (timeout < TimeDelta())
+        timeout = TimeDelta();
+
+    Timer timer;
+    timer.action = action;
+    timer.type = type;
+    timer.nestingLevel = m_nestingLevel + 1;
+    if (timer.nestingLevel > kMaxTimerNestingLevel && timeout < kMinimumInterval)
+        timeout = kMinimumInterval;
+    if (Type::kInterval == type)
+    {
+        // Repeating timers would reach the nesting limit after a few rounds
+        // anyway, so they are clamped at once.
+        timer.interval = timeout < kMinimumInterval ? kMinimumInterval : timeout;
+    }
+
+    int timeoutID;
+    do {
+        timeoutID = ++m_lastTimeoutID;
+        if (timeoutID <= 0)
+            timeoutID = m_lastTimeoutID = 1;
+    } while (0 != m_timers.count(timeoutID));
+
+    m_timers.emplace(timeoutID, std::move(timer));
+    Schedule(timeoutID, timeout);
+    return timeoutID;
+}
+
+TimeDelta DOMTimerCoordinator::Now(void) const
+{
+    if (UsesVirtualTime())
+        return m_virtualNow;
+    return TimeTicks::Now() - m_origin;
+}
+
+double DOMTimerCoordinator::NowInMilliseconds(void) const
+{
+    return Now().InMillisecondsF();
+}
+
+void DOMTimerCoordinator::RemoveTimeoutByID(int timeoutID)
+{
+    // Pending tasks and virtual fires of the timer are skipped when they come.
+    m_timers.erase(timeoutID);
+}
+
+void DOMTimerCoordinator::Run(int timeoutID)
+{
+    auto it = m_timers.find(timeoutID);
+    if (std::end(m_timers) == it)
+        return;
+
+    // The action may remove its own timer, or even destroy the window.
+    const Action action = it->second.action;
+    const int nestingLevel = m_nestingLevel;
+    m_nestingLevel = it->second.nestingLevel;
+    if (it->second.interval.is_zero())
+        m_timers.erase(it);
+    else
+        Schedule(timeoutID, it->second.interval);
+
+    std::shared_ptr<bool> isAlive(m_isAlive);
+    action(timeoutID);
+    if (*isAlive)
+        m_nestingLevel = nestingLevel;
+}
+
+void DOMTimerCoordinator::Schedule(int timeoutID, TimeDelta delay)
+{
+    m_timers[timeoutID].dueTime = Now() + delay;
+    if (UsesVirtualTime())
+    {
+        m_pendingFires.push({ m_virtualNow + delay, ++m_sequence, timeoutID });
+        ScheduleVirtualTimeAdvance(TimeDelta());
+        return;
+    }
+
+    std::shared_ptr<bool> isAlive(m_isAlive);
+    const auto callback = [this, isAlive, timeoutID]
+    {
+        if (*isAlive)
+            Run(timeoutID);
+    };
+    m_taskRunner->PostDelayedTask(FROM_HERE, callback, delay);
+}
+
+void DOMTimerCoordinator::ScheduleVirtualTimeAdvance(TimeDelta delay)
+{
+    if (m_advanceScheduled)
+        return;
+
+    std::shared_ptr<bool> isAlive(m_isAlive);
+    const auto callback = [this, isAlive]
+    {
+        if (*isAlive)
+            AdvanceVirtualTime();
+    };
+    m_advanceScheduled = true;
+    m_taskRunner->PostDelayedTask(FROM_HERE, callback, delay);
+}
+
+} // namespace blink
@@ -0,0 +1,107 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: dom_timer_coordinator.h
+// Description: DOMTimerCoordinator Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_DOM_TIMER_COORDINATOR_H
+#define BLINKIT_BLINK_DOM_TIMER_COORDINATOR_H
+
+#pragma once
+
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include "third_party/blink/renderer/platform/wtf/noncopyable.h"
+#include "third_party/blink/renderer/platform/wtf/time.h"
+
+namespace base {
+class SingleThreadTaskRunner;
+}
+
+namespace blink {
+
+class LocalDOMWindow;
+
+// The timers of a window, for setTimeout, setInterval and
+// requestAnimationFrame. In virtual time, timers never wait: the earliest one
+// fires as soon as the task queue comes to it, and the clock jumps to its fire
+// time. Virtual time is paused while subresources are loading, and timers past
+// the budget are dropped.
+class DOMTimerCoordinator final
+{
+    WTF_MAKE_NONCOPYABLE(DOMTimerCoordinator);
+public:
+    using Action = std::function<void(int timeoutID)>;
+    enum class Type { kTimeout, kInterval, kAnimationFrame };
+
+    // Real time is used if |virtualTimeBudget| is zero.
+    DOMTimerCoordinator(LocalDOMWindow &window, const std::shared_ptr<base::SingleThreadTaskRunner> &taskRunner,
+        TimeDelta virtualTimeBudget);
+    ~DOMTimerCoordinator(void);
+
+    int InstallNewTimeout(const Action &action, TimeDelta timeout, Type type);
+    void RemoveTimeoutByID(int timeoutID);
+
+    // Whether a timeout is due within |horizon|. Intervals and animation
+    // frames are not counted, since pages may keep them forever. In virtual
+    // time, every timeout is due at once.
+    bool HasTimeoutDueWithin(TimeDelta horizon) const;
+
+    // Milliseconds since the coordinator was created, in virtual time if it is
+    // used.
+    double NowInMilliseconds(void) const;
+private:
+    bool UsesVirtualTime(void) const { return !m_virtualTimeBudget.is_zero(); }
+    TimeDelta Now(void) const;
+
+    void Schedule(int timeoutID, TimeDelta delay);
+    void Run(int timeoutID);
+    void ScheduleVirtualTimeAdvance(TimeDelta delay);
+    void AdvanceVirtualTime(void);
+
+    struct Timer {
+        Action action;
+        Type type;
+        TimeDelta interval; // Zero for single shot timers.
+        TimeDelta dueTime;
+        int nestingLevel;
+    };
+
+    struct PendingFire {
+        TimeDelta fireTime;
+        uint64_t sequence;
+        int timeoutID;
+
+        // Earliest first, then first in, first out.
+        bool operator<(const PendingFire &o) const
+        {
+            if (fireTime != o.fireTime)
+                return o.fireTime < fireTime;
+            return sequence > o.sequence;
+        }
+    };
+
+    LocalDOMWindow &m_window;
+    std::shared_ptr<base::SingleThreadTaskRunner> m_taskRunner;
+    std::shared_ptr<bool> m_isAlive;
+    std::unordered_map<int, Timer> m_timers;
+    int m_lastTimeoutID = 0;
+    int m_nestingLevel = 0; // Of the timer being fired.
+    const TimeTicks m_origin;
+
+    const TimeDelta m_virtualTimeBudget;
+    TimeDelta m_virtualNow;
+    std::priority_queue<PendingFire> m_pendingFires;
+    uint64_t m_sequence = 0;
+    bool m_advanceScheduled = false;
+};
+
+} // namespace blink
+
+#endif // BLINKIT_BLINK_DOM_TIMER_COORDINATOR_H
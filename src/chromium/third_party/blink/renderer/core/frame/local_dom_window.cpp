@@ -38,12 +38,14 @@
 #include "local_dom_window.h"
 
 #include "blinkit/crawler/crawler_document.h"
+#include "blinkit/crawler/crawler_impl.h"
 #include "third_party/blink/renderer/bindings/core/duk/script_controller.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/document_init.h"
 #include "third_party/blink/renderer/core/dom/events/event.h"
 #include "third_party/blink/renderer/core/dom/events/event_dispatch_forbidden_scope.h"
 #include "third_party/blink/renderer/core/event_type_names.h"
+#include "third_party/blink/renderer/core/frame/dom_timer_coordinator.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/core/frame/local_frame_client.h"
 #include "third_party/blink/renderer/core/frame/navigator.h"
@@ -140,6 +142,7 @@ void LocalDOMWindow::FinishedLoading(void)
 void LocalDOMWindow::FrameDestroyed(void)
 {
     RemoveAllEventListeners();
+    m_timers.reset();
     DisconnectFromFrame();
 }
 
@@ -159,6 +162,8 @@ Document* LocalDOMWindow::InstallNewDocument(const DocumentInit &init)
     ASSERT(init.GetFrame() == frame);
 
     ClearDocument();
+    // Timers belong to the document.
+    m_timers.reset();
 
 #ifdef BLINKIT_CRAWLER_ONLY
     ASSERT(init.GetFrame()->Client()->IsCrawler());
@@ -207,7 +212,24 @@ void LocalDOMWindow::RemoveAllEventListeners(void)
 
 void LocalDOMWindow::Reset(void)
 {
-    ASSERT(false); // BKTODO:
+    FrameDestroyed();
+    m_navigator.reset();
+}
+
+DOMTimerCoordinator& LocalDOMWindow::Timers(void)
+{
+    if (!m_timers)
+    {
+        LocalFrame *frame = GetFrame();
+        ASSERT(nullptr != frame);
+
+        TimeDelta virtualTimeBudget;
+        if (CrawlerImpl *crawler = ToCrawlerImpl(frame->Client()))
+            virtualTimeBudget = crawler->VirtualTimeBudget();
+        m_timers = std::make_unique<DOMTimerCoordinator>(*this, frame->GetTaskRunner(TaskType::kJavascriptTimer),
+            virtualTimeBudget);
+    }
+    return *m_timers;
 }
 
 }  // namespace blink
@@ -48,6 +48,7 @@ namespace blink {
 
 class Document;
 class DocumentInit;
+class DOMTimerCoordinator;
 class LocalFrame;
 class Navigator;
 
@@ -65,6 +66,7 @@ public:
 
     LocalFrame* GetFrame(void) const;
     Document* document(void) const { return m_document.get(); }
+    DOMTimerCoordinator& Timers(void);
 
     void Reset(void);
 
@@ -100,6 +102,7 @@ private:
     std::unique_ptr<Document> m_document;
 
     mutable std::unique_ptr<Navigator> m_navigator;
+    std::unique_ptr<DOMTimerCoordinator> m_timers;
     
     std::unordered_set<EventListenerObserver *> m_eventListenerObservers;
 };
@@ -41,6 +41,8 @@
 
 #include "base/auto_reset.h"
 #include "base/numerics/safe_conversions.h"
+#include "blinkit/crawler/crawler_metrics.h"
+#include "blinkit/crawler/memory_budget.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/public/platform/task_type.h"
 #include "third_party/blink/renderer/core/dom/document_fragment.h"
@@ -56,7 +58,7 @@
 #include "third_party/blink/renderer/core/script/html_parser_script_runner.h"
 // BKTODO: #include "third_party/blink/renderer/platform/cross_thread_functional.h"
 // BKTODO: #include "third_party/blink/renderer/platform/heap/handle.h"
-// BKTODO: #include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
 // BKTODO: #include "third_party/blink/renderer/platform/scheduler/public/thread.h"
 // BKTODO: #include "third_party/blink/renderer/platform/scheduler/public/thread_scheduler.h"
@@ -222,6 +224,8 @@ void HTMLDocumentParser::PumpTokenizerIfPossible() {
 void HTMLDocumentParser::RunScriptsForPausedTreeBuilder() {
   DCHECK(ScriptingContentIsAllowed(GetParserContentPolicy()));
 
+  base::TimeTicks start = base::TimeTicks::Now();
+
   TextPosition script_start_position = TextPosition::BelowRangePosition();
   Element* script_element =
       tree_builder_->TakeScriptToProcess(script_start_position);
@@ -229,6 +233,9 @@ void HTMLDocumentParser::RunScriptsForPausedTreeBuilder() {
   if (script_runner_)
     script_runner_->ProcessScriptElement(script_element, script_start_position);
   CheckIfBodyStylesheetAdded();
+
+  blocking_script_time_ =
+      blocking_script_time_ + (base::TimeTicks::Now() - start);
 }
 
 bool HTMLDocumentParser::CanTakeNextToken() {
@@ -333,12 +340,44 @@ void HTMLDocumentParser::PumpTokenizer() {
 
   PumpSession session(pump_session_nesting_level_);
 
+  // Tokenizing and tree building interleave per token, so they are summed up
+  // into the arguments of the span rather than traced one by one.
+  TRACE_EVENT_NAMED0(tracer, "parser", "HTMLDocumentParser::PumpTokenizer");
+  uint64_t tokenize_us = 0, tree_build_us = 0;
+
+  base::TimeTicks pump_start = base::TimeTicks::Now();
+  base::TimeDelta script_time_at_start = blocking_script_time_;
+
   while (CanTakeNextToken()) {
+    uint64_t start = tracer.IsActive() ? base::trace_event::TraceLog::Now() : 0;
     if (!tokenizer_->NextToken(input_.Current(), Token()))
       break;
 
+    uint64_t tokenized = tracer.IsActive() ? base::trace_event::TraceLog::Now() : 0;
     ConstructTreeFromHTMLToken();
     DCHECK(IsStopped() || Token().IsUninitialized());
+
+    if (tracer.IsActive()) {
+      tokenize_us += tokenized - start;
+      tree_build_us += base::trace_event::TraceLog::Now() - tokenized;
+    }
+  }
+
+  if (tracer.IsActive()) {
+    tracer.SetArg(0, "tokenize_us", tokenize_us);
+    tracer.SetArg(1, "tree_build_us", tree_build_us);
+  }
+
+  if (GetDocument()) {
+    if (BlinKit::CrawlerMetrics* metrics =
+            BlinKit::CrawlerMetrics::From(*GetDocument())) {
+      base::TimeDelta script_time =
+          blocking_script_time_ - script_time_at_start;
+      metrics->AddParseTime(base::TimeTicks::Now() - pump_start - script_time);
+    }
+    if (BlinKit::MemoryBudget* budget =
+            BlinKit::MemoryBudget::From(*GetDocument()))
+      budget->Checkpoint();
   }
 
   if (IsStopped())
@@ -448,24 +487,6 @@ void HTMLDocumentParser::Append(const String& input_source) {
 
   const SegmentedString source(input_source);
 
-#if 0 // BKTODO: Check if necessary
-  if (GetDocument()->IsPrefetchOnly()) {
-    // Do not prefetch if there is an appcache.
-    if (GetDocument()->Loader()->GetResponse().AppCacheID() != 0)
-      return;
-
-    if (!preload_scanner_) {
-      preload_scanner_ =
-          CreatePreloadScanner(TokenPreloadScanner::ScannerType::kMainDocument);
-    }
-
-    preload_scanner_->AppendToEnd(source);
-    ScanAndPreload(preload_scanner_.get());
-
-    // Return after the preload scanner, do not actually parse the document.
-    return;
-  }
-
   if (preload_scanner_) {
     if (input_.Current().IsEmpty() && !IsPaused()) {
       // We have parsed until the end of the current input and so are now moving
@@ -478,7 +499,6 @@ void HTMLDocumentParser::Append(const String& input_source) {
         ScanAndPreload(preload_scanner_.get());
     }
   }
-#endif
 
   input_.AppendToEnd(source);
 
@@ -755,6 +775,7 @@ std::unique_ptr<HTMLPreloadScanner> HTMLDocumentParser::CreatePreloadScanner(
 }
 
 void HTMLDocumentParser::ScanAndPreload(HTMLPreloadScanner* scanner) {
+  TRACE_EVENT0("parser", "HTMLDocumentParser::ScanAndPreload");
   PreloadRequestStream requests =
       scanner->Scan(GetDocument()->ValidBaseElementURL(), nullptr);
   preloader_->TakeAndPreload(requests);
@@ -38,6 +38,7 @@
 #define THIRD_PARTY_BLINK_RENDERER_CORE_HTML_PARSER_HTML_DOCUMENT_PARSER_H_
 
 #include <memory>
+#include "base/time/time.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/dom/parser_content_policy.h"
 #include "third_party/blink/renderer/core/dom/scriptable_document_parser.h"
@@ -250,6 +251,10 @@ class CORE_EXPORT HTMLDocumentParser : public ScriptableDocumentParser
 
   TaskHandle resume_parsing_task_handle_;
 
+  // Time spent in the scripts run from the tokenizer pump, which is taken off
+  // the parse time of the crawler metrics.
+  base::TimeDelta blocking_script_time_;
+
   bool end_was_delayed_;
   bool tasks_were_paused_;
   unsigned pump_session_nesting_level_;
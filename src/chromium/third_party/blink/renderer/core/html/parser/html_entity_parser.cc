@@ -96,11 +96,46 @@ static void UnconsumeCharacters(SegmentedString& source,
                    SegmentedString::PrependType::kUnconsume);
 }
 
+template <typename CharType>
+static const HTMLEntityTableEntry* FindCommonEntity(const CharType* characters,
+                                                    unsigned length) {
+  // There must be a character after ';', or a longer entity could not be
+  // ruled out by the regular path either.
+  length = std::min(length - 1, HTMLEntityTrie::kMaxCommonEntityLength);
+  LChar name[HTMLEntityTrie::kMaxCommonEntityLength];
+  for (unsigned i = 0; i < length; ++i) {
+    if (characters[i] > 0x7F)
+      return nullptr;
+    name[i] = static_cast<LChar>(characters[i]);
+    if (name[i] == ';')
+      return HTMLEntityTrie::FindCommonEntity(name, i + 1);
+  }
+  return nullptr;
+}
+
 static bool ConsumeNamedEntity(SegmentedString& source,
                                DecodedHTMLEntity& decoded_entity,
                                bool& not_enough_characters,
                                UChar additional_allowed_character,
                                UChar& cc) {
+  if (source.CurrentSubstringLength() > 1) {
+    const unsigned available = source.CurrentSubstringLength();
+    const HTMLEntityTableEntry* common =
+        source.CurrentSubstringIs8Bit()
+            ? FindCommonEntity(source.CurrentSubstringCharacters8(), available)
+            : FindCommonEntity(source.CurrentSubstringCharacters16(),
+                               available);
+    if (common) {
+      // Names ending with ';' are always the longest match.
+      source.AdvanceWithinSubstringAndUpdateLineNumbers(common->length);
+      cc = source.CurrentChar();
+      decoded_entity.Append(common->first_value);
+      if (UChar32 second = common->second_value)
+        decoded_entity.Append(second);
+      return true;
+    }
+  }
+
   ConsumedCharacterBuffer consumed_characters;
   HTMLEntitySearch entity_search;
   while (!source.IsEmpty()) {
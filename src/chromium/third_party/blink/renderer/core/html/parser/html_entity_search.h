@@ -26,13 +26,12 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_HTML_PARSER_HTML_ENTITY_SEARCH_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_HTML_PARSER_HTML_ENTITY_SEARCH_H_
 
+#include "third_party/blink/renderer/core/html_entity_trie.h"
 #include "third_party/blink/renderer/platform/wtf/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace blink {
 
-struct HTMLEntityTableEntry;
-
 class HTMLEntitySearch {
   STACK_ALLOCATED();
 
@@ -41,7 +40,7 @@ class HTMLEntitySearch {
 
   void Advance(UChar);
 
-  bool IsEntityPrefix() const { return !!first_; }
+  bool IsEntityPrefix() const { return !!node_; }
   int CurrentLength() const { return current_length_; }
 
   const HTMLEntityTableEntry* MostRecentMatch() const {
@@ -49,26 +48,11 @@ class HTMLEntitySearch {
   }
 
  private:
-  enum CompareResult {
-    kBefore,
-    kPrefix,
-    kAfter,
-  };
-
-  CompareResult Compare(const HTMLEntityTableEntry*, UChar) const;
-  const HTMLEntityTableEntry* FindFirst(UChar) const;
-  const HTMLEntityTableEntry* FindLast(UChar) const;
-
-  void Fail() {
-    first_ = nullptr;
-    last_ = nullptr;
-  }
-
   int current_length_;
 
   const HTMLEntityTableEntry* most_recent_match_;
-  const HTMLEntityTableEntry* first_;
-  const HTMLEntityTableEntry* last_;
+  // The node of HTMLEntityTrie for the characters consumed so far.
+  const HTMLEntityTrie::Node* node_;
 };
 
 }  // namespace blink
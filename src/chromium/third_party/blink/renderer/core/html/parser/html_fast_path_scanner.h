@@ -0,0 +1,127 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: html_fast_path_scanner.h
+// Description: Run Scanner for HTMLTokenizer
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_HTML_FAST_PATH_SCANNER_H
+#define BLINKIT_BLINK_HTML_FAST_PATH_SCANNER_H
+
+#pragma once
+
+#include "build/build_config.h"
+#include "third_party/blink/renderer/platform/wtf/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/text/unicode.h"
+
+#if defined(ARCH_CPU_X86_FAMILY)
+#include <emmintrin.h>
+#if defined(COMPILER_MSVC)
+#include <intrin.h>
+#endif
+#elif defined(ARCH_CPU_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace blink {
+
+// Returns the number of leading characters in |characters| which are none of
+// the stop characters. The tokenizer appends such a run to the current token
+// in one step, instead of going through its state machine per character.
+// Stop characters must be ASCII.
+template <LChar c0, LChar c1, LChar c2, LChar c3>
+class HTMLFastPathScanner {
+  STATIC_ONLY(HTMLFastPathScanner);
+
+ public:
+  static unsigned Scan(const LChar* characters, unsigned length) {
+    unsigned i = 0;
+#if defined(ARCH_CPU_X86_FAMILY)
+    const __m128i s0 = _mm_set1_epi8(c0), s1 = _mm_set1_epi8(c1),
+                  s2 = _mm_set1_epi8(c2), s3 = _mm_set1_epi8(c3);
+    for (; i + 16 <= length; i += 16) {
+      __m128i v = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(characters + i));
+      __m128i m = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(v, s0), _mm_cmpeq_epi8(v, s1)),
+          _mm_or_si128(_mm_cmpeq_epi8(v, s2), _mm_cmpeq_epi8(v, s3)));
+      if (int mask = _mm_movemask_epi8(m))
+        return i + FirstSetBit(mask);
+    }
+#elif defined(ARCH_CPU_ARM64)
+    const uint8x16_t s0 = vdupq_n_u8(c0), s1 = vdupq_n_u8(c1),
+                     s2 = vdupq_n_u8(c2), s3 = vdupq_n_u8(c3);
+    for (; i + 16 <= length; i += 16) {
+      uint8x16_t v = vld1q_u8(characters + i);
+      uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, s0), vceqq_u8(v, s1)),
+                              vorrq_u8(vceqq_u8(v, s2), vceqq_u8(v, s3)));
+      if (vmaxvq_u8(m))
+        break;  // Locate the stop character below.
+    }
+#endif
+    for (; i < length; ++i) {
+      if (IsStop(characters[i]))
+        break;
+    }
+    return i;
+  }
+
+  static unsigned Scan(const UChar* characters, unsigned length) {
+    unsigned i = 0;
+#if defined(ARCH_CPU_X86_FAMILY)
+    const __m128i s0 = _mm_set1_epi16(c0), s1 = _mm_set1_epi16(c1),
+                  s2 = _mm_set1_epi16(c2), s3 = _mm_set1_epi16(c3);
+    for (; i + 8 <= length; i += 8) {
+      __m128i v = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(characters + i));
+      __m128i m = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(v, s0), _mm_cmpeq_epi16(v, s1)),
+          _mm_or_si128(_mm_cmpeq_epi16(v, s2), _mm_cmpeq_epi16(v, s3)));
+      // Each matched UChar sets two bits of the mask.
+      if (int mask = _mm_movemask_epi8(m))
+        return i + FirstSetBit(mask) / 2;
+    }
+#elif defined(ARCH_CPU_ARM64)
+    const uint16x8_t s0 = vdupq_n_u16(c0), s1 = vdupq_n_u16(c1),
+                     s2 = vdupq_n_u16(c2), s3 = vdupq_n_u16(c3);
+    for (; i + 8 <= length; i += 8) {
+      uint16x8_t v =
+          vld1q_u16(reinterpret_cast<const uint16_t*>(characters + i));
+      uint16x8_t m = vorrq_u16(vorrq_u16(vceqq_u16(v, s0), vceqq_u16(v, s1)),
+                               vorrq_u16(vceqq_u16(v, s2), vceqq_u16(v, s3)));
+      if (vmaxvq_u16(m))
+        break;  // Locate the stop character below.
+    }
+#endif
+    for (; i < length; ++i) {
+      if (IsStop(characters[i]))
+        break;
+    }
+    return i;
+  }
+
+ private:
+  static ALWAYS_INLINE bool IsStop(UChar cc) {
+    return cc == c0 || cc == c1 || cc == c2 || cc == c3;
+  }
+
+#if defined(ARCH_CPU_X86_FAMILY)
+  static ALWAYS_INLINE unsigned FirstSetBit(int mask) {
+#if defined(COMPILER_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, static_cast<unsigned long>(mask));
+    return index;
+#else
+    return __builtin_ctz(static_cast<unsigned>(mask));
+#endif
+  }
+#endif
+};
+
+}  // namespace blink
+
+#endif  // BLINKIT_BLINK_HTML_FAST_PATH_SCANNER_H
@@ -161,6 +161,7 @@ class TokenPreloadScanner::StartTagScanner {
 #endif
         referrer_policy_set_(false),
         referrer_policy_(kReferrerPolicyDefault),
+        defer_(FetchParameters::kNoDefer),
 #ifndef BLINKIT_CRAWLER_ONLY
         lazyload_attr_set_to_off_(false),
         width_attr_small_absolute_(false),
@@ -243,7 +244,8 @@ class TokenPreloadScanner::StartTagScanner {
         PreloadRequest::kRequestTypePreload;
     std::optional<ResourceType> type;
 #ifdef BLINKIT_CRAWLER_ONLY
-    ASSERT(false); // BKTODO:
+    if (!ShouldPreload(type))
+      return nullptr;
 #else
     if (ShouldPreconnect()) {
       request_type = PreloadRequest::kRequestTypePreconnect;
@@ -263,69 +265,28 @@ class TokenPreloadScanner::StartTagScanner {
     }
 #endif
 
-    ASSERT(false); // BKTODO:
-    return nullptr;
-#if 0
     TextPosition position =
         TextPosition(source.CurrentLine(), source.CurrentColumn());
-    FetchParameters::ResourceWidth resource_width;
-    float source_size = source_size_;
-    bool source_size_set = source_size_set_;
-    if (picture_data.picked) {
-      source_size_set = picture_data.source_size_set;
-      source_size = picture_data.source_size;
-    }
-    ResourceFetcher::IsImageSet is_image_set =
-        (picture_data.picked || !srcset_image_candidate_.IsEmpty())
-            ? ResourceFetcher::kImageIsImageSet
-            : ResourceFetcher::kImageNotImageSet;
-
-    if (source_size_set) {
-      resource_width.width = source_size;
-      resource_width.is_set = true;
-    }
 
-    if (type == base::nullopt)
+    if (!type)
       type = GetResourceType();
 
-    // The element's 'referrerpolicy' attribute (if present) takes precedence
-    // over the document's referrer policy.
-    ReferrerPolicy referrer_policy =
-        (referrer_policy_ != kReferrerPolicyDefault) ? referrer_policy_
-                                                     : document_referrer_policy;
     auto request = PreloadRequest::CreateIfNeeded(
         InitiatorFor(tag_impl_), position, url_to_load_, predicted_base_url,
-        type.value(), referrer_policy, PreloadRequest::kDocumentIsReferrer,
-        is_image_set, resource_width, client_hints_preferences, request_type);
+        type.value(), request_type);
     if (!request)
       return nullptr;
 
-    if ((Match(tag_impl_, scriptTag) && type_attribute_value_ == "module") ||
-        IsLinkRelModulePreload()) {
-      request->SetScriptType(ScriptType::kModule);
-    }
-
-    request->SetCrossOrigin(cross_origin_);
-    request->SetImportance(importance_);
-    request->SetNonce(nonce_);
-    request->SetCharset(Charset());
+#ifndef BLINKIT_CRAWLER_ONLY
+    ASSERT(false); // BKTODO: Image sets, referrer policy, module scripts,
+                   // cross origin, integrity and lazyload images.
+#endif
     request->SetDefer(defer_);
 
-    if (lazyload_attr_set_to_off_ ||
-        (width_attr_small_absolute_ && height_attr_small_absolute_)) {
-      request->SetIsLazyloadImageDisabled(true);
-    }
-
-    // The only link tags that should keep the integrity metadata are
-    // stylesheets until crbug.com/677022 is resolved.
-    if (link_is_style_sheet_ || !Match(tag_impl_, linkTag))
-      request->SetIntegrityMetadata(integrity_metadata_);
-
     if (scanner_type_ == ScannerType::kInsertion)
       request->SetFromInsertionScanner(true);
 
     return request;
-#endif
   }
 
  private:
@@ -341,6 +302,9 @@ class TokenPreloadScanner::StartTagScanner {
       language_attribute_value_ = attribute_value;
     } else if (Match(attribute_name, kNomoduleAttr)) {
       nomodule_attribute_value_ = true;
+    } else if (Match(attribute_name, kAsyncAttr) ||
+               Match(attribute_name, kDeferAttr)) {
+      defer_ = FetchParameters::kLazyLoad;
     } else if (!referrer_policy_set_ &&
                Match(attribute_name, kReferrerpolicyAttr) &&
                !attribute_value.IsNull()) {
@@ -663,6 +627,7 @@ class TokenPreloadScanner::StartTagScanner {
 #endif
   bool referrer_policy_set_;
   ReferrerPolicy referrer_policy_;
+  FetchParameters::DeferOption defer_;
 #ifndef BLINKIT_CRAWLER_ONLY
   bool width_attr_small_absolute_;
   bool height_attr_small_absolute_;
@@ -951,13 +916,11 @@ void TokenPreloadScanner::UpdatePredictedBaseURL(const Token& token) {
   DCHECK(predicted_base_element_url_.IsEmpty());
   if (const typename Token::Attribute* href_attribute =
           token.GetAttributeItem(kHrefAttr)) {
-    ASSERT(false); // BKTODO:
-#if 0
-    BkURL url(document_url_, StripLeadingAndTrailingHTMLSpaces(
-                                href_attribute->Value8BitIfNecessary()));
+    String href =
+        StripLeadingAndTrailingHTMLSpaces(href_attribute->Value8BitIfNecessary());
+    BkURL url = document_url_.Resolve(href.StdUtf8());
     predicted_base_element_url_ =
-        url.IsValid() && !url.ProtocolIsData() ? url.Copy() : BkURL();
-#endif
+        url.IsValid() && !url.SchemeIsData() ? url : BkURL();
   }
 }
 
@@ -1015,7 +978,7 @@ PreloadRequestStream HTMLPreloadScanner::Scan(
 CachedDocumentParameters::CachedDocumentParameters(Document* document) {
   DCHECK(IsMainThread());
   DCHECK(document);
-  do_html_preload_scanning = false;
+  do_html_preload_scanning = true;
 #ifndef BLINKIT_CRAWLER_ONLY
   ASSERT(false); // BKTODO:
   do_html_preload_scanning =
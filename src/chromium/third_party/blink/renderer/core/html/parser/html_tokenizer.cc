@@ -39,6 +39,7 @@
 #include "third_party/blink/renderer/core/html/parser/html_tokenizer.h"
 
 #include "third_party/blink/renderer/core/html/parser/html_entity_parser.h"
+#include "third_party/blink/renderer/core/html/parser/html_fast_path_scanner.h"
 #include "third_party/blink/renderer/core/html/parser/html_parser_idioms.h"
 #include "third_party/blink/renderer/core/html/parser/html_tree_builder.h"
 #include "third_party/blink/renderer/core/html/parser/markup_tokenizer_inlines.h"
@@ -109,6 +110,41 @@ inline bool HTMLTokenizer::ProcessEntity(SegmentedString& source) {
   return true;
 }
 
+// Stop characters of the fast paths. '\r' and '\0' need the input stream
+// preprocessor, and kEndOfFileMarker is '\0' as well.
+using DataScanner = HTMLFastPathScanner<'<', '&', '\r', '\0'>;
+using DoubleQuotedValueScanner = HTMLFastPathScanner<'"', '&', '\r', '\0'>;
+using SingleQuotedValueScanner = HTMLFastPathScanner<'\'', '&', '\r', '\0'>;
+using CommentScanner = HTMLFastPathScanner<'-', '\r', '\0', '\0'>;
+
+template <typename Scanner, typename Append>
+inline void HTMLTokenizer::ConsumeCharacterRun(SegmentedString& source,
+                                               const Append& append) {
+  // A pending '\n' after '\r' has to be dropped by the preprocessor.
+  if (input_stream_preprocessor_.SkipNextNewLine())
+    return;
+
+  unsigned available = source.CurrentSubstringLength();
+  if (available < 2)
+    return;
+
+  unsigned run;
+  if (source.CurrentSubstringIs8Bit()) {
+    const LChar* characters = source.CurrentSubstringCharacters8() + 1;
+    run = Scanner::Scan(characters, available - 1);
+    if (!run)
+      return;
+    append(characters, run);
+  } else {
+    const UChar* characters = source.CurrentSubstringCharacters16() + 1;
+    run = Scanner::Scan(characters, available - 1);
+    if (!run)
+      return;
+    append(characters, run);
+  }
+  source.AdvanceWithinSubstringAndUpdateLineNumbers(run);
+}
+
 bool HTMLTokenizer::FlushBufferedEndTag(SegmentedString& source) {
   DCHECK(token_->GetType() == HTMLToken::kCharacter ||
          token_->GetType() == HTMLToken::kUninitialized);
@@ -180,6 +216,10 @@ bool HTMLTokenizer::NextToken(SegmentedString& source, HTMLToken& token) {
         return EmitEndOfFile(source);
       else {
         BufferCharacter(cc);
+        ConsumeCharacterRun<DataScanner>(
+            source, [this](const auto* characters, unsigned length) {
+              token_->AppendToCharacter(characters, length);
+            });
         HTML_CONSUME(kDataState);
       }
     }
@@ -818,6 +858,10 @@ bool HTMLTokenizer::NextToken(SegmentedString& source, HTMLToken& token) {
         HTML_RECONSUME_IN(kDataState);
       } else {
         token_->AppendToAttributeValue(cc);
+        ConsumeCharacterRun<DoubleQuotedValueScanner>(
+            source, [this](const auto* characters, unsigned length) {
+              token_->AppendToAttributeValue(characters, length);
+            });
         HTML_CONSUME(kAttributeValueDoubleQuotedState);
       }
     }
@@ -836,6 +880,10 @@ bool HTMLTokenizer::NextToken(SegmentedString& source, HTMLToken& token) {
         HTML_RECONSUME_IN(kDataState);
       } else {
         token_->AppendToAttributeValue(cc);
+        ConsumeCharacterRun<SingleQuotedValueScanner>(
+            source, [this](const auto* characters, unsigned length) {
+              token_->AppendToAttributeValue(characters, length);
+            });
         HTML_CONSUME(kAttributeValueSingleQuotedState);
       }
     }
@@ -1017,6 +1065,10 @@ bool HTMLTokenizer::NextToken(SegmentedString& source, HTMLToken& token) {
         return EmitAndReconsumeIn(source, HTMLTokenizer::kDataState);
       } else {
         token_->AppendToComment(cc);
+        ConsumeCharacterRun<CommentScanner>(
+            source, [this](const auto* characters, unsigned length) {
+              token_->AppendToComment(characters, length);
+            });
         HTML_CONSUME(kCommentState);
       }
     }
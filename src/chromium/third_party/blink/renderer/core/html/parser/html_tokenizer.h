@@ -202,6 +202,12 @@ class CORE_EXPORT HTMLTokenizer {
 
   inline bool ProcessEntity(SegmentedString&);
 
+  // Hands the characters following the current one, up to the first stop
+  // character of |Scanner|, to |append| at once and leaves the last of them
+  // as the current character.
+  template <typename Scanner, typename Append>
+  inline void ConsumeCharacterRun(SegmentedString&, const Append& append);
+
   inline void ParseError();
 
   inline void BufferCharacter(UChar character) {
@@ -15,11 +15,98 @@
 
 #include "preload_request.h"
 
+#include "base/memory/ptr_util.h"
+#include "blinkit/crawler/crawler_impl.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/core/loader/resource/script_resource.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
+
+using namespace BlinKit;
+
 namespace blink {
 
+PreloadRequest::PreloadRequest(
+    const String &initiatorName,
+    const TextPosition &initiatorPosition,
+    const String &resourceURL,
+    const BkURL &baseURL,
+    ResourceType resourceType,
+    RequestType requestType)
+    : m_initiatorName(initiatorName)
+    , m_initiatorPosition(initiatorPosition)
+    , m_resourceURL(resourceURL)
+    , m_baseURL(baseURL)
+    , m_resourceType(resourceType)
+    , m_requestType(requestType)
+{
+}
+
+BkURL PreloadRequest::CompleteURL(Document *document) const
+{
+    if (!m_baseURL.IsEmpty())
+        return document->CompleteURLWithOverride(m_resourceURL, m_baseURL);
+    return document->CompleteURL(m_resourceURL);
+}
+
+std::unique_ptr<PreloadRequest> PreloadRequest::CreateIfNeeded(
+    const String &initiatorName,
+    const TextPosition &initiatorPosition,
+    const String &resourceURL,
+    const BkURL &baseURL,
+    ResourceType resourceType,
+    RequestType requestType)
+{
+    // Never preload data URLs. We also disallow relative ref URLs which become
+    // data URLs if the document's URL is a data URL. We don't want to create
+    // extra resource requests with data URLs to avoid copy / initialization
+    // overhead, which can be significant for large URLs.
+    if (resourceURL.IsEmpty() || resourceURL.StartsWith('#') || resourceURL.StartsWithIgnoringASCIICase("data:"))
+        return nullptr;
+
+    return base::WrapUnique(new PreloadRequest(initiatorName, initiatorPosition, resourceURL, baseURL,
+        resourceType, requestType));
+}
+
 Resource* PreloadRequest::Start(Document *document)
 {
-    ASSERT(false); // BKTODO:
+    ASSERT(IsMainThread());
+    ASSERT(kRequestTypePreload == m_requestType); // Only scripts are scanned for now.
+
+    BkURL url = CompleteURL(document);
+    if (!url.IsValid() || url.SchemeIsData())
+        return nullptr;
+
+    // Keep the request the same as the one to be made by the element, so that
+    // the fetcher could match them.
+    ResourceRequest request(url);
+    if (document->ForCrawler())
+    {
+        CrawlerImpl *crawler = ToCrawlerImpl(document->GetFrame()->Client());
+        request.SetCrawler(crawler);
+        if (ResourceType::kScript == m_resourceType)
+            request.SetHijackType(HijackType::kScript);
+        request.SetUseSharedCache(crawler->AllowsSharedCache());
+    }
+
+    ResourceLoaderOptions options;
+    options.initiator_info.name = AtomicString(m_initiatorName);
+    options.initiator_info.position = m_initiatorPosition;
+
+    FetchParameters params(request, options);
+    params.SetDefer(m_defer);
+    params.SetSpeculativePreloadType(m_fromInsertionScanner
+        ? FetchParameters::SpeculativePreloadType::kInserted
+        : FetchParameters::SpeculativePreloadType::kInDocument);
+
+    switch (m_resourceType)
+    {
+        case ResourceType::kScript:
+            return ScriptResource::Fetch(params, document->Fetcher(), nullptr).get();
+        default:
+            NOTREACHED();
+    }
     return nullptr;
 }
 
@@ -18,13 +18,22 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
+#include "blinkit/common/bk_url.h"
+#include "third_party/blink/renderer/platform/loader/fetch/fetch_parameters.h"
+#include "third_party/blink/renderer/platform/wtf/text/text_position.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace blink {
 
 class Document;
 class Resource;
+enum class ResourceType : uint8_t;
 
+// A fetch found by the preload scanner ahead of the parser. It goes through the
+// resource fetcher of the document like the real one, which takes the preloaded
+// resource over later.
 class PreloadRequest
 {
 public:
@@ -34,7 +43,33 @@ public:
         kRequestTypeLinkRelPreload
     };
 
+    // Returns nullptr for the URLs not worth a request, such as data URLs.
+    static std::unique_ptr<PreloadRequest> CreateIfNeeded(const String &initiatorName,
+        const TextPosition &initiatorPosition, const String &resourceURL, const BlinKit::BkURL &baseURL,
+        ResourceType resourceType, RequestType requestType = kRequestTypePreload);
+
     Resource* Start(Document *document);
+
+    void SetDefer(FetchParameters::DeferOption defer) { m_defer = defer; }
+    void SetFromInsertionScanner(bool fromInsertionScanner) { m_fromInsertionScanner = fromInsertionScanner; }
+
+    const String& ResourceURL(void) const { return m_resourceURL; }
+    ResourceType GetResourceType(void) const { return m_resourceType; }
+    RequestType GetRequestType(void) const { return m_requestType; }
+private:
+    PreloadRequest(const String &initiatorName, const TextPosition &initiatorPosition, const String &resourceURL,
+        const BlinKit::BkURL &baseURL, ResourceType resourceType, RequestType requestType);
+
+    BlinKit::BkURL CompleteURL(Document *document) const;
+
+    const String m_initiatorName;
+    const TextPosition m_initiatorPosition;
+    const String m_resourceURL;
+    const BlinKit::BkURL m_baseURL;
+    const ResourceType m_resourceType;
+    const RequestType m_requestType;
+    FetchParameters::DeferOption m_defer = FetchParameters::kNoDefer;
+    bool m_fromInsertionScanner = false;
 };
 
 typedef std::vector<std::unique_ptr<PreloadRequest>> PreloadRequestStream;
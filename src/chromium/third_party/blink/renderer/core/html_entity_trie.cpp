@@ -0,0 +1,9950 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: html_entity_trie.cpp
+// Description: HTMLEntityTrie Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+// THIS FILE IS GENERATED BY scripts/html_entity_trie.cpp.php.
+// DO NOT EDIT!
+
+#include "html_entity_trie.h"
+
+#include <cstring>
+
+namespace blink {
+
+static const HTMLEntityTrie::Node kNodes[9854] = {
+    { 1, 52, 0, -1 },
+    { 53, 16, 'A', -1 },
+    { 69, 8, 'B', -1 },
+    { 77, 14, 'C', -1 },
+    { 91, 11, 'D', -1 },
+    { 102, 16, 'E', -1 },
+    { 118, 5, 'F', -1 },
+    { 123, 12, 'G', -1 },
+    { 135, 8, 'H', -1 },
+    { 143, 14, 'I', -1 },
+    { 157, 5, 'J', -1 },
+    { 162, 7, 'K', -1 },
+    { 169, 11, 'L', -1 },
+    { 180, 8, 'M', -1 },
+    { 188, 9, 'N', -1 },
+    { 197, 14, 'O', -1 },
+    { 211, 9, 'P', -1 },
+    { 220, 4, 'Q', -1 },
+    { 224, 12, 'R', -1 },
+    { 236, 13, 'S', -1 },
+    { 249, 11, 'T', -1 },
+    { 260, 14, 'U', -1 },
+    { 274, 9, 'V', -1 },
+    { 283, 5, 'W', -1 },
+    { 288, 4, 'X', -1 },
+    { 292, 9, 'Y', -1 },
+    { 301, 8, 'Z', -1 },
+    { 309, 16, 'a', -1 },
+    { 325, 16, 'b', -1 },
+    { 341, 15, 'c', -1 },
+    { 356, 19, 'd', -1 },
+    { 375, 18, 'e', -1 },
+    { 393, 12, 'f', -1 },
+    { 405, 17, 'g', -1 },
+    { 422, 10, 'h', -1 },
+    { 432, 15, 'i', -1 },
+    { 447, 6, 'j', -1 },
+    { 453, 8, 'k', -1 },
+    { 461, 23, 'l', -1 },
+    { 484, 14, 'm', -1 },
+    { 498, 24, 'n', -1 },
+    { 522, 18, 'o', -1 },
+    { 540, 12, 'p', -1 },
+    { 552, 6, 'q', -1 },
+    { 558, 21, 'r', -1 },
+    { 579, 19, 's', -1 },
+    { 598, 13, 't', -1 },
+    { 611, 18, 'u', -1 },
+    { 629, 15, 'v', -1 },
+    { 644, 7, 'w', -1 },
+    { 651, 14, 'x', -1 },
+    { 665, 8, 'y', -1 },
+    { 673, 10, 'z', -1 },
+    { 683, 1, 'E', -1 },
+    { 684, 1, 'M', -1 },
+    { 685, 1, 'a', -1 },
+    { 686, 1, 'b', -1 },
+    { 687, 2, 'c', -1 },
+    { 689, 1, 'f', -1 },
+    { 690, 1, 'g', -1 },
+    { 691, 1, 'l', -1 },
+    { 692, 1, 'm', -1 },
+    { 693, 1, 'n', -1 },
+    { 694, 2, 'o', -1 },
+    { 696, 1, 'p', -1 },
+    { 697, 1, 'r', -1 },
+    { 698, 2, 's', -1 },
+    { 700, 1, 't', -1 },
+    { 701, 1, 'u', -1 },
+    { 702, 2, 'a', -1 },
+    { 704, 1, 'c', -1 },
+    { 705, 3, 'e', -1 },
+    { 708, 1, 'f', -1 },
+    { 709, 1, 'o', -1 },
+    { 710, 1, 'r', -1 },
+    { 711, 1, 's', -1 },
+    { 712, 1, 'u', -1 },
+    { 713, 1, 'H', -1 },
+    { 714, 1, 'O', -1 },
+    { 715, 3, 'a', -1 },
+    { 718, 4, 'c', -1 },
+    { 722, 1, 'd', -1 },
+    { 723, 2, 'e', -1 },
+    { 725, 1, 'f', -1 },
+    { 726, 1, 'h', -1 },
+    { 727, 1, 'i', -1 },
+    { 728, 1, 'l', -1 },
+    { 729, 4, 'o', -1 },
+    { 733, 1, 'r', -1 },
+    { 734, 1, 's', -1 },
+    { 735, 1, 'u', -1 },
+    { 736, 2, 'D', -1 },
+    { 738, 1, 'J', -1 },
+    { 739, 1, 'S', -1 },
+    { 740, 1, 'Z', -1 },
+    { 741, 3, 'a', -1 },
+    { 744, 2, 'c', -1 },
+    { 746, 1, 'e', -1 },
+    { 747, 1, 'f', -1 },
+    { 748, 2, 'i', -1 },
+    { 750, 4, 'o', -1 },
+    { 754, 2, 's', -1 },
+    { 756, 1, 'N', -1 },
+    { 757, 1, 'T', -1 },
+    { 758, 1, 'a', -1 },
+    { 759, 3, 'c', -1 },
+    { 762, 1, 'd', -1 },
+    { 763, 1, 'f', -1 },
+    { 764, 1, 'g', -1 },
+    { 765, 1, 'l', -1 },
+    { 766, 2, 'm', -1 },
+    { 768, 2, 'o', -1 },
+    { 770, 1, 'p', -1 },
+    { 771, 1, 'q', -1 },
+    { 772, 2, 's', -1 },
+    { 774, 1, 't', -1 },
+    { 775, 1, 'u', -1 },
+    { 776, 2, 'x', -1 },
+    { 778, 1, 'c', -1 },
+    { 779, 1, 'f', -1 },
+    { 780, 1, 'i', -1 },
+    { 781, 3, 'o', -1 },
+    { 784, 1, 's', -1 },
+    { 785, 1, 'J', -1 },
+    { 786, 1, 'T', 168 },
+    { 787, 1, 'a', -1 },
+    { 788, 1, 'b', -1 },
+    { 789, 3, 'c', -1 },
+    { 792, 1, 'd', -1 },
+    { 793, 1, 'f', -1 },
+    { 794, 1, 'g', -1 },
+    { 795, 1, 'o', -1 },
+    { 796, 1, 'r', -1 },
+    { 797, 1, 's', -1 },
+    { 798, 1, 't', -1 },
+    { 799, 1, 'A', -1 },
+    { 800, 2, 'a', -1 },
+    { 802, 1, 'c', -1 },
+    { 803, 1, 'f', -1 },
+    { 804, 1, 'i', -1 },
+    { 805, 2, 'o', -1 },
+    { 807, 2, 's', -1 },
+    { 809, 1, 'u', -1 },
+    { 810, 1, 'E', -1 },
+    { 811, 1, 'J', -1 },
+    { 812, 1, 'O', -1 },
+    { 813, 1, 'a', -1 },
+    { 814, 2, 'c', -1 },
+    { 816, 1, 'd', -1 },
+    { 817, 1, 'f', -1 },
+    { 818, 1, 'g', -1 },
+    { 819, 3, 'm', -1 },
+    { 822, 2, 'n', -1 },
+    { 824, 3, 'o', -1 },
+    { 827, 1, 's', -1 },
+    { 828, 1, 't', -1 },
+    { 829, 2, 'u', -1 },
+    { 831, 2, 'c', -1 },
+    { 833, 1, 'f', -1 },
+    { 834, 1, 'o', -1 },
+    { 835, 2, 's', -1 },
+    { 837, 1, 'u', -1 },
+    { 838, 1, 'H', -1 },
+    { 839, 1, 'J', -1 },
+    { 840, 1, 'a', -1 },
+    { 841, 2, 'c', -1 },
+    { 843, 1, 'f', -1 },
+    { 844, 1, 'o', -1 },
+    { 845, 1, 's', -1 },
+    { 846, 1, 'J', -1 },
+    { 847, 1, 'T', 246 },
+    { 848, 5, 'a', -1 },
+    { 853, 3, 'c', -1 },
+    { 856, 2, 'e', -1 },
+    { 858, 1, 'f', -1 },
+    { 859, 2, 'l', -1 },
+    { 861, 1, 'm', -1 },
+    { 862, 3, 'o', -1 },
+    { 865, 3, 's', -1 },
+    { 868, 1, 't', -1 },
+    { 869, 1, 'a', -1 },
+    { 870, 1, 'c', -1 },
+    { 871, 2, 'e', -1 },
+    { 873, 1, 'f', -1 },
+    { 874, 1, 'i', -1 },
+    { 875, 1, 'o', -1 },
+    { 876, 1, 's', -1 },
+    { 877, 1, 'u', -1 },
+    { 878, 1, 'J', -1 },
+    { 879, 1, 'a', -1 },
+    { 880, 3, 'c', -1 },
+    { 883, 3, 'e', -1 },
+    { 886, 1, 'f', -1 },
+    { 887, 4, 'o', -1 },
+    { 891, 1, 's', -1 },
+    { 892, 1, 't', -1 },
+    { 893, 1, 'u', -1 },
+    { 894, 1, 'E', -1 },
+    { 895, 1, 'a', -1 },
+    { 896, 2, 'c', -1 },
+    { 898, 1, 'd', -1 },
+    { 899, 1, 'f', -1 },
+    { 900, 1, 'g', -1 },
+    { 901, 3, 'm', -1 },
+    { 904, 1, 'o', -1 },
+    { 905, 1, 'p', -1 },
+    { 906, 1, 'r', -1 },
+    { 907, 2, 's', -1 },
+    { 909, 1, 't', -1 },
+    { 910, 1, 'u', -1 },
+    { 911, 1, 'v', -1 },
+    { 912, 1, 'a', -1 },
+    { 913, 1, 'c', -1 },
+    { 914, 1, 'f', -1 },
+    { 915, 1, 'h', -1 },
+    { 916, 1, 'i', -1 },
+    { 917, 1, 'l', -1 },
+    { 918, 2, 'o', -1 },
+    { 920, 4, 'r', -1 },
+    { 924, 2, 's', -1 },
+    { 926, 1, 'U', -1 },
+    { 927, 1, 'f', -1 },
+    { 928, 1, 'o', -1 },
+    { 929, 1, 's', -1 },
+    { 930, 1, 'B', -1 },
+    { 931, 1, 'E', -1 },
+    { 932, 3, 'a', -1 },
+    { 935, 3, 'c', -1 },
+    { 938, 2, 'e', -1 },
+    { 940, 1, 'f', -1 },
+    { 941, 1, 'h', -1 },
+    { 942, 1, 'i', -1 },
+    { 943, 2, 'o', -1 },
+    { 945, 1, 'r', -1 },
+    { 946, 2, 's', -1 },
+    { 948, 1, 'u', -1 },
+    { 949, 2, 'H', -1 },
+    { 951, 1, 'O', -1 },
+    { 952, 1, 'a', -1 },
+    { 953, 5, 'c', -1 },
+    { 958, 1, 'f', -1 },
+    { 959, 1, 'h', -1 },
+    { 960, 1, 'i', -1 },
+    { 961, 1, 'm', -1 },
+    { 962, 1, 'o', -1 },
+    { 963, 2, 'q', -1 },
+    { 965, 1, 's', -1 },
+    { 966, 1, 't', -1 },
+    { 967, 4, 'u', -1 },
+    { 971, 1, 'H', -1 },
+    { 972, 1, 'R', -1 },
+    { 973, 2, 'S', -1 },
+    { 975, 2, 'a', -1 },
+    { 977, 3, 'c', -1 },
+    { 980, 1, 'f', -1 },
+    { 981, 2, 'h', -1 },
+    { 983, 1, 'i', -1 },
+    { 984, 1, 'o', -1 },
+    { 985, 1, 'r', -1 },
+    { 986, 2, 's', -1 },
+    { 988, 2, 'a', -1 },
+    { 990, 1, 'b', -1 },
+    { 991, 2, 'c', -1 },
+    { 993, 1, 'd', -1 },
+    { 994, 1, 'f', -1 },
+    { 995, 1, 'g', -1 },
+    { 996, 1, 'm', -1 },
+    { 997, 2, 'n', -1 },
+    { 999, 2, 'o', -1 },
+    { 1001, 8, 'p', -1 },
+    { 1009, 1, 'r', -1 },
+    { 1010, 1, 's', -1 },
+    { 1011, 1, 't', -1 },
+    { 1012, 1, 'u', -1 },
+    { 1013, 1, 'D', -1 },
+    { 1014, 1, 'b', -1 },
+    { 1015, 1, 'c', -1 },
+    { 1016, 1, 'd', -1 },
+    { 1017, 2, 'e', -1 },
+    { 1019, 1, 'f', -1 },
+    { 1020, 1, 'o', -1 },
+    { 1021, 1, 's', -1 },
+    { 1022, 1, 'v', -1 },
+    { 1023, 1, 'c', -1 },
+    { 1024, 1, 'e', -1 },
+    { 1025, 1, 'f', -1 },
+    { 1026, 1, 'o', -1 },
+    { 1027, 1, 's', -1 },
+    { 1028, 1, 'f', -1 },
+    { 1029, 1, 'i', -1 },
+    { 1030, 1, 'o', -1 },
+    { 1031, 1, 's', -1 },
+    { 1032, 1, 'A', -1 },
+    { 1033, 1, 'I', -1 },
+    { 1034, 1, 'U', -1 },
+    { 1035, 1, 'a', -1 },
+    { 1036, 2, 'c', -1 },
+    { 1038, 1, 'f', -1 },
+    { 1039, 1, 'o', -1 },
+    { 1040, 1, 's', -1 },
+    { 1041, 1, 'u', -1 },
+    { 1042, 1, 'H', -1 },
+    { 1043, 1, 'a', -1 },
+    { 1044, 2, 'c', -1 },
+    { 1046, 1, 'd', -1 },
+    { 1047, 2, 'e', -1 },
+    { 1049, 1, 'f', -1 },
+    { 1050, 1, 'o', -1 },
+    { 1051, 1, 's', -1 },
+    { 1052, 1, 'a', -1 },
+    { 1053, 1, 'b', -1 },
+    { 1054, 6, 'c', -1 },
+    { 1060, 1, 'e', -1 },
+    { 1061, 2, 'f', -1 },
+    { 1063, 1, 'g', -1 },
+    { 1064, 2, 'l', -1 },
+    { 1066, 2, 'm', -1 },
+    { 1068, 2, 'n', -1 },
+    { 1070, 2, 'o', -1 },
+    { 1072, 7, 'p', -1 },
+    { 1079, 1, 'r', -1 },
+    { 1080, 3, 's', -1 },
+    { 1083, 1, 't', -1 },
+    { 1084, 1, 'u', -1 },
+    { 1085, 2, 'w', -1 },
+    { 1087, 1, 'N', -1 },
+    { 1088, 2, 'a', -1 },
+    { 1090, 1, 'b', -1 },
+    { 1091, 2, 'c', -1 },
+    { 1093, 1, 'd', -1 },
+    { 1094, 5, 'e', -1 },
+    { 1099, 1, 'f', -1 },
+    { 1100, 1, 'i', -1 },
+    { 1101, 1, 'k', -1 },
+    { 1102, 3, 'l', -1 },
+    { 1105, 2, 'n', -1 },
+    { 1107, 4, 'o', -1 },
+    { 1111, 1, 'p', -1 },
+    { 1112, 2, 'r', -1 },
+    { 1114, 4, 's', -1 },
+    { 1118, 2, 'u', -1 },
+    { 1120, 3, 'a', -1 },
+    { 1123, 4, 'c', -1 },
+    { 1127, 1, 'd', -1 },
+    { 1128, 3, 'e', -1 },
+    { 1131, 1, 'f', -1 },
+    { 1132, 3, 'h', -1 },
+    { 1135, 1, 'i', -1 },
+    { 1136, 1, 'l', -1 },
+    { 1137, 4, 'o', -1 },
+    { 1141, 2, 'r', -1 },
+    { 1143, 2, 's', -1 },
+    { 1145, 1, 't', -1 },
+    { 1146, 7, 'u', -1 },
+    { 1153, 2, 'w', -1 },
+    { 1155, 1, 'y', -1 },
+    { 1156, 1, 'A', -1 },
+    { 1157, 1, 'H', -1 },
+    { 1158, 4, 'a', -1 },
+    { 1162, 2, 'b', -1 },
+    { 1164, 2, 'c', -1 },
+    { 1166, 3, 'd', -1 },
+    { 1169, 3, 'e', -1 },
+    { 1172, 2, 'f', -1 },
+    { 1174, 1, 'h', -1 },
+    { 1175, 5, 'i', -1 },
+    { 1180, 1, 'j', -1 },
+    { 1181, 1, 'l', -1 },
+    { 1182, 5, 'o', -1 },
+    { 1187, 2, 'r', -1 },
+    { 1189, 3, 's', -1 },
+    { 1192, 2, 't', -1 },
+    { 1194, 2, 'u', -1 },
+    { 1196, 1, 'w', -1 },
+    { 1197, 2, 'z', -1 },
+    { 1199, 2, 'D', -1 },
+    { 1201, 2, 'a', -1 },
+    { 1203, 4, 'c', -1 },
+    { 1207, 1, 'd', -1 },
+    { 1208, 1, 'e', -1 },
+    { 1209, 2, 'f', -1 },
+    { 1211, 3, 'g', -1 },
+    { 1214, 4, 'l', -1 },
+    { 1218, 3, 'm', -1 },
+    { 1221, 2, 'n', -1 },
+    { 1223, 2, 'o', -1 },
+    { 1225, 3, 'p', -1 },
+    { 1228, 4, 'q', -1 },
+    { 1232, 2, 'r', -1 },
+    { 1234, 3, 's', -1 },
+    { 1237, 2, 't', -1 },
+    { 1239, 2, 'u', -1 },
+    { 1241, 3, 'x', -1 },
+    { 1244, 1, 'a', -1 },
+    { 1245, 1, 'c', -1 },
+    { 1246, 1, 'e', -1 },
+    { 1247, 3, 'f', -1 },
+    { 1250, 1, 'i', -1 },
+    { 1251, 1, 'j', -1 },
+    { 1252, 3, 'l', -1 },
+    { 1255, 1, 'n', -1 },
+    { 1256, 2, 'o', -1 },
+    { 1258, 1, 'p', -1 },
+    { 1259, 2, 'r', -1 },
+    { 1261, 1, 's', -1 },
+    { 1262, 2, 'E', -1 },
+    { 1264, 3, 'a', -1 },
+    { 1267, 1, 'b', -1 },
+    { 1268, 2, 'c', -1 },
+    { 1270, 1, 'd', -1 },
+    { 1271, 4, 'e', -1 },
+    { 1275, 1, 'f', -1 },
+    { 1276, 2, 'g', -1 },
+    { 1278, 1, 'i', -1 },
+    { 1279, 1, 'j', -1 },
+    { 1280, 4, 'l', -1 },
+    { 1284, 4, 'n', -1 },
+    { 1288, 1, 'o', -1 },
+    { 1289, 1, 'r', -1 },
+    { 1290, 2, 's', -1 },
+    { 1292, 6, 't', 1134 },
+    { 1298, 2, 'v', -1 },
+    { 1300, 1, 'A', -1 },
+    { 1301, 4, 'a', -1 },
+    { 1305, 1, 'b', -1 },
+    { 1306, 1, 'c', -1 },
+    { 1307, 3, 'e', -1 },
+    { 1310, 1, 'f', -1 },
+    { 1311, 1, 'k', -1 },
+    { 1312, 5, 'o', -1 },
+    { 1317, 3, 's', -1 },
+    { 1320, 2, 'y', -1 },
+    { 1322, 1, 'a', -1 },
+    { 1323, 3, 'c', -1 },
+    { 1326, 2, 'e', -1 },
+    { 1328, 2, 'f', -1 },
+    { 1330, 1, 'g', -1 },
+    { 1331, 4, 'i', -1 },
+    { 1335, 1, 'j', -1 },
+    { 1336, 3, 'm', -1 },
+    { 1339, 5, 'n', -1 },
+    { 1344, 4, 'o', -1 },
+    { 1348, 1, 'p', -1 },
+    { 1349, 1, 'q', -1 },
+    { 1350, 2, 's', -1 },
+    { 1352, 2, 't', -1 },
+    { 1354, 2, 'u', -1 },
+    { 1356, 2, 'c', -1 },
+    { 1358, 1, 'f', -1 },
+    { 1359, 1, 'm', -1 },
+    { 1360, 1, 'o', -1 },
+    { 1361, 2, 's', -1 },
+    { 1363, 1, 'u', -1 },
+    { 1364, 1, 'a', -1 },
+    { 1365, 2, 'c', -1 },
+    { 1367, 1, 'f', -1 },
+    { 1368, 1, 'g', -1 },
+    { 1369, 1, 'h', -1 },
+    { 1370, 1, 'j', -1 },
+    { 1371, 1, 'o', -1 },
+    { 1372, 1, 's', -1 },
+    { 1373, 3, 'A', -1 },
+    { 1376, 1, 'B', -1 },
+    { 1377, 2, 'E', -1 },
+    { 1379, 1, 'H', -1 },
+    { 1380, 9, 'a', -1 },
+    { 1389, 3, 'b', -1 },
+    { 1392, 4, 'c', -1 },
+    { 1396, 4, 'd', -1 },
+    { 1400, 5, 'e', -1 },
+    { 1405, 3, 'f', -1 },
+    { 1408, 2, 'g', -1 },
+    { 1410, 2, 'h', -1 },
+    { 1412, 1, 'j', -1 },
+    { 1413, 5, 'l', -1 },
+    { 1418, 2, 'm', -1 },
+    { 1420, 4, 'n', -1 },
+    { 1424, 8, 'o', -1 },
+    { 1432, 1, 'p', -1 },
+    { 1433, 5, 'r', -1 },
+    { 1438, 6, 's', -1 },
+    { 1444, 8, 't', 1389 },
+    { 1452, 1, 'u', -1 },
+    { 1453, 2, 'v', -1 },
+    { 1455, 1, 'D', -1 },
+    { 1456, 4, 'a', -1 },
+    { 1460, 2, 'c', -1 },
+    { 1462, 1, 'd', -1 },
+    { 1463, 1, 'e', -1 },
+    { 1464, 1, 'f', -1 },
+    { 1465, 1, 'h', -1 },
+    { 1466, 3, 'i', -1 },
+    { 1469, 2, 'l', -1 },
+    { 1471, 1, 'n', -1 },
+    { 1472, 2, 'o', -1 },
+    { 1474, 1, 'p', -1 },
+    { 1475, 2, 's', -1 },
+    { 1477, 3, 'u', -1 },
+    { 1480, 2, 'G', -1 },
+    { 1482, 3, 'L', -1 },
+    { 1485, 1, 'R', -1 },
+    { 1486, 2, 'V', -1 },
+    { 1488, 5, 'a', -1 },
+    { 1493, 2, 'b', -1 },
+    { 1495, 5, 'c', -1 },
+    { 1500, 1, 'd', -1 },
+    { 1501, 7, 'e', -1 },
+    { 1508, 1, 'f', -1 },
+    { 1509, 4, 'g', -1 },
+    { 1513, 3, 'h', -1 },
+    { 1516, 3, 'i', -1 },
+    { 1519, 1, 'j', -1 },
+    { 1520, 7, 'l', -1 },
+    { 1527, 1, 'm', -1 },
+    { 1528, 2, 'o', -1 },
+    { 1530, 3, 'p', -1 },
+    { 1533, 4, 'r', -1 },
+    { 1537, 7, 's', -1 },
+    { 1544, 4, 't', -1 },
+    { 1548, 2, 'u', -1 },
+    { 1550, 9, 'v', -1 },
+    { 1559, 3, 'w', -1 },
+    { 1562, 1, 'S', -1 },
+    { 1563, 2, 'a', -1 },
+    { 1565, 2, 'c', -1 },
+    { 1567, 5, 'd', -1 },
+    { 1572, 1, 'e', -1 },
+    { 1573, 2, 'f', -1 },
+    { 1575, 3, 'g', -1 },
+    { 1578, 2, 'h', -1 },
+    { 1580, 1, 'i', -1 },
+    { 1581, 4, 'l', -1 },
+    { 1585, 3, 'm', -1 },
+    { 1588, 1, 'o', -1 },
+    { 1589, 3, 'p', -1 },
+    { 1592, 7, 'r', -1 },
+    { 1599, 3, 's', -1 },
+    { 1602, 1, 't', -1 },
+    { 1603, 1, 'u', -1 },
+    { 1604, 1, 'v', -1 },
+    { 1605, 1, 'a', -1 },
+    { 1606, 1, 'c', -1 },
+    { 1607, 1, 'e', -1 },
+    { 1608, 1, 'f', -1 },
+    { 1609, 3, 'h', -1 },
+    { 1612, 3, 'i', -1 },
+    { 1615, 2, 'l', -1 },
+    { 1617, 1, 'm', -1 },
+    { 1618, 3, 'o', -1 },
+    { 1621, 10, 'r', -1 },
+    { 1631, 2, 's', -1 },
+    { 1633, 1, 'u', -1 },
+    { 1634, 1, 'f', -1 },
+    { 1635, 1, 'i', -1 },
+    { 1636, 1, 'o', -1 },
+    { 1637, 1, 'p', -1 },
+    { 1638, 1, 's', -1 },
+    { 1639, 3, 'u', -1 },
+    { 1642, 3, 'A', -1 },
+    { 1645, 1, 'B', -1 },
+    { 1646, 1, 'H', -1 },
+    { 1647, 7, 'a', -1 },
+    { 1654, 3, 'b', -1 },
+    { 1657, 4, 'c', -1 },
+    { 1661, 4, 'd', -1 },
+    { 1665, 3, 'e', -1 },
+    { 1668, 3, 'f', -1 },
+    { 1671, 2, 'h', -1 },
+    { 1673, 3, 'i', -1 },
+    { 1676, 3, 'l', -1 },
+    { 1679, 1, 'm', -1 },
+    { 1680, 1, 'n', -1 },
+    { 1681, 4, 'o', -1 },
+    { 1685, 2, 'p', -1 },
+    { 1687, 1, 'r', -1 },
+    { 1688, 4, 's', -1 },
+    { 1692, 3, 't', -1 },
+    { 1695, 1, 'u', -1 },
+    { 1696, 1, 'x', -1 },
+    { 1697, 1, 'a', -1 },
+    { 1698, 1, 'b', -1 },
+    { 1699, 10, 'c', -1 },
+    { 1709, 1, 'd', -1 },
+    { 1710, 7, 'e', -1 },
+    { 1717, 1, 'f', -1 },
+    { 1718, 4, 'h', -1 },
+    { 1722, 2, 'i', -1 },
+    { 1724, 1, 'l', -1 },
+    { 1725, 4, 'm', -1 },
+    { 1729, 3, 'o', -1 },
+    { 1732, 1, 'p', -1 },
+    { 1733, 3, 'q', -1 },
+    { 1736, 1, 'r', -1 },
+    { 1737, 4, 's', -1 },
+    { 1741, 2, 't', -1 },
+    { 1743, 5, 'u', -1 },
+    { 1748, 3, 'w', -1 },
+    { 1751, 1, 'z', -1 },
+    { 1752, 2, 'a', -1 },
+    { 1754, 1, 'b', -1 },
+    { 1755, 3, 'c', -1 },
+    { 1758, 1, 'd', -1 },
+    { 1759, 1, 'e', -1 },
+    { 1760, 1, 'f', -1 },
+    { 1761, 4, 'h', -1 },
+    { 1765, 3, 'i', -1 },
+    { 1768, 3, 'o', -1 },
+    { 1771, 1, 'p', -1 },
+    { 1772, 3, 'r', -1 },
+    { 1775, 3, 's', -1 },
+    { 1778, 2, 'w', -1 },
+    { 1780, 1, 'A', -1 },
+    { 1781, 1, 'H', -1 },
+    { 1782, 2, 'a', -1 },
+    { 1784, 1, 'b', -1 },
+    { 1785, 2, 'c', -1 },
+    { 1787, 3, 'd', -1 },
+    { 1790, 2, 'f', -1 },
+    { 1792, 1, 'g', -1 },
+    { 1793, 2, 'h', -1 },
+    { 1795, 2, 'l', -1 },
+    { 1797, 2, 'm', -1 },
+    { 1799, 2, 'o', -1 },
+    { 1801, 6, 'p', -1 },
+    { 1807, 3, 'r', -1 },
+    { 1810, 1, 's', -1 },
+    { 1811, 3, 't', -1 },
+    { 1814, 2, 'u', -1 },
+    { 1816, 1, 'w', -1 },
+    { 1817, 1, 'A', -1 },
+    { 1818, 1, 'B', -1 },
+    { 1819, 1, 'D', -1 },
+    { 1820, 2, 'a', -1 },
+    { 1822, 1, 'c', -1 },
+    { 1823, 1, 'd', -1 },
+    { 1824, 3, 'e', -1 },
+    { 1827, 1, 'f', -1 },
+    { 1828, 1, 'l', -1 },
+    { 1829, 1, 'n', -1 },
+    { 1830, 1, 'o', -1 },
+    { 1831, 1, 'p', -1 },
+    { 1832, 1, 'r', -1 },
+    { 1833, 2, 's', -1 },
+    { 1835, 1, 'z', -1 },
+    { 1836, 1, 'c', -1 },
+    { 1837, 2, 'e', -1 },
+    { 1839, 1, 'f', -1 },
+    { 1840, 1, 'o', -1 },
+    { 1841, 1, 'p', -1 },
+    { 1842, 2, 'r', -1 },
+    { 1844, 1, 's', -1 },
+    { 1845, 3, 'c', -1 },
+    { 1848, 1, 'd', -1 },
+    { 1849, 1, 'f', -1 },
+    { 1850, 2, 'h', -1 },
+    { 1852, 1, 'i', -1 },
+    { 1853, 2, 'l', -1 },
+    { 1855, 1, 'm', -1 },
+    { 1856, 1, 'n', -1 },
+    { 1857, 3, 'o', -1 },
+    { 1860, 2, 'r', -1 },
+    { 1862, 2, 's', -1 },
+    { 1864, 2, 'u', -1 },
+    { 1866, 1, 'v', -1 },
+    { 1867, 1, 'w', -1 },
+    { 1868, 1, 'a', -1 },
+    { 1869, 2, 'c', -1 },
+    { 1871, 1, 'e', -1 },
+    { 1872, 1, 'f', -1 },
+    { 1873, 1, 'i', -1 },
+    { 1874, 1, 'o', -1 },
+    { 1875, 1, 's', -1 },
+    { 1876, 2, 'u', -1 },
+    { 1878, 1, 'a', -1 },
+    { 1879, 2, 'c', -1 },
+    { 1881, 1, 'd', -1 },
+    { 1882, 2, 'e', -1 },
+    { 1884, 1, 'f', -1 },
+    { 1885, 1, 'h', -1 },
+    { 1886, 1, 'i', -1 },
+    { 1887, 1, 'o', -1 },
+    { 1888, 1, 's', -1 },
+    { 1889, 2, 'w', -1 },
+    { 1891, 1, 'l', -1 },
+    { 1892, 1, 'P', 2 },
+    { 1893, 1, 'c', -1 },
+    { 1894, 1, 'r', -1 },
+    { 1895, 1, 'i', -1 },
+    { 1896, 1, 'y', -1 },
+    { 1897, 1, 'r', -1 },
+    { 1898, 1, 'r', -1 },
+    { 1899, 1, 'p', -1 },
+    { 1900, 1, 'a', -1 },
+    { 1901, 1, 'd', -1 },
+    { 1902, 1, 'g', -1 },
+    { 1903, 1, 'p', -1 },
+    { 1904, 1, 'p', -1 },
+    { 1905, 1, 'i', -1 },
+    { 1906, 1, 'c', -1 },
+    { 1907, 1, 's', -1 },
+    { 1908, 1, 'i', -1 },
+    { 1909, 1, 'm', -1 },
+    { 1910, 1, 'c', -1 },
+    { 1911, 2, 'r', -1 },
+    { 1913, 1, 'y', -1 },
+    { 1914, 1, 'c', -1 },
+    { 1915, 1, 'r', -1 },
+    { 1916, 1, 't', -1 },
+    { 1917, 1, 'r', -1 },
+    { 1918, 1, 'p', -1 },
+    { 1919, 1, 'e', -1 },
+    { 1920, 1, 'c', -1 },
+    { 1921, 1, 'm', -1 },
+    { 1922, 1, 'c', -1 },
+    { 1923, 1, 'P', -1 },
+    { 1924, 1, 'c', -1 },
+    { 1925, 2, 'p', -1 },
+    { 1927, 1, 'y', -1 },
+    { 1928, 1, 'a', -1 },
+    { 1929, 1, 'e', -1 },
+    { 1930, 1, 'i', -1 },
+    { 1931, 1, 'o', -1 },
+    { 1932, 1, 'o', -1 },
+    { 1933, 1, 'd', -1 },
+    { 1934, 1, 'n', -1 },
+    { 1935, 1, 'r', -1 },
+    { 1936, 1, 'i', -1 },
+    { 1937, 1, 'r', -1 },
+    { 1938, 2, 'o', -1 },
+    { 1940, 1, 'l', -1 },
+    { 1941, 3, 'n', -1 },
+    { 1944, 2, 'p', -1 },
+    { 1946, 1, 'u', -1 },
+    { 1947, 1, 'o', -1 },
+    { 1948, 1, 'c', -1 },
+    { 1949, 2, 'p', -1 },
+    { 0, 0, ';', 75 },
+    { 1951, 1, 'o', -1 },
+    { 1952, 1, 'c', -1 },
+    { 1953, 1, 'c', -1 },
+    { 1954, 1, 'c', -1 },
+    { 1955, 1, 'g', -1 },
+    { 1956, 1, 'r', -1 },
+    { 1957, 1, 's', -1 },
+    { 1958, 1, 'a', -1 },
+    { 1959, 1, 'y', -1 },
+    { 1960, 2, 'l', -1 },
+    { 1962, 1, 'r', -1 },
+    { 1963, 2, 'a', -1 },
+    { 1965, 1, 'f', -1 },
+    { 1966, 1, 'p', -1 },
+    { 1967, 3, 't', -1 },
+    { 1970, 1, 'u', -1 },
+    { 1971, 1, 'w', -1 },
+    { 1972, 1, 'c', -1 },
+    { 1973, 1, 't', -1 },
+    { 1974, 1, 'G', -1 },
+    { 1975, 1, 'H', 130 },
+    { 1976, 1, 'c', -1 },
+    { 1977, 1, 'a', -1 },
+    { 1978, 1, 'i', -1 },
+    { 1979, 1, 'y', -1 },
+    { 1980, 1, 'o', -1 },
+    { 1981, 1, 'r', -1 },
+    { 1982, 1, 'r', -1 },
+    { 1983, 1, 'e', -1 },
+    { 1984, 1, 'a', -1 },
+    { 1985, 1, 'p', -1 },
+    { 1986, 1, 'g', -1 },
+    { 1987, 1, 'p', -1 },
+    { 1988, 1, 's', -1 },
+    { 1989, 2, 'u', -1 },
+    { 1991, 1, 'c', -1 },
+    { 1992, 1, 'i', -1 },
+    { 1993, 1, 'a', -1 },
+    { 1994, 1, 'm', -1 },
+    { 1995, 1, 'i', -1 },
+    { 1996, 1, 'p', -1 },
+    { 1997, 1, 'y', -1 },
+    { 1998, 1, 'r', -1 },
+    { 1999, 1, 'l', -1 },
+    { 2000, 1, 'p', -1 },
+    { 2001, 1, 'r', -1 },
+    { 2002, 1, 'u', -1 },
+    { 2003, 1, 'c', -1 },
+    { 2004, 1, 'c', -1 },
+    { 0, 0, ';', 169 },
+    { 2005, 1, 'm', -1 },
+    { 2006, 1, 'r', -1 },
+    { 2007, 1, 'e', -1 },
+    { 2008, 1, 'i', -1 },
+    { 2009, 1, 'y', -1 },
+    { 2010, 1, 'o', -1 },
+    { 2011, 1, 'r', -1 },
+    { 0, 0, ';', 178 },
+    { 2012, 1, 'p', -1 },
+    { 2013, 1, 'e', -1 },
+    { 2014, 1, 'c', -1 },
+    { 0, 0, ';', 188 },
+    { 2015, 1, 'R', -1 },
+    { 2016, 1, 'c', -1 },
+    { 2017, 1, 't', -1 },
+    { 2018, 1, 'i', -1 },
+    { 2019, 1, 'r', -1 },
+    { 2020, 1, 'l', -1 },
+    { 2021, 1, 'p', -1 },
+    { 2022, 1, 'r', -1 },
+    { 2023, 1, 'c', -1 },
+    { 2024, 1, 't', -1 },
+    { 2025, 1, 'm', -1 },
+    { 2026, 1, 'c', -1 },
+    { 2027, 1, 'l', -1 },
+    { 2028, 1, 'c', -1 },
+    { 2029, 1, 'c', -1 },
+    { 2030, 1, 'i', -1 },
+    { 2031, 1, 'y', -1 },
+    { 2032, 1, 'o', -1 },
+    { 2033, 1, 'r', -1 },
+    { 2034, 1, 'r', -1 },
+    { 0, 0, ';', 213 },
+    { 2035, 2, 'a', -1 },
+    { 2037, 1, 'p', -1 },
+    { 2038, 2, 't', -1 },
+    { 2040, 1, 'v', -1 },
+    { 2041, 1, 'g', -1 },
+    { 2042, 1, 'p', -1 },
+    { 2043, 1, 't', -1 },
+    { 2044, 1, 'c', -1 },
+    { 2045, 1, 'i', -1 },
+    { 2046, 1, 'k', -1 },
+    { 2047, 1, 'm', -1 },
+    { 2048, 1, 'i', -1 },
+    { 2049, 1, 'y', -1 },
+    { 2050, 1, 'r', -1 },
+    { 2051, 1, 'p', -1 },
+    { 2052, 1, 'c', -1 },
+    { 2053, 1, 'e', -1 },
+    { 2054, 1, 'k', -1 },
+    { 2055, 1, 'c', -1 },
+    { 2056, 1, 'c', -1 },
+    { 2057, 1, 'p', -1 },
+    { 2058, 1, 'e', -1 },
+    { 2059, 1, 'y', -1 },
+    { 2060, 1, 'r', -1 },
+    { 2061, 1, 'p', -1 },
+    { 2062, 1, 'c', -1 },
+    { 2063, 1, 'c', -1 },
+    { 0, 0, ';', 247 },
+    { 2064, 1, 'c', -1 },
+    { 2065, 1, 'm', -1 },
+    { 2066, 1, 'n', -1 },
+    { 2067, 1, 'p', -1 },
+    { 2068, 1, 'r', -1 },
+    { 2069, 1, 'a', -1 },
+    { 2070, 1, 'e', -1 },
+    { 2071, 1, 'y', -1 },
+    { 2072, 1, 'f', -1 },
+    { 2073, 1, 's', -1 },
+    { 2074, 1, 'r', -1 },
+    { 0, 0, ';', 289 },
+    { 2075, 1, 'e', -1 },
+    { 2076, 1, 'i', -1 },
+    { 2077, 1, 'n', -1 },
+    { 2078, 1, 'p', -1 },
+    { 2079, 1, 'w', -1 },
+    { 2080, 1, 'c', -1 },
+    { 2081, 1, 'h', -1 },
+    { 2082, 1, 't', -1 },
+    { 0, 0, ';', 304 },
+    { 2083, 1, 'p', -1 },
+    { 2084, 1, 'y', -1 },
+    { 2085, 1, 'd', -1 },
+    { 2086, 1, 'l', -1 },
+    { 2087, 1, 'r', -1 },
+    { 2088, 1, 'n', -1 },
+    { 2089, 1, 'p', -1 },
+    { 2090, 1, 'c', -1 },
+    { 0, 0, ';', 313 },
+    { 2091, 1, 'c', -1 },
+    { 2092, 1, 'c', -1 },
+    { 2093, 1, 'a', -1 },
+    { 2094, 1, 'e', -1 },
+    { 2095, 1, 'y', -1 },
+    { 2096, 1, 'g', -1 },
+    { 2097, 1, 's', -1 },
+    { 2098, 1, 'w', -1 },
+    { 2099, 1, 'r', -1 },
+    { 2100, 1, 'B', -1 },
+    { 2101, 1, 'n', -1 },
+    { 2102, 1, 'p', -1 },
+    { 2103, 13, 't', -1 },
+    { 2116, 1, 'c', -1 },
+    { 2117, 1, 'i', -1 },
+    { 0, 0, ';', 385 },
+    { 2118, 1, 'l', -1 },
+    { 2119, 1, 'c', -1 },
+    { 2120, 1, 'i', -1 },
+    { 2121, 1, 'y', -1 },
+    { 2122, 1, 'b', -1 },
+    { 2123, 1, 'r', -1 },
+    { 2124, 1, 'r', -1 },
+    { 2125, 1, 'a', -1 },
+    { 2126, 1, 'e', -1 },
+    { 2127, 1, 'i', -1 },
+    { 2128, 1, 'p', -1 },
+    { 2129, 1, 'e', -1 },
+    { 0, 0, ';', 402 },
+    { 2130, 1, 'c', -1 },
+    { 2131, 1, 'l', -1 },
+    { 2132, 2, 'i', -1 },
+    { 2134, 1, 'm', -1 },
+    { 2135, 1, 'e', -1 },
+    { 2136, 1, 'r', -1 },
+    { 2137, 1, 'y', -1 },
+    { 2138, 1, 'r', -1 },
+    { 2139, 1, 'i', -1 },
+    { 0, 0, ';', 419 },
+    { 2140, 1, 'u', -1 },
+    { 2141, 1, 'i', -1 },
+    { 2142, 1, 'p', -1 },
+    { 0, 0, ';', 423 },
+    { 2143, 1, 'e', -1 },
+    { 2144, 1, 'i', -1 },
+    { 2145, 2, 'o', -1 },
+    { 2147, 1, 'c', -1 },
+    { 2148, 1, 'i', -1 },
+    { 2149, 1, 'O', -1 },
+    { 2150, 1, 'r', -1 },
+    { 2151, 1, 'p', -1 },
+    { 2152, 1, 'c', -1 },
+    { 2153, 1, 'a', -1 },
+    { 2154, 1, 'G', 440 },
+    { 2155, 1, 'c', -1 },
+    { 2156, 1, 'n', -1 },
+    { 2157, 1, 'r', -1 },
+    { 2158, 1, 'a', -1 },
+    { 2159, 1, 'e', -1 },
+    { 2160, 1, 'y', -1 },
+    { 0, 0, ';', 449 },
+    { 2161, 1, 'v', -1 },
+    { 2162, 1, 'r', -1 },
+    { 2163, 1, 'o', -1 },
+    { 2164, 1, 'g', -1 },
+    { 2165, 1, 'p', -1 },
+    { 2166, 1, 'u', -1 },
+    { 2167, 1, 'i', -1 },
+    { 2168, 1, 'c', -1 },
+    { 2169, 1, 'h', -1 },
+    { 2170, 1, 'l', -1 },
+    { 2171, 1, 'C', -1 },
+    { 2172, 1, 'c', -1 },
+    { 2173, 1, 'F', -1 },
+    { 2174, 1, 'c', -1 },
+    { 0, 0, ';', 488 },
+    { 2175, 1, 'a', -1 },
+    { 2176, 1, 'e', -1 },
+    { 2177, 1, 'i', -1 },
+    { 2178, 1, 'y', -1 },
+    { 2179, 1, 'r', -1 },
+    { 2180, 1, 'o', -1 },
+    { 2181, 1, 'g', -1 },
+    { 2182, 1, 'a', -1 },
+    { 2183, 1, 'p', -1 },
+    { 2184, 1, 'r', -1 },
+    { 2185, 1, 'u', -1 },
+    { 2186, 1, 'c', -1 },
+    { 2187, 1, 'a', -1 },
+    { 2188, 2, 'b', -1 },
+    { 2190, 2, 'c', -1 },
+    { 2192, 1, 'm', -1 },
+    { 2193, 3, 'p', -1 },
+    { 2196, 1, 'O', -1 },
+    { 2197, 1, 'A', -1 },
+    { 2198, 1, 'H', -1 },
+    { 2199, 1, 'c', -1 },
+    { 2200, 1, 'b', -1 },
+    { 2201, 1, 'u', -1 },
+    { 2202, 1, 'a', -1 },
+    { 2203, 1, 'e', -1 },
+    { 2204, 1, 'y', -1 },
+    { 2205, 1, 'r', -1 },
+    { 2206, 2, 'e', -1 },
+    { 2208, 2, 'i', -1 },
+    { 2210, 1, 'l', -1 },
+    { 2211, 1, 'p', -1 },
+    { 2212, 1, 'i', -1 },
+    { 2213, 1, 'c', -1 },
+    { 2214, 1, 't', -1 },
+    { 2215, 1, 'c', -1 },
+    { 2216, 1, 'r', -1 },
+    { 2217, 2, 'r', -1 },
+    { 2219, 1, 'i', -1 },
+    { 2220, 1, 'y', -1 },
+    { 2221, 1, 'b', -1 },
+    { 2222, 1, 'r', -1 },
+    { 2223, 1, 'r', -1 },
+    { 2224, 1, 'a', -1 },
+    { 2225, 1, 'd', -1 },
+    { 2226, 1, 'i', -1 },
+    { 2227, 1, 'g', -1 },
+    { 2228, 1, 'p', -1 },
+    { 2229, 1, 'A', -1 },
+    { 2230, 1, 'D', -1 },
+    { 2231, 1, 'E', -1 },
+    { 2232, 1, 'T', -1 },
+    { 2233, 1, 'a', -1 },
+    { 2234, 1, 'd', -1 },
+    { 2235, 1, 'p', -1 },
+    { 2236, 1, 's', -1 },
+    { 2237, 1, 'i', -1 },
+    { 2238, 1, 'c', -1 },
+    { 2239, 1, 'i', -1 },
+    { 2240, 1, 'm', -1 },
+    { 2241, 1, 'a', -1 },
+    { 2242, 1, 'a', -1 },
+    { 2243, 1, 'y', -1 },
+    { 2244, 1, 'a', -1 },
+    { 2245, 1, 'e', -1 },
+    { 2246, 3, 'r', -1 },
+    { 2249, 1, 'r', -1 },
+    { 2250, 1, 'p', -1 },
+    { 2251, 1, 'c', -1 },
+    { 2252, 1, 'd', -1 },
+    { 2253, 1, 'i', -1 },
+    { 2254, 1, 'd', -1 },
+    { 2255, 1, 'r', -1 },
+    { 2256, 1, 'p', -1 },
+    { 2257, 1, 'c', -1 },
+    { 2258, 1, 'r', -1 },
+    { 0, 0, ';', 610 },
+    { 2259, 1, 'p', -1 },
+    { 2260, 1, 'c', -1 },
+    { 2261, 1, 'c', -1 },
+    { 2262, 1, 'c', -1 },
+    { 2263, 1, 'c', -1 },
+    { 2264, 1, 'c', -1 },
+    { 2265, 1, 'i', -1 },
+    { 2266, 1, 'y', -1 },
+    { 2267, 1, 'r', -1 },
+    { 2268, 1, 'p', -1 },
+    { 2269, 1, 'c', -1 },
+    { 2270, 1, 'm', -1 },
+    { 2271, 1, 'c', -1 },
+    { 2272, 1, 'c', -1 },
+    { 2273, 1, 'a', -1 },
+    { 2274, 1, 'y', -1 },
+    { 2275, 1, 'o', -1 },
+    { 2276, 1, 'r', -1 },
+    { 2277, 1, 't', -1 },
+    { 2278, 1, 'r', -1 },
+    { 2279, 1, 'p', -1 },
+    { 2280, 1, 'c', -1 },
+    { 2281, 1, 'c', -1 },
+    { 2282, 1, 'r', -1 },
+    { 0, 0, ';', 637 },
+    { 2283, 1, 'E', -1 },
+    { 2284, 1, 'd', -1 },
+    { 2285, 1, 'i', -1 },
+    { 2286, 1, 'u', -1 },
+    { 2287, 1, 'y', -1 },
+    { 2288, 1, 'l', -1 },
+    { 0, 0, ';', 647 },
+    { 2289, 1, 'r', -1 },
+    { 2290, 1, 'r', -1 },
+    { 2291, 2, 'e', -1 },
+    { 2293, 1, 'p', -1 },
+    { 2294, 2, 'a', -1 },
+    { 2296, 1, 'p', 656 },
+    { 2297, 5, 'd', -1 },
+    { 2302, 7, 'g', -1 },
+    { 2309, 1, 'g', -1 },
+    { 2310, 1, 'p', -1 },
+    { 0, 0, ';', 683 },
+    { 2311, 1, 'E', -1 },
+    { 2312, 1, 'a', -1 },
+    { 2313, 1, 'e', -1 },
+    { 2314, 1, 'i', -1 },
+    { 2315, 1, 'o', -1 },
+    { 2316, 1, 'p', -1 },
+    { 2317, 1, 'i', -1 },
+    { 2318, 1, 'c', -1 },
+    { 2319, 1, 't', -1 },
+    { 2320, 1, 'y', -1 },
+    { 2321, 1, 'i', -1 },
+    { 2322, 1, 'm', -1 },
+    { 2323, 1, 'c', -1 },
+    { 2324, 1, 'i', -1 },
+    { 2325, 1, 'o', -1 },
+    { 2326, 1, 'c', -1 },
+    { 2327, 2, 'r', -1 },
+    { 2329, 1, 'r', -1 },
+    { 2330, 1, 'o', -1 },
+    { 2331, 1, 'y', -1 },
+    { 2332, 1, 'q', -1 },
+    { 2333, 1, 'c', -1 },
+    { 2334, 1, 'm', -1 },
+    { 2335, 1, 'p', -1 },
+    { 2336, 1, 'r', -1 },
+    { 2337, 3, 't', -1 },
+    { 2340, 1, 'r', -1 },
+    { 2341, 7, 'g', -1 },
+    { 2348, 1, 'a', -1 },
+    { 2349, 2, 'a', -1 },
+    { 2351, 2, 'k', -1 },
+    { 2353, 1, 'o', -1 },
+    { 2354, 2, 'e', -1 },
+    { 2356, 1, 'o', -1 },
+    { 2357, 1, 'p', -1 },
+    { 2358, 2, 't', -1 },
+    { 2360, 1, 'w', -1 },
+    { 2361, 12, 'x', -1 },
+    { 2373, 1, 'r', -1 },
+    { 2374, 1, 'e', -1 },
+    { 2375, 1, 'v', -1 },
+    { 2376, 1, 'c', -1 },
+    { 2377, 1, 'e', -1 },
+    { 2378, 1, 'i', -1 },
+    { 2379, 1, 'o', -1 },
+    { 2380, 1, 'l', -1 },
+    { 2381, 1, 'm', -1 },
+    { 2382, 1, 'c', -1 },
+    { 2383, 6, 'p', -1 },
+    { 2389, 2, 'r', -1 },
+    { 2391, 2, 'a', -1 },
+    { 2393, 1, 'e', -1 },
+    { 2394, 1, 'i', -1 },
+    { 2395, 1, 'u', -1 },
+    { 2396, 1, 'o', -1 },
+    { 2397, 1, 'd', -1 },
+    { 2398, 1, 'm', -1 },
+    { 2399, 1, 'n', -1 },
+    { 2400, 1, 'r', -1 },
+    { 2401, 1, 'c', -1 },
+    { 2402, 1, 'e', -1 },
+    { 2403, 1, 'i', -1 },
+    { 2404, 7, 'r', -1 },
+    { 2411, 1, 'u', -1 },
+    { 2412, 1, 'l', -1 },
+    { 2413, 2, 'm', -1 },
+    { 2415, 2, 'n', -1 },
+    { 2417, 3, 'p', -1 },
+    { 2420, 1, 'a', -1 },
+    { 2421, 1, 'o', -1 },
+    { 2422, 1, 'c', -1 },
+    { 2423, 2, 'u', -1 },
+    { 2425, 1, 'd', -1 },
+    { 2426, 1, 'd', -1 },
+    { 2427, 2, 'e', -1 },
+    { 2429, 1, 'l', -1 },
+    { 2430, 6, 'p', -1 },
+    { 2436, 4, 'r', -1 },
+    { 2440, 1, 'v', -1 },
+    { 2441, 1, 'w', -1 },
+    { 2442, 1, 'c', -1 },
+    { 2443, 1, 'i', -1 },
+    { 2444, 1, 'l', -1 },
+    { 2445, 1, 'r', -1 },
+    { 2446, 1, 'a', -1 },
+    { 2447, 1, 'g', -1 },
+    { 2448, 1, 'l', -1 },
+    { 2449, 1, 'r', -1 },
+    { 2450, 1, 's', -1 },
+    { 2451, 1, 'k', -1 },
+    { 2452, 1, 'l', -1 },
+    { 2453, 1, 'a', -1 },
+    { 2454, 1, 'y', -1 },
+    { 0, 0, ';', 929 },
+    { 2455, 2, 'a', -1 },
+    { 2457, 1, 'o', -1 },
+    { 2458, 1, 'g', 933 },
+    { 2459, 1, 'l', -1 },
+    { 2460, 1, 'm', -1 },
+    { 2461, 1, 'i', -1 },
+    { 2462, 1, 'r', -1 },
+    { 2463, 1, 'a', -1 },
+    { 2464, 1, 'a', -1 },
+    { 2465, 1, 'e', -1 },
+    { 2466, 1, 'g', -1 },
+    { 2467, 1, 's', -1 },
+    { 2468, 3, 'v', -1 },
+    { 2471, 1, 'c', -1 },
+    { 2472, 2, 'c', -1 },
+    { 2474, 1, 'l', -1 },
+    { 2475, 1, 'p', -1 },
+    { 2476, 5, 't', -1 },
+    { 2481, 1, 'u', -1 },
+    { 2482, 1, 'w', -1 },
+    { 2483, 1, 'b', -1 },
+    { 2484, 2, 'c', -1 },
+    { 2486, 2, 'c', -1 },
+    { 2488, 1, 'o', -1 },
+    { 2489, 1, 't', -1 },
+    { 2490, 1, 'd', -1 },
+    { 2491, 1, 'r', -1 },
+    { 2492, 1, 'a', -1 },
+    { 2493, 1, 'h', -1 },
+    { 2494, 1, 'a', -1 },
+    { 2495, 1, 'c', -1 },
+    { 2496, 1, 'i', -1 },
+    { 2497, 1, 'D', -1 },
+    { 2498, 1, 'o', -1 },
+    { 2499, 1, 'c', -1 },
+    { 2500, 1, 's', -1 },
+    { 2501, 1, 'a', -1 },
+    { 2502, 1, 'i', -1 },
+    { 2503, 1, 'o', -1 },
+    { 2504, 1, 'y', -1 },
+    { 2505, 1, 'o', -1 },
+    { 0, 0, ';', 996 },
+    { 2506, 1, 'D', -1 },
+    { 2507, 1, 'r', -1 },
+    { 0, 0, ';', 999 },
+    { 2508, 1, 'r', -1 },
+    { 2509, 2, 's', -1 },
+    { 0, 0, ';', 1004 },
+    { 2511, 1, 'i', -1 },
+    { 2512, 1, 'l', -1 },
+    { 2513, 2, 's', -1 },
+    { 2515, 1, 'a', -1 },
+    { 2516, 1, 'p', -1 },
+    { 2517, 1, 's', -1 },
+    { 2518, 1, 'g', -1 },
+    { 2519, 1, 's', -1 },
+    { 2520, 1, 'g', -1 },
+    { 2521, 1, 'p', -1 },
+    { 2522, 1, 'a', -1 },
+    { 2523, 1, 'l', -1 },
+    { 2524, 1, 's', -1 },
+    { 2525, 2, 'c', -1 },
+    { 2527, 2, 's', -1 },
+    { 2529, 3, 'u', -1 },
+    { 2532, 1, 'v', -1 },
+    { 2533, 1, 'D', -1 },
+    { 2534, 1, 'a', -1 },
+    { 2535, 1, 'c', -1 },
+    { 2536, 1, 'd', -1 },
+    { 2537, 1, 'i', -1 },
+    { 2538, 1, 'a', -1 },
+    { 2539, 1, 'h', 1042 },
+    { 2540, 1, 'm', -1 },
+    { 2541, 1, 'r', -1 },
+    { 2542, 1, 'c', -1 },
+    { 2543, 1, 'i', -1 },
+    { 2544, 2, 'p', -1 },
+    { 2546, 1, 'l', -1 },
+    { 2547, 1, 'y', -1 },
+    { 2548, 1, 'm', -1 },
+    { 2549, 1, 'i', -1 },
+    { 2550, 2, 'l', -1 },
+    { 2552, 1, 'r', -1 },
+    { 2553, 1, 'l', -1 },
+    { 2554, 1, 'l', -1 },
+    { 2555, 1, 'a', -1 },
+    { 2556, 1, 'l', -1 },
+    { 2557, 1, 't', -1 },
+    { 2558, 1, 'o', -1 },
+    { 2559, 1, 'p', -1 },
+    { 2560, 2, 'r', -1 },
+    { 2562, 1, 'a', -1 },
+    { 2563, 2, 'a', -1 },
+    { 2565, 1, 'o', -1 },
+    { 2566, 1, 'c', -1 },
+    { 0, 0, ';', 1090 },
+    { 2567, 1, 'l', -1 },
+    { 2568, 1, 'c', -1 },
+    { 2569, 1, 'm', -1 },
+    { 2570, 1, 'p', -1 },
+    { 2571, 1, 'r', -1 },
+    { 2572, 1, 'i', -1 },
+    { 2573, 1, 'y', -1 },
+    { 2574, 1, 'o', -1 },
+    { 0, 0, ';', 1100 },
+    { 2575, 1, 'l', -1 },
+    { 2576, 3, 'q', -1 },
+    { 2579, 4, 's', -1 },
+    { 2583, 1, 'r', -1 },
+    { 0, 0, ';', 1113 },
+    { 2584, 1, 'g', -1 },
+    { 2585, 1, 'm', -1 },
+    { 2586, 1, 'c', -1 },
+    { 0, 0, ';', 1117 },
+    { 2587, 1, 'E', -1 },
+    { 2588, 1, 'a', -1 },
+    { 2589, 1, 'j', -1 },
+    { 2590, 1, 'E', -1 },
+    { 2591, 1, 'a', -1 },
+    { 2592, 2, 'e', -1 },
+    { 2594, 1, 's', -1 },
+    { 2595, 1, 'p', -1 },
+    { 2596, 1, 'a', -1 },
+    { 2597, 1, 'c', -1 },
+    { 2598, 1, 'i', -1 },
+    { 0, 0, ';', 1135 },
+    { 2599, 2, 'c', -1 },
+    { 2601, 1, 'd', -1 },
+    { 2602, 1, 'l', -1 },
+    { 2603, 1, 'q', -1 },
+    { 2604, 5, 'r', -1 },
+    { 2609, 1, 'e', -1 },
+    { 2610, 1, 'n', -1 },
+    { 2611, 1, 'r', -1 },
+    { 2612, 1, 'i', -1 },
+    { 2613, 1, 'l', -1 },
+    { 2614, 1, 'm', -1 },
+    { 2615, 2, 'r', -1 },
+    { 2617, 1, 'a', -1 },
+    { 2618, 1, 'i', -1 },
+    { 2619, 1, 'a', -1 },
+    { 2620, 1, 'l', -1 },
+    { 2621, 1, 'r', -1 },
+    { 2622, 1, 'r', -1 },
+    { 2623, 2, 's', -1 },
+    { 2625, 1, 'a', -1 },
+    { 2626, 1, 'm', -1 },
+    { 2627, 1, 'o', -1 },
+    { 2628, 1, 'p', -1 },
+    { 2629, 1, 'r', -1 },
+    { 2630, 1, 'c', -1 },
+    { 2631, 1, 'l', -1 },
+    { 2632, 1, 't', -1 },
+    { 2633, 1, 'b', -1 },
+    { 2634, 1, 'p', -1 },
+    { 2635, 1, 'c', -1 },
+    { 0, 0, ';', 1180 },
+    { 2636, 1, 'i', -1 },
+    { 2637, 1, 'y', -1 },
+    { 2638, 1, 'c', -1 },
+    { 2639, 1, 'x', -1 },
+    { 2640, 1, 'f', -1 },
+    { 2641, 1, 'r', -1 },
+    { 2642, 1, 'r', -1 },
+    { 0, 0, ';', 1191 },
+    { 2643, 2, 'i', -1 },
+    { 2645, 1, 'n', -1 },
+    { 2646, 1, 'o', -1 },
+    { 2647, 1, 'l', -1 },
+    { 2648, 3, 'a', -1 },
+    { 2651, 1, 'o', -1 },
+    { 2652, 1, 'p', -1 },
+    { 0, 0, ';', 1204 },
+    { 2653, 1, 'c', -1 },
+    { 2654, 1, 'f', -1 },
+    { 2655, 1, 'o', -1 },
+    { 2656, 5, 't', -1 },
+    { 2661, 1, 'c', -1 },
+    { 2662, 1, 'g', -1 },
+    { 2663, 1, 'p', -1 },
+    { 2664, 1, 't', -1 },
+    { 2665, 1, 'r', -1 },
+    { 2666, 1, 'u', -1 },
+    { 2667, 1, 'c', -1 },
+    { 2668, 1, 'i', -1 },
+    { 0, 0, ';', 1229 },
+    { 2669, 1, 'i', -1 },
+    { 2670, 1, 'k', -1 },
+    { 2671, 1, 'm', -1 },
+    { 2672, 1, 'i', -1 },
+    { 2673, 1, 'y', -1 },
+    { 2674, 1, 'r', -1 },
+    { 2675, 1, 'a', -1 },
+    { 2676, 1, 'p', -1 },
+    { 2677, 1, 'c', -1 },
+    { 2678, 1, 'e', -1 },
+    { 2679, 1, 'k', -1 },
+    { 2680, 1, 'p', -1 },
+    { 2681, 1, 'e', -1 },
+    { 2682, 1, 'y', -1 },
+    { 2683, 1, 'r', -1 },
+    { 2684, 1, 'r', -1 },
+    { 2685, 1, 'c', -1 },
+    { 2686, 1, 'c', -1 },
+    { 2687, 1, 'p', -1 },
+    { 2688, 1, 'c', -1 },
+    { 2689, 1, 'a', -1 },
+    { 2690, 1, 'r', -1 },
+    { 2691, 1, 't', -1 },
+    { 2692, 1, 'a', -1 },
+    { 0, 0, ';', 1256 },
+    { 2693, 1, 'g', -1 },
+    { 2694, 1, 'a', -1 },
+    { 2695, 1, 'c', -1 },
+    { 2696, 1, 'e', -1 },
+    { 2697, 1, 'g', -1 },
+    { 2698, 1, 'm', -1 },
+    { 2699, 1, 'n', -1 },
+    { 2700, 1, 'p', -1 },
+    { 2701, 1, 'q', -1 },
+    { 2702, 1, 'r', -1 },
+    { 2703, 3, 't', -1 },
+    { 2706, 1, 'a', -1 },
+    { 2707, 1, 'b', -1 },
+    { 2708, 2, 'r', -1 },
+    { 2710, 1, 'a', -1 },
+    { 2711, 2, 'e', -1 },
+    { 2713, 1, 'u', -1 },
+    { 2714, 1, 'y', -1 },
+    { 2715, 1, 'c', -1 },
+    { 2716, 1, 'q', -1 },
+    { 2717, 2, 'r', -1 },
+    { 2719, 1, 's', -1 },
+    { 0, 0, ';', 1300 },
+    { 2720, 1, 'f', -1 },
+    { 2721, 1, 'g', -1 },
+    { 2722, 3, 'q', -1 },
+    { 2725, 5, 's', -1 },
+    { 2730, 1, 'i', -1 },
+    { 2731, 1, 'l', -1 },
+    { 2732, 1, 'r', -1 },
+    { 0, 0, ';', 1331 },
+    { 2733, 1, 'E', -1 },
+    { 2734, 1, 'a', -1 },
+    { 2735, 1, 'b', -1 },
+    { 2736, 1, 'c', -1 },
+    { 0, 0, ';', 1338 },
+    { 2737, 1, 'a', -1 },
+    { 2738, 1, 'c', -1 },
+    { 2739, 1, 'h', -1 },
+    { 2740, 1, 't', -1 },
+    { 2741, 1, 'i', -1 },
+    { 2742, 1, 'o', -1 },
+    { 2743, 1, 'E', -1 },
+    { 2744, 1, 'a', -1 },
+    { 2745, 2, 'e', -1 },
+    { 2747, 1, 's', -1 },
+    { 2748, 2, 'a', -1 },
+    { 2750, 1, 'b', -1 },
+    { 2751, 1, 'n', -1 },
+    { 2752, 1, 'o', -1 },
+    { 2753, 3, 'p', -1 },
+    { 2756, 1, 't', -1 },
+    { 2757, 2, 'w', -1 },
+    { 2759, 3, 'z', -1 },
+    { 2762, 1, 'a', -1 },
+    { 2763, 1, 'a', -1 },
+    { 2764, 1, 'c', -1 },
+    { 2765, 1, 'h', -1 },
+    { 2766, 1, 'm', -1 },
+    { 2767, 1, 't', -1 },
+    { 2768, 1, 'a', -1 },
+    { 2769, 1, 'c', -1 },
+    { 2770, 1, 'h', -1 },
+    { 2771, 1, 'i', -1 },
+    { 2772, 2, 'q', -1 },
+    { 2774, 1, 't', -1 },
+    { 0, 0, ';', 1390 },
+    { 2775, 2, 'c', -1 },
+    { 2777, 1, 'd', -1 },
+    { 2778, 1, 'h', -1 },
+    { 2779, 1, 'i', -1 },
+    { 2780, 1, 'l', -1 },
+    { 2781, 1, 'q', -1 },
+    { 2782, 2, 'r', -1 },
+    { 2784, 2, 'r', -1 },
+    { 2786, 1, 'e', -1 },
+    { 2787, 1, 'n', -1 },
+    { 2788, 1, 'D', -1 },
+    { 2789, 1, 'c', -1 },
+    { 2790, 2, 'l', -1 },
+    { 2792, 2, 'p', -1 },
+    { 2794, 1, 'r', -1 },
+    { 2795, 1, 'o', -1 },
+    { 2796, 1, 'y', -1 },
+    { 2797, 1, 'a', -1 },
+    { 2798, 1, 'a', -1 },
+    { 2799, 1, 'r', -1 },
+    { 2800, 1, 'o', -1 },
+    { 2801, 1, 'c', -1 },
+    { 2802, 4, 'd', -1 },
+    { 2806, 1, 'n', -1 },
+    { 2807, 1, 'c', -1 },
+    { 2808, 1, 'd', -1 },
+    { 2809, 1, 'p', -1 },
+    { 2810, 1, 'd', -1 },
+    { 2811, 1, 'p', -1 },
+    { 0, 0, ';', 1440 },
+    { 2812, 1, 'c', -1 },
+    { 2813, 1, 't', -1 },
+    { 0, 0, ';', 1443 },
+    { 2814, 1, 'l', -1 },
+    { 2815, 1, 'm', -1 },
+    { 2816, 1, 'g', -1 },
+    { 2817, 2, 't', -1 },
+    { 2819, 1, 'e', -1 },
+    { 2820, 1, 'l', -1 },
+    { 2821, 2, 't', -1 },
+    { 2823, 1, 'i', -1 },
+    { 2824, 1, 'D', -1 },
+    { 2825, 1, 'd', -1 },
+    { 2826, 1, 'b', -1 },
+    { 2827, 1, 'c', -1 },
+    { 2828, 1, 'n', -1 },
+    { 2829, 5, 'p', -1 },
+    { 2834, 1, 't', -1 },
+    { 2835, 1, 's', -1 },
+    { 2836, 1, 'u', -1 },
+    { 2837, 2, 'a', -1 },
+    { 2839, 1, 'e', -1 },
+    { 2840, 1, 'o', -1 },
+    { 2841, 1, 'u', -1 },
+    { 2842, 1, 'y', -1 },
+    { 2843, 1, 'a', -1 },
+    { 0, 0, ';', 1480 },
+    { 2844, 1, 'A', -1 },
+    { 2845, 1, 'a', -1 },
+    { 2846, 1, 'd', -1 },
+    { 2847, 1, 'q', -1 },
+    { 2848, 2, 's', -1 },
+    { 2850, 1, 'x', -1 },
+    { 2851, 1, 'r', -1 },
+    { 2852, 1, 'E', -1 },
+    { 2853, 3, 'e', -1 },
+    { 2856, 1, 's', -1 },
+    { 2857, 2, 't', -1 },
+    { 2859, 1, 'A', -1 },
+    { 2860, 1, 'a', -1 },
+    { 2861, 1, 'p', -1 },
+    { 0, 0, ';', 1504 },
+    { 2862, 2, 's', -1 },
+    { 2864, 1, 'v', -1 },
+    { 2865, 1, 'c', -1 },
+    { 2866, 1, 'A', -1 },
+    { 2867, 1, 'E', -1 },
+    { 2868, 1, 'a', -1 },
+    { 2869, 1, 'd', -1 },
+    { 2870, 4, 'e', -1 },
+    { 2874, 1, 's', -1 },
+    { 2875, 2, 't', -1 },
+    { 2877, 1, 'i', -1 },
+    { 2878, 1, 'p', -1 },
+    { 2879, 3, 't', 1527 },
+    { 2882, 1, 'a', -1 },
+    { 2883, 1, 'o', -1 },
+    { 2884, 3, 'r', -1 },
+    { 2887, 1, 'A', -1 },
+    { 2888, 1, 'a', -1 },
+    { 2889, 1, 'i', -1 },
+    { 2890, 1, 't', -1 },
+    { 2891, 4, 'c', -1 },
+    { 2895, 1, 'h', -1 },
+    { 2896, 1, 'i', -1 },
+    { 2897, 1, 'm', -1 },
+    { 2898, 1, 'p', -1 },
+    { 2899, 1, 'q', -1 },
+    { 2900, 3, 'u', -1 },
+    { 2903, 1, 'g', -1 },
+    { 2904, 1, 'i', -1 },
+    { 2905, 1, 'l', -1 },
+    { 2906, 1, 'r', -1 },
+    { 0, 0, ';', 1591 },
+    { 2907, 3, 'm', -1 },
+    { 2910, 1, 'D', -1 },
+    { 2911, 1, 'H', -1 },
+    { 2912, 1, 'a', -1 },
+    { 2913, 1, 'd', -1 },
+    { 2914, 2, 'g', -1 },
+    { 2916, 1, 'i', -1 },
+    { 2917, 3, 'l', -1 },
+    { 2920, 2, 'r', -1 },
+    { 2922, 1, 's', -1 },
+    { 2923, 1, 'A', -1 },
+    { 2924, 1, 'a', -1 },
+    { 2925, 1, 'n', -1 },
+    { 0, 0, ';', 1614 },
+    { 2926, 1, 'c', -1 },
+    { 2927, 1, 's', -1 },
+    { 2928, 1, 'i', -1 },
+    { 2929, 1, 'y', -1 },
+    { 2930, 1, 'a', -1 },
+    { 2931, 1, 'b', -1 },
+    { 2932, 1, 'i', -1 },
+    { 2933, 1, 'o', -1 },
+    { 2934, 1, 's', -1 },
+    { 2935, 1, 'l', -1 },
+    { 2936, 1, 'c', -1 },
+    { 2937, 1, 'r', -1 },
+    { 2938, 1, 'o', -1 },
+    { 2939, 1, 'r', -1 },
+    { 2940, 1, 't', -1 },
+    { 2941, 1, 'b', -1 },
+    { 2942, 1, 'm', -1 },
+    { 2943, 1, 'n', -1 },
+    { 2944, 1, 'a', -1 },
+    { 2945, 2, 'c', -1 },
+    { 2947, 1, 'i', -1 },
+    { 2948, 1, 't', -1 },
+    { 2949, 1, 'a', -1 },
+    { 2950, 1, 'e', -1 },
+    { 2951, 3, 'i', -1 },
+    { 2954, 1, 'p', -1 },
+    { 2955, 1, 'a', -1 },
+    { 2956, 1, 'e', -1 },
+    { 2957, 1, 'l', -1 },
+    { 0, 0, ';', 1651 },
+    { 2958, 1, 'a', -1 },
+    { 2959, 4, 'd', -1 },
+    { 2963, 1, 'i', -1 },
+    { 2964, 1, 'o', -1 },
+    { 2965, 1, 's', -1 },
+    { 2966, 1, 'v', -1 },
+    { 2967, 1, 'c', -1 },
+    { 2968, 1, 'l', -1 },
+    { 2969, 1, 'o', -1 },
+    { 2970, 2, 'i', -1 },
+    { 2972, 1, 'm', -1 },
+    { 2973, 1, 'b', -1 },
+    { 2974, 4, 'r', -1 },
+    { 2978, 1, 'y', -1 },
+    { 2979, 5, 'r', -1 },
+    { 2984, 1, 'r', -1 },
+    { 2985, 2, 'i', -1 },
+    { 2987, 1, 'm', -1 },
+    { 2988, 1, 'o', -1 },
+    { 0, 0, ';', 1693 },
+    { 2989, 1, 't', -1 },
+    { 2990, 1, 'v', -1 },
+    { 2991, 1, 'a', -1 },
+    { 2992, 1, 'u', -1 },
+    { 0, 0, ';', 1710 },
+    { 2993, 1, 'i', -1 },
+    { 2994, 1, 'p', -1 },
+    { 2995, 1, 'u', -1 },
+    { 0, 0, ';', 1715 },
+    { 2996, 1, 'E', -1 },
+    { 2997, 1, 'a', -1 },
+    { 2998, 1, 'c', -1 },
+    { 2999, 2, 'e', -1 },
+    { 3001, 1, 'i', -1 },
+    { 3002, 3, 'n', -1 },
+    { 3005, 3, 'o', -1 },
+    { 3008, 1, 's', -1 },
+    { 3009, 1, 'u', -1 },
+    { 3010, 1, 'c', -1 },
+    { 3011, 1, 'i', -1 },
+    { 3012, 1, 'n', -1 },
+    { 3013, 1, 'r', -1 },
+    { 3014, 1, 'n', -1 },
+    { 3015, 1, 'p', -1 },
+    { 3016, 1, 'r', -1 },
+    { 3017, 1, 'c', -1 },
+    { 3018, 1, 'a', -1 },
+    { 3019, 1, 'e', -1 },
+    { 3020, 1, 'o', -1 },
+    { 3021, 1, 'a', -1 },
+    { 3022, 1, 'r', -1 },
+    { 3023, 1, 't', -1 },
+    { 3024, 1, 'a', -1 },
+    { 3025, 1, 'a', -1 },
+    { 3026, 2, 'c', -1 },
+    { 3028, 1, 'd', -1 },
+    { 3029, 1, 'e', -1 },
+    { 3030, 1, 'n', -1 },
+    { 3031, 1, 'q', -1 },
+    { 3032, 1, 'r', -1 },
+    { 3033, 2, 't', -1 },
+    { 3035, 1, 'a', -1 },
+    { 3036, 1, 'b', -1 },
+    { 3037, 2, 'r', -1 },
+    { 3039, 1, 'a', -1 },
+    { 3040, 2, 'e', -1 },
+    { 3042, 1, 'u', -1 },
+    { 3043, 1, 'y', -1 },
+    { 3044, 1, 'c', -1 },
+    { 3045, 1, 'l', -1 },
+    { 3046, 1, 'q', -1 },
+    { 3047, 1, 's', -1 },
+    { 3048, 1, 'a', -1 },
+    { 3049, 1, 'c', -1 },
+    { 3050, 1, 'g', 1807 },
+    { 3051, 1, 'i', -1 },
+    { 3052, 1, 'l', -1 },
+    { 3053, 1, 'r', -1 },
+    { 3054, 1, 'a', -1 },
+    { 3055, 2, 'o', -1 },
+    { 3057, 1, 'g', -1 },
+    { 3058, 1, 'n', -1 },
+    { 3059, 1, 's', -1 },
+    { 3060, 1, 'a', -1 },
+    { 3061, 1, 'h', -1 },
+    { 3062, 1, 'm', -1 },
+    { 3063, 1, 'o', -1 },
+    { 3064, 1, 'm', -1 },
+    { 3065, 2, 'a', -1 },
+    { 3067, 1, 'b', -1 },
+    { 3068, 3, 'p', -1 },
+    { 3071, 1, 't', -1 },
+    { 3072, 1, 'a', -1 },
+    { 3073, 1, 'p', -1 },
+    { 3074, 1, 'a', -1 },
+    { 3075, 1, 'a', -1 },
+    { 3076, 1, 'c', -1 },
+    { 3077, 1, 'h', -1 },
+    { 3078, 2, 'q', -1 },
+    { 3080, 1, 'h', -1 },
+    { 3081, 1, 'i', -1 },
+    { 3082, 1, 'r', -1 },
+    { 3083, 1, 'l', -1 },
+    { 0, 0, ';', 1858 },
+    { 3084, 1, 'c', -1 },
+    { 3085, 1, 'q', -1 },
+    { 0, 0, ';', 1861 },
+    { 3086, 1, 'E', -1 },
+    { 3087, 2, 'a', -1 },
+    { 3089, 1, 'c', -1 },
+    { 3090, 2, 'e', -1 },
+    { 3092, 1, 'i', -1 },
+    { 3093, 3, 'n', -1 },
+    { 3096, 1, 'p', -1 },
+    { 3097, 1, 's', -1 },
+    { 3098, 1, 'y', -1 },
+    { 3099, 1, 'o', -1 },
+    { 3100, 1, 'A', -1 },
+    { 3101, 1, 'a', -1 },
+    { 3102, 1, 'c', -1 },
+    { 3103, 1, 'm', -1 },
+    { 3104, 1, 's', -1 },
+    { 3105, 1, 't', -1 },
+    { 3106, 1, 'x', -1 },
+    { 3107, 2, 'r', -1 },
+    { 3109, 1, 'a', -1 },
+    { 3110, 2, 'c', -1 },
+    { 3112, 1, 'o', -1 },
+    { 3113, 1, 'y', 1896 },
+    { 3114, 1, 'g', -1 },
+    { 3115, 8, 'm', -1 },
+    { 3123, 1, 'a', -1 },
+    { 3124, 2, 'a', -1 },
+    { 3126, 1, 'e', -1 },
+    { 3127, 2, 'i', -1 },
+    { 3129, 2, 't', -1 },
+    { 3131, 1, 'f', -1 },
+    { 3132, 2, 'l', -1 },
+    { 3134, 1, 'p', -1 },
+    { 3135, 2, 'a', -1 },
+    { 3137, 2, 'c', -1 },
+    { 3139, 1, 's', -1 },
+    { 3140, 3, 'u', -1 },
+    { 3143, 1, 'a', -1 },
+    { 3144, 1, 'c', -1 },
+    { 3145, 1, 'e', -1 },
+    { 3146, 1, 'm', -1 },
+    { 3147, 1, 't', -1 },
+    { 3148, 1, 'a', -1 },
+    { 3149, 2, 'r', -1 },
+    { 3151, 9, 'b', -1 },
+    { 3160, 1, 'c', -1 },
+    { 3161, 1, 'm', -1 },
+    { 3162, 1, 'n', -1 },
+    { 3163, 13, 'p', -1 },
+    { 3176, 1, 'A', -1 },
+    { 3177, 1, 'a', -1 },
+    { 3178, 1, 'n', -1 },
+    { 3179, 1, 'l', -1 },
+    { 3180, 1, 'r', -1 },
+    { 3181, 1, 'u', -1 },
+    { 3182, 1, 'r', -1 },
+    { 3183, 1, 'a', -1 },
+    { 3184, 1, 'e', -1 },
+    { 3185, 1, 'y', -1 },
+    { 3186, 1, 'o', -1 },
+    { 3187, 1, 'l', -1 },
+    { 3188, 1, 'r', -1 },
+    { 3189, 2, 'e', -1 },
+    { 3191, 2, 'i', -1 },
+    { 3193, 2, 'k', -1 },
+    { 3195, 1, 'o', -1 },
+    { 3196, 1, 'l', -1 },
+    { 3197, 1, 'm', -1 },
+    { 3198, 1, 'n', -1 },
+    { 3199, 1, 'e', -1 },
+    { 3200, 4, 'p', -1 },
+    { 3204, 1, 's', -1 },
+    { 3205, 1, 'r', -1 },
+    { 3206, 1, 'a', -1 },
+    { 3207, 7, 'i', -1 },
+    { 3214, 1, 'p', -1 },
+    { 3215, 2, 'c', -1 },
+    { 3217, 1, 'h', -1 },
+    { 3218, 1, 't', -1 },
+    { 3219, 1, 'i', -1 },
+    { 3220, 1, 'o', -1 },
+    { 3221, 1, 'r', -1 },
+    { 3222, 1, 'a', -1 },
+    { 3223, 1, 'c', -1 },
+    { 3224, 1, 'r', -1 },
+    { 3225, 2, 'r', -1 },
+    { 3227, 1, 'i', -1 },
+    { 3228, 1, 'y', -1 },
+    { 3229, 1, 'a', -1 },
+    { 3230, 1, 'b', -1 },
+    { 3231, 1, 'h', -1 },
+    { 3232, 1, 'i', -1 },
+    { 3233, 1, 'r', -1 },
+    { 3234, 1, 'r', -1 },
+    { 3235, 1, 'a', -1 },
+    { 3236, 1, 'b', -1 },
+    { 3237, 2, 'c', -1 },
+    { 3239, 1, 't', -1 },
+    { 3240, 1, 'a', -1 },
+    { 3241, 1, 'l', 2100 },
+    { 3242, 1, 'g', -1 },
+    { 3243, 1, 'p', -1 },
+    { 3244, 1, 'a', -1 },
+    { 3245, 1, 'd', -1 },
+    { 3246, 1, 'h', -1 },
+    { 3247, 1, 'l', -1 },
+    { 3248, 1, 's', -1 },
+    { 3249, 1, 'u', -1 },
+    { 3250, 2, 'c', -1 },
+    { 3252, 1, 'i', -1 },
+    { 3253, 1, 't', -1 },
+    { 3254, 1, 'c', -1 },
+    { 3255, 1, 'd', -1 },
+    { 3256, 1, 'i', -1 },
+    { 3257, 1, 'r', -1 },
+    { 3258, 1, 'a', -1 },
+    { 3259, 1, 'm', -1 },
+    { 3260, 1, 'a', -1 },
+    { 3261, 1, 'r', -1 },
+    { 3262, 1, 'a', -1 },
+    { 3263, 1, 'a', -1 },
+    { 3264, 1, 'n', -1 },
+    { 3265, 7, 'r', -1 },
+    { 3272, 1, 'y', -1 },
+    { 3273, 1, 'a', -1 },
+    { 3274, 3, 'e', -1 },
+    { 3277, 1, 'l', -1 },
+    { 3278, 2, 'r', -1 },
+    { 3280, 1, 'r', -1 },
+    { 3281, 1, 't', -1 },
+    { 3282, 1, 's', -1 },
+    { 3283, 1, 'p', -1 },
+    { 3284, 1, 'r', -1 },
+    { 3285, 1, 't', -1 },
+    { 3286, 1, 'c', -1 },
+    { 3287, 2, 'u', -1 },
+    { 3289, 1, 'i', -1 },
+    { 3290, 1, 'i', -1 },
+    { 3291, 2, 'd', -1 },
+    { 3293, 1, 'i', -1 },
+    { 3294, 1, 'r', -1 },
+    { 3295, 1, 'p', -1 },
+    { 0, 0, ';', 2176 },
+    { 0, 0, ';', 2177 },
+    { 3296, 1, 'e', -1 },
+    { 3297, 1, 'c', -1 },
+    { 3298, 1, 'a', -1 },
+    { 3299, 1, 'i', -1 },
+    { 3300, 1, 'u', -1 },
+    { 3301, 1, 't', -1 },
+    { 3302, 1, 'r', -1 },
+    { 3303, 1, 'A', -1 },
+    { 3304, 1, 'a', -1 },
+    { 0, 0, ';', 2187 },
+    { 3305, 1, 'A', -1 },
+    { 3306, 1, 'a', -1 },
+    { 3307, 1, 'a', -1 },
+    { 3308, 1, 'i', -1 },
+    { 3309, 1, 'd', -1 },
+    { 3310, 2, 'p', -1 },
+    { 3312, 1, 't', -1 },
+    { 3313, 1, 'A', -1 },
+    { 3314, 1, 'a', -1 },
+    { 3315, 1, 'c', -1 },
+    { 3316, 1, 'q', -1 },
+    { 3317, 1, 'p', -1 },
+    { 3318, 1, 't', -1 },
+    { 3319, 1, 'e', -1 },
+    { 3320, 1, 'e', -1 },
+    { 3321, 2, 'c', -1 },
+    { 3323, 1, 'i', -1 },
+    { 3324, 1, 'y', -1 },
+    { 3325, 1, 'n', 2209 },
+    { 3326, 1, 'r', -1 },
+    { 3327, 1, 'c', -1 },
+    { 3328, 1, 'p', -1 },
+    { 3329, 1, 'c', -1 },
+    { 3330, 1, 'c', -1 },
+    { 3331, 1, 'm', -1 },
+    { 3332, 1, 'c', -1 },
+    { 3333, 1, 'a', -1 },
+    { 3334, 1, 'y', -1 },
+    { 3335, 1, 'o', -1 },
+    { 3336, 1, 'e', -1 },
+    { 3337, 1, 't', -1 },
+    { 3338, 1, 'r', -1 },
+    { 3339, 1, 'c', -1 },
+    { 3340, 1, 'g', -1 },
+    { 3341, 1, 'p', -1 },
+    { 3342, 1, 'c', -1 },
+    { 3343, 1, 'j', -1 },
+    { 3344, 1, 'n', -1 },
+    { 3345, 1, 'i', -1 },
+    { 0, 0, ';', 3 },
+    { 3346, 1, 'u', -1 },
+    { 3347, 1, 'e', -1 },
+    { 3348, 1, 'r', -1 },
+    { 0, 0, ';', 9 },
+    { 0, 0, ';', 10 },
+    { 3349, 1, 'a', -1 },
+    { 3350, 1, 'h', -1 },
+    { 3351, 1, 'c', -1 },
+    { 0, 0, ';', 15 },
+    { 3352, 1, 'o', -1 },
+    { 3353, 1, 'f', -1 },
+    { 3354, 1, 'l', -1 },
+    { 3355, 1, 'n', -1 },
+    { 3356, 1, 'r', -1 },
+    { 3357, 1, 'i', -1 },
+    { 3358, 1, 'l', -1 },
+    { 3359, 1, 'l', 25 },
+    { 3360, 1, 'k', -1 },
+    { 3361, 1, 'v', -1 },
+    { 3362, 1, 'w', -1 },
+    { 0, 0, ';', 30 },
+    { 3363, 1, 'a', -1 },
+    { 3364, 1, 'n', -1 },
+    { 3365, 1, 'a', -1 },
+    { 0, 0, ';', 34 },
+    { 3366, 1, 'f', -1 },
+    { 3367, 1, 'v', -1 },
+    { 3368, 1, 'r', -1 },
+    { 3369, 1, 'p', -1 },
+    { 3370, 1, 'y', -1 },
+    { 3371, 1, 'Y', 40 },
+    { 3372, 1, 'u', -1 },
+    { 0, 0, ';', 43 },
+    { 3373, 1, 'i', -1 },
+    { 3374, 1, 'l', -1 },
+    { 3375, 1, 'r', -1 },
+    { 3376, 1, 'd', -1 },
+    { 3377, 1, 'r', -1 },
+    { 3378, 1, 'n', -1 },
+    { 3379, 1, 't', -1 },
+    { 3380, 1, 'i', -1 },
+    { 3381, 1, 't', -1 },
+    { 0, 0, ';', 54 },
+    { 0, 0, ';', 55 },
+    { 3382, 1, 'c', -1 },
+    { 3383, 1, 'c', -1 },
+    { 3384, 1, 's', -1 },
+    { 3385, 1, 'o', -1 },
+    { 3386, 1, 'g', -1 },
+    { 3387, 1, 'i', -1 },
+    { 3388, 1, 't', -1 },
+    { 3389, 1, 'f', -1 },
+    { 3390, 1, 'r', -1 },
+    { 3391, 1, 'n', -1 },
+    { 3392, 1, 's', -1 },
+    { 3393, 1, 'r', -1 },
+    { 0, 0, ';', 73 },
+    { 3394, 1, 'C', -1 },
+    { 3395, 1, 't', -1 },
+    { 3396, 1, 'y', -1 },
+    { 3397, 1, 'y', -1 },
+    { 3398, 1, 'y', -1 },
+    { 3399, 1, 'g', -1 },
+    { 3400, 1, 'r', -1 },
+    { 3401, 1, 'h', -1 },
+    { 3402, 1, 'r', -1 },
+    { 0, 0, ';', 84 },
+    { 0, 0, ';', 85 },
+    { 3403, 1, 't', -1 },
+    { 0, 0, ';', 87 },
+    { 3404, 1, 'c', -1 },
+    { 3405, 1, 'm', -1 },
+    { 3406, 1, 'f', -1 },
+    { 3407, 1, 'f', -1 },
+    { 0, 0, ';', 96 },
+    { 3408, 1, 'D', -1 },
+    { 3409, 1, 'E', -1 },
+    { 3410, 1, 'b', -1 },
+    { 3411, 6, 'n', -1 },
+    { 3417, 1, 'r', -1 },
+    { 3418, 1, 'r', -1 },
+    { 0, 0, ';', 129 },
+    { 0, 0, ';', 131 },
+    { 3419, 1, 'u', -1 },
+    { 3420, 1, 'r', -1 },
+    { 3421, 1, 'r', -1 },
+    { 0, 0, ';', 137 },
+    { 3422, 1, 't', -1 },
+    { 0, 0, ';', 139 },
+    { 3423, 1, 'a', -1 },
+    { 3424, 1, 'm', -1 },
+    { 3425, 1, 'c', -1 },
+    { 3426, 1, 't', -1 },
+    { 3427, 1, 'o', -1 },
+    { 3428, 1, 'f', -1 },
+    { 3429, 1, 'i', -1 },
+    { 3430, 1, 'a', -1 },
+    { 3431, 1, 'i', -1 },
+    { 3432, 1, 'r', -1 },
+    { 3433, 1, 'm', -1 },
+    { 0, 0, ';', 154 },
+    { 3434, 1, 'l', 155 },
+    { 3435, 1, 's', -1 },
+    { 3436, 1, 'o', -1 },
+    { 0, 0, ';', 159 },
+    { 0, 0, ';', 160 },
+    { 3437, 1, 'l', -1 },
+    { 3438, 1, 'f', -1 },
+    { 3439, 1, 'A', -1 },
+    { 3440, 1, 'r', -1 },
+    { 3441, 1, 'r', -1 },
+    { 3442, 1, 'y', -1 },
+    { 3443, 1, 'm', -1 },
+    { 3444, 1, 'e', -1 },
+    { 3445, 1, 'd', -1 },
+    { 3446, 1, 'r', -1 },
+    { 0, 0, ';', 175 },
+    { 3447, 1, 't', -1 },
+    { 0, 0, ';', 177 },
+    { 3448, 1, 'f', -1 },
+    { 3449, 1, 'a', -1 },
+    { 3450, 1, 'r', -1 },
+    { 3451, 1, 'D', -1 },
+    { 3452, 1, 'e', -1 },
+    { 0, 0, ';', 191 },
+    { 3453, 1, 'r', -1 },
+    { 0, 0, ';', 193 },
+    { 3454, 1, 'b', -1 },
+    { 3455, 1, 'f', -1 },
+    { 3456, 1, 'i', -1 },
+    { 3457, 1, 'r', -1 },
+    { 3458, 1, 'r', -1 },
+    { 3459, 2, 'p', -1 },
+    { 3461, 1, 'y', -1 },
+    { 3462, 1, 'i', -1 },
+    { 3463, 1, 'y', -1 },
+    { 3464, 1, 'u', -1 },
+    { 3465, 1, 'r', -1 },
+    { 0, 0, ';', 208 },
+    { 3466, 1, 't', -1 },
+    { 0, 0, ';', 210 },
+    { 3467, 1, 'a', -1 },
+    { 3468, 1, 'c', -1 },
+    { 3469, 1, 'g', -1 },
+    { 3470, 1, 'l', -1 },
+    { 0, 0, ';', 217 },
+    { 3471, 2, 'e', -1 },
+    { 3473, 1, 'i', -1 },
+    { 3474, 1, 'o', -1 },
+    { 3475, 1, 'f', -1 },
+    { 3476, 1, 'a', -1 },
+    { 3477, 1, 'r', -1 },
+    { 3478, 1, 'l', -1 },
+    { 3479, 1, 'c', -1 },
+    { 3480, 1, 'l', 228 },
+    { 3481, 1, 'r', -1 },
+    { 0, 0, ';', 231 },
+    { 0, 0, ';', 232 },
+    { 3482, 1, 'f', -1 },
+    { 3483, 1, 'r', -1 },
+    { 3484, 1, 'r', -1 },
+    { 3485, 1, 'c', -1 },
+    { 3486, 1, 'y', -1 },
+    { 3487, 1, 'y', -1 },
+    { 3488, 1, 'p', -1 },
+    { 3489, 1, 'd', -1 },
+    { 0, 0, ';', 241 },
+    { 0, 0, ';', 242 },
+    { 3490, 1, 'f', -1 },
+    { 3491, 1, 'r', -1 },
+    { 3492, 1, 'y', -1 },
+    { 3493, 1, 'u', -1 },
+    { 3494, 1, 'b', -1 },
+    { 3495, 1, 'g', -1 },
+    { 3496, 1, 'l', -1 },
+    { 3497, 1, 'r', -1 },
+    { 3498, 1, 'r', -1 },
+    { 3499, 1, 'd', -1 },
+    { 0, 0, ';', 255 },
+    { 3500, 10, 't', -1 },
+    { 3510, 6, 's', -1 },
+    { 0, 0, ';', 288 },
+    { 3516, 1, 'f', -1 },
+    { 3517, 1, 'd', -1 },
+    { 3518, 4, 'g', -1 },
+    { 3522, 1, 'f', -1 },
+    { 3523, 1, 'e', -1 },
+    { 3524, 1, 'r', -1 },
+    { 0, 0, ';', 302 },
+    { 3525, 1, 'r', -1 },
+    { 0, 0, ';', 305 },
+    { 0, 0, ';', 306 },
+    { 3526, 1, 'i', -1 },
+    { 3527, 1, 'l', -1 },
+    { 0, 0, ';', 309 },
+    { 3528, 1, 'u', -1 },
+    { 3529, 1, 'f', -1 },
+    { 3530, 1, 'r', -1 },
+    { 3531, 1, 'y', -1 },
+    { 3532, 1, 'u', -1 },
+    { 3533, 1, 'r', -1 },
+    { 3534, 1, 'd', -1 },
+    { 0, 0, ';', 318 },
+    { 3535, 1, 'a', -1 },
+    { 3536, 1, 't', -1 },
+    { 3537, 1, 'L', -1 },
+    { 0, 0, ';', 326 },
+    { 3538, 1, 'r', -1 },
+    { 3539, 1, 'B', -1 },
+    { 3540, 1, 'f', -1 },
+    { 0, 0, ';', 330 },
+    { 3541, 2, 'C', -1 },
+    { 3543, 1, 'D', -1 },
+    { 3544, 3, 'E', -1 },
+    { 3547, 1, 'G', -1 },
+    { 3548, 1, 'H', -1 },
+    { 3549, 1, 'L', -1 },
+    { 3550, 1, 'N', -1 },
+    { 3551, 1, 'P', -1 },
+    { 3552, 2, 'R', -1 },
+    { 3554, 2, 'S', -1 },
+    { 3556, 1, 'T', -1 },
+    { 3557, 1, 'V', -1 },
+    { 3558, 1, 'r', -1 },
+    { 3559, 1, 'l', -1 },
+    { 3560, 1, 'i', -1 },
+    { 3561, 1, 'u', -1 },
+    { 3562, 1, 'r', -1 },
+    { 0, 0, ';', 391 },
+    { 3563, 1, 'l', -1 },
+    { 0, 0, ';', 393 },
+    { 3564, 1, 'a', -1 },
+    { 3565, 1, 'c', -1 },
+    { 3566, 1, 'g', -1 },
+    { 3567, 1, 'c', -1 },
+    { 3568, 1, 'f', -1 },
+    { 3569, 1, 'n', -1 },
+    { 3570, 1, 'r', -1 },
+    { 3571, 1, 'a', -1 },
+    { 3572, 1, 'l', -1 },
+    { 3573, 1, 'm', -1 },
+    { 3574, 1, 'l', 409 },
+    { 3575, 2, 'r', -1 },
+    { 3577, 1, 't', -1 },
+    { 0, 0, ';', 416 },
+    { 0, 0, ';', 417 },
+    { 0, 0, ';', 418 },
+    { 3578, 1, 's', -1 },
+    { 3579, 1, 'n', -1 },
+    { 3580, 1, 'f', -1 },
+    { 3581, 1, 'c', -1 },
+    { 3582, 1, 'm', -1 },
+    { 3583, 1, 'd', -1 },
+    { 3584, 1, 'p', -1 },
+    { 3585, 1, 'r', -1 },
+    { 0, 0, ';', 433 },
+    { 3586, 1, 'T', 434 },
+    { 0, 0, ';', 436 },
+    { 3587, 1, 'f', -1 },
+    { 3588, 1, 'r', -1 },
+    { 3589, 1, 'r', -1 },
+    { 0, 0, ';', 441 },
+    { 3590, 1, 'u', -1 },
+    { 3591, 1, 'g', -1 },
+    { 3592, 2, 'r', -1 },
+    { 3594, 1, 'r', -1 },
+    { 3595, 1, 'd', -1 },
+    { 0, 0, ';', 448 },
+    { 3596, 1, 'e', -1 },
+    { 0, 0, ';', 453 },
+    { 0, 0, ';', 454 },
+    { 3597, 1, 'h', -1 },
+    { 3598, 1, 'f', -1 },
+    { 3599, 1, 'n', -1 },
+    { 3600, 1, 'g', -1 },
+    { 3601, 1, 'r', -1 },
+    { 0, 0, ';', 482 },
+    { 3602, 1, 'e', -1 },
+    { 3603, 1, 'H', -1 },
+    { 3604, 1, 'y', -1 },
+    { 3605, 1, 'T', -1 },
+    { 3606, 1, 'u', -1 },
+    { 3607, 1, 'r', -1 },
+    { 3608, 1, 'd', -1 },
+    { 3609, 1, 'r', -1 },
+    { 0, 0, ';', 492 },
+    { 0, 0, ';', 493 },
+    { 3610, 1, 'r', -1 },
+    { 3611, 1, 'm', -1 },
+    { 3612, 1, 'l', -1 },
+    { 3613, 1, 'f', -1 },
+    { 3614, 1, 't', -1 },
+    { 3615, 1, 'a', -1 },
+    { 3616, 1, 'r', -1 },
+    { 3617, 1, 'r', -1 },
+    { 0, 0, ';', 511 },
+    { 3618, 1, 's', -1 },
+    { 3619, 1, 'c', -1 },
+    { 3620, 1, 'h', -1 },
+    { 0, 0, ';', 519 },
+    { 0, 0, ';', 520 },
+    { 3621, 1, 'e', -1 },
+    { 3622, 1, 's', -1 },
+    { 3623, 1, 'R', -1 },
+    { 3624, 1, 'D', -1 },
+    { 3625, 1, 'c', -1 },
+    { 3626, 1, 'y', -1 },
+    { 0, 0, ';', 529 },
+    { 0, 0, ';', 530 },
+    { 3627, 1, 'r', -1 },
+    { 3628, 1, 'd', -1 },
+    { 0, 0, ';', 533 },
+    { 0, 0, ';', 534 },
+    { 3629, 1, 'r', -1 },
+    { 3630, 1, 't', -1 },
+    { 3631, 1, 'c', -1 },
+    { 3632, 1, 'n', -1 },
+    { 3633, 1, 'd', -1 },
+    { 3634, 1, 'f', -1 },
+    { 3635, 1, 'p', -1 },
+    { 3636, 1, 'r', -1 },
+    { 3637, 1, 'r', -1 },
+    { 3638, 1, 'u', -1 },
+    { 3639, 2, 'r', -1 },
+    { 3641, 1, 'c', -1 },
+    { 3642, 1, 'e', -1 },
+    { 3643, 1, 'r', -1 },
+    { 0, 0, ';', 555 },
+    { 3644, 1, 'l', -1 },
+    { 0, 0, ';', 557 },
+    { 3645, 1, 'a', -1 },
+    { 3646, 1, 'c', -1 },
+    { 3647, 1, 'e', -1 },
+    { 3648, 1, 'o', -1 },
+    { 3649, 1, 'o', -1 },
+    { 3650, 1, 'f', -1 },
+    { 3651, 1, 'r', -1 },
+    { 3652, 1, 'o', -1 },
+    { 3653, 1, 'q', -1 },
+    { 3654, 1, 'e', -1 },
+    { 3655, 1, 'r', -1 },
+    { 3656, 1, 'o', -1 },
+    { 3657, 1, 'e', -1 },
+    { 3658, 2, 'i', -1 },
+    { 3660, 1, 'n', -1 },
+    { 3661, 1, 'r', -1 },
+    { 3662, 1, 'l', -1 },
+    { 3663, 1, 'l', 585 },
+    { 3664, 1, 's', -1 },
+    { 3665, 1, 'r', -1 },
+    { 0, 0, ';', 589 },
+    { 3666, 1, 's', -1 },
+    { 0, 0, ';', 592 },
+    { 3667, 1, 'b', -1 },
+    { 3668, 2, 't', -1 },
+    { 3670, 1, 'y', -1 },
+    { 0, 0, ';', 600 },
+    { 3671, 1, 'f', -1 },
+    { 3672, 1, 'r', -1 },
+    { 3673, 1, 'a', -1 },
+    { 3674, 1, 'r', -1 },
+    { 3675, 1, 'g', -1 },
+    { 0, 0, ';', 606 },
+    { 3676, 1, 'f', -1 },
+    { 3677, 1, 'r', -1 },
+    { 0, 0, ';', 609 },
+    { 3678, 1, 'f', -1 },
+    { 3679, 1, 'r', -1 },
+    { 3680, 1, 'y', -1 },
+    { 3681, 1, 'y', -1 },
+    { 3682, 1, 'y', -1 },
+    { 3683, 1, 'u', -1 },
+    { 3684, 1, 'r', -1 },
+    { 0, 0, ';', 619 },
+    { 0, 0, ';', 620 },
+    { 3685, 1, 'f', -1 },
+    { 3686, 1, 'r', -1 },
+    { 3687, 1, 'l', -1 },
+    { 3688, 1, 'y', -1 },
+    { 3689, 1, 'u', -1 },
+    { 3690, 1, 'r', -1 },
+    { 0, 0, ';', 627 },
+    { 3691, 1, 't', -1 },
+    { 3692, 1, 'o', -1 },
+    { 3693, 1, 'a', -1 },
+    { 0, 0, ';', 631 },
+    { 3694, 1, 'f', -1 },
+    { 3695, 1, 'r', -1 },
+    { 3696, 1, 'u', -1 },
+    { 3697, 1, 'e', -1 },
+    { 0, 0, ';', 638 },
+    { 0, 0, ';', 639 },
+    { 3698, 1, 'r', -1 },
+    { 3699, 1, 't', -1 },
+    { 0, 0, ';', 644 },
+    { 3700, 1, 'i', -1 },
+    { 0, 0, ';', 648 },
+    { 3701, 1, 'a', -1 },
+    { 3702, 1, 'f', -1 },
+    { 3703, 1, 'p', -1 },
+    { 3704, 1, 'h', -1 },
+    { 3705, 1, 'c', -1 },
+    { 3706, 1, 'l', -1 },
+    { 0, 0, ';', 657 },
+    { 0, 0, ';', 658 },
+    { 3707, 1, 'a', -1 },
+    { 3708, 1, 'd', -1 },
+    { 3709, 1, 's', -1 },
+    { 3710, 1, 'v', -1 },
+    { 0, 0, ';', 663 },
+    { 3711, 1, 'e', -1 },
+    { 3712, 1, 'l', -1 },
+    { 3713, 1, 'm', -1 },
+    { 3714, 1, 'r', -1 },
+    { 3715, 2, 's', -1 },
+    { 3717, 1, 'z', -1 },
+    { 3718, 1, 'o', -1 },
+    { 3719, 1, 'f', -1 },
+    { 0, 0, ';', 684 },
+    { 3720, 1, 'c', -1 },
+    { 0, 0, ';', 686 },
+    { 3721, 1, 'd', -1 },
+    { 3722, 1, 's', -1 },
+    { 3723, 1, 'r', -1 },
+    { 3724, 1, 'n', -1 },
+    { 3725, 1, 'r', -1 },
+    { 0, 0, ';', 694 },
+    { 3726, 1, 'm', -1 },
+    { 3727, 1, 'l', -1 },
+    { 3728, 1, 'l', 699 },
+    { 3729, 1, 'o', -1 },
+    { 3730, 1, 'n', -1 },
+    { 3731, 1, 't', -1 },
+    { 3732, 4, 'k', -1 },
+    { 3736, 1, 'v', -1 },
+    { 3737, 1, 'w', -1 },
+    { 3738, 2, 'k', -1 },
+    { 3740, 1, 'n', -1 },
+    { 0, 0, ';', 715 },
+    { 3741, 1, 'u', -1 },
+    { 3742, 1, 'a', -1 },
+    { 3743, 1, 'p', -1 },
+    { 3744, 1, 's', -1 },
+    { 3745, 1, 'n', -1 },
+    { 3746, 1, 'a', -1 },
+    { 3747, 1, 'h', -1 },
+    { 3748, 1, 'w', -1 },
+    { 0, 0, ';', 725 },
+    { 3749, 3, 'c', -1 },
+    { 3752, 3, 'o', -1 },
+    { 3755, 2, 's', -1 },
+    { 3757, 1, 't', -1 },
+    { 3758, 1, 'u', -1 },
+    { 3759, 1, 'v', -1 },
+    { 3760, 1, 'w', -1 },
+    { 3761, 1, 'r', -1 },
+    { 3762, 1, 'c', -1 },
+    { 3763, 1, 'n', -1 },
+    { 3764, 2, '1', -1 },
+    { 3766, 1, '3', -1 },
+    { 3767, 1, 'c', -1 },
+    { 0, 0, ';', 751 },
+    { 3768, 1, 'q', -1 },
+    { 3769, 1, 't', -1 },
+    { 3770, 1, 'f', -1 },
+    { 0, 0, ';', 755 },
+    { 3771, 1, 't', -1 },
+    { 3772, 1, 't', -1 },
+    { 3773, 4, 'D', -1 },
+    { 3777, 5, 'H', -1 },
+    { 3782, 4, 'U', -1 },
+    { 3786, 7, 'V', -1 },
+    { 3793, 1, 'b', -1 },
+    { 3794, 4, 'd', -1 },
+    { 3798, 5, 'h', -1 },
+    { 3803, 1, 'm', -1 },
+    { 3804, 1, 'p', -1 },
+    { 3805, 1, 't', -1 },
+    { 3806, 4, 'u', -1 },
+    { 3810, 7, 'v', -1 },
+    { 3817, 1, 'i', -1 },
+    { 3818, 1, 'v', -1 },
+    { 3819, 1, 'b', -1 },
+    { 3820, 1, 'r', -1 },
+    { 3821, 1, 'm', -1 },
+    { 3822, 2, 'm', -1 },
+    { 3824, 3, 'l', -1 },
+    { 3827, 2, 'l', -1 },
+    { 3829, 3, 'p', -1 },
+    { 3832, 1, 'u', -1 },
+    { 0, 0, ';', 820 },
+    { 3833, 1, 'a', -1 },
+    { 3834, 1, 'b', -1 },
+    { 3835, 2, 'c', -1 },
+    { 3837, 1, 'd', -1 },
+    { 3838, 1, 's', -1 },
+    { 3839, 1, 'e', -1 },
+    { 3840, 1, 'o', -1 },
+    { 3841, 1, 'p', -1 },
+    { 3842, 1, 'r', -1 },
+    { 3843, 1, 'd', -1 },
+    { 3844, 1, 'r', -1 },
+    { 3845, 1, 'p', -1 },
+    { 3846, 1, 't', -1 },
+    { 3847, 1, 'i', -1 },
+    { 3848, 1, 'p', -1 },
+    { 3849, 2, 't', 840 },
+    { 0, 0, ';', 843 },
+    { 3851, 1, 'y', -1 },
+    { 3852, 1, 'c', -1 },
+    { 0, 0, ';', 847 },
+    { 0, 0, ';', 848 },
+    { 3853, 1, 'E', -1 },
+    { 3854, 3, 'c', -1 },
+    { 3857, 1, 'e', -1 },
+    { 3858, 1, 'f', -1 },
+    { 3859, 1, 'm', -1 },
+    { 3860, 1, 's', -1 },
+    { 3861, 1, 'b', -1 },
+    { 3862, 1, 'o', -1 },
+    { 3863, 1, 'm', -1 },
+    { 3864, 3, 'p', -1 },
+    { 3867, 2, 'g', -1 },
+    { 3869, 1, 'i', -1 },
+    { 3870, 1, 'f', -1 },
+    { 3871, 1, 'r', -1 },
+    { 3872, 2, 'y', 879 },
+    { 3874, 1, 'r', -1 },
+    { 3875, 1, 's', -1 },
+    { 3876, 1, 'r', -1 },
+    { 3877, 2, 'b', -1 },
+    { 3879, 2, 'p', -1 },
+    { 3881, 1, 'o', -1 },
+    { 3882, 1, 'a', -1 },
+    { 3883, 1, 'p', -1 },
+    { 3884, 1, 's', -1 },
+    { 3885, 1, 'a', -1 },
+    { 0, 0, ';', 896 },
+    { 3886, 1, 'b', -1 },
+    { 3887, 2, 'c', -1 },
+    { 3889, 1, 'd', -1 },
+    { 3890, 1, 'o', -1 },
+    { 3891, 1, 's', -1 },
+    { 3892, 1, 'a', -1 },
+    { 3893, 1, 'l', -1 },
+    { 3894, 1, 'r', -1 },
+    { 3895, 1, 'v', -1 },
+    { 3896, 1, 'e', -1 },
+    { 3897, 1, 'e', -1 },
+    { 3898, 1, 'o', -1 },
+    { 3899, 1, 'n', -1 },
+    { 3900, 1, 'c', -1 },
+    { 3901, 1, 'r', -1 },
+    { 3902, 1, 'r', -1 },
+    { 3903, 1, 'g', -1 },
+    { 3904, 1, 'e', -1 },
+    { 3905, 1, 'r', -1 },
+    { 3906, 2, 'h', -1 },
+    { 3908, 1, 'a', -1 },
+    { 3909, 1, 'a', -1 },
+    { 3910, 1, 'r', -1 },
+    { 0, 0, ';', 928 },
+    { 3911, 1, 'g', -1 },
+    { 3912, 1, 'r', -1 },
+    { 3913, 1, 't', -1 },
+    { 0, 0, ';', 934 },
+    { 3914, 1, 't', -1 },
+    { 3915, 1, 'p', -1 },
+    { 3916, 1, 's', -1 },
+    { 0, 0, ';', 938 },
+    { 3917, 2, 'r', -1 },
+    { 3919, 3, 'm', -1 },
+    { 0, 0, ';', 945 },
+    { 3922, 1, 'a', -1 },
+    { 3923, 1, 'i', -1 },
+    { 0, 0, ';', 948 },
+    { 3924, 1, 'i', -1 },
+    { 3925, 1, 'o', -1 },
+    { 3926, 1, 'y', -1 },
+    { 3927, 1, 'o', -1 },
+    { 3928, 1, 'r', -1 },
+    { 3929, 1, 'l', -1 },
+    { 3930, 1, 'f', -1 },
+    { 0, 0, ';', 958 },
+    { 3931, 1, 'e', -1 },
+    { 3932, 1, 'm', -1 },
+    { 3933, 1, 'p', -1 },
+    { 3934, 1, 's', -1 },
+    { 3935, 1, 'b', -1 },
+    { 3936, 3, 'n', -1 },
+    { 3939, 1, 'k', -1 },
+    { 3940, 1, 'o', -1 },
+    { 3941, 1, 'r', -1 },
+    { 3942, 1, 'r', -1 },
+    { 3943, 1, 'y', -1 },
+    { 3944, 1, 'l', -1 },
+    { 3945, 1, 'r', -1 },
+    { 3946, 1, 'o', -1 },
+    { 3947, 2, 'i', -1 },
+    { 3949, 1, 'r', -1 },
+    { 3950, 1, 'a', -1 },
+    { 3951, 1, 'n', -1 },
+    { 3952, 1, 'y', -1 },
+    { 3953, 1, 'g', -1 },
+    { 3954, 1, 'o', -1 },
+    { 3955, 1, 't', -1 },
+    { 3956, 1, 'u', -1 },
+    { 3957, 1, 't', -1 },
+    { 3958, 1, 'r', -1 },
+    { 3959, 2, 'r', -1 },
+    { 3961, 1, 'l', -1 },
+    { 0, 0, ';', 994 },
+    { 3962, 1, 't', -1 },
+    { 3963, 1, 'o', -1 },
+    { 0, 0, ';', 998 },
+    { 3964, 1, 'a', -1 },
+    { 0, 0, ';', 1002 },
+    { 3965, 1, 'd', -1 },
+    { 3966, 1, 'n', -1 },
+    { 0, 0, ';', 1006 },
+    { 0, 0, ';', 1007 },
+    { 3967, 1, 'd', -1 },
+    { 3968, 1, 'c', -1 },
+    { 3969, 1, 't', -1 },
+    { 3970, 2, 'p', -1 },
+    { 0, 0, ';', 1016 },
+    { 3972, 1, 'p', -1 },
+    { 3973, 1, 'o', -1 },
+    { 3974, 1, 'f', -1 },
+    { 3975, 2, 'r', -1 },
+    { 3977, 1, 'u', -1 },
+    { 3978, 3, 'i', -1 },
+    { 3981, 1, 'i', -1 },
+    { 3982, 1, 'o', -1 },
+    { 3983, 1, 'i', -1 },
+    { 3984, 1, 'l', -1 },
+    { 3985, 1, 'a', -1 },
+    { 3986, 1, 'e', -1 },
+    { 3987, 1, 'i', -1 },
+    { 3988, 1, 'p', -1 },
+    { 3989, 1, 'o', -1 },
+    { 3990, 1, 'r', -1 },
+    { 3991, 1, 'r', -1 },
+    { 3992, 1, 'o', -1 },
+    { 3993, 1, 'm', -1 },
+    { 0, 0, ';', 1041 },
+    { 0, 0, ';', 1043 },
+    { 3994, 1, 'l', 1044 },
+    { 3995, 1, 'o', -1 },
+    { 3996, 1, 'l', -1 },
+    { 3997, 1, 's', -1 },
+    { 3998, 1, 'e', -1 },
+    { 3999, 1, 'o', -1 },
+    { 4000, 1, 'l', -1 },
+    { 0, 0, ';', 1052 },
+    { 4001, 1, 'a', -1 },
+    { 4002, 1, 'l', -1 },
+    { 4003, 1, 'i', -1 },
+    { 4004, 1, 'l', -1 },
+    { 0, 0, ';', 1057 },
+    { 4005, 1, 'i', -1 },
+    { 4006, 1, 'i', -1 },
+    { 4007, 1, 't', -1 },
+    { 4008, 1, 'i', -1 },
+    { 4009, 1, 'n', -1 },
+    { 4010, 1, 'f', -1 },
+    { 4011, 1, 'f', -1 },
+    { 4012, 1, 'a', -1 },
+    { 4013, 2, 'k', -1 },
+    { 4015, 1, 'r', -1 },
+    { 4016, 6, 'c', -1 },
+    { 4022, 1, 's', -1 },
+    { 4023, 1, 'w', -1 },
+    { 4024, 1, 'r', -1 },
+    { 0, 0, ';', 1091 },
+    { 4025, 1, 'u', -1 },
+    { 4026, 1, 'm', -1 },
+    { 0, 0, ';', 1095 },
+    { 4027, 1, 'e', -1 },
+    { 4028, 1, 'r', -1 },
+    { 0, 0, ';', 1098 },
+    { 4029, 1, 't', -1 },
+    { 0, 0, ';', 1101 },
+    { 0, 0, ';', 1102 },
+    { 4030, 1, 'q', -1 },
+    { 4031, 1, 's', -1 },
+    { 0, 0, ';', 1105 },
+    { 4032, 1, 'c', -1 },
+    { 4033, 1, 'd', -1 },
+    { 4034, 2, 'l', -1 },
+    { 0, 0, ';', 1112 },
+    { 0, 0, ';', 1114 },
+    { 4036, 1, 'e', -1 },
+    { 4037, 1, 'y', -1 },
+    { 0, 0, ';', 1118 },
+    { 0, 0, ';', 1119 },
+    { 0, 0, ';', 1120 },
+    { 0, 0, ';', 1121 },
+    { 4038, 2, 'p', -1 },
+    { 0, 0, ';', 1124 },
+    { 4040, 2, 'q', -1 },
+    { 4042, 1, 'i', -1 },
+    { 4043, 1, 'f', -1 },
+    { 4044, 1, 'v', -1 },
+    { 4045, 1, 'r', -1 },
+    { 4046, 3, 'm', -1 },
+    { 4049, 1, 'c', -1 },
+    { 4050, 1, 'i', -1 },
+    { 4051, 1, 'o', -1 },
+    { 4052, 1, 'P', -1 },
+    { 4053, 1, 'u', -1 },
+    { 4054, 2, 'a', -1 },
+    { 4056, 1, 'd', -1 },
+    { 4057, 1, 'e', -1 },
+    { 4058, 1, 'l', -1 },
+    { 4059, 1, 's', -1 },
+    { 4060, 1, 'r', -1 },
+    { 4061, 1, 'E', -1 },
+    { 4062, 1, 'r', -1 },
+    { 4063, 1, 'r', -1 },
+    { 4064, 1, 'f', -1 },
+    { 4065, 1, 'i', -1 },
+    { 4066, 1, 'd', -1 },
+    { 4067, 3, 'r', -1 },
+    { 4070, 1, 'r', -1 },
+    { 4071, 1, 'r', -1 },
+    { 4072, 1, 'r', -1 },
+    { 4073, 1, 'l', -1 },
+    { 4074, 1, 'c', -1 },
+    { 0, 0, ';', 1164 },
+    { 4075, 1, 'e', -1 },
+    { 4076, 1, 'w', -1 },
+    { 4077, 1, 'r', -1 },
+    { 4078, 1, 't', -1 },
+    { 4079, 2, 'k', -1 },
+    { 4081, 1, 'f', -1 },
+    { 4082, 1, 'b', -1 },
+    { 4083, 1, 'r', -1 },
+    { 4084, 1, 'a', -1 },
+    { 4085, 1, 'r', -1 },
+    { 4086, 1, 'u', -1 },
+    { 4087, 1, 'h', -1 },
+    { 4088, 1, 'u', -1 },
+    { 4089, 1, 'r', -1 },
+    { 0, 0, ';', 1183 },
+    { 4090, 1, 'y', -1 },
+    { 4091, 1, 'c', -1 },
+    { 0, 0, ';', 1187 },
+    { 0, 0, ';', 1188 },
+    { 4092, 1, 'a', -1 },
+    { 4093, 1, 'i', -1 },
+    { 4094, 1, 'n', -1 },
+    { 4095, 1, 'f', -1 },
+    { 4096, 1, 't', -1 },
+    { 4097, 1, 'i', -1 },
+    { 4098, 1, 'c', -1 },
+    { 4099, 3, 'g', -1 },
+    { 4102, 1, 't', -1 },
+    { 4103, 1, 'f', -1 },
+    { 4104, 1, 'e', -1 },
+    { 4105, 1, 'a', -1 },
+    { 4106, 1, 'i', -1 },
+    { 4107, 1, 'd', -1 },
+    { 0, 0, ';', 1209 },
+    { 4108, 1, 'c', -1 },
+    { 4109, 2, 'e', -1 },
+    { 4111, 1, 'l', -1 },
+    { 4112, 1, 'p', -1 },
+    { 4113, 1, 'y', -1 },
+    { 4114, 1, 'o', -1 },
+    { 4115, 1, 'f', -1 },
+    { 4116, 1, 'a', -1 },
+    { 4117, 1, 'o', -1 },
+    { 4118, 1, 'e', -1 },
+    { 4119, 1, 'r', -1 },
+    { 4120, 5, 'n', -1 },
+    { 4125, 1, 'l', -1 },
+    { 4126, 1, 'c', -1 },
+    { 4127, 1, 'l', 1232 },
+    { 4128, 1, 'r', -1 },
+    { 0, 0, ';', 1235 },
+    { 0, 0, ';', 1236 },
+    { 4129, 1, 't', -1 },
+    { 4130, 1, 'f', -1 },
+    { 4131, 1, 'r', -1 },
+    { 4132, 1, 'r', -1 },
+    { 4133, 1, 'c', -1 },
+    { 4134, 1, 'p', -1 },
+    { 4135, 1, 'd', -1 },
+    { 0, 0, ';', 1245 },
+    { 0, 0, ';', 1246 },
+    { 4136, 1, 'e', -1 },
+    { 4137, 1, 'y', -1 },
+    { 4138, 1, 'y', -1 },
+    { 4139, 1, 'f', -1 },
+    { 4140, 1, 'r', -1 },
+    { 4141, 1, 'r', -1 },
+    { 4142, 1, 'r', -1 },
+    { 4143, 1, 'a', -1 },
+    { 4144, 1, 'r', -1 },
+    { 0, 0, ';', 1257 },
+    { 4145, 1, 'r', -1 },
+    { 4146, 1, 'u', -1 },
+    { 4147, 1, 'm', -1 },
+    { 4148, 1, 'r', -1 },
+    { 4149, 1, 'b', -1 },
+    { 4150, 3, 'g', -1 },
+    { 0, 0, ';', 1266 },
+    { 4153, 1, 'u', -1 },
+    { 4154, 8, 'r', -1 },
+    { 0, 0, ';', 1278 },
+    { 4162, 1, 'a', -1 },
+    { 4163, 2, 'e', -1 },
+    { 4165, 1, 'r', -1 },
+    { 4166, 1, 'r', -1 },
+    { 4167, 1, 'a', -1 },
+    { 4168, 2, 'k', -1 },
+    { 4170, 1, 'r', -1 },
+    { 4171, 1, 'd', -1 },
+    { 4172, 1, 'i', -1 },
+    { 4173, 1, 'b', -1 },
+    { 0, 0, ';', 1293 },
+    { 4174, 1, 'a', -1 },
+    { 4175, 1, 'u', -1 },
+    { 4176, 1, 'd', -1 },
+    { 4177, 1, 'u', -1 },
+    { 4178, 1, 'h', -1 },
+    { 4179, 5, 't', -1 },
+    { 0, 0, ';', 1311 },
+    { 0, 0, ';', 1312 },
+    { 4184, 1, 'q', -1 },
+    { 4185, 1, 's', -1 },
+    { 0, 0, ';', 1315 },
+    { 4186, 1, 'c', -1 },
+    { 4187, 1, 'd', -1 },
+    { 4188, 2, 'g', -1 },
+    { 4190, 5, 's', -1 },
+    { 4195, 1, 's', -1 },
+    { 4196, 1, 'o', -1 },
+    { 0, 0, ';', 1330 },
+    { 0, 0, ';', 1332 },
+    { 4197, 2, 'r', -1 },
+    { 4199, 1, 'l', -1 },
+    { 4200, 1, 'y', -1 },
+    { 4201, 1, 'r', -1 },
+    { 4202, 1, 'o', -1 },
+    { 4203, 1, 'a', -1 },
+    { 4204, 1, 'r', -1 },
+    { 4205, 1, 'd', -1 },
+    { 4206, 1, 'u', -1 },
+    { 0, 0, ';', 1346 },
+    { 4207, 2, 'p', -1 },
+    { 0, 0, ';', 1349 },
+    { 4209, 2, 'q', -1 },
+    { 4211, 1, 'i', -1 },
+    { 4212, 1, 'n', -1 },
+    { 4213, 1, 'r', -1 },
+    { 4214, 1, 'r', -1 },
+    { 4215, 3, 'g', -1 },
+    { 4218, 1, 'p', -1 },
+    { 4219, 1, 'a', -1 },
+    { 4220, 1, 'f', -1 },
+    { 4221, 1, 'l', -1 },
+    { 4222, 1, 'i', -1 },
+    { 4223, 1, 'a', -1 },
+    { 4224, 1, 'b', -1 },
+    { 0, 0, ';', 1368 },
+    { 4225, 1, 'e', -1 },
+    { 4226, 1, 'f', -1 },
+    { 4227, 2, 'r', -1 },
+    { 4229, 1, 'r', -1 },
+    { 4230, 1, 'o', -1 },
+    { 4231, 1, 'a', -1 },
+    { 0, 0, ';', 1377 },
+    { 4232, 1, 'r', -1 },
+    { 4233, 1, 'q', -1 },
+    { 4234, 1, 'r', -1 },
+    { 0, 0, ';', 1381 },
+    { 4235, 3, 'm', -1 },
+    { 4238, 1, 'b', -1 },
+    { 4239, 1, 'u', -1 },
+    { 4240, 1, 'r', -1 },
+    { 4241, 1, 'c', -1 },
+    { 4242, 1, 'i', -1 },
+    { 4243, 1, 'o', -1 },
+    { 4244, 1, 'r', -1 },
+    { 4245, 1, 'm', -1 },
+    { 4246, 1, 'a', -1 },
+    { 4247, 1, 'u', -1 },
+    { 4248, 1, 'P', -1 },
+    { 4249, 3, 'i', -1 },
+    { 4252, 1, 'd', -1 },
+    { 4253, 1, 'u', -1 },
+    { 4254, 1, 'r', -1 },
+    { 4255, 1, 'E', -1 },
+    { 4256, 1, 'o', -1 },
+    { 4257, 1, 'r', 1407 },
+    { 4258, 1, 'e', -1 },
+    { 4259, 2, 't', -1 },
+    { 0, 0, ';', 1412 },
+    { 4261, 1, 's', -1 },
+    { 4262, 1, 'k', -1 },
+    { 4263, 1, 'm', -1 },
+    { 0, 0, ';', 1419 },
+    { 4264, 1, 's', -1 },
+    { 4265, 1, 's', -1 },
+    { 0, 0, ';', 1422 },
+    { 0, 0, ';', 1423 },
+    { 4266, 1, 'r', -1 },
+    { 0, 0, ';', 1426 },
+    { 4267, 1, 'a', -1 },
+    { 4268, 1, 'c', -1 },
+    { 4269, 1, 'd', -1 },
+    { 4270, 1, 'u', -1 },
+    { 4271, 1, 'p', -1 },
+    { 4272, 1, 'r', -1 },
+    { 4273, 1, 'l', -1 },
+    { 4274, 1, 'e', -1 },
+    { 4275, 1, 'f', -1 },
+    { 4276, 1, 'r', -1 },
+    { 4277, 1, 'p', -1 },
+    { 4278, 1, 't', -1 },
+    { 4279, 1, 'a', -1 },
+    { 0, 0, ';', 1446 },
+    { 0, 0, ';', 1447 },
+    { 4280, 1, 'v', -1 },
+    { 4281, 1, 'f', -1 },
+    { 0, 0, ';', 1451 },
+    { 0, 0, ';', 1452 },
+    { 4282, 1, 'v', -1 },
+    { 4283, 1, 'g', -1 },
+    { 4284, 1, 'a', -1 },
+    { 4285, 1, 'a', -1 },
+    { 4286, 1, 'l', -1 },
+    { 4287, 1, 'u', -1 },
+    { 4288, 1, 'g', -1 },
+    { 0, 0, ';', 1460 },
+    { 4289, 1, 'E', -1 },
+    { 4290, 1, 'i', -1 },
+    { 4291, 1, 'o', -1 },
+    { 4292, 1, 'p', -1 },
+    { 4293, 1, 'u', -1 },
+    { 4294, 1, 'p', 1468 },
+    { 4295, 1, 'm', -1 },
+    { 4296, 1, 'p', -1 },
+    { 4297, 1, 'r', -1 },
+    { 4298, 1, 'd', -1 },
+    { 4299, 1, 'n', -1 },
+    { 4300, 1, 'p', -1 },
+    { 0, 0, ';', 1478 },
+    { 4301, 1, 's', -1 },
+    { 4302, 1, 'r', -1 },
+    { 4303, 2, 'r', -1 },
+    { 4305, 1, 'o', -1 },
+    { 4306, 1, 'u', -1 },
+    { 4307, 1, 'e', -1 },
+    { 4308, 1, 'i', -1 },
+    { 4309, 1, 'i', -1 },
+    { 0, 0, ';', 1491 },
+    { 0, 0, ';', 1492 },
+    { 0, 0, ';', 1493 },
+    { 4310, 3, 'q', -1 },
+    { 4313, 1, 's', -1 },
+    { 4314, 1, 'i', -1 },
+    { 0, 0, ';', 1499 },
+    { 4315, 1, 'r', -1 },
+    { 4316, 1, 'r', -1 },
+    { 4317, 1, 'r', -1 },
+    { 4318, 1, 'a', -1 },
+    { 0, 0, ';', 1505 },
+    { 4319, 1, 'd', -1 },
+    { 0, 0, ';', 1507 },
+    { 4320, 1, 'y', -1 },
+    { 4321, 1, 'r', -1 },
+    { 0, 0, ';', 1510 },
+    { 4322, 1, 'r', -1 },
+    { 4323, 1, 'r', -1 },
+    { 0, 0, ';', 1513 },
+    { 4324, 1, 'f', -1 },
+    { 4325, 3, 'q', -1 },
+    { 4328, 2, 's', -1 },
+    { 4330, 1, 'i', -1 },
+    { 0, 0, ';', 1522 },
+    { 4331, 1, 'r', -1 },
+    { 4332, 1, 'd', -1 },
+    { 4333, 1, 'f', -1 },
+    { 0, 0, ';', 1528 },
+    { 4334, 1, 'i', -1 },
+    { 4335, 1, 'n', -1 },
+    { 4336, 4, 'r', -1 },
+    { 4340, 1, 'l', -1 },
+    { 0, 0, ';', 1544 },
+    { 4341, 1, 'c', -1 },
+    { 4342, 2, 'e', -1 },
+    { 4344, 1, 'r', -1 },
+    { 4345, 1, 'r', -1 },
+    { 4346, 1, 'g', -1 },
+    { 4347, 1, 'r', -1 },
+    { 0, 0, ';', 1556 },
+    { 4348, 1, 'c', -1 },
+    { 4349, 1, 'e', -1 },
+    { 4350, 1, 'r', -1 },
+    { 4351, 1, 'o', -1 },
+    { 4352, 2, 'm', -1 },
+    { 4354, 1, 'i', -1 },
+    { 4355, 1, 'a', -1 },
+    { 4356, 1, 's', -1 },
+    { 4357, 4, 'b', -1 },
+    { 4361, 1, 'c', -1 },
+    { 4362, 4, 'p', -1 },
+    { 4366, 1, 'l', -1 },
+    { 4367, 1, 'l', -1 },
+    { 4368, 1, 'g', -1 },
+    { 4369, 1, 'i', -1 },
+    { 0, 0, ';', 1592 },
+    { 4370, 1, 'e', -1 },
+    { 4371, 1, 's', -1 },
+    { 4372, 1, 'a', -1 },
+    { 4373, 1, 'a', -1 },
+    { 4374, 1, 'p', -1 },
+    { 4375, 1, 'a', -1 },
+    { 4376, 1, 'e', -1 },
+    { 4377, 1, 't', -1 },
+    { 4378, 1, 'n', -1 },
+    { 4379, 1, 'A', -1 },
+    { 4380, 1, 'e', -1 },
+    { 4381, 2, 't', -1 },
+    { 4383, 1, 'A', -1 },
+    { 4384, 1, 't', -1 },
+    { 4385, 1, 'i', -1 },
+    { 4386, 1, 'r', -1 },
+    { 4387, 2, 'r', -1 },
+    { 4389, 1, 'e', -1 },
+    { 4390, 1, 'u', -1 },
+    { 4391, 1, 't', -1 },
+    { 4392, 2, 'r', -1 },
+    { 0, 0, ';', 1621 },
+    { 4394, 1, 's', -1 },
+    { 4395, 1, 'l', -1 },
+    { 4396, 1, 'v', -1 },
+    { 4397, 1, 't', -1 },
+    { 4398, 1, 'o', -1 },
+    { 4399, 1, 'i', -1 },
+    { 4400, 1, 'i', -1 },
+    { 0, 0, ';', 1629 },
+    { 4401, 1, 'n', -1 },
+    { 4402, 1, 'a', -1 },
+    { 0, 0, ';', 1633 },
+    { 4403, 1, 'a', -1 },
+    { 0, 0, ';', 1635 },
+    { 4404, 1, 't', -1 },
+    { 4405, 1, 'r', -1 },
+    { 4406, 1, 'i', -1 },
+    { 4407, 1, 'r', -1 },
+    { 4408, 1, 'n', -1 },
+    { 0, 0, ';', 1641 },
+    { 4409, 1, 'c', -1 },
+    { 4410, 1, 'g', -1 },
+    { 4411, 1, 'c', -1 },
+    { 4412, 1, 'd', -1 },
+    { 4413, 1, 'n', -1 },
+    { 4414, 1, 'f', -1 },
+    { 4415, 1, 'r', -1 },
+    { 4416, 1, 'r', -1 },
+    { 4417, 1, 'u', -1 },
+    { 4418, 1, 'r', -1 },
+    { 0, 0, ';', 1653 },
+    { 4419, 1, 'e', -1 },
+    { 4420, 1, 'f', 1656 },
+    { 4421, 1, 'm', 1658 },
+    { 4422, 1, 'g', -1 },
+    { 4423, 1, 'r', -1 },
+    { 4424, 1, 'l', -1 },
+    { 0, 0, ';', 1663 },
+    { 4425, 1, 'r', -1 },
+    { 4426, 1, 'a', -1 },
+    { 4427, 1, 'l', -1 },
+    { 4428, 1, 'l', -1 },
+    { 4429, 1, 'm', -1 },
+    { 4430, 1, 'l', 1672 },
+    { 4431, 1, 'a', -1 },
+    { 0, 0, ';', 1675 },
+    { 4432, 2, 'a', 1676 },
+    { 4434, 2, 's', -1 },
+    { 4436, 1, 't', -1 },
+    { 0, 0, ';', 1682 },
+    { 4437, 1, 'c', -1 },
+    { 4438, 1, 'i', -1 },
+    { 4439, 1, 'm', -1 },
+    { 4440, 1, 'p', -1 },
+    { 4441, 1, 't', -1 },
+    { 0, 0, ';', 1688 },
+    { 0, 0, ';', 1689 },
+    { 4442, 1, 'v', -1 },
+    { 4443, 1, 'm', -1 },
+    { 4444, 1, 'n', -1 },
+    { 4445, 1, 'c', -1 },
+    { 0, 0, ';', 1695 },
+    { 4446, 2, 'n', -1 },
+    { 4448, 9, 's', -1 },
+    { 4457, 1, 'n', -1 },
+    { 4458, 1, 'f', -1 },
+    { 4459, 1, 'n', -1 },
+    { 0, 0, ';', 1716 },
+    { 4460, 1, 'p', -1 },
+    { 4461, 1, 'u', -1 },
+    { 0, 0, ';', 1719 },
+    { 4462, 6, 'c', -1 },
+    { 4468, 1, 'm', -1 },
+    { 4469, 1, 'E', -1 },
+    { 4470, 1, 'a', -1 },
+    { 4471, 1, 's', -1 },
+    { 4472, 1, 'd', -1 },
+    { 4473, 3, 'f', -1 },
+    { 4476, 2, 'p', -1 },
+    { 4478, 1, 'i', -1 },
+    { 4479, 1, 'r', -1 },
+    { 4480, 1, 'r', -1 },
+    { 0, 0, ';', 1742 },
+    { 4481, 1, 'c', -1 },
+    { 0, 0, ';', 1744 },
+    { 4482, 1, 't', -1 },
+    { 4483, 1, 'f', -1 },
+    { 4484, 1, 'i', -1 },
+    { 4485, 1, 'r', -1 },
+    { 4486, 2, 't', -1 },
+    { 4488, 1, 's', -1 },
+    { 4489, 1, 't', 1753 },
+    { 4490, 1, 'r', -1 },
+    { 4491, 1, 'r', -1 },
+    { 4492, 1, 'a', -1 },
+    { 4493, 1, 'r', -1 },
+    { 4494, 1, 'r', -1 },
+    { 4495, 1, 'e', -1 },
+    { 4496, 1, 'u', -1 },
+    { 4497, 1, 'i', -1 },
+    { 4498, 1, 'm', -1 },
+    { 4499, 4, 'g', -1 },
+    { 4503, 1, 'u', -1 },
+    { 4504, 11, 'r', -1 },
+    { 4515, 1, 'a', -1 },
+    { 4516, 1, 'i', -1 },
+    { 4517, 1, 'r', -1 },
+    { 4518, 1, 'r', -1 },
+    { 4519, 1, 'a', -1 },
+    { 4520, 2, 'k', -1 },
+    { 4522, 1, 'r', -1 },
+    { 4523, 1, 'd', -1 },
+    { 4524, 1, 'i', -1 },
+    { 4525, 1, 'b', -1 },
+    { 0, 0, ';', 1796 },
+    { 4526, 1, 'a', -1 },
+    { 4527, 1, 'd', -1 },
+    { 4528, 1, 'u', -1 },
+    { 4529, 1, 'h', -1 },
+    { 4530, 4, 'l', -1 },
+    { 4534, 1, 't', -1 },
+    { 0, 0, ';', 1808 },
+    { 4535, 1, 's', -1 },
+    { 4536, 1, 'o', -1 },
+    { 0, 0, ';', 1811 },
+    { 4537, 2, 'r', -1 },
+    { 0, 0, ';', 1815 },
+    { 4539, 1, 'v', -1 },
+    { 4540, 1, 'h', -1 },
+    { 4541, 1, 'g', -1 },
+    { 4542, 1, 'i', -1 },
+    { 4543, 1, 'r', -1 },
+    { 4544, 1, 'a', -1 },
+    { 0, 0, ';', 1830 },
+    { 4545, 1, 'u', -1 },
+    { 4546, 1, 'i', -1 },
+    { 4547, 1, 'n', -1 },
+    { 4548, 1, 'r', -1 },
+    { 4549, 1, 'r', -1 },
+    { 4550, 1, 'a', -1 },
+    { 4551, 1, 'f', -1 },
+    { 4552, 1, 'l', -1 },
+    { 4553, 1, 'i', -1 },
+    { 4554, 2, 'r', -1 },
+    { 4556, 1, 'o', -1 },
+    { 4557, 1, 'r', -1 },
+    { 4558, 1, 'q', -1 },
+    { 4559, 1, 'r', -1 },
+    { 0, 0, ';', 1847 },
+    { 4560, 1, 'b', -1 },
+    { 4561, 1, 'u', -1 },
+    { 4562, 1, 'r', -1 },
+    { 4563, 1, 'm', -1 },
+    { 4564, 4, 'i', -1 },
+    { 4568, 1, 'u', -1 },
+    { 4569, 1, 'u', -1 },
+    { 4570, 1, 'u', -1 },
+    { 0, 0, ';', 1862 },
+    { 4571, 1, 'p', -1 },
+    { 4572, 1, 'r', -1 },
+    { 4573, 1, 'u', -1 },
+    { 0, 0, ';', 1866 },
+    { 4574, 1, 'd', -1 },
+    { 4575, 1, 'r', -1 },
+    { 4576, 1, 'E', -1 },
+    { 4577, 1, 'a', -1 },
+    { 4578, 1, 's', -1 },
+    { 4579, 1, 'o', -1 },
+    { 4580, 1, 'i', -1 },
+    { 0, 0, ';', 1874 },
+    { 4581, 3, 't', -1 },
+    { 4584, 1, 'r', -1 },
+    { 4585, 2, 'r', -1 },
+    { 4587, 1, 't', 1882 },
+    { 4588, 1, 'i', -1 },
+    { 4589, 1, 'w', -1 },
+    { 4590, 2, 'm', -1 },
+    { 4592, 1, 't', -1 },
+    { 0, 0, ';', 1889 },
+    { 4593, 1, 'o', -1 },
+    { 4594, 1, 'r', -1 },
+    { 4595, 1, 'h', -1 },
+    { 4596, 1, 'y', -1 },
+    { 4597, 1, 'r', -1 },
+    { 0, 0, ';', 1897 },
+    { 4598, 1, 'm', -1 },
+    { 0, 0, ';', 1901 },
+    { 4599, 1, 'd', -1 },
+    { 4600, 2, 'e', -1 },
+    { 4602, 2, 'g', -1 },
+    { 4604, 2, 'l', -1 },
+    { 4606, 1, 'n', -1 },
+    { 4607, 1, 'p', -1 },
+    { 4608, 1, 'r', -1 },
+    { 4609, 1, 'r', -1 },
+    { 4610, 1, 'l', -1 },
+    { 4611, 1, 's', -1 },
+    { 4612, 1, 'p', -1 },
+    { 4613, 1, 'd', -1 },
+    { 4614, 1, 'l', -1 },
+    { 0, 0, ';', 1918 },
+    { 4615, 2, 'e', -1 },
+    { 4617, 1, 't', -1 },
+    { 0, 0, ';', 1922 },
+    { 4618, 2, 'b', -1 },
+    { 4620, 1, 'f', -1 },
+    { 4621, 1, 'd', -1 },
+    { 4622, 1, 'r', -1 },
+    { 4623, 1, 'a', -1 },
+    { 4624, 1, 'u', -1 },
+    { 4625, 2, 'u', -1 },
+    { 0, 0, ';', 1941 },
+    { 4627, 1, 'a', -1 },
+    { 4628, 1, 'f', -1 },
+    { 4629, 1, 'r', -1 },
+    { 4630, 1, 'r', -1 },
+    { 4631, 1, 't', -1 },
+    { 4632, 1, 'i', -1 },
+    { 4633, 1, 'a', -1 },
+    { 4634, 2, 'r', -1 },
+    { 4636, 1, 'a', -1 },
+    { 4637, 1, 'n', -1 },
+    { 0, 0, ';', 1955 },
+    { 4638, 1, 'E', -1 },
+    { 4639, 1, 'd', -1 },
+    { 4640, 2, 'e', -1 },
+    { 4642, 1, 'm', -1 },
+    { 4643, 2, 'n', -1 },
+    { 4645, 1, 'p', -1 },
+    { 4646, 1, 'r', -1 },
+    { 4647, 3, 's', -1 },
+    { 4650, 6, 'c', -1 },
+    { 0, 0, ';', 1981 },
+    { 4656, 1, 'g', -1 },
+    { 4657, 1, '1', 1983 },
+    { 4658, 1, '2', 1985 },
+    { 4659, 1, '3', 1987 },
+    { 0, 0, ';', 1989 },
+    { 4660, 1, 'E', -1 },
+    { 4661, 2, 'd', -1 },
+    { 4663, 2, 'e', -1 },
+    { 4665, 1, 'h', -1 },
+    { 4666, 1, 'l', -1 },
+    { 4667, 1, 'm', -1 },
+    { 4668, 2, 'n', -1 },
+    { 4670, 1, 'p', -1 },
+    { 4671, 3, 's', -1 },
+    { 4674, 1, 'r', -1 },
+    { 4675, 2, 'r', -1 },
+    { 4677, 1, 'w', -1 },
+    { 4678, 1, 'i', -1 },
+    { 4679, 1, 'g', -1 },
+    { 0, 0, ';', 2018 },
+    { 4680, 1, 'k', -1 },
+    { 4681, 1, 'r', -1 },
+    { 4682, 1, 'd', -1 },
+    { 0, 0, ';', 2022 },
+    { 4683, 1, 't', -1 },
+    { 4684, 1, 'r', -1 },
+    { 0, 0, ';', 2025 },
+    { 4685, 1, 'r', -1 },
+    { 4686, 1, 't', -1 },
+    { 4687, 1, 'c', -1 },
+    { 4688, 1, 'n', -1 },
+    { 4689, 1, 'a', -1 },
+    { 4690, 1, 's', -1 },
+    { 4691, 1, 'r', -1 },
+    { 4692, 1, 'd', -1 },
+    { 4693, 1, 'e', -1 },
+    { 4694, 1, 't', -1 },
+    { 4695, 1, 'a', -1 },
+    { 0, 0, ';', 2046 },
+    { 4696, 1, 'b', -1 },
+    { 4697, 1, 'c', -1 },
+    { 4698, 2, 'f', -1 },
+    { 4700, 1, 'a', -1 },
+    { 4701, 1, 'i', -1 },
+    { 4702, 1, 'd', -1 },
+    { 4703, 1, 'a', -1 },
+    { 4704, 1, 'd', -1 },
+    { 4705, 1, 'e', -1 },
+    { 4706, 1, 'm', -1 },
+    { 4707, 1, 'p', -1 },
+    { 4708, 1, 's', -1 },
+    { 4709, 1, 't', -1 },
+    { 4710, 1, 'e', -1 },
+    { 4711, 1, 'r', -1 },
+    { 4712, 1, 'y', -1 },
+    { 4713, 1, 'c', -1 },
+    { 4714, 1, 'r', -1 },
+    { 4715, 1, 'x', -1 },
+    { 4716, 1, 'h', -1 },
+    { 4717, 1, 'r', -1 },
+    { 4718, 1, 'r', -1 },
+    { 4719, 1, 'u', -1 },
+    { 4720, 1, 'r', -1 },
+    { 4721, 1, 'c', -1 },
+    { 4722, 1, 'e', -1 },
+    { 4723, 1, 'r', -1 },
+    { 0, 0, ';', 2084 },
+    { 4724, 1, 'r', -1 },
+    { 4725, 1, 'l', -1 },
+    { 4726, 1, 'a', -1 },
+    { 4727, 1, 's', -1 },
+    { 0, 0, ';', 2089 },
+    { 4728, 1, 'a', -1 },
+    { 4729, 2, 'r', -1 },
+    { 4731, 1, 'l', -1 },
+    { 4732, 1, 'o', -1 },
+    { 4733, 1, 'r', -1 },
+    { 4734, 1, 'r', -1 },
+    { 4735, 1, 'c', -1 },
+    { 0, 0, ';', 2101 },
+    { 4736, 1, 'o', -1 },
+    { 4737, 1, 'f', -1 },
+    { 4738, 1, 'r', -1 },
+    { 4739, 1, 'o', -1 },
+    { 4740, 1, 'a', -1 },
+    { 4741, 1, 'u', -1 },
+    { 4742, 3, 'i', -1 },
+    { 4745, 1, 'p', -1 },
+    { 4746, 1, 'o', -1 },
+    { 4747, 1, 'r', -1 },
+    { 4748, 1, 'n', -1 },
+    { 4749, 1, 'r', -1 },
+    { 4750, 1, 'r', -1 },
+    { 4751, 1, 'o', -1 },
+    { 4752, 1, 'l', -1 },
+    { 4753, 2, 'i', -1 },
+    { 4755, 1, 'r', -1 },
+    { 4756, 1, 'l', 2124 },
+    { 4757, 1, 'n', -1 },
+    { 4758, 1, 'r', -1 },
+    { 4759, 2, 'r', -1 },
+    { 4761, 1, 's', -1 },
+    { 4762, 1, 'g', -1 },
+    { 4763, 1, 'e', -1 },
+    { 4764, 1, 'k', -1 },
+    { 4765, 1, 'n', -1 },
+    { 4766, 3, 'p', -1 },
+    { 4769, 2, 'r', -1 },
+    { 4771, 2, 's', -1 },
+    { 4773, 2, 't', -1 },
+    { 0, 0, ';', 2148 },
+    { 4775, 1, 's', -1 },
+    { 0, 0, ';', 2150 },
+    { 4776, 1, 'b', -1 },
+    { 4777, 1, 'e', -1 },
+    { 4778, 1, 'l', -1 },
+    { 4779, 1, 'b', -1 },
+    { 4780, 1, 't', -1 },
+    { 0, 0, ';', 2156 },
+    { 4781, 1, 'r', -1 },
+    { 4782, 2, 'u', -1 },
+    { 4784, 1, 'f', -1 },
+    { 4785, 1, 'o', -1 },
+    { 4786, 1, 'r', -1 },
+    { 4787, 1, 'r', -1 },
+    { 4788, 1, 'b', -1 },
+    { 4789, 1, 'p', -1 },
+    { 4790, 1, 'g', -1 },
+    { 4791, 1, 'r', -1 },
+    { 4792, 1, 'b', -1 },
+    { 4793, 1, 'g', -1 },
+    { 4794, 1, 'e', -1 },
+    { 0, 0, ';', 2174 },
+    { 4795, 1, 'f', -1 },
+    { 4796, 1, 'a', -1 },
+    { 4797, 1, 'r', -1 },
+    { 4798, 1, 'p', -1 },
+    { 4799, 1, 'r', -1 },
+    { 4800, 1, 'p', -1 },
+    { 4801, 1, 'r', -1 },
+    { 0, 0, ';', 2184 },
+    { 4802, 1, 'r', -1 },
+    { 4803, 1, 'r', -1 },
+    { 4804, 1, 'r', -1 },
+    { 4805, 1, 'r', -1 },
+    { 4806, 1, 'p', -1 },
+    { 4807, 1, 's', -1 },
+    { 4808, 1, 'o', -1 },
+    { 4809, 1, 'f', -1 },
+    { 4810, 1, 'l', -1 },
+    { 4811, 1, 'i', -1 },
+    { 4812, 1, 'r', -1 },
+    { 4813, 1, 'r', -1 },
+    { 4814, 1, 'r', -1 },
+    { 4815, 1, 'c', -1 },
+    { 4816, 1, 'l', -1 },
+    { 4817, 1, 'r', -1 },
+    { 4818, 1, 'e', -1 },
+    { 4819, 1, 'd', -1 },
+    { 4820, 1, 'u', -1 },
+    { 4821, 1, 'y', -1 },
+    { 4822, 1, 'r', -1 },
+    { 0, 0, ';', 2208 },
+    { 0, 0, ';', 2210 },
+    { 0, 0, ';', 2211 },
+    { 4823, 1, 'y', -1 },
+    { 4824, 1, 'f', -1 },
+    { 4825, 1, 'r', -1 },
+    { 4826, 1, 'y', -1 },
+    { 4827, 1, 'l', 2216 },
+    { 4828, 1, 'u', -1 },
+    { 4829, 1, 'r', -1 },
+    { 0, 0, ';', 2220 },
+    { 4830, 1, 't', -1 },
+    { 4831, 1, 't', -1 },
+    { 4832, 1, 'a', -1 },
+    { 0, 0, ';', 2224 },
+    { 4833, 1, 'y', -1 },
+    { 4834, 1, 'r', -1 },
+    { 4835, 1, 'f', -1 },
+    { 4836, 1, 'r', -1 },
+    { 0, 0, ';', 2229 },
+    { 4837, 1, 'j', -1 },
+    { 4838, 1, 'g', 0 },
+    { 4839, 1, 't', -1 },
+    { 4840, 1, 'v', -1 },
+    { 4841, 1, 'c', 7 },
+    { 4842, 1, 'v', -1 },
+    { 4843, 1, 'a', -1 },
+    { 4844, 1, 'r', -1 },
+    { 4845, 1, 'n', -1 },
+    { 0, 0, ';', 17 },
+    { 4846, 1, 'y', -1 },
+    { 4847, 1, 'g', 19 },
+    { 0, 0, ';', 21 },
+    { 4848, 1, 'g', -1 },
+    { 4849, 1, 'd', -1 },
+    { 0, 0, ';', 26 },
+    { 4850, 1, 's', -1 },
+    { 0, 0, ';', 28 },
+    { 4851, 1, 'e', -1 },
+    { 4852, 1, 'u', -1 },
+    { 4853, 1, 'o', -1 },
+    { 0, 0, ';', 33 },
+    { 0, 0, ';', 35 },
+    { 4854, 1, 'e', -1 },
+    { 0, 0, ';', 37 },
+    { 4855, 1, 'e', -1 },
+    { 0, 0, ';', 39 },
+    { 0, 0, ';', 41 },
+    { 4856, 1, 't', -1 },
+    { 4857, 1, 't', -1 },
+    { 4858, 1, 'e', -1 },
+    { 4859, 1, 'o', -1 },
+    { 4860, 1, 'i', -1 },
+    { 4861, 1, 'c', -1 },
+    { 4862, 1, 'i', -1 },
+    { 0, 0, ';', 51 },
+    { 4863, 1, 'l', -1 },
+    { 4864, 1, 'e', -1 },
+    { 4865, 1, 'l', -1 },
+    { 4866, 1, 'k', -1 },
+    { 4867, 1, 'e', -1 },
+    { 4868, 2, 'n', -1 },
+    { 4870, 1, 'r', -1 },
+    { 4871, 1, 'n', -1 },
+    { 4872, 1, 'o', -1 },
+    { 0, 0, ';', 68 },
+    { 4873, 1, 'o', -1 },
+    { 4874, 1, 't', -1 },
+    { 4875, 1, 's', -1 },
+    { 0, 0, ';', 72 },
+    { 4876, 1, 'a', -1 },
+    { 4877, 1, 'r', -1 },
+    { 0, 0, ';', 77 },
+    { 0, 0, ';', 78 },
+    { 0, 0, ';', 79 },
+    { 4878, 1, 'e', -1 },
+    { 0, 0, ';', 81 },
+    { 4879, 1, 'v', -1 },
+    { 4880, 1, 'o', -1 },
+    { 4881, 1, 'a', -1 },
+    { 4882, 1, 'r', -1 },
+    { 4883, 1, 'o', -1 },
+    { 4884, 1, 'e', -1 },
+    { 0, 0, ';', 95 },
+    { 4885, 1, 'o', -1 },
+    { 4886, 1, 'q', -1 },
+    { 4887, 1, 'l', -1 },
+    { 4888, 1, 'A', -1 },
+    { 4889, 1, 'B', -1 },
+    { 4890, 1, 'L', -1 },
+    { 4891, 1, 'R', -1 },
+    { 4892, 1, 'T', -1 },
+    { 4893, 1, 'a', -1 },
+    { 0, 0, ';', 127 },
+    { 4894, 1, 'o', -1 },
+    { 4895, 1, 't', -1 },
+    { 4896, 1, 'o', -1 },
+    { 4897, 1, 'c', 135 },
+    { 0, 0, ';', 138 },
+    { 4898, 1, 'v', -1 },
+    { 4899, 1, 'e', -1 },
+    { 4900, 1, 'r', -1 },
+    { 4901, 2, 'y', -1 },
+    { 4903, 1, 'n', -1 },
+    { 0, 0, ';', 147 },
+    { 4904, 1, 'l', -1 },
+    { 4905, 2, 'l', -1 },
+    { 4907, 1, 'l', -1 },
+    { 0, 0, ';', 152 },
+    { 0, 0, ';', 153 },
+    { 0, 0, ';', 156 },
+    { 4908, 1, 't', -1 },
+    { 4909, 1, 'n', -1 },
+    { 4910, 1, 'e', -1 },
+    { 0, 0, ';', 163 },
+    { 4911, 1, 'l', -1 },
+    { 4912, 1, 'i', -1 },
+    { 0, 0, ';', 166 },
+    { 0, 0, ';', 167 },
+    { 4913, 2, 'a', -1 },
+    { 4915, 1, 'v', -1 },
+    { 4916, 1, 'i', -1 },
+    { 4917, 1, 'c', -1 },
+    { 0, 0, ';', 176 },
+    { 0, 0, ';', 179 },
+    { 4918, 1, 't', -1 },
+    { 0, 0, ';', 187 },
+    { 4919, 1, 'c', -1 },
+    { 4920, 1, 'k', -1 },
+    { 4921, 1, 'c', -1 },
+    { 4922, 1, 'e', -1 },
+    { 0, 0, ';', 195 },
+    { 4923, 1, 'z', -1 },
+    { 0, 0, ';', 197 },
+    { 4924, 1, 'o', -1 },
+    { 4925, 1, 'D', -1 },
+    { 4926, 1, 'E', -1 },
+    { 0, 0, ';', 201 },
+    { 4927, 1, 'g', -1 },
+    { 0, 0, ';', 203 },
+    { 4928, 1, 't', -1 },
+    { 4929, 1, 'c', 206 },
+    { 0, 0, ';', 209 },
+    { 4930, 1, 'v', -1 },
+    { 4931, 1, 'r', -1 },
+    { 4932, 1, 'i', -1 },
+    { 4933, 1, 'i', -1 },
+    { 4934, 1, 'g', -1 },
+    { 4935, 1, 'r', -1 },
+    { 4936, 1, 's', -1 },
+    { 4937, 1, 'n', -1 },
+    { 0, 0, ';', 223 },
+    { 0, 0, ';', 224 },
+    { 0, 0, ';', 225 },
+    { 4938, 1, 'd', -1 },
+    { 4939, 1, 'y', -1 },
+    { 0, 0, ';', 229 },
+    { 4940, 1, 'c', -1 },
+    { 0, 0, ';', 233 },
+    { 0, 0, ';', 234 },
+    { 4941, 1, 'c', -1 },
+    { 4942, 1, 'y', -1 },
+    { 0, 0, ';', 237 },
+    { 0, 0, ';', 238 },
+    { 4943, 1, 'a', -1 },
+    { 4944, 1, 'i', -1 },
+    { 0, 0, ';', 243 },
+    { 0, 0, ';', 244 },
+    { 0, 0, ';', 245 },
+    { 4945, 1, 't', -1 },
+    { 4946, 1, 'd', -1 },
+    { 0, 0, ';', 250 },
+    { 4947, 1, 'a', -1 },
+    { 0, 0, ';', 252 },
+    { 4948, 1, 'o', -1 },
+    { 4949, 1, 'i', -1 },
+    { 4950, 2, 'A', -1 },
+    { 4952, 1, 'C', -1 },
+    { 4953, 1, 'D', -1 },
+    { 4954, 1, 'F', -1 },
+    { 4955, 1, 'R', -1 },
+    { 4956, 2, 'T', -1 },
+    { 4958, 1, 'U', -1 },
+    { 4959, 1, 'V', -1 },
+    { 4960, 1, 'a', -1 },
+    { 4961, 1, 'r', -1 },
+    { 4962, 1, 'E', -1 },
+    { 4963, 1, 'F', -1 },
+    { 4964, 1, 'G', -1 },
+    { 4965, 1, 'L', -1 },
+    { 4966, 1, 'S', -1 },
+    { 4967, 1, 'T', -1 },
+    { 4968, 1, 't', -1 },
+    { 4969, 1, 'o', -1 },
+    { 4970, 1, 'L', -1 },
+    { 4971, 1, 'R', -1 },
+    { 4972, 1, 'l', -1 },
+    { 4973, 1, 'r', -1 },
+    { 0, 0, ';', 298 },
+    { 4974, 2, 'r', -1 },
+    { 0, 0, ';', 301 },
+    { 4976, 1, 'o', -1 },
+    { 4977, 1, 'u', -1 },
+    { 4978, 1, 'i', -1 },
+    { 4979, 1, 's', -1 },
+    { 0, 0, ';', 311 },
+    { 0, 0, ';', 312 },
+    { 0, 0, ';', 314 },
+    { 4980, 1, 't', -1 },
+    { 4981, 1, 'o', -1 },
+    { 4982, 1, 'i', -1 },
+    { 4983, 1, 't', -1 },
+    { 4984, 1, 'e', -1 },
+    { 4985, 1, 'i', -1 },
+    { 4986, 1, 'e', -1 },
+    { 4987, 1, 'r', -1 },
+    { 0, 0, ';', 329 },
+    { 4988, 1, 'o', -1 },
+    { 4989, 1, 'u', -1 },
+    { 4990, 1, 'o', -1 },
+    { 4991, 1, 'l', -1 },
+    { 4992, 1, 'q', -1 },
+    { 4993, 1, 'x', -1 },
+    { 4994, 1, 'r', -1 },
+    { 4995, 1, 'u', -1 },
+    { 4996, 2, 'e', -1 },
+    { 4998, 1, 'e', -1 },
+    { 4999, 1, 'r', -1 },
+    { 5000, 1, 'e', -1 },
+    { 5001, 1, 'i', -1 },
+    { 5002, 1, 'q', -1 },
+    { 5003, 3, 'u', -1 },
+    { 5006, 1, 'i', -1 },
+    { 5007, 1, 'e', -1 },
+    { 0, 0, ';', 382 },
+    { 5008, 1, 'd', -1 },
+    { 5009, 1, 'g', -1 },
+    { 5010, 1, 't', -1 },
+    { 5011, 1, 'c', 389 },
+    { 5012, 1, 'a', -1 },
+    { 5013, 1, 'v', -1 },
+    { 5014, 1, 'r', -1 },
+    { 5015, 1, 'a', -1 },
+    { 5016, 1, 'r', -1 },
+    { 0, 0, ';', 399 },
+    { 5017, 1, 'C', -1 },
+    { 0, 0, ';', 403 },
+    { 5018, 1, 's', -1 },
+    { 5019, 1, 'd', -1 },
+    { 5020, 1, 'e', -1 },
+    { 0, 0, ';', 410 },
+    { 5021, 2, 'B', -1 },
+    { 5023, 1, 'P', -1 },
+    { 5024, 1, 'i', -1 },
+    { 5025, 1, 'M', -1 },
+    { 5026, 1, 'c', -1 },
+    { 0, 0, ';', 422 },
+    { 5027, 1, 'e', -1 },
+    { 5028, 1, 'e', -1 },
+    { 5029, 1, 'u', -1 },
+    { 5030, 1, 'o', -1 },
+    { 0, 0, ';', 432 },
+    { 0, 0, ';', 435 },
+    { 0, 0, ';', 437 },
+    { 0, 0, ';', 438 },
+    { 5031, 1, 'r', -1 },
+    { 5032, 1, 't', -1 },
+    { 0, 0, ';', 443 },
+    { 0, 0, ';', 444 },
+    { 5033, 1, 't', -1 },
+    { 5034, 1, 'o', -1 },
+    { 5035, 1, 'i', -1 },
+    { 5036, 1, 'r', -1 },
+    { 5037, 8, 't', -1 },
+    { 0, 0, ';', 478 },
+    { 5045, 1, 'd', -1 },
+    { 5046, 1, 'h', -1 },
+    { 0, 0, ';', 481 },
+    { 5047, 1, 'D', -1 },
+    { 5048, 1, 'c', -1 },
+    { 0, 0, ';', 485 },
+    { 5049, 1, 'c', -1 },
+    { 5050, 1, 't', -1 },
+    { 5051, 1, 'o', -1 },
+    { 5052, 1, 'i', -1 },
+    { 5053, 1, 'c', -1 },
+    { 5054, 4, 't', -1 },
+    { 5058, 1, 'a', -1 },
+    { 5059, 1, 'l', -1 },
+    { 0, 0, ';', 500 },
+    { 0, 0, ';', 501 },
+    { 5060, 1, 'r', -1 },
+    { 0, 0, ';', 509 },
+    { 0, 0, ';', 510 },
+    { 5061, 1, 'e', -1 },
+    { 5062, 1, 'e', -1 },
+    { 5063, 1, 'T', -1 },
+    { 5064, 1, 'r', -1 },
+    { 5065, 1, 'e', -1 },
+    { 5066, 1, 'N', 524 },
+    { 5067, 1, 'E', -1 },
+    { 5068, 1, 'y', -1 },
+    { 0, 0, ';', 528 },
+    { 5069, 1, 'o', -1 },
+    { 5070, 1, 'i', -1 },
+    { 5071, 1, 'e', -1 },
+    { 5072, 1, 'a', -1 },
+    { 5073, 1, 'k', -1 },
+    { 5074, 1, 'S', -1 },
+    { 5075, 4, 'e', -1 },
+    { 0, 0, ';', 543 },
+    { 5079, 1, 'l', -1 },
+    { 0, 0, ';', 545 },
+    { 5080, 1, 'o', -1 },
+    { 5081, 1, 't', -1 },
+    { 0, 0, ';', 549 },
+    { 5082, 1, 'o', -1 },
+    { 5083, 1, 'y', -1 },
+    { 5084, 1, 'v', -1 },
+    { 5085, 1, 'c', 553 },
+    { 5086, 1, 'a', -1 },
+    { 5087, 1, 'v', -1 },
+    { 5088, 1, 'r', -1 },
+    { 5089, 2, 'r', -1 },
+    { 5091, 2, 'n', -1 },
+    { 5093, 1, 'n', -1 },
+    { 0, 0, ';', 568 },
+    { 5094, 1, 'r', -1 },
+    { 5095, 1, 'w', -1 },
+    { 5096, 1, 'u', -1 },
+    { 5097, 2, 'e', -1 },
+    { 5099, 1, 'r', -1 },
+    { 5100, 1, 'w', -1 },
+    { 5101, 2, 'r', -1 },
+    { 0, 0, ';', 580 },
+    { 5103, 1, 'l', -1 },
+    { 5104, 1, 'g', -1 },
+    { 0, 0, ';', 583 },
+    { 5105, 1, 'd', -1 },
+    { 0, 0, ';', 586 },
+    { 5106, 1, 'h', -1 },
+    { 0, 0, ';', 588 },
+    { 5107, 2, 'h', -1 },
+    { 5109, 1, 'a', -1 },
+    { 0, 0, ';', 594 },
+    { 5110, 1, 'i', -1 },
+    { 5111, 1, 'T', -1 },
+    { 0, 0, ';', 601 },
+    { 0, 0, ';', 602 },
+    { 5112, 1, 's', -1 },
+    { 5113, 1, 'c', -1 },
+    { 5114, 1, 'e', -1 },
+    { 0, 0, ';', 607 },
+    { 0, 0, ';', 608 },
+    { 0, 0, ';', 611 },
+    { 0, 0, ';', 612 },
+    { 0, 0, ';', 613 },
+    { 0, 0, ';', 614 },
+    { 0, 0, ';', 615 },
+    { 5115, 1, 't', -1 },
+    { 5116, 1, 'c', -1 },
+    { 0, 0, ';', 621 },
+    { 0, 0, ';', 622 },
+    { 0, 0, ';', 623 },
+    { 0, 0, ';', 624 },
+    { 5117, 1, 't', -1 },
+    { 5118, 1, 'o', -1 },
+    { 0, 0, ';', 628 },
+    { 5119, 1, 'W', -1 },
+    { 0, 0, ';', 630 },
+    { 0, 0, ';', 632 },
+    { 0, 0, ';', 633 },
+    { 5120, 1, 't', -1 },
+    { 5121, 1, 'v', -1 },
+    { 5122, 1, 'c', 640 },
+    { 5123, 1, 'e', 642 },
+    { 5124, 1, 'g', 645 },
+    { 5125, 1, 'v', -1 },
+    { 5126, 1, 's', -1 },
+    { 5127, 1, 'h', -1 },
+    { 5128, 1, 'a', -1 },
+    { 5129, 1, 'r', -1 },
+    { 5130, 1, 'g', -1 },
+    { 5131, 1, 'n', -1 },
+    { 0, 0, ';', 660 },
+    { 5132, 1, 'l', -1 },
+    { 0, 0, ';', 662 },
+    { 0, 0, ';', 664 },
+    { 5133, 1, 'e', -1 },
+    { 5134, 1, 's', -1 },
+    { 5135, 2, 't', -1 },
+    { 5137, 1, 'p', -1 },
+    { 5138, 1, 't', -1 },
+    { 5139, 1, 'a', -1 },
+    { 5140, 1, 'n', -1 },
+    { 0, 0, ';', 682 },
+    { 5141, 1, 'i', -1 },
+    { 0, 0, ';', 687 },
+    { 0, 0, ';', 688 },
+    { 5142, 1, 'o', -1 },
+    { 5143, 1, 'g', 691 },
+    { 0, 0, ';', 693 },
+    { 5144, 2, 'p', -1 },
+    { 5146, 1, 'd', -1 },
+    { 0, 0, ';', 700 },
+    { 5147, 1, 'n', -1 },
+    { 5148, 1, 't', -1 },
+    { 0, 0, ';', 703 },
+    { 5149, 1, 'c', -1 },
+    { 5150, 1, 'e', -1 },
+    { 5151, 1, 'p', -1 },
+    { 5152, 1, 's', -1 },
+    { 5153, 1, 'e', -1 },
+    { 5154, 1, 'e', -1 },
+    { 0, 0, ';', 712 },
+    { 5155, 1, 't', -1 },
+    { 5156, 1, 'g', -1 },
+    { 5157, 1, 'o', -1 },
+    { 5158, 1, 'u', -1 },
+    { 5159, 1, 't', -1 },
+    { 5160, 1, 'i', -1 },
+    { 5161, 1, 'o', -1 },
+    { 0, 0, ';', 722 },
+    { 0, 0, ';', 723 },
+    { 5162, 1, 'e', -1 },
+    { 5163, 1, 'a', -1 },
+    { 5164, 1, 'i', -1 },
+    { 5165, 1, 'u', -1 },
+    { 5166, 1, 'd', -1 },
+    { 5167, 1, 'p', -1 },
+    { 5168, 1, 't', -1 },
+    { 5169, 1, 'q', -1 },
+    { 5170, 1, 't', -1 },
+    { 5171, 1, 'r', -1 },
+    { 5172, 1, 'p', -1 },
+    { 5173, 1, 'e', -1 },
+    { 5174, 1, 'e', -1 },
+    { 5175, 1, 'o', -1 },
+    { 5176, 3, 'k', -1 },
+    { 5179, 1, 'k', -1 },
+    { 5180, 1, '2', -1 },
+    { 5181, 1, '4', -1 },
+    { 5182, 1, '4', -1 },
+    { 5183, 1, 'k', -1 },
+    { 5184, 1, 'u', -1 },
+    { 0, 0, ';', 753 },
+    { 0, 0, ';', 754 },
+    { 5185, 1, 'o', -1 },
+    { 5186, 1, 'i', -1 },
+    { 5187, 1, 'L', -1 },
+    { 5188, 1, 'R', -1 },
+    { 5189, 1, 'l', -1 },
+    { 5190, 1, 'r', -1 },
+    { 0, 0, ';', 762 },
+    { 5191, 1, 'D', -1 },
+    { 5192, 1, 'U', -1 },
+    { 5193, 1, 'd', -1 },
+    { 5194, 1, 'u', -1 },
+    { 5195, 1, 'L', -1 },
+    { 5196, 1, 'R', -1 },
+    { 5197, 1, 'l', -1 },
+    { 5198, 1, 'r', -1 },
+    { 0, 0, ';', 771 },
+    { 5199, 1, 'H', -1 },
+    { 5200, 1, 'L', -1 },
+    { 5201, 1, 'R', -1 },
+    { 5202, 1, 'h', -1 },
+    { 5203, 1, 'l', -1 },
+    { 5204, 1, 'r', -1 },
+    { 5205, 1, 'o', -1 },
+    { 5206, 1, 'L', -1 },
+    { 5207, 1, 'R', -1 },
+    { 5208, 1, 'l', -1 },
+    { 5209, 1, 'r', -1 },
+    { 0, 0, ';', 783 },
+    { 5210, 1, 'D', -1 },
+    { 5211, 1, 'U', -1 },
+    { 5212, 1, 'd', -1 },
+    { 5213, 1, 'u', -1 },
+    { 5214, 1, 'i', -1 },
+    { 5215, 1, 'l', -1 },
+    { 5216, 1, 'i', -1 },
+    { 5217, 1, 'L', -1 },
+    { 5218, 1, 'R', -1 },
+    { 5219, 1, 'l', -1 },
+    { 5220, 1, 'r', -1 },
+    { 0, 0, ';', 795 },
+    { 5221, 1, 'H', -1 },
+    { 5222, 1, 'L', -1 },
+    { 5223, 1, 'R', -1 },
+    { 5224, 1, 'h', -1 },
+    { 5225, 1, 'l', -1 },
+    { 5226, 1, 'r', -1 },
+    { 5227, 1, 'm', -1 },
+    { 5228, 1, 'e', -1 },
+    { 5229, 1, 'a', -1 },
+    { 0, 0, ';', 806 },
+    { 5230, 1, 'i', -1 },
+    { 0, 0, ';', 808 },
+    { 5231, 1, 'e', -1 },
+    { 0, 0, ';', 810 },
+    { 5232, 1, 'b', -1 },
+    { 5233, 1, 'h', -1 },
+    { 0, 0, ';', 813 },
+    { 5234, 1, 'e', -1 },
+    { 0, 0, ';', 815 },
+    { 5235, 1, 'E', -1 },
+    { 5236, 2, 'e', -1 },
+    { 5238, 1, 't', -1 },
+    { 5239, 1, 'n', -1 },
+    { 5240, 1, 'r', -1 },
+    { 5241, 1, 'a', -1 },
+    { 5242, 1, 'u', -1 },
+    { 5243, 1, 'o', -1 },
+    { 0, 0, ';', 826 },
+    { 5244, 1, 't', -1 },
+    { 5245, 1, 'n', -1 },
+    { 5246, 1, 's', -1 },
+    { 5247, 1, 'o', -1 },
+    { 5248, 1, 'i', -1 },
+    { 5249, 1, 'c', -1 },
+    { 5250, 2, 's', -1 },
+    { 0, 0, ';', 836 },
+    { 5252, 1, 'l', 837 },
+    { 5253, 1, 't', -1 },
+    { 0, 0, ';', 841 },
+    { 5254, 1, 'e', -1 },
+    { 0, 0, ';', 844 },
+    { 5255, 2, 'k', -1 },
+    { 0, 0, ';', 849 },
+    { 0, 0, ';', 850 },
+    { 5257, 1, 'e', -1 },
+    { 5258, 1, 'l', -1 },
+    { 0, 0, ';', 859 },
+    { 5259, 1, 'n', -1 },
+    { 5260, 1, 'i', -1 },
+    { 5261, 1, 'c', -1 },
+    { 5262, 2, 's', -1 },
+    { 5264, 2, 'n', -1 },
+    { 5266, 2, 'a', -1 },
+    { 0, 0, ';', 870 },
+    { 5268, 1, 'f', -1 },
+    { 5269, 1, 'l', -1 },
+    { 0, 0, ';', 874 },
+    { 5270, 1, 'd', -1 },
+    { 5271, 1, 'n', -1 },
+    { 0, 0, ';', 877 },
+    { 5272, 1, 'o', -1 },
+    { 0, 0, ';', 880 },
+    { 5273, 1, 's', -1 },
+    { 5274, 1, 'r', -1 },
+    { 5275, 1, 's', -1 },
+    { 0, 0, ';', 884 },
+    { 0, 0, ';', 885 },
+    { 5276, 1, 'e', -1 },
+    { 0, 0, ';', 887 },
+    { 5277, 1, 'e', -1 },
+    { 5278, 1, 't', -1 },
+    { 5279, 1, 'r', -1 },
+    { 5280, 1, 'r', -1 },
+    { 5281, 1, 'c', -1 },
+    { 5282, 1, 'r', -1 },
+    { 5283, 1, 'r', -1 },
+    { 5284, 1, 'a', -1 },
+    { 5285, 1, 'u', -1 },
+    { 5286, 1, 'o', -1 },
+    { 5287, 1, 'r', -1 },
+    { 0, 0, ';', 902 },
+    { 5288, 1, 'r', -1 },
+    { 5289, 3, 'y', -1 },
+    { 5292, 1, 'e', -1 },
+    { 5293, 1, 'e', -1 },
+    { 5294, 1, 'e', -1 },
+    { 5295, 1, 'd', -1 },
+    { 5296, 1, 'n', -1 },
+    { 5297, 1, 't', -1 },
+    { 5298, 1, 't', -1 },
+    { 0, 0, ';', 918 },
+    { 0, 0, ';', 919 },
+    { 5299, 1, 'e', -1 },
+    { 5300, 1, 't', -1 },
+    { 0, 0, ';', 922 },
+    { 0, 0, ';', 923 },
+    { 5301, 1, 'v', -1 },
+    { 5302, 1, 'r', -1 },
+    { 5303, 1, 'c', -1 },
+    { 5304, 1, 'o', -1 },
+    { 5305, 1, 'g', -1 },
+    { 5306, 1, 'r', -1 },
+    { 5307, 1, 's', -1 },
+    { 5308, 1, 'a', -1 },
+    { 5309, 1, 't', -1 },
+    { 5310, 1, 'h', -1 },
+    { 5311, 1, 'l', -1 },
+    { 5312, 1, 'r', -1 },
+    { 0, 0, ';', 941 },
+    { 5313, 1, 'o', -1 },
+    { 5314, 1, 's', -1 },
+    { 5315, 1, 'm', -1 },
+    { 5316, 1, 'n', -1 },
+    { 5317, 1, 'd', -1 },
+    { 5318, 1, 'n', -1 },
+    { 0, 0, ';', 953 },
+    { 5319, 1, 'r', -1 },
+    { 5320, 1, 'o', -1 },
+    { 5321, 1, 'a', -1 },
+    { 0, 0, ';', 957 },
+    { 5322, 2, 'q', -1 },
+    { 5324, 1, 'i', -1 },
+    { 5325, 1, 'l', -1 },
+    { 5326, 1, 'q', -1 },
+    { 5327, 1, 'l', -1 },
+    { 5328, 1, 'a', -1 },
+    { 5329, 1, 'd', -1 },
+    { 5330, 1, 'h', -1 },
+    { 5331, 1, 'a', -1 },
+    { 5332, 1, 'r', -1 },
+    { 5333, 1, 'o', -1 },
+    { 0, 0, ';', 972 },
+    { 0, 0, ';', 973 },
+    { 0, 0, ';', 974 },
+    { 5334, 1, 'o', -1 },
+    { 5335, 1, 't', -1 },
+    { 0, 0, ';', 977 },
+    { 5336, 1, 'f', -1 },
+    { 5337, 1, 'r', -1 },
+    { 5338, 1, 'r', -1 },
+    { 5339, 1, 'g', -1 },
+    { 0, 0, ';', 982 },
+    { 5340, 1, 'r', -1 },
+    { 5341, 1, 't', -1 },
+    { 0, 0, ';', 985 },
+    { 5342, 1, 't', -1 },
+    { 5343, 1, 'e', -1 },
+    { 5344, 1, 'o', -1 },
+    { 0, 0, ';', 990 },
+    { 5345, 1, 'c', 991 },
+    { 5346, 1, 'o', -1 },
+    { 0, 0, ';', 995 },
+    { 5347, 1, 't', -1 },
+    { 5348, 1, 'v', -1 },
+    { 5349, 1, 'o', -1 },
+    { 5350, 1, 't', -1 },
+    { 5351, 1, 'o', -1 },
+    { 5352, 1, 'r', -1 },
+    { 5353, 3, 'y', -1 },
+    { 5356, 2, '1', -1 },
+    { 0, 0, ';', 1015 },
+    { 0, 0, ';', 1017 },
+    { 5358, 1, 'n', -1 },
+    { 0, 0, ';', 1019 },
+    { 0, 0, ';', 1020 },
+    { 5359, 1, 's', -1 },
+    { 5360, 1, 's', -1 },
+    { 0, 0, ';', 1023 },
+    { 5361, 1, 'l', -1 },
+    { 5362, 1, 'v', -1 },
+    { 5363, 1, 'r', -1 },
+    { 5364, 1, 'l', -1 },
+    { 5365, 1, 'm', -1 },
+    { 5366, 1, 'a', -1 },
+    { 5367, 1, 'l', -1 },
+    { 5368, 1, 's', -1 },
+    { 5369, 2, 'v', -1 },
+    { 5371, 1, 'a', -1 },
+    { 5372, 1, 't', -1 },
+    { 5373, 1, 'r', -1 },
+    { 0, 0, ';', 1038 },
+    { 5374, 1, 't', -1 },
+    { 0, 0, ';', 1040 },
+    { 0, 0, ';', 1045 },
+    { 0, 0, ';', 1046 },
+    { 0, 0, ';', 1047 },
+    { 5375, 1, 't', -1 },
+    { 5376, 1, 'c', -1 },
+    { 5377, 1, 'n', -1 },
+    { 5378, 1, 'i', -1 },
+    { 5379, 1, 'l', -1 },
+    { 5380, 1, 'i', -1 },
+    { 5381, 1, 'g', -1 },
+    { 5382, 1, 'i', -1 },
+    { 5383, 1, 'g', -1 },
+    { 5384, 1, 'g', -1 },
+    { 0, 0, ';', 1060 },
+    { 5385, 1, 'g', -1 },
+    { 5386, 1, 's', -1 },
+    { 0, 0, ';', 1063 },
+    { 0, 0, ';', 1064 },
+    { 5387, 1, 'l', -1 },
+    { 0, 0, ';', 1066 },
+    { 5388, 1, 'v', -1 },
+    { 5389, 1, 't', -1 },
+    { 5390, 6, '1', -1 },
+    { 5396, 2, '2', -1 },
+    { 5398, 3, '3', -1 },
+    { 5401, 1, '4', -1 },
+    { 5402, 2, '5', -1 },
+    { 5404, 1, '7', -1 },
+    { 5405, 1, 'l', -1 },
+    { 5406, 1, 'n', -1 },
+    { 0, 0, ';', 1089 },
+    { 5407, 1, 't', -1 },
+    { 5408, 2, 'a', -1 },
+    { 5410, 1, 'v', -1 },
+    { 5411, 1, 'c', -1 },
+    { 0, 0, ';', 1099 },
+    { 0, 0, ';', 1103 },
+    { 5412, 1, 'l', -1 },
+    { 5413, 1, 'c', -1 },
+    { 5414, 1, 'o', -1 },
+    { 0, 0, ';', 1110 },
+    { 5415, 1, 'e', -1 },
+    { 5416, 1, 'l', -1 },
+    { 0, 0, ';', 1116 },
+    { 0, 0, ';', 1122 },
+    { 5417, 1, 'p', -1 },
+    { 0, 0, ';', 1125 },
+    { 5418, 1, 'q', -1 },
+    { 5419, 1, 'm', -1 },
+    { 0, 0, ';', 1128 },
+    { 5420, 1, 'e', -1 },
+    { 0, 0, ';', 1130 },
+    { 0, 0, ';', 1131 },
+    { 5421, 1, 'e', -1 },
+    { 5422, 1, 'l', -1 },
+    { 0, 0, ';', 1136 },
+    { 5423, 1, 'r', -1 },
+    { 5424, 1, 't', -1 },
+    { 5425, 1, 'a', -1 },
+    { 5426, 1, 'e', -1 },
+    { 5427, 1, 'p', -1 },
+    { 5428, 1, 'r', -1 },
+    { 5429, 1, 'o', -1 },
+    { 5430, 2, 'q', -1 },
+    { 5432, 1, 'e', -1 },
+    { 5433, 1, 'i', -1 },
+    { 5434, 1, 't', -1 },
+    { 0, 0, ';', 1149 },
+    { 0, 0, ';', 1150 },
+    { 5435, 1, 's', -1 },
+    { 0, 0, ';', 1152 },
+    { 5436, 1, 'l', -1 },
+    { 5437, 1, 'c', -1 },
+    { 0, 0, ';', 1155 },
+    { 5438, 1, 'c', -1 },
+    { 5439, 1, 'w', -1 },
+    { 0, 0, ';', 1158 },
+    { 5440, 1, 'c', -1 },
+    { 5441, 1, 't', -1 },
+    { 5442, 1, 'i', -1 },
+    { 5443, 1, 'o', -1 },
+    { 5444, 1, 'a', -1 },
+    { 5445, 1, 'a', -1 },
+    { 5446, 1, 'r', -1 },
+    { 5447, 1, 'h', -1 },
+    { 5448, 1, 'l', -1 },
+    { 5449, 1, 'r', -1 },
+    { 0, 0, ';', 1171 },
+    { 5450, 1, 'a', -1 },
+    { 0, 0, ';', 1173 },
+    { 5451, 1, 's', -1 },
+    { 5452, 1, 'o', -1 },
+    { 5453, 1, 'l', -1 },
+    { 5454, 1, 'e', -1 },
+    { 5455, 1, 't', -1 },
+    { 5456, 1, 'c', 1181 },
+    { 0, 0, ';', 1184 },
+    { 5457, 1, 'l', 1185 },
+    { 5458, 1, 'v', -1 },
+    { 5459, 1, 'n', -1 },
+    { 5460, 1, 't', -1 },
+    { 5461, 1, 'i', -1 },
+    { 5462, 1, 'a', -1 },
+    { 5463, 1, 'g', -1 },
+    { 5464, 1, 'r', -1 },
+    { 5465, 1, 'e', -1 },
+    { 5466, 1, 'l', -1 },
+    { 5467, 1, 'p', -1 },
+    { 5468, 1, 'h', -1 },
+    { 0, 0, ';', 1202 },
+    { 5469, 1, 'd', -1 },
+    { 5470, 1, 'r', -1 },
+    { 5471, 2, 'n', -1 },
+    { 5473, 1, 'o', -1 },
+    { 5474, 1, 'a', -1 },
+    { 5475, 1, 'g', -1 },
+    { 5476, 1, 'r', -1 },
+    { 5477, 1, 'a', -1 },
+    { 5478, 1, 'r', -1 },
+    { 0, 0, ';', 1215 },
+    { 5479, 1, 'n', -1 },
+    { 0, 0, ';', 1217 },
+    { 0, 0, ';', 1218 },
+    { 5480, 1, 'd', -1 },
+    { 5481, 1, 's', -1 },
+    { 0, 0, ';', 1222 },
+    { 0, 0, ';', 1223 },
+    { 5482, 1, 'E', -1 },
+    { 5483, 1, 'd', -1 },
+    { 5484, 2, 's', -1 },
+    { 5486, 1, 'v', -1 },
+    { 5487, 1, 'd', -1 },
+    { 5488, 1, 'y', -1 },
+    { 0, 0, ';', 1233 },
+    { 5489, 1, 'c', -1 },
+    { 5490, 1, 'h', -1 },
+    { 0, 0, ';', 1238 },
+    { 0, 0, ';', 1239 },
+    { 5491, 1, 'c', -1 },
+    { 5492, 1, 'y', -1 },
+    { 5493, 2, 'a', -1 },
+    { 5495, 1, 'i', -1 },
+    { 5496, 1, 'e', -1 },
+    { 0, 0, ';', 1248 },
+    { 0, 0, ';', 1249 },
+    { 0, 0, ';', 1250 },
+    { 0, 0, ';', 1251 },
+    { 5497, 1, 'r', -1 },
+    { 0, 0, ';', 1253 },
+    { 5498, 1, 'i', -1 },
+    { 5499, 1, 'r', -1 },
+    { 0, 0, ';', 1258 },
+    { 5500, 1, 't', -1 },
+    { 5501, 1, 'p', -1 },
+    { 5502, 1, 'a', -1 },
+    { 5503, 1, 'd', -1 },
+    { 0, 0, ';', 1263 },
+    { 5504, 1, 'd', -1 },
+    { 5505, 1, 'l', -1 },
+    { 5506, 1, 'o', 1267 },
+    { 0, 0, ';', 1269 },
+    { 5507, 2, 'b', -1 },
+    { 5509, 1, 'f', -1 },
+    { 5510, 1, 'h', -1 },
+    { 5511, 1, 'l', -1 },
+    { 5512, 1, 'p', -1 },
+    { 5513, 1, 's', -1 },
+    { 5514, 1, 't', -1 },
+    { 5515, 1, 'i', -1 },
+    { 0, 0, ';', 1280 },
+    { 5516, 1, 's', -1 },
+    { 5517, 1, 'r', -1 },
+    { 5518, 1, 'k', -1 },
+    { 5519, 2, 'c', -1 },
+    { 5521, 1, 'e', -1 },
+    { 5522, 1, 's', -1 },
+    { 5523, 1, 'o', -1 },
+    { 5524, 1, 'i', -1 },
+    { 5525, 1, 'l', -1 },
+    { 0, 0, ';', 1292 },
+    { 0, 0, ';', 1294 },
+    { 5526, 2, 'o', -1 },
+    { 5528, 1, 'h', -1 },
+    { 5529, 1, 's', -1 },
+    { 0, 0, ';', 1299 },
+    { 5530, 1, 'a', -1 },
+    { 5531, 1, 'h', -1 },
+    { 5532, 1, 'l', -1 },
+    { 5533, 1, 'r', -1 },
+    { 5534, 1, 't', -1 },
+    { 0, 0, ';', 1313 },
+    { 5535, 1, 'l', -1 },
+    { 5536, 1, 'c', -1 },
+    { 5537, 1, 'o', -1 },
+    { 0, 0, ';', 1320 },
+    { 5538, 1, 'e', -1 },
+    { 5539, 1, 'a', -1 },
+    { 5540, 1, 'd', -1 },
+    { 5541, 1, 'e', -1 },
+    { 5542, 1, 'g', -1 },
+    { 5543, 1, 's', -1 },
+    { 5544, 1, 'h', -1 },
+    { 5545, 1, 'o', -1 },
+    { 5546, 1, 'd', -1 },
+    { 5547, 2, 'u', -1 },
+    { 5549, 1, 'k', -1 },
+    { 0, 0, ';', 1337 },
+    { 5550, 1, 'r', -1 },
+    { 5551, 1, 'r', -1 },
+    { 5552, 1, 'r', -1 },
+    { 5553, 1, 'i', -1 },
+    { 5554, 1, 'o', -1 },
+    { 5555, 1, 's', -1 },
+    { 0, 0, ';', 1347 },
+    { 5556, 1, 'p', -1 },
+    { 0, 0, ';', 1350 },
+    { 5557, 1, 'q', -1 },
+    { 5558, 1, 'm', -1 },
+    { 5559, 1, 'g', -1 },
+    { 5560, 1, 'r', -1 },
+    { 5561, 1, 'k', -1 },
+    { 5562, 1, 'l', -1 },
+    { 5563, 1, 'm', -1 },
+    { 5564, 1, 'r', -1 },
+    { 5565, 1, 'a', -1 },
+    { 5566, 1, 'r', -1 },
+    { 0, 0, ';', 1363 },
+    { 5567, 1, 'u', -1 },
+    { 5568, 1, 'm', -1 },
+    { 5569, 1, 's', -1 },
+    { 5570, 1, 'a', -1 },
+    { 5571, 1, 'n', -1 },
+    { 0, 0, ';', 1370 },
+    { 0, 0, ';', 1371 },
+    { 5572, 1, 'l', -1 },
+    { 5573, 1, 'r', -1 },
+    { 5574, 1, 'r', -1 },
+    { 5575, 2, 'r', -1 },
+    { 5577, 1, 'i', -1 },
+    { 5578, 1, 'u', -1 },
+    { 0, 0, ';', 1380 },
+    { 0, 0, ';', 1382 },
+    { 5579, 1, 'e', -1 },
+    { 5580, 1, 'g', -1 },
+    { 0, 0, ';', 1385 },
+    { 5581, 2, 'o', -1 },
+    { 5583, 1, 'o', -1 },
+    { 0, 0, ';', 1391 },
+    { 5584, 1, 'r', -1 },
+    { 5585, 1, 't', -1 },
+    { 5586, 1, 'e', -1 },
+    { 5587, 1, 'e', -1 },
+    { 5588, 1, 'r', -1 },
+    { 5589, 1, 'e', -1 },
+    { 5590, 1, 'a', -1 },
+    { 0, 0, ';', 1399 },
+    { 5591, 1, 'e', -1 },
+    { 5592, 1, 'f', -1 },
+    { 5593, 1, 's', -1 },
+    { 5594, 1, 'h', -1 },
+    { 5595, 1, 't', -1 },
+    { 0, 0, ';', 1405 },
+    { 5596, 1, 't', -1 },
+    { 0, 0, ';', 1408 },
+    { 0, 0, ';', 1409 },
+    { 0, 0, ';', 1410 },
+    { 5597, 1, 'e', -1 },
+    { 5598, 1, 't', -1 },
+    { 5599, 1, 'e', -1 },
+    { 5600, 1, 'm', -1 },
+    { 5601, 1, 'h', -1 },
+    { 5602, 1, 'u', -1 },
+    { 5603, 1, 'o', 1424 },
+    { 5604, 1, 's', -1 },
+    { 5605, 1, 'i', -1 },
+    { 5606, 1, 'o', -1 },
+    { 5607, 3, 's', -1 },
+    { 0, 0, ';', 1435 },
+    { 0, 0, ';', 1436 },
+    { 5610, 1, 'u', -1 },
+    { 5611, 1, 'l', -1 },
+    { 0, 0, ';', 1439 },
+    { 0, 0, ';', 1441 },
+    { 5612, 1, 'o', -1 },
+    { 5613, 1, 'i', -1 },
+    { 5614, 1, 'p', -1 },
+    { 0, 0, ';', 1448 },
+    { 5615, 2, 't', -1 },
+    { 0, 0, ';', 1453 },
+    { 5617, 1, 'h', -1 },
+    { 5618, 1, 's', -1 },
+    { 5619, 1, 's', -1 },
+    { 5620, 1, 'a', -1 },
+    { 5621, 1, 't', -1 },
+    { 0, 0, ';', 1459 },
+    { 0, 0, ';', 1461 },
+    { 5622, 1, 'd', -1 },
+    { 5623, 1, 's', -1 },
+    { 5624, 1, 'r', -1 },
+    { 5625, 2, 'r', -1 },
+    { 0, 0, ';', 1469 },
+    { 5627, 2, 'p', -1 },
+    { 0, 0, ';', 1472 },
+    { 5629, 1, 'o', -1 },
+    { 5630, 1, 'i', -1 },
+    { 5631, 2, 'g', -1 },
+    { 0, 0, ';', 1477 },
+    { 5633, 1, 'h', -1 },
+    { 5634, 1, 'r', -1 },
+    { 5635, 1, 'h', -1 },
+    { 5636, 2, 'r', -1 },
+    { 5638, 1, 't', -1 },
+    { 5639, 1, 'i', -1 },
+    { 5640, 1, 'a', -1 },
+    { 5641, 1, 'm', -1 },
+    { 5642, 1, 's', -1 },
+    { 0, 0, ';', 1494 },
+    { 5643, 1, 'q', -1 },
+    { 5644, 1, 's', -1 },
+    { 0, 0, ';', 1497 },
+    { 5645, 1, 'm', -1 },
+    { 0, 0, ';', 1500 },
+    { 5646, 1, 'r', -1 },
+    { 5647, 1, 'r', -1 },
+    { 5648, 1, 'r', -1 },
+    { 0, 0, ';', 1506 },
+    { 0, 0, ';', 1508 },
+    { 5649, 1, 'r', -1 },
+    { 5650, 1, 'r', -1 },
+    { 0, 0, ';', 1512 },
+    { 5651, 2, 't', -1 },
+    { 0, 0, ';', 1516 },
+    { 5653, 1, 'q', -1 },
+    { 5654, 1, 's', -1 },
+    { 0, 0, ';', 1519 },
+    { 5655, 1, 's', -1 },
+    { 5656, 1, 'm', -1 },
+    { 5657, 2, 'i', -1 },
+    { 0, 0, ';', 1525 },
+    { 0, 0, ';', 1526 },
+    { 5659, 4, 'n', -1 },
+    { 5663, 2, 'i', -1 },
+    { 0, 0, ';', 1539 },
+    { 5665, 1, 'a', -1 },
+    { 5666, 1, 's', -1 },
+    { 5667, 1, 't', -1 },
+    { 5668, 1, 'i', -1 },
+    { 5669, 1, 'u', -1 },
+    { 0, 0, ';', 1546 },
+    { 5670, 2, 'c', -1 },
+    { 5672, 1, 'r', -1 },
+    { 5673, 3, 'r', -1 },
+    { 5676, 1, 'h', -1 },
+    { 5677, 2, 'i', -1 },
+    { 5679, 1, 'u', -1 },
+    { 0, 0, ';', 1558 },
+    { 0, 0, ';', 1559 },
+    { 5680, 1, 'r', -1 },
+    { 0, 0, ';', 1562 },
+    { 5681, 2, 'e', -1 },
+    { 5683, 1, 'd', -1 },
+    { 5684, 1, 'r', -1 },
+    { 5685, 2, 'u', -1 },
+    { 0, 0, ';', 1569 },
+    { 5687, 1, 'E', -1 },
+    { 5688, 1, 'e', -1 },
+    { 5689, 1, 's', -1 },
+    { 5690, 2, 'c', -1 },
+    { 0, 0, ';', 1577 },
+    { 5692, 1, 'E', -1 },
+    { 5693, 1, 'e', -1 },
+    { 5694, 1, 's', -1 },
+    { 0, 0, ';', 1583 },
+    { 5695, 1, 'd', -1 },
+    { 0, 0, ';', 1586 },
+    { 5696, 1, 'a', -1 },
+    { 5697, 1, 'r', -1 },
+    { 5698, 1, 'p', -1 },
+    { 5699, 1, 's', -1 },
+    { 5700, 1, 'r', -1 },
+    { 0, 0, ';', 1597 },
+    { 5701, 1, 's', -1 },
+    { 0, 0, ';', 1599 },
+    { 0, 0, ';', 1600 },
+    { 5702, 1, 'f', -1 },
+    { 5703, 1, 'r', -1 },
+    { 0, 0, ';', 1603 },
+    { 0, 0, ';', 1604 },
+    { 5704, 1, 'r', -1 },
+    { 5705, 1, 'r', -1 },
+    { 5706, 1, 'r', -1 },
+    { 5707, 1, 'm', -1 },
+    { 5708, 1, 'r', -1 },
+    { 5709, 1, 'h', -1 },
+    { 5710, 2, 'r', -1 },
+    { 5712, 1, 'a', -1 },
+    { 5713, 1, 't', -1 },
+    { 0, 0, ';', 1617 },
+    { 0, 0, ';', 1618 },
+    { 5714, 1, 'c', 1619 },
+    { 5715, 1, 'h', -1 },
+    { 5716, 1, 'a', -1 },
+    { 0, 0, ';', 1624 },
+    { 0, 0, ';', 1625 },
+    { 5717, 1, 'l', -1 },
+    { 5718, 1, 'g', -1 },
+    { 5719, 1, 'r', -1 },
+    { 0, 0, ';', 1630 },
+    { 5720, 1, 'v', -1 },
+    { 5721, 1, 'r', -1 },
+    { 0, 0, ';', 1636 },
+    { 5722, 1, 'r', -1 },
+    { 5723, 1, 'r', -1 },
+    { 5724, 1, 'o', -1 },
+    { 5725, 1, 'e', -1 },
+    { 5726, 1, 'r', -1 },
+    { 5727, 1, 'a', -1 },
+    { 5728, 1, 'r', -1 },
+    { 0, 0, ';', 1645 },
+    { 5729, 1, 'u', -1 },
+    { 0, 0, ';', 1647 },
+    { 0, 0, ';', 1648 },
+    { 5730, 1, 'p', -1 },
+    { 5731, 1, 's', -1 },
+    { 5732, 1, 'r', -1 },
+    { 5733, 2, 'r', -1 },
+    { 0, 0, ';', 1657 },
+    { 0, 0, ';', 1659 },
+    { 5735, 1, 'o', -1 },
+    { 0, 0, ';', 1661 },
+    { 5736, 1, 'o', -1 },
+    { 0, 0, ';', 1664 },
+    { 5737, 1, 's', -1 },
+    { 0, 0, ';', 1667 },
+    { 5738, 1, 'd', -1 },
+    { 5739, 1, 'e', -1 },
+    { 0, 0, ';', 1673 },
+    { 5740, 1, 'r', -1 },
+    { 0, 0, ';', 1677 },
+    { 5741, 1, 'l', -1 },
+    { 5742, 1, 'i', -1 },
+    { 5743, 1, 'l', -1 },
+    { 0, 0, ';', 1681 },
+    { 5744, 1, 'n', -1 },
+    { 5745, 1, 'o', -1 },
+    { 5746, 1, 'i', -1 },
+    { 0, 0, ';', 1686 },
+    { 5747, 1, 'e', -1 },
+    { 0, 0, ';', 1690 },
+    { 5748, 1, 'a', -1 },
+    { 5749, 1, 'e', -1 },
+    { 5750, 1, 'h', -1 },
+    { 5751, 1, 'c', -1 },
+    { 5752, 1, 'k', -1 },
+    { 0, 0, ';', 1699 },
+    { 5753, 1, 'a', -1 },
+    { 5754, 1, 'b', -1 },
+    { 5755, 1, 'c', -1 },
+    { 5756, 2, 'd', -1 },
+    { 5758, 1, 'e', -1 },
+    { 5759, 1, 'm', -1 },
+    { 5760, 1, 's', -1 },
+    { 5761, 1, 't', -1 },
+    { 5762, 1, 't', -1 },
+    { 0, 0, ';', 1712 },
+    { 5763, 1, 'd', 1713 },
+    { 0, 0, ';', 1717 },
+    { 5764, 1, 'e', -1 },
+    { 0, 0, ';', 1720 },
+    { 5765, 1, 'a', -1 },
+    { 5766, 1, 'c', -1 },
+    { 5767, 1, 'e', -1 },
+    { 5768, 3, 'n', -1 },
+    { 5771, 1, 's', -1 },
+    { 5772, 2, 'e', -1 },
+    { 0, 0, ';', 1730 },
+    { 5774, 1, 'p', -1 },
+    { 5775, 1, 'i', -1 },
+    { 0, 0, ';', 1733 },
+    { 5776, 1, 'a', -1 },
+    { 5777, 1, 'l', -1 },
+    { 5778, 1, 's', -1 },
+    { 0, 0, ';', 1737 },
+    { 5779, 1, 't', -1 },
+    { 5780, 1, 'm', -1 },
+    { 5781, 1, 'e', -1 },
+    { 0, 0, ';', 1741 },
+    { 5782, 1, 's', -1 },
+    { 0, 0, ';', 1745 },
+    { 0, 0, ';', 1746 },
+    { 5783, 1, 'm', -1 },
+    { 0, 0, ';', 1748 },
+    { 5784, 1, 'e', -1 },
+    { 5785, 1, 'i', -1 },
+    { 5786, 2, 't', -1 },
+    { 0, 0, ';', 1754 },
+    { 5788, 1, 'r', -1 },
+    { 0, 0, ';', 1756 },
+    { 5789, 1, 'i', -1 },
+    { 5790, 1, 'r', -1 },
+    { 0, 0, ';', 1759 },
+    { 0, 0, ';', 1760 },
+    { 5791, 1, 't', -1 },
+    { 5792, 1, 'c', -1 },
+    { 5793, 1, 'p', -1 },
+    { 0, 0, ';', 1764 },
+    { 5794, 1, 'd', -1 },
+    { 5795, 1, 'e', -1 },
+    { 5796, 1, 'l', -1 },
+    { 5797, 1, 'o', 1768 },
+    { 0, 0, ';', 1770 },
+    { 5798, 1, 'a', -1 },
+    { 5799, 2, 'b', -1 },
+    { 5801, 1, 'c', -1 },
+    { 5802, 1, 'f', -1 },
+    { 5803, 1, 'h', -1 },
+    { 5804, 1, 'l', -1 },
+    { 5805, 1, 'p', -1 },
+    { 5806, 1, 's', -1 },
+    { 5807, 1, 't', -1 },
+    { 5808, 1, 'w', -1 },
+    { 5809, 1, 'i', -1 },
+    { 5810, 2, 'o', -1 },
+    { 5812, 1, 'r', -1 },
+    { 5813, 1, 'k', -1 },
+    { 5814, 2, 'c', -1 },
+    { 5816, 1, 'e', -1 },
+    { 5817, 1, 's', -1 },
+    { 5818, 1, 'o', -1 },
+    { 5819, 1, 'i', -1 },
+    { 5820, 1, 'l', -1 },
+    { 0, 0, ';', 1795 },
+    { 0, 0, ';', 1797 },
+    { 5821, 1, 'h', -1 },
+    { 5822, 2, 'o', -1 },
+    { 0, 0, ';', 1801 },
+    { 0, 0, ';', 1802 },
+    { 5824, 1, 'i', -1 },
+    { 5825, 1, 'p', -1 },
+    { 5826, 1, 's', -1 },
+    { 0, 0, ';', 1806 },
+    { 5827, 1, 'h', -1 },
+    { 5828, 1, 'o', -1 },
+    { 5829, 1, 'd', -1 },
+    { 5830, 2, 'u', -1 },
+    { 0, 0, ';', 1816 },
+    { 5832, 6, 't', -1 },
+    { 0, 0, ';', 1826 },
+    { 5838, 1, 'n', -1 },
+    { 5839, 1, 'r', -1 },
+    { 5840, 1, 'r', -1 },
+    { 5841, 1, 's', -1 },
+    { 5842, 1, 'd', -1 },
+    { 5843, 1, 'g', -1 },
+    { 5844, 1, 'r', -1 },
+    { 5845, 1, 'k', -1 },
+    { 5846, 1, 'r', -1 },
+    { 0, 0, ';', 1838 },
+    { 5847, 1, 'u', -1 },
+    { 5848, 1, 'm', -1 },
+    { 0, 0, ';', 1841 },
+    { 5849, 1, 'g', -1 },
+    { 5850, 1, 'l', -1 },
+    { 5851, 1, 'r', -1 },
+    { 5852, 1, 'u', -1 },
+    { 0, 0, ';', 1846 },
+    { 0, 0, ';', 1848 },
+    { 5853, 2, 'o', -1 },
+    { 5855, 1, 'e', -1 },
+    { 5856, 1, 'e', -1 },
+    { 0, 0, ';', 1853 },
+    { 5857, 1, 'e', -1 },
+    { 5858, 1, 'f', -1 },
+    { 5859, 1, 'l', -1 },
+    { 5860, 1, 'h', -1 },
+    { 5861, 1, 't', -1 },
+    { 5862, 1, 'o', -1 },
+    { 0, 0, ';', 1863 },
+    { 5863, 1, 'o', -1 },
+    { 5864, 1, 'e', -1 },
+    { 5865, 1, 'i', -1 },
+    { 5866, 1, 'c', -1 },
+    { 0, 0, ';', 1869 },
+    { 5867, 1, 'p', -1 },
+    { 5868, 1, 'i', -1 },
+    { 5869, 1, 'l', -1 },
+    { 5870, 1, 'm', -1 },
+    { 0, 0, ';', 1875 },
+    { 5871, 1, 'b', -1 },
+    { 5872, 1, 'e', -1 },
+    { 5873, 1, 'r', -1 },
+    { 5874, 1, 'h', -1 },
+    { 5875, 2, 'r', -1 },
+    { 0, 0, ';', 1883 },
+    { 0, 0, ';', 1884 },
+    { 5877, 1, 'a', -1 },
+    { 5878, 1, 'i', -1 },
+    { 5879, 1, 'n', -1 },
+    { 0, 0, ';', 1888 },
+    { 5880, 1, 'w', -1 },
+    { 5881, 1, 'p', -1 },
+    { 5882, 1, 'c', -1 },
+    { 0, 0, ';', 1893 },
+    { 5883, 2, 't', -1 },
+    { 5885, 3, 'a', -1 },
+    { 5888, 1, 'o', -1 },
+    { 0, 0, ';', 1903 },
+    { 5889, 1, 'q', -1 },
+    { 0, 0, ';', 1905 },
+    { 5890, 1, 'E', -1 },
+    { 0, 0, ';', 1907 },
+    { 5891, 1, 'E', -1 },
+    { 5892, 1, 'e', -1 },
+    { 5893, 1, 'l', -1 },
+    { 5894, 1, 'a', -1 },
+    { 5895, 1, 'r', -1 },
+    { 5896, 1, 'l', -1 },
+    { 5897, 1, 'h', -1 },
+    { 5898, 1, 'a', -1 },
+    { 0, 0, ';', 1916 },
+    { 5899, 1, 'e', -1 },
+    { 0, 0, ';', 1919 },
+    { 5900, 1, 's', -1 },
+    { 5901, 1, 'c', -1 },
+    { 0, 0, ';', 1923 },
+    { 5902, 1, 'a', -1 },
+    { 0, 0, ';', 1925 },
+    { 5903, 1, 'e', -1 },
+    { 0, 0, ';', 1928 },
+    { 5904, 2, 'p', -1 },
+    { 5906, 2, 'p', -1 },
+    { 5908, 3, 'b', -1 },
+    { 5911, 3, 'p', -1 },
+    { 5914, 2, 'r', -1 },
+    { 0, 0, ';', 1944 },
+    { 5916, 1, 'r', -1 },
+    { 0, 0, ';', 1946 },
+    { 5917, 1, 'm', -1 },
+    { 5918, 1, 'l', -1 },
+    { 5919, 1, 'r', -1 },
+    { 0, 0, ';', 1950 },
+    { 5920, 1, 'f', -1 },
+    { 5921, 1, 'i', -1 },
+    { 5922, 1, 's', -1 },
+    { 0, 0, ';', 1956 },
+    { 5923, 1, 'o', -1 },
+    { 0, 0, ';', 1958 },
+    { 5924, 1, 'd', -1 },
+    { 5925, 1, 'u', -1 },
+    { 5926, 1, 'E', -1 },
+    { 5927, 1, 'e', -1 },
+    { 5928, 1, 'l', -1 },
+    { 5929, 1, 'a', -1 },
+    { 5930, 1, 'e', -1 },
+    { 5931, 1, 'i', -1 },
+    { 5932, 2, 'u', -1 },
+    { 0, 0, ';', 1973 },
+    { 5934, 1, 'a', -1 },
+    { 5935, 1, 'c', -1 },
+    { 5936, 1, 'e', -1 },
+    { 5937, 3, 'n', -1 },
+    { 5940, 1, 's', -1 },
+    { 0, 0, ';', 1982 },
+    { 0, 0, ';', 1984 },
+    { 0, 0, ';', 1986 },
+    { 0, 0, ';', 1988 },
+    { 0, 0, ';', 1990 },
+    { 5941, 1, 'o', -1 },
+    { 5942, 1, 's', -1 },
+    { 0, 0, ';', 1993 },
+    { 5943, 1, 'd', -1 },
+    { 5944, 2, 's', -1 },
+    { 5946, 1, 'a', -1 },
+    { 5947, 1, 'u', -1 },
+    { 5948, 1, 'E', -1 },
+    { 5949, 1, 'e', -1 },
+    { 5950, 1, 'l', -1 },
+    { 5951, 1, 'e', -1 },
+    { 5952, 1, 'i', -1 },
+    { 5953, 2, 'u', -1 },
+    { 5955, 1, 'r', -1 },
+    { 5956, 1, 'h', -1 },
+    { 5957, 2, 'r', -1 },
+    { 5959, 1, 'a', -1 },
+    { 5960, 1, 'g', 2015 },
+    { 5961, 1, 'e', -1 },
+    { 0, 0, ';', 2019 },
+    { 5962, 1, 'o', -1 },
+    { 5963, 1, 'i', -1 },
+    { 0, 0, ';', 2023 },
+    { 5964, 1, 'e', -1 },
+    { 5965, 2, 'e', -1 },
+    { 5967, 3, 'a', -1 },
+    { 5970, 2, 'k', -1 },
+    { 5972, 1, 's', -1 },
+    { 5973, 1, 'p', -1 },
+    { 5974, 1, 'i', -1 },
+    { 5975, 1, 'n', 2036 },
+    { 5976, 1, 'e', -1 },
+    { 5977, 3, 's', 2039 },
+    { 0, 0, ';', 2044 },
+    { 0, 0, ';', 2045 },
+    { 5980, 1, 'o', -1 },
+    { 5981, 1, 'i', -1 },
+    { 0, 0, ';', 2049 },
+    { 5982, 1, 'o', -1 },
+    { 0, 0, ';', 2051 },
+    { 5983, 1, 'm', -1 },
+    { 5984, 1, 'e', -1 },
+    { 5985, 1, 'n', -1 },
+    { 5986, 1, 'o', -1 },
+    { 0, 0, ';', 2062 },
+    { 5987, 1, 'i', -1 },
+    { 5988, 1, 'l', -1 },
+    { 5989, 1, 'b', -1 },
+    { 5990, 1, 'i', -1 },
+    { 5991, 1, 'z', -1 },
+    { 0, 0, ';', 2068 },
+    { 0, 0, ';', 2069 },
+    { 5992, 1, 'y', -1 },
+    { 5993, 1, 'o', -1 },
+    { 5994, 1, 't', -1 },
+    { 5995, 1, 'e', -1 },
+    { 0, 0, ';', 2075 },
+    { 0, 0, ';', 2076 },
+    { 5996, 1, 't', -1 },
+    { 0, 0, ';', 2079 },
+    { 5997, 1, 'y', -1 },
+    { 5998, 1, 'v', -1 },
+    { 5999, 1, 'c', 2082 },
+    { 6000, 1, 'r', -1 },
+    { 6001, 1, 'a', -1 },
+    { 6002, 1, 'r', -1 },
+    { 6003, 1, 'h', -1 },
+    { 6004, 1, 'v', -1 },
+    { 6005, 1, 'l', -1 },
+    { 6006, 1, 'r', -1 },
+    { 6007, 1, 'k', -1 },
+    { 6008, 1, 'r', -1 },
+    { 6009, 1, 'o', -1 },
+    { 6010, 1, 'i', -1 },
+    { 6011, 1, 'r', -1 },
+    { 6012, 1, 'n', -1 },
+    { 0, 0, ';', 2103 },
+    { 6013, 1, 'r', -1 },
+    { 6014, 1, 'w', -1 },
+    { 6015, 1, 'r', -1 },
+    { 6016, 1, 's', -1 },
+    { 0, 0, ';', 2109 },
+    { 6017, 1, 'h', -1 },
+    { 6018, 1, 'l', -1 },
+    { 6019, 1, 'a', -1 },
+    { 6020, 1, 'r', -1 },
+    { 6021, 1, 'o', -1 },
+    { 6022, 1, 'g', -1 },
+    { 6023, 1, 'i', -1 },
+    { 0, 0, ';', 2118 },
+    { 6024, 1, 't', -1 },
+    { 6025, 1, 'd', -1 },
+    { 0, 0, ';', 2121 },
+    { 6026, 1, 'f', -1 },
+    { 6027, 1, 'r', -1 },
+    { 0, 0, ';', 2125 },
+    { 6028, 1, 'g', -1 },
+    { 0, 0, ';', 2127 },
+    { 0, 0, ';', 2128 },
+    { 6029, 1, 'v', -1 },
+    { 6030, 1, 'h', -1 },
+    { 6031, 1, 'r', -1 },
+    { 6032, 1, 'p', -1 },
+    { 6033, 1, 'a', -1 },
+    { 6034, 1, 'o', -1 },
+    { 6035, 1, 'h', -1 },
+    { 6036, 1, 'i', -1 },
+    { 6037, 1, 'r', -1 },
+    { 0, 0, ';', 2138 },
+    { 6038, 1, 'h', -1 },
+    { 6039, 1, 'i', -1 },
+    { 6040, 2, 'u', -1 },
+    { 6042, 1, 'h', -1 },
+    { 6043, 1, 'r', -1 },
+    { 6044, 1, 'h', -1 },
+    { 6045, 1, 'a', -1 },
+    { 6046, 1, 'q', -1 },
+    { 6047, 1, 'i', -1 },
+    { 6048, 1, 'a', -1 },
+    { 0, 0, ';', 2155 },
+    { 6049, 1, 'i', -1 },
+    { 6050, 1, 'b', -1 },
+    { 6051, 1, 'p', -1 },
+    { 0, 0, ';', 2160 },
+    { 6052, 1, 'p', -1 },
+    { 6053, 1, 'i', -1 },
+    { 0, 0, ';', 2163 },
+    { 6054, 2, 'n', -1 },
+    { 6056, 2, 'n', -1 },
+    { 6058, 1, 'z', -1 },
+    { 6059, 1, 'c', -1 },
+    { 6060, 1, 'a', -1 },
+    { 6061, 2, 'e', -1 },
+    { 6063, 1, 'r', -1 },
+    { 0, 0, ';', 2175 },
+    { 6064, 1, 't', -1 },
+    { 0, 0, ';', 2179 },
+    { 0, 0, ';', 2180 },
+    { 6065, 1, 'c', -1 },
+    { 0, 0, ';', 2182 },
+    { 6066, 1, 'i', -1 },
+    { 6067, 1, 'r', -1 },
+    { 6068, 1, 'r', -1 },
+    { 6069, 1, 'r', -1 },
+    { 6070, 1, 'r', -1 },
+    { 0, 0, ';', 2190 },
+    { 0, 0, ';', 2191 },
+    { 6071, 1, 't', -1 },
+    { 0, 0, ';', 2193 },
+    { 6072, 1, 'u', -1 },
+    { 6073, 1, 'm', -1 },
+    { 6074, 1, 'r', -1 },
+    { 6075, 1, 'r', -1 },
+    { 0, 0, ';', 2198 },
+    { 6076, 1, 'u', -1 },
+    { 6077, 1, 'u', -1 },
+    { 6078, 1, 'i', -1 },
+    { 0, 0, ';', 2202 },
+    { 6079, 1, 'g', -1 },
+    { 6080, 1, 't', -1 },
+    { 0, 0, ';', 2206 },
+    { 6081, 1, 'c', -1 },
+    { 0, 0, ';', 2212 },
+    { 0, 0, ';', 2213 },
+    { 0, 0, ';', 2214 },
+    { 0, 0, ';', 2215 },
+    { 0, 0, ';', 2217 },
+    { 6082, 1, 't', -1 },
+    { 6083, 1, 'o', -1 },
+    { 0, 0, ';', 2221 },
+    { 6084, 1, 'r', -1 },
+    { 0, 0, ';', 2223 },
+    { 0, 0, ';', 2225 },
+    { 6085, 1, 'a', -1 },
+    { 0, 0, ';', 2227 },
+    { 0, 0, ';', 2228 },
+    { 0, 0, ';', 2230 },
+    { 0, 0, ';', 1 },
+    { 6086, 1, 'e', 4 },
+    { 6087, 1, 'e', -1 },
+    { 0, 0, ';', 8 },
+    { 6088, 1, 'e', 11 },
+    { 0, 0, ';', 13 },
+    { 0, 0, ';', 14 },
+    { 0, 0, ';', 16 },
+    { 6089, 1, 'F', -1 },
+    { 0, 0, ';', 20 },
+    { 6090, 1, 'n', -1 },
+    { 6091, 1, 'e', 23 },
+    { 6092, 1, 'l', -1 },
+    { 6093, 1, 'd', -1 },
+    { 6094, 1, 's', -1 },
+    { 6095, 1, 'u', -1 },
+    { 0, 0, ';', 36 },
+    { 6096, 1, 'q', -1 },
+    { 6097, 1, 'e', -1 },
+    { 6098, 1, 'a', -1 },
+    { 6099, 1, 'y', -1 },
+    { 6100, 1, 'n', -1 },
+    { 6101, 1, 'l', 47 },
+    { 0, 0, ';', 49 },
+    { 6102, 1, 'n', -1 },
+    { 6103, 1, 'l', -1 },
+    { 6104, 1, 'r', -1 },
+    { 6105, 4, 'e', -1 },
+    { 6109, 1, 'w', -1 },
+    { 6110, 1, 'C', -1 },
+    { 0, 0, ';', 63 },
+    { 6111, 1, 'e', -1 },
+    { 6112, 1, 'u', -1 },
+    { 6113, 1, 't', -1 },
+    { 6114, 1, 'u', -1 },
+    { 6115, 1, 'd', -1 },
+    { 6116, 1, 'e', -1 },
+    { 0, 0, ';', 71 },
+    { 6117, 1, 'p', -1 },
+    { 6118, 1, 'a', -1 },
+    { 6119, 1, 'r', -1 },
+    { 0, 0, ';', 82 },
+    { 6120, 1, 'n', -1 },
+    { 0, 0, ';', 86 },
+    { 6121, 1, 'i', -1 },
+    { 6122, 1, 'n', -1 },
+    { 6123, 1, 'r', -1 },
+    { 6124, 1, 't', -1 },
+    { 6125, 1, 'u', -1 },
+    { 6126, 6, 'e', -1 },
+    { 6132, 1, 'r', -1 },
+    { 6133, 1, 'r', -1 },
+    { 6134, 1, 'e', -1 },
+    { 6135, 1, 'i', -1 },
+    { 6136, 1, 'e', -1 },
+    { 6137, 1, 'r', -1 },
+    { 6138, 1, 'k', -1 },
+    { 6139, 1, 'e', 132 },
+    { 6140, 1, 'n', -1 },
+    { 0, 0, ';', 136 },
+    { 6141, 1, 'e', 140 },
+    { 6142, 1, 'n', -1 },
+    { 0, 0, ';', 143 },
+    { 6143, 1, 'S', -1 },
+    { 6144, 1, 'V', -1 },
+    { 0, 0, ';', 146 },
+    { 6145, 1, 'o', -1 },
+    { 0, 0, ';', 149 },
+    { 6146, 1, 'T', -1 },
+    { 6147, 1, 'i', -1 },
+    { 6148, 1, 's', -1 },
+    { 6149, 1, 'e', -1 },
+    { 6150, 2, 'd', -1 },
+    { 6152, 1, 'l', -1 },
+    { 6153, 1, 'e', -1 },
+    { 0, 0, ';', 170 },
+    { 6154, 1, 'd', -1 },
+    { 6155, 1, 'e', -1 },
+    { 6156, 1, 'l', -1 },
+    { 0, 0, ';', 174 },
+    { 6157, 1, 'e', -1 },
+    { 6158, 1, 'y', -1 },
+    { 0, 0, ';', 190 },
+    { 0, 0, ';', 192 },
+    { 6159, 1, 'r', -1 },
+    { 6160, 1, 'o', -1 },
+    { 6161, 1, 'k', -1 },
+    { 6162, 1, 'o', -1 },
+    { 6163, 1, 'q', -1 },
+    { 0, 0, ';', 202 },
+    { 6164, 1, 'e', 204 },
+    { 0, 0, ';', 207 },
+    { 6165, 1, 'e', 211 },
+    { 0, 0, ';', 214 },
+    { 6166, 1, 'n', -1 },
+    { 6167, 1, 'e', -1 },
+    { 6168, 1, 'r', -1 },
+    { 6169, 1, 's', -1 },
+    { 6170, 1, 'i', -1 },
+    { 0, 0, ';', 222 },
+    { 6171, 1, 'e', -1 },
+    { 0, 0, ';', 227 },
+    { 0, 0, ';', 230 },
+    { 6172, 1, 'y', -1 },
+    { 0, 0, ';', 236 },
+    { 0, 0, ';', 239 },
+    { 6173, 1, 'l', -1 },
+    { 6174, 1, 'e', -1 },
+    { 6175, 1, 'a', -1 },
+    { 6176, 1, 'c', -1 },
+    { 6177, 1, 'n', -1 },
+    { 6178, 1, 'l', -1 },
+    { 6179, 1, 'n', -1 },
+    { 6180, 1, 'r', -1 },
+    { 6181, 1, 'e', -1 },
+    { 6182, 2, 'o', -1 },
+    { 6184, 1, 'l', -1 },
+    { 6185, 1, 'i', -1 },
+    { 6186, 1, 'e', -1 },
+    { 6187, 1, 'r', -1 },
+    { 6188, 3, 'p', -1 },
+    { 6191, 1, 'e', -1 },
+    { 6192, 1, 'r', -1 },
+    { 6193, 1, 'i', -1 },
+    { 6194, 1, 'q', -1 },
+    { 6195, 1, 'u', -1 },
+    { 6196, 1, 'r', -1 },
+    { 6197, 1, 'e', -1 },
+    { 6198, 1, 'l', -1 },
+    { 6199, 1, 'i', -1 },
+    { 6200, 1, 'a', -1 },
+    { 6201, 1, 't', -1 },
+    { 6202, 1, 'e', -1 },
+    { 6203, 1, 'i', -1 },
+    { 6204, 1, 'e', -1 },
+    { 6205, 1, 'i', -1 },
+    { 6206, 1, 'L', -1 },
+    { 6207, 1, 'R', -1 },
+    { 6208, 1, 'k', -1 },
+    { 6209, 1, 'm', -1 },
+    { 6210, 1, 'n', -1 },
+    { 6211, 1, 'P', -1 },
+    { 6212, 1, 'e', -1 },
+    { 6213, 1, 'n', -1 },
+    { 6214, 1, 'l', -1 },
+    { 6215, 1, 'i', -1 },
+    { 6216, 2, 'd', -1 },
+    { 6218, 1, 'n', -1 },
+    { 6219, 1, 'a', -1 },
+    { 6220, 1, 'e', -1 },
+    { 6221, 1, 'n', -1 },
+    { 6222, 1, 'p', -1 },
+    { 6223, 1, 'u', -1 },
+    { 6224, 1, 'e', -1 },
+    { 6225, 1, 'u', -1 },
+    { 6226, 1, 'i', -1 },
+    { 6227, 1, 'e', -1 },
+    { 6228, 1, 'm', -1 },
+    { 6229, 1, 'f', -1 },
+    { 6230, 1, 's', -1 },
+    { 6231, 1, 's', -1 },
+    { 6232, 1, 'e', -1 },
+    { 6233, 1, 'v', -1 },
+    { 6234, 1, 'g', -1 },
+    { 6235, 1, 'u', -1 },
+    { 6236, 1, 'b', -1 },
+    { 6237, 1, 'c', -1 },
+    { 6238, 1, 'p', -1 },
+    { 6239, 1, 'l', -1 },
+    { 6240, 1, 'r', -1 },
+    { 6241, 1, 'e', 383 },
+    { 0, 0, ';', 386 },
+    { 6242, 1, 'e', 387 },
+    { 0, 0, ';', 390 },
+    { 6243, 1, 'c', -1 },
+    { 6244, 1, 'e', 394 },
+    { 0, 0, ';', 396 },
+    { 0, 0, ';', 397 },
+    { 6245, 1, 'o', -1 },
+    { 6246, 1, 'u', -1 },
+    { 6247, 1, 'h', 404 },
+    { 6248, 1, 'e', 406 },
+    { 6249, 1, 's', -1 },
+    { 6250, 1, 'a', -1 },
+    { 6251, 1, 'r', -1 },
+    { 6252, 1, 'a', -1 },
+    { 6253, 1, 'a', -1 },
+    { 6254, 1, 'i', -1 },
+    { 6255, 1, 'a', -1 },
+    { 6256, 1, 'd', -1 },
+    { 0, 0, ';', 428 },
+    { 6257, 1, 'c', -1 },
+    { 6258, 1, 'r', -1 },
+    { 0, 0, ';', 439 },
+    { 6259, 1, 'e', -1 },
+    { 6260, 1, 'l', -1 },
+    { 6261, 1, 'n', -1 },
+    { 6262, 1, 'l', -1 },
+    { 6263, 1, 's', -1 },
+    { 6264, 2, 'A', -1 },
+    { 6266, 1, 'C', -1 },
+    { 6267, 1, 'D', -1 },
+    { 6268, 1, 'F', -1 },
+    { 6269, 2, 'T', -1 },
+    { 6271, 1, 'U', -1 },
+    { 6272, 1, 'V', -1 },
+    { 6273, 1, 'a', -1 },
+    { 6274, 1, 'I', -1 },
+    { 6275, 1, 't', -1 },
+    { 6276, 1, 'e', -1 },
+    { 6277, 1, 'y', -1 },
+    { 6278, 1, 'y', -1 },
+    { 6279, 1, 'e', -1 },
+    { 6280, 1, 'n', -1 },
+    { 6281, 1, 'l', -1 },
+    { 0, 0, ';', 491 },
+    { 6282, 1, 'D', -1 },
+    { 6283, 1, 'L', -1 },
+    { 6284, 1, 'R', -1 },
+    { 6285, 1, 'U', -1 },
+    { 0, 0, ';', 498 },
+    { 6286, 1, 'C', -1 },
+    { 6287, 4, 'e', -1 },
+    { 6291, 2, 't', -1 },
+    { 6293, 1, 'e', -1 },
+    { 6294, 1, 'h', -1 },
+    { 6295, 1, 's', -1 },
+    { 6296, 1, 't', -1 },
+    { 0, 0, ';', 525 },
+    { 0, 0, ';', 526 },
+    { 0, 0, ';', 527 },
+    { 6297, 1, 'n', -1 },
+    { 6298, 1, 'l', -1 },
+    { 6299, 1, 'f', -1 },
+    { 0, 0, ';', 536 },
+    { 6300, 1, 'S', -1 },
+    { 6301, 1, 'p', -1 },
+    { 0, 0, ';', 539 },
+    { 6302, 1, 'E', -1 },
+    { 6303, 1, 'F', -1 },
+    { 6304, 1, 'T', -1 },
+    { 6305, 1, 'e', -1 },
+    { 6306, 1, 'k', -1 },
+    { 6307, 1, 'e', 547 },
+    { 6308, 1, 'c', -1 },
+    { 0, 0, ';', 551 },
+    { 6309, 1, 'e', -1 },
+    { 0, 0, ';', 554 },
+    { 6310, 1, 'c', -1 },
+    { 6311, 1, 'e', 558 },
+    { 0, 0, ';', 560 },
+    { 6312, 2, 'B', -1 },
+    { 6314, 1, 'P', -1 },
+    { 0, 0, ';', 565 },
+    { 6315, 1, 'P', -1 },
+    { 0, 0, ';', 567 },
+    { 6316, 1, 'o', -1 },
+    { 6317, 1, 'n', -1 },
+    { 6318, 1, 'i', -1 },
+    { 0, 0, ';', 574 },
+    { 6319, 1, 'A', -1 },
+    { 6320, 1, 'o', -1 },
+    { 6321, 1, 'n', -1 },
+    { 6322, 1, 'L', -1 },
+    { 6323, 1, 'R', -1 },
+    { 6324, 1, 'o', -1 },
+    { 0, 0, ';', 582 },
+    { 6325, 1, 'e', -1 },
+    { 0, 0, ';', 587 },
+    { 0, 0, ';', 590 },
+    { 6326, 1, 'l', -1 },
+    { 6327, 1, 'r', -1 },
+    { 6328, 1, 'c', -1 },
+    { 6329, 1, 'h', -1 },
+    { 6330, 1, 'h', -1 },
+    { 0, 0, ';', 604 },
+    { 0, 0, ';', 605 },
+    { 6331, 1, 'e', 616 },
+    { 0, 0, ';', 618 },
+    { 6332, 1, 'e', -1 },
+    { 6333, 1, 'n', -1 },
+    { 6334, 1, 'i', -1 },
+    { 6335, 1, 'e', 634 },
+    { 6336, 1, 'e', -1 },
+    { 0, 0, ';', 641 },
+    { 0, 0, ';', 643 },
+    { 0, 0, ';', 646 },
+    { 6337, 1, 'e', 649 },
+    { 6338, 1, 'y', -1 },
+    { 0, 0, ';', 652 },
+    { 0, 0, ';', 653 },
+    { 0, 0, ';', 654 },
+    { 0, 0, ';', 655 },
+    { 6339, 1, 'd', -1 },
+    { 6340, 1, 'o', -1 },
+    { 0, 0, ';', 665 },
+    { 6341, 2, 'd', -1 },
+    { 0, 0, ';', 675 },
+    { 6343, 1, 'v', -1 },
+    { 6344, 1, 'h', -1 },
+    { 0, 0, ';', 679 },
+    { 6345, 1, 'r', -1 },
+    { 0, 0, ';', 681 },
+    { 6346, 1, 'r', -1 },
+    { 6347, 2, 'x', -1 },
+    { 0, 0, ';', 692 },
+    { 0, 0, ';', 695 },
+    { 6349, 1, 'e', -1 },
+    { 6350, 1, 'e', 697 },
+    { 6351, 1, 'i', -1 },
+    { 0, 0, ';', 702 },
+    { 6352, 1, 'o', -1 },
+    { 6353, 1, 'p', -1 },
+    { 6354, 1, 'r', -1 },
+    { 6355, 1, 'i', -1 },
+    { 6356, 1, 'e', -1 },
+    { 6357, 2, 'd', -1 },
+    { 6359, 1, 'b', -1 },
+    { 0, 0, ';', 714 },
+    { 0, 0, ';', 716 },
+    { 6360, 2, 's', -1 },
+    { 6362, 1, 'y', -1 },
+    { 0, 0, ';', 720 },
+    { 6363, 1, 'u', -1 },
+    { 6364, 1, 'e', -1 },
+    { 6365, 1, 'p', -1 },
+    { 6366, 1, 'r', -1 },
+    { 6367, 1, 'p', -1 },
+    { 6368, 1, 'o', -1 },
+    { 6369, 1, 'l', -1 },
+    { 6370, 1, 'i', -1 },
+    { 6371, 1, 'c', -1 },
+    { 6372, 1, 'a', -1 },
+    { 6373, 1, 'i', -1 },
+    { 6374, 1, 'l', -1 },
+    { 6375, 1, 'e', -1 },
+    { 6376, 1, 'd', -1 },
+    { 6377, 1, 'w', -1 },
+    { 6378, 1, 'l', -1 },
+    { 6379, 1, 's', -1 },
+    { 6380, 1, 't', -1 },
+    { 0, 0, ';', 746 },
+    { 0, 0, ';', 747 },
+    { 0, 0, ';', 748 },
+    { 0, 0, ';', 749 },
+    { 0, 0, ';', 750 },
+    { 6381, 1, 'i', -1 },
+    { 6382, 1, 'm', -1 },
+    { 6383, 1, 'e', -1 },
+    { 0, 0, ';', 758 },
+    { 0, 0, ';', 759 },
+    { 0, 0, ';', 760 },
+    { 0, 0, ';', 761 },
+    { 0, 0, ';', 763 },
+    { 0, 0, ';', 764 },
+    { 0, 0, ';', 765 },
+    { 0, 0, ';', 766 },
+    { 0, 0, ';', 767 },
+    { 0, 0, ';', 768 },
+    { 0, 0, ';', 769 },
+    { 0, 0, ';', 770 },
+    { 0, 0, ';', 772 },
+    { 0, 0, ';', 773 },
+    { 0, 0, ';', 774 },
+    { 0, 0, ';', 775 },
+    { 0, 0, ';', 776 },
+    { 0, 0, ';', 777 },
+    { 6384, 1, 'x', -1 },
+    { 0, 0, ';', 779 },
+    { 0, 0, ';', 780 },
+    { 0, 0, ';', 781 },
+    { 0, 0, ';', 782 },
+    { 0, 0, ';', 784 },
+    { 0, 0, ';', 785 },
+    { 0, 0, ';', 786 },
+    { 0, 0, ';', 787 },
+    { 6385, 1, 'n', -1 },
+    { 6386, 1, 'u', -1 },
+    { 6387, 1, 'm', -1 },
+    { 0, 0, ';', 791 },
+    { 0, 0, ';', 792 },
+    { 0, 0, ';', 793 },
+    { 0, 0, ';', 794 },
+    { 0, 0, ';', 796 },
+    { 0, 0, ';', 797 },
+    { 0, 0, ';', 798 },
+    { 0, 0, ';', 799 },
+    { 0, 0, ';', 800 },
+    { 0, 0, ';', 801 },
+    { 6388, 1, 'e', -1 },
+    { 0, 0, ';', 803 },
+    { 6389, 1, 'r', 804 },
+    { 0, 0, ';', 807 },
+    { 0, 0, ';', 809 },
+    { 0, 0, ';', 811 },
+    { 6390, 1, 's', -1 },
+    { 6391, 1, 't', -1 },
+    { 0, 0, ';', 816 },
+    { 0, 0, ';', 817 },
+    { 6392, 1, 'q', -1 },
+    { 6393, 1, 'e', -1 },
+    { 6394, 1, 'd', -1 },
+    { 6395, 1, 'c', -1 },
+    { 6396, 1, 'p', -1 },
+    { 6397, 1, 'p', -1 },
+    { 6398, 1, 't', -1 },
+    { 0, 0, ';', 827 },
+    { 0, 0, ';', 828 },
+    { 0, 0, ';', 829 },
+    { 6399, 1, 'n', -1 },
+    { 6400, 1, 'l', 831 },
+    { 0, 0, ';', 833 },
+    { 0, 0, ';', 834 },
+    { 6401, 1, 's', -1 },
+    { 0, 0, ';', 838 },
+    { 6402, 1, 'y', -1 },
+    { 6403, 1, 'r', -1 },
+    { 0, 0, ';', 845 },
+    { 6404, 1, 'm', -1 },
+    { 6405, 1, 'q', -1 },
+    { 6406, 2, 'e', -1 },
+    { 6408, 1, 'i', -1 },
+    { 6409, 1, 'd', -1 },
+    { 6410, 1, 'i', -1 },
+    { 0, 0, ';', 863 },
+    { 6411, 1, 'u', -1 },
+    { 0, 0, ';', 865 },
+    { 6412, 2, 'e', -1 },
+    { 0, 0, ';', 868 },
+    { 6414, 1, 't', -1 },
+    { 6415, 1, 'n', -1 },
+    { 6416, 2, 'e', -1 },
+    { 6418, 1, 'o', -1 },
+    { 6419, 1, 't', -1 },
+    { 6420, 1, 'd', -1 },
+    { 6421, 1, 'r', -1 },
+    { 0, 0, ';', 882 },
+    { 0, 0, ';', 883 },
+    { 0, 0, ';', 886 },
+    { 0, 0, ';', 888 },
+    { 0, 0, ';', 889 },
+    { 6422, 2, 'r', -1 },
+    { 0, 0, ';', 892 },
+    { 0, 0, ';', 893 },
+    { 6424, 2, 'r', -1 },
+    { 6426, 1, 'c', -1 },
+    { 6427, 1, 'p', -1 },
+    { 6428, 1, 'p', -1 },
+    { 6429, 1, 't', -1 },
+    { 0, 0, ';', 901 },
+    { 6430, 2, 'r', -1 },
+    { 6432, 1, 'e', -1 },
+    { 6433, 1, 'v', -1 },
+    { 6434, 1, 'w', -1 },
+    { 6435, 1, 'n', 909 },
+    { 6436, 1, 'a', -1 },
+    { 0, 0, ';', 913 },
+    { 0, 0, ';', 914 },
+    { 6437, 1, 'i', -1 },
+    { 0, 0, ';', 916 },
+    { 6438, 1, 'y', -1 },
+    { 6439, 1, 'r', -1 },
+    { 6440, 1, 'h', -1 },
+    { 0, 0, ';', 924 },
+    { 6441, 1, 'o', -1 },
+    { 0, 0, ';', 926 },
+    { 6442, 1, 'n', -1 },
+    { 6443, 1, 'e', -1 },
+    { 0, 0, ';', 931 },
+    { 6444, 1, 'e', -1 },
+    { 0, 0, ';', 935 },
+    { 6445, 1, 'y', -1 },
+    { 6446, 1, 't', -1 },
+    { 0, 0, ';', 939 },
+    { 0, 0, ';', 940 },
+    { 6447, 1, 'n', -1 },
+    { 0, 0, ';', 944 },
+    { 6448, 1, 'm', -1 },
+    { 0, 0, ';', 947 },
+    { 6449, 2, 'e', 949 },
+    { 6451, 1, 'x', -1 },
+    { 6452, 1, 'n', -1 },
+    { 6453, 1, 'p', -1 },
+    { 6454, 1, 'r', -1 },
+    { 0, 0, ';', 959 },
+    { 6455, 1, 'd', -1 },
+    { 6456, 1, 'n', -1 },
+    { 6457, 1, 'u', -1 },
+    { 6458, 1, 'u', -1 },
+    { 6459, 1, 'e', -1 },
+    { 6460, 1, 'r', -1 },
+    { 6461, 1, 'o', -1 },
+    { 6462, 1, 'a', -1 },
+    { 6463, 1, 'r', -1 },
+    { 6464, 1, 'n', -1 },
+    { 6465, 1, 'p', -1 },
+    { 6466, 1, 'k', -1 },
+    { 0, 0, ';', 976 },
+    { 0, 0, ';', 978 },
+    { 0, 0, ';', 979 },
+    { 0, 0, ';', 980 },
+    { 6467, 1, 'l', -1 },
+    { 6468, 1, 'a', -1 },
+    { 0, 0, ';', 984 },
+    { 6469, 1, 'e', 986 },
+    { 6470, 1, 'r', -1 },
+    { 6471, 1, 'n', -1 },
+    { 0, 0, ';', 992 },
+    { 6472, 1, 'n', -1 },
+    { 0, 0, ';', 997 },
+    { 6473, 1, 'e', 1000 },
+    { 6474, 1, 't', -1 },
+    { 6475, 1, 'e', -1 },
+    { 6476, 1, 't', -1 },
+    { 0, 0, ';', 1009 },
+    { 0, 0, ';', 1010 },
+    { 6477, 1, 's', -1 },
+    { 6478, 1, 'v', -1 },
+    { 6479, 1, '3', -1 },
+    { 6480, 1, '4', -1 },
+    { 0, 0, ';', 1018 },
+    { 6481, 1, 'l', -1 },
+    { 0, 0, ';', 1022 },
+    { 6482, 1, 'o', -1 },
+    { 0, 0, ';', 1025 },
+    { 6483, 1, 'c', -1 },
+    { 6484, 1, 'o', -1 },
+    { 0, 0, ';', 1028 },
+    { 6485, 1, 'n', -1 },
+    { 6486, 1, 's', -1 },
+    { 6487, 1, 't', -1 },
+    { 0, 0, ';', 1033 },
+    { 6488, 1, 'D', -1 },
+    { 6489, 1, 'r', -1 },
+    { 0, 0, ';', 1036 },
+    { 0, 0, ';', 1037 },
+    { 0, 0, ';', 1039 },
+    { 0, 0, ';', 1048 },
+    { 6490, 1, 't', -1 },
+    { 6491, 1, 'e', -1 },
+    { 6492, 1, 'n', -1 },
+    { 6493, 1, 'e', -1 },
+    { 6494, 1, 'g', -1 },
+    { 0, 0, ';', 1055 },
+    { 6495, 1, 'g', -1 },
+    { 0, 0, ';', 1058 },
+    { 0, 0, ';', 1059 },
+    { 0, 0, ';', 1061 },
+    { 0, 0, ';', 1062 },
+    { 6496, 1, 'l', -1 },
+    { 0, 0, ';', 1067 },
+    { 6497, 1, 'i', -1 },
+    { 6498, 1, '2', 1069 },
+    { 6499, 1, '3', -1 },
+    { 6500, 1, '4', 1072 },
+    { 6501, 1, '5', -1 },
+    { 6502, 1, '6', -1 },
+    { 6503, 1, '8', -1 },
+    { 6504, 1, '3', -1 },
+    { 6505, 1, '5', -1 },
+    { 6506, 1, '4', 1079 },
+    { 6507, 1, '5', -1 },
+    { 6508, 1, '8', -1 },
+    { 6509, 1, '5', -1 },
+    { 6510, 1, '6', -1 },
+    { 6511, 1, '8', -1 },
+    { 6512, 1, '8', -1 },
+    { 0, 0, ';', 1087 },
+    { 0, 0, ';', 1088 },
+    { 6513, 1, 'e', -1 },
+    { 0, 0, ';', 1093 },
+    { 6514, 1, 'd', -1 },
+    { 6515, 1, 'e', -1 },
+    { 0, 0, ';', 1097 },
+    { 6516, 1, 'a', -1 },
+    { 0, 0, ';', 1106 },
+    { 6517, 2, 't', -1 },
+    { 6519, 1, 's', -1 },
+    { 0, 0, ';', 1115 },
+    { 6520, 1, 'r', -1 },
+    { 0, 0, ';', 1126 },
+    { 0, 0, ';', 1127 },
+    { 0, 0, ';', 1129 },
+    { 0, 0, ';', 1132 },
+    { 0, 0, ';', 1133 },
+    { 0, 0, ';', 1137 },
+    { 0, 0, ';', 1138 },
+    { 6521, 1, 'r', -1 },
+    { 6522, 1, 's', -1 },
+    { 6523, 1, 'p', -1 },
+    { 6524, 1, 'r', -1 },
+    { 6525, 1, 't', -1 },
+    { 6526, 1, 'l', -1 },
+    { 6527, 1, 'q', -1 },
+    { 6528, 1, 's', -1 },
+    { 6529, 1, 'm', -1 },
+    { 6530, 1, 'n', -1 },
+    { 6531, 1, 'p', -1 },
+    { 6532, 1, 't', -1 },
+    { 6533, 1, 'y', -1 },
+    { 6534, 1, 'i', -1 },
+    { 0, 0, ';', 1157 },
+    { 0, 0, ';', 1159 },
+    { 6535, 2, 's', -1 },
+    { 6537, 1, 'p', -1 },
+    { 6538, 1, 'n', -1 },
+    { 6539, 1, 'r', -1 },
+    { 6540, 1, 'r', -1 },
+    { 0, 0, ';', 1167 },
+    { 6541, 1, 't', -1 },
+    { 6542, 1, 'e', -1 },
+    { 6543, 1, 'i', -1 },
+    { 6544, 1, 'r', -1 },
+    { 6545, 1, 'h', -1 },
+    { 6546, 1, 'k', -1 },
+    { 6547, 1, 'l', -1 },
+    { 6548, 1, 'n', -1 },
+    { 6549, 1, 'e', 1178 },
+    { 0, 0, ';', 1182 },
+    { 0, 0, ';', 1186 },
+    { 6550, 1, 'e', 1189 },
+    { 6551, 1, 't', -1 },
+    { 0, 0, ';', 1193 },
+    { 6552, 1, 'n', -1 },
+    { 0, 0, ';', 1195 },
+    { 0, 0, ';', 1196 },
+    { 0, 0, ';', 1197 },
+    { 0, 0, ';', 1198 },
+    { 6553, 1, 'i', -1 },
+    { 6554, 1, 'a', -1 },
+    { 0, 0, ';', 1201 },
+    { 0, 0, ';', 1203 },
+    { 6555, 1, 'e', -1 },
+    { 0, 0, ';', 1206 },
+    { 6556, 1, 't', -1 },
+    { 6557, 1, 't', -1 },
+    { 6558, 1, 'l', -1 },
+    { 6559, 1, 'e', -1 },
+    { 6560, 1, 'c', -1 },
+    { 6561, 1, 'r', -1 },
+    { 6562, 1, 'o', -1 },
+    { 0, 0, ';', 1216 },
+    { 0, 0, ';', 1219 },
+    { 6563, 1, 't', 1220 },
+    { 0, 0, ';', 1224 },
+    { 6564, 1, 'o', -1 },
+    { 0, 0, ';', 1226 },
+    { 6565, 1, 'v', -1 },
+    { 0, 0, ';', 1228 },
+    { 6566, 1, 'e', -1 },
+    { 0, 0, ';', 1231 },
+    { 0, 0, ';', 1234 },
+    { 0, 0, ';', 1237 },
+    { 6567, 1, 'y', -1 },
+    { 0, 0, ';', 1241 },
+    { 0, 0, ';', 1242 },
+    { 6568, 1, 'v', -1 },
+    { 6569, 1, 'l', -1 },
+    { 6570, 1, 'n', -1 },
+    { 0, 0, ';', 1252 },
+    { 6571, 1, 'l', -1 },
+    { 0, 0, ';', 1255 },
+    { 6572, 1, 'e', -1 },
+    { 6573, 1, 't', -1 },
+    { 6574, 1, 'n', -1 },
+    { 6575, 1, 'a', -1 },
+    { 0, 0, ';', 1264 },
+    { 6576, 1, 'e', -1 },
+    { 0, 0, ';', 1268 },
+    { 0, 0, ';', 1270 },
+    { 6577, 1, 'f', -1 },
+    { 6578, 1, 's', -1 },
+    { 6579, 1, 'k', -1 },
+    { 6580, 1, 'p', -1 },
+    { 6581, 1, 'l', -1 },
+    { 6582, 1, 'i', -1 },
+    { 6583, 1, 'l', -1 },
+    { 6584, 1, 'l', -1 },
+    { 0, 0, ';', 1281 },
+    { 0, 0, ';', 1282 },
+    { 0, 0, ';', 1283 },
+    { 6585, 1, 'e', -1 },
+    { 6586, 1, 'k', -1 },
+    { 0, 0, ';', 1286 },
+    { 6587, 2, 'l', -1 },
+    { 6589, 1, 'n', -1 },
+    { 6590, 1, 'l', -1 },
+    { 0, 0, ';', 1291 },
+    { 0, 0, ';', 1295 },
+    { 6591, 1, 'r', -1 },
+    { 6592, 1, 'a', -1 },
+    { 6593, 1, 'h', -1 },
+    { 6594, 1, 'r', -1 },
+    { 6595, 1, 'a', -1 },
+    { 6596, 1, 'e', -1 },
+    { 6597, 1, 'i', -1 },
+    { 6598, 1, 'h', -1 },
+    { 6599, 1, 'a', -1 },
+    { 0, 0, ';', 1316 },
+    { 6600, 2, 't', -1 },
+    { 6602, 1, 's', -1 },
+    { 6603, 1, 'p', -1 },
+    { 6604, 1, 'o', -1 },
+    { 6605, 2, 'q', -1 },
+    { 6607, 1, 't', -1 },
+    { 6608, 1, 'i', -1 },
+    { 6609, 1, 't', -1 },
+    { 6610, 1, 'r', -1 },
+    { 0, 0, ';', 1333 },
+    { 0, 0, ';', 1334 },
+    { 6611, 1, 'l', -1 },
+    { 0, 0, ';', 1336 },
+    { 0, 0, ';', 1339 },
+    { 6612, 1, 'n', -1 },
+    { 6613, 1, 'd', -1 },
+    { 0, 0, ';', 1342 },
+    { 6614, 1, 't', -1 },
+    { 6615, 2, 't', -1 },
+    { 6617, 1, 'r', -1 },
+    { 0, 0, ';', 1351 },
+    { 0, 0, ';', 1352 },
+    { 0, 0, ';', 1353 },
+    { 0, 0, ';', 1354 },
+    { 0, 0, ';', 1355 },
+    { 6618, 1, 'e', -1 },
+    { 6619, 1, 'a', -1 },
+    { 6620, 1, 'i', -1 },
+    { 6621, 1, 'r', -1 },
+    { 0, 0, ';', 1362 },
+    { 6622, 1, 's', -1 },
+    { 6623, 1, 'e', -1 },
+    { 6624, 1, 't', -1 },
+    { 6625, 1, 'r', -1 },
+    { 6626, 1, 'g', -1 },
+    { 6627, 1, 't', -1 },
+    { 0, 0, ';', 1373 },
+    { 6628, 1, 'n', -1 },
+    { 0, 0, ';', 1375 },
+    { 6629, 1, 'd', -1 },
+    { 0, 0, ';', 1378 },
+    { 6630, 1, 'o', -1 },
+    { 0, 0, ';', 1383 },
+    { 0, 0, ';', 1384 },
+    { 0, 0, ';', 1386 },
+    { 6631, 1, 'r', -1 },
+    { 6632, 1, 'k', -1 },
+    { 0, 0, ';', 1392 },
+    { 0, 0, ';', 1393 },
+    { 6633, 1, 'e', -1 },
+    { 6634, 1, 's', -1 },
+    { 6635, 1, 'r', -1 },
+    { 6636, 1, 's', -1 },
+    { 6637, 1, 'r', -1 },
+    { 0, 0, ';', 1400 },
+    { 0, 0, ';', 1401 },
+    { 6638, 1, 'h', -1 },
+    { 6639, 1, 'a', -1 },
+    { 6640, 1, 'n', -1 },
+    { 0, 0, ';', 1406 },
+    { 6641, 1, 's', -1 },
+    { 6642, 4, 'o', -1 },
+    { 6646, 1, 'r', -1 },
+    { 6647, 1, 'a', -1 },
+    { 0, 0, ';', 1420 },
+    { 6648, 1, 'r', -1 },
+    { 0, 0, ';', 1425 },
+    { 6649, 1, 't', -1 },
+    { 6650, 1, 'r', -1 },
+    { 6651, 1, 't', 1429 },
+    { 0, 0, ';', 1431 },
+    { 6652, 1, 'b', -1 },
+    { 6653, 2, 'd', -1 },
+    { 6655, 1, 's', -1 },
+    { 6656, 1, 's', -1 },
+    { 6657, 1, 's', -1 },
+    { 6658, 1, 'm', -1 },
+    { 0, 0, ';', 1445 },
+    { 6659, 1, 'a', -1 },
+    { 6660, 1, 'r', -1 },
+    { 6661, 1, 't', -1 },
+    { 6662, 1, 'h', -1 },
+    { 6663, 1, 'h', -1 },
+    { 0, 0, ';', 1457 },
+    { 6664, 1, 'e', -1 },
+    { 0, 0, ';', 1462 },
+    { 0, 0, ';', 1463 },
+    { 6665, 1, 'o', -1 },
+    { 0, 0, ';', 1465 },
+    { 6666, 1, 'a', -1 },
+    { 0, 0, ';', 1470 },
+    { 6667, 1, 'e', -1 },
+    { 6668, 1, 'n', -1 },
+    { 6669, 1, 'l', -1 },
+    { 0, 0, ';', 1475 },
+    { 6670, 1, 'd', -1 },
+    { 0, 0, ';', 1479 },
+    { 0, 0, ';', 1481 },
+    { 6671, 1, 'k', -1 },
+    { 0, 0, ';', 1483 },
+    { 6672, 1, 'o', -1 },
+    { 0, 0, ';', 1485 },
+    { 6673, 1, 'v', -1 },
+    { 6674, 1, 'r', -1 },
+    { 0, 0, ';', 1488 },
+    { 6675, 2, 't', -1 },
+    { 0, 0, ';', 1495 },
+    { 6677, 1, 'l', -1 },
+    { 0, 0, ';', 1498 },
+    { 0, 0, ';', 1501 },
+    { 0, 0, ';', 1502 },
+    { 0, 0, ';', 1503 },
+    { 0, 0, ';', 1509 },
+    { 0, 0, ';', 1511 },
+    { 6678, 1, 'a', -1 },
+    { 6679, 1, 'r', -1 },
+    { 0, 0, ';', 1517 },
+    { 6680, 1, 'l', -1 },
+    { 0, 0, ';', 1520 },
+    { 0, 0, ';', 1521 },
+    { 0, 0, ';', 1523 },
+    { 6681, 1, 'e', -1 },
+    { 0, 0, ';', 1529 },
+    { 6682, 1, 'E', -1 },
+    { 6683, 1, 'd', -1 },
+    { 6684, 3, 'v', -1 },
+    { 0, 0, ';', 1535 },
+    { 6687, 3, 'v', -1 },
+    { 6690, 1, 'l', -1 },
+    { 6691, 1, 'l', -1 },
+    { 0, 0, ';', 1542 },
+    { 6692, 1, 'n', -1 },
+    { 6693, 1, 'e', -1 },
+    { 0, 0, ';', 1547 },
+    { 6694, 1, 'e', -1 },
+    { 0, 0, ';', 1549 },
+    { 0, 0, ';', 1550 },
+    { 6695, 1, 'c', -1 },
+    { 6696, 1, 'w', -1 },
+    { 6697, 1, 't', -1 },
+    { 0, 0, ';', 1554 },
+    { 6698, 1, 'e', -1 },
+    { 6699, 1, 'e', -1 },
+    { 6700, 2, 't', -1 },
+    { 0, 0, ';', 1563 },
+    { 6702, 1, 'q', -1 },
+    { 0, 0, ';', 1565 },
+    { 0, 0, ';', 1566 },
+    { 6703, 1, 'b', -1 },
+    { 6704, 1, 'p', -1 },
+    { 0, 0, ';', 1570 },
+    { 0, 0, ';', 1571 },
+    { 6705, 1, 'e', -1 },
+    { 0, 0, ';', 1575 },
+    { 6706, 1, 'e', -1 },
+    { 0, 0, ';', 1578 },
+    { 0, 0, ';', 1579 },
+    { 6707, 1, 'e', -1 },
+    { 6708, 1, 'e', 1584 },
+    { 6709, 1, 'n', -1 },
+    { 6710, 1, 'o', -1 },
+    { 0, 0, ';', 1594 },
+    { 6711, 1, 'h', -1 },
+    { 6712, 1, 'r', -1 },
+    { 6713, 1, 'h', -1 },
+    { 6714, 1, 'i', -1 },
+    { 6715, 1, 'r', -1 },
+    { 6716, 1, 'i', -1 },
+    { 6717, 1, 'r', -1 },
+    { 6718, 1, 'i', -1 },
+    { 0, 0, ';', 1608 },
+    { 0, 0, ';', 1609 },
+    { 6719, 1, 'k', -1 },
+    { 0, 0, ';', 1611 },
+    { 6720, 1, 'o', -1 },
+    { 6721, 1, 'r', -1 },
+    { 6722, 1, 'e', 1615 },
+    { 0, 0, ';', 1620 },
+    { 0, 0, ';', 1622 },
+    { 6723, 1, 'c', -1 },
+    { 6724, 1, 'd', -1 },
+    { 0, 0, ';', 1627 },
+    { 0, 0, ';', 1628 },
+    { 6725, 1, 'e', 1631 },
+    { 0, 0, ';', 1634 },
+    { 0, 0, ';', 1637 },
+    { 0, 0, ';', 1638 },
+    { 6726, 1, 's', -1 },
+    { 0, 0, ';', 1640 },
+    { 0, 0, ';', 1642 },
+    { 0, 0, ';', 1643 },
+    { 6727, 1, 'o', -1 },
+    { 6728, 1, 's', -1 },
+    { 0, 0, ';', 1649 },
+    { 0, 0, ';', 1650 },
+    { 0, 0, ';', 1652 },
+    { 0, 0, ';', 1654 },
+    { 6729, 1, 'o', -1 },
+    { 6730, 1, 'f', -1 },
+    { 6731, 1, 'p', -1 },
+    { 6732, 1, 'h', 1665 },
+    { 6733, 1, 'e', 1668 },
+    { 6734, 2, 's', -1 },
+    { 0, 0, ';', 1674 },
+    { 6736, 1, 'l', -1 },
+    { 6737, 1, 'm', -1 },
+    { 0, 0, ';', 1680 },
+    { 6738, 1, 't', -1 },
+    { 6739, 1, 'd', -1 },
+    { 6740, 1, 'l', -1 },
+    { 6741, 1, 'n', -1 },
+    { 6742, 1, 't', -1 },
+    { 0, 0, ';', 1692 },
+    { 6743, 1, 'f', -1 },
+    { 6744, 2, 'k', -1 },
+    { 6746, 1, 'v', -1 },
+    { 6747, 1, 'c', -1 },
+    { 0, 0, ';', 1701 },
+    { 6748, 1, 'i', -1 },
+    { 6749, 1, 'o', -1 },
+    { 6750, 1, 'u', -1 },
+    { 0, 0, ';', 1705 },
+    { 6751, 1, 'n', 1706 },
+    { 6752, 1, 'i', -1 },
+    { 6753, 1, 'w', -1 },
+    { 6754, 1, 'i', -1 },
+    { 0, 0, ';', 1714 },
+    { 0, 0, ';', 1718 },
+    { 6755, 1, 'p', -1 },
+    { 6756, 1, 'u', -1 },
+    { 6757, 1, 'q', -1 },
+    { 6758, 1, 'a', -1 },
+    { 6759, 1, 'e', -1 },
+    { 6760, 1, 's', -1 },
+    { 6761, 1, 'i', -1 },
+    { 0, 0, ';', 1728 },
+    { 6762, 1, 's', -1 },
+    { 0, 0, ';', 1731 },
+    { 6763, 1, 'm', -1 },
+    { 6764, 1, 'l', -1 },
+    { 6765, 1, 'i', -1 },
+    { 6766, 1, 'u', -1 },
+    { 6767, 1, 'o', -1 },
+    { 0, 0, ';', 1739 },
+    { 6768, 1, 'l', -1 },
+    { 6769, 1, 'p', -1 },
+    { 6770, 1, 'e', -1 },
+    { 6771, 1, 'r', -1 },
+    { 6772, 1, 'n', -1 },
+    { 0, 0, ';', 1751 },
+    { 6773, 1, 'e', -1 },
+    { 0, 0, ';', 1755 },
+    { 6774, 1, 'l', -1 },
+    { 0, 0, ';', 1758 },
+    { 6775, 1, 'e', -1 },
+    { 0, 0, ';', 1762 },
+    { 6776, 1, 't', -1 },
+    { 0, 0, ';', 1765 },
+    { 0, 0, ';', 1766 },
+    { 6777, 1, 'e', -1 },
+    { 0, 0, ';', 1769 },
+    { 6778, 1, 'p', -1 },
+    { 0, 0, ';', 1772 },
+    { 6779, 1, 'f', -1 },
+    { 0, 0, ';', 1774 },
+    { 6780, 1, 's', -1 },
+    { 6781, 1, 'k', -1 },
+    { 6782, 1, 'p', -1 },
+    { 6783, 1, 'l', -1 },
+    { 6784, 1, 'i', -1 },
+    { 6785, 1, 'l', -1 },
+    { 0, 0, ';', 1781 },
+    { 6786, 1, 'l', -1 },
+    { 0, 0, ';', 1783 },
+    { 6787, 1, 'n', -1 },
+    { 0, 0, ';', 1785 },
+    { 0, 0, ';', 1786 },
+    { 6788, 1, 'e', -1 },
+    { 6789, 1, 'k', -1 },
+    { 0, 0, ';', 1789 },
+    { 6790, 2, 'l', -1 },
+    { 6792, 1, 'n', -1 },
+    { 6793, 1, 'l', -1 },
+    { 0, 0, ';', 1794 },
+    { 6794, 1, 'a', -1 },
+    { 0, 0, ';', 1799 },
+    { 6795, 1, 'r', -1 },
+    { 6796, 1, 'n', -1 },
+    { 6797, 1, 'a', -1 },
+    { 0, 0, ';', 1805 },
+    { 6798, 1, 't', -1 },
+    { 6799, 1, 'r', -1 },
+    { 0, 0, ';', 1812 },
+    { 0, 0, ';', 1813 },
+    { 6800, 1, 'l', -1 },
+    { 6801, 1, 'a', -1 },
+    { 6802, 1, 'h', -1 },
+    { 6803, 1, 'l', -1 },
+    { 6804, 1, 'r', -1 },
+    { 6805, 1, 's', -1 },
+    { 6806, 1, 't', -1 },
+    { 6807, 1, 'g', -1 },
+    { 0, 0, ';', 1828 },
+    { 0, 0, ';', 1829 },
+    { 6808, 2, 't', -1 },
+    { 0, 0, ';', 1833 },
+    { 0, 0, ';', 1834 },
+    { 0, 0, ';', 1835 },
+    { 0, 0, ';', 1836 },
+    { 0, 0, ';', 1837 },
+    { 6810, 1, 's', -1 },
+    { 6811, 1, 'e', -1 },
+    { 6812, 1, 't', -1 },
+    { 6813, 1, 'i', -1 },
+    { 0, 0, ';', 1844 },
+    { 6814, 1, 'o', -1 },
+    { 0, 0, ';', 1849 },
+    { 6815, 1, 'r', -1 },
+    { 6816, 1, 'e', -1 },
+    { 6817, 1, 's', -1 },
+    { 0, 0, ';', 1854 },
+    { 0, 0, ';', 1855 },
+    { 6818, 1, 't', -1 },
+    { 6819, 1, 'a', -1 },
+    { 6820, 1, 'e', -1 },
+    { 0, 0, ';', 1860 },
+    { 6821, 1, 'n', -1 },
+    { 0, 0, ';', 1865 },
+    { 6822, 1, 'l', -1 },
+    { 0, 0, ';', 1868 },
+    { 0, 0, ';', 1870 },
+    { 6823, 1, 'm', -1 },
+    { 6824, 1, 'i', -1 },
+    { 0, 0, ';', 1873 },
+    { 0, 0, ';', 1876 },
+    { 0, 0, ';', 1877 },
+    { 0, 0, ';', 1878 },
+    { 6825, 1, 'k', -1 },
+    { 0, 0, ';', 1880 },
+    { 6826, 1, 'o', -1 },
+    { 6827, 1, 'r', -1 },
+    { 6828, 1, 'n', -1 },
+    { 0, 0, ';', 1887 },
+    { 6829, 1, 'n', -1 },
+    { 0, 0, ';', 1891 },
+    { 6830, 1, 'y', -1 },
+    { 6831, 1, 'm', -1 },
+    { 6832, 1, 'p', -1 },
+    { 0, 0, ';', 1898 },
+    { 6833, 1, 'f', -1 },
+    { 6834, 1, 'v', -1 },
+    { 6835, 1, 't', -1 },
+    { 0, 0, ';', 1904 },
+    { 0, 0, ';', 1906 },
+    { 0, 0, ';', 1908 },
+    { 0, 0, ';', 1909 },
+    { 6836, 1, 'u', -1 },
+    { 6837, 1, 'r', -1 },
+    { 0, 0, ';', 1912 },
+    { 6838, 1, 's', -1 },
+    { 6839, 1, 'p', -1 },
+    { 6840, 1, 'r', -1 },
+    { 0, 0, ';', 1917 },
+    { 0, 0, ';', 1920 },
+    { 6841, 1, 'y', -1 },
+    { 6842, 1, 'r', -1 },
+    { 6843, 2, 's', -1 },
+    { 0, 0, ';', 1929 },
+    { 6845, 1, 's', -1 },
+    { 0, 0, ';', 1931 },
+    { 6846, 1, 's', -1 },
+    { 0, 0, ';', 1933 },
+    { 6847, 1, 'e', -1 },
+    { 6848, 1, 's', -1 },
+    { 0, 0, ';', 1937 },
+    { 6849, 1, 'e', -1 },
+    { 6850, 1, 's', -1 },
+    { 6851, 1, 'e', -1 },
+    { 6852, 1, 'f', -1 },
+    { 0, 0, ';', 1945 },
+    { 6853, 1, 'n', -1 },
+    { 6854, 1, 'e', -1 },
+    { 6855, 1, 'f', -1 },
+    { 0, 0, ';', 1951 },
+    { 6856, 1, 'g', -1 },
+    { 0, 0, ';', 1954 },
+    { 6857, 1, 't', -1 },
+    { 6858, 1, 'o', -1 },
+    { 6859, 1, 'l', -1 },
+    { 0, 0, ';', 1961 },
+    { 0, 0, ';', 1962 },
+    { 6860, 1, 'u', -1 },
+    { 6861, 1, 'r', -1 },
+    { 6862, 3, 't', -1 },
+    { 6865, 1, 'm', -1 },
+    { 6866, 1, 'b', -1 },
+    { 6867, 1, 'p', -1 },
+    { 6868, 1, 'p', -1 },
+    { 6869, 1, 'u', -1 },
+    { 6870, 1, 'q', -1 },
+    { 6871, 1, 'a', -1 },
+    { 6872, 1, 'e', -1 },
+    { 6873, 1, 's', -1 },
+    { 6874, 1, 'i', -1 },
+    { 6875, 1, 't', -1 },
+    { 6876, 1, 'u', -1 },
+    { 6877, 1, 'o', -1 },
+    { 6878, 1, 'o', -1 },
+    { 6879, 1, 'u', -1 },
+    { 6880, 1, 'r', -1 },
+    { 6881, 1, 'l', -1 },
+    { 0, 0, ';', 1999 },
+    { 0, 0, ';', 2000 },
+    { 6882, 1, 'u', -1 },
+    { 6883, 3, 't', -1 },
+    { 6886, 1, 'm', -1 },
+    { 6887, 1, 'b', -1 },
+    { 6888, 1, 'p', -1 },
+    { 0, 0, ';', 2010 },
+    { 6889, 1, 'k', -1 },
+    { 0, 0, ';', 2012 },
+    { 6890, 1, 'o', -1 },
+    { 6891, 1, 'r', -1 },
+    { 0, 0, ';', 2016 },
+    { 6892, 1, 't', -1 },
+    { 6893, 1, 'n', -1 },
+    { 6894, 1, 'l', -1 },
+    { 6895, 1, 'c', -1 },
+    { 6896, 1, '4', -1 },
+    { 6897, 1, 'f', -1 },
+    { 0, 0, ';', 2028 },
+    { 6898, 1, 's', -1 },
+    { 6899, 1, 'v', -1 },
+    { 6900, 1, 'a', -1 },
+    { 6901, 1, 's', -1 },
+    { 6902, 1, 'p', -1 },
+    { 0, 0, ';', 2034 },
+    { 6903, 1, 'm', -1 },
+    { 0, 0, ';', 2037 },
+    { 0, 0, ';', 2038 },
+    { 0, 0, ';', 2040 },
+    { 6904, 2, 'b', -1 },
+    { 6906, 1, 'd', -1 },
+    { 6907, 1, 't', -1 },
+    { 6908, 1, 'r', -1 },
+    { 6909, 1, 'r', -1 },
+    { 6910, 1, 'e', -1 },
+    { 0, 0, ';', 2053 },
+    { 6911, 1, 'g', -1 },
+    { 6912, 1, 't', -1 },
+    { 6913, 1, 'n', -1 },
+    { 6914, 1, 'u', -1 },
+    { 0, 0, ';', 2065 },
+    { 6915, 1, 'm', -1 },
+    { 6916, 1, 'i', -1 },
+    { 0, 0, ';', 2070 },
+    { 6917, 1, 'k', -1 },
+    { 0, 0, ';', 2072 },
+    { 6918, 1, 'a', -1 },
+    { 6919, 1, 'e', 2077 },
+    { 0, 0, ';', 2080 },
+    { 6920, 1, 'e', -1 },
+    { 0, 0, ';', 2083 },
+    { 0, 0, ';', 2085 },
+    { 6921, 1, 'c', -1 },
+    { 0, 0, ';', 2087 },
+    { 6922, 1, 't', -1 },
+    { 6923, 1, 'e', 2090 },
+    { 0, 0, ';', 2092 },
+    { 0, 0, ';', 2093 },
+    { 0, 0, ';', 2094 },
+    { 6924, 2, 'n', -1 },
+    { 6926, 1, 'p', -1 },
+    { 0, 0, ';', 2098 },
+    { 0, 0, ';', 2099 },
+    { 0, 0, ';', 2102 },
+    { 6927, 1, 'o', -1 },
+    { 6928, 1, 'n', -1 },
+    { 6929, 1, 'p', -1 },
+    { 0, 0, ';', 2108 },
+    { 0, 0, ';', 2110 },
+    { 6930, 1, 'o', -1 },
+    { 6931, 1, 'r', -1 },
+    { 6932, 2, 'n', -1 },
+    { 6934, 1, 'p', -1 },
+    { 0, 0, ';', 2116 },
+    { 0, 0, ';', 2117 },
+    { 0, 0, ';', 2119 },
+    { 6935, 1, 'e', -1 },
+    { 0, 0, ';', 2122 },
+    { 0, 0, ';', 2123 },
+    { 6936, 1, 'l', -1 },
+    { 0, 0, ';', 2129 },
+    { 0, 0, ';', 2130 },
+    { 6937, 1, 't', -1 },
+    { 6938, 1, 's', -1 },
+    { 6939, 1, 'p', -1 },
+    { 6940, 1, 't', -1 },
+    { 6941, 1, 'i', -1 },
+    { 0, 0, ';', 2136 },
+    { 6942, 1, 'o', -1 },
+    { 6943, 1, 'o', -1 },
+    { 6944, 1, 'g', -1 },
+    { 6945, 1, 'b', -1 },
+    { 6946, 1, 'p', -1 },
+    { 6947, 1, 'e', -1 },
+    { 6948, 1, 'i', -1 },
+    { 0, 0, ';', 2149 },
+    { 6949, 1, 'r', -1 },
+    { 0, 0, ';', 2152 },
+    { 6950, 1, 'p', -1 },
+    { 6951, 1, 'r', -1 },
+    { 0, 0, ';', 2157 },
+    { 0, 0, ';', 2158 },
+    { 0, 0, ';', 2159 },
+    { 0, 0, ';', 2161 },
+    { 0, 0, ';', 2162 },
+    { 6952, 1, 'E', -1 },
+    { 6953, 1, 'e', -1 },
+    { 6954, 1, 'E', -1 },
+    { 6955, 1, 'e', -1 },
+    { 6956, 1, 'a', -1 },
+    { 0, 0, ';', 2169 },
+    { 6957, 1, 'r', -1 },
+    { 0, 0, ';', 2171 },
+    { 6958, 1, 'q', -1 },
+    { 6959, 1, 'p', -1 },
+    { 6960, 1, 'h', -1 },
+    { 0, 0, ';', 2181 },
+    { 0, 0, ';', 2183 },
+    { 0, 0, ';', 2185 },
+    { 0, 0, ';', 2186 },
+    { 0, 0, ';', 2188 },
+    { 0, 0, ';', 2189 },
+    { 0, 0, ';', 2192 },
+    { 6961, 1, 's', -1 },
+    { 6962, 1, 'e', -1 },
+    { 0, 0, ';', 2196 },
+    { 0, 0, ';', 2197 },
+    { 6963, 1, 'p', -1 },
+    { 6964, 1, 's', -1 },
+    { 0, 0, ';', 2201 },
+    { 6965, 1, 'e', -1 },
+    { 6966, 1, 'e', 2204 },
+    { 0, 0, ';', 2207 },
+    { 6967, 1, 'e', -1 },
+    { 6968, 1, 'n', -1 },
+    { 6969, 1, 'f', -1 },
+    { 6970, 1, 'r', -1 },
+    { 0, 0, ';', 5 },
+    { 0, 0, ';', 6 },
+    { 0, 0, ';', 12 },
+    { 6971, 1, 'u', -1 },
+    { 0, 0, ';', 22 },
+    { 0, 0, ';', 24 },
+    { 6972, 1, 'a', -1 },
+    { 0, 0, ';', 29 },
+    { 6973, 1, 'e', -1 },
+    { 6974, 1, 'l', -1 },
+    { 0, 0, ';', 38 },
+    { 0, 0, ';', 42 },
+    { 6975, 1, 'l', -1 },
+    { 6976, 1, 's', -1 },
+    { 0, 0, ';', 46 },
+    { 0, 0, ';', 48 },
+    { 6977, 1, 't', -1 },
+    { 6978, 1, 'a', -1 },
+    { 6979, 1, 'D', -1 },
+    { 6980, 1, 'D', -1 },
+    { 6981, 1, 'M', -1 },
+    { 6982, 1, 'P', -1 },
+    { 6983, 1, 'T', -1 },
+    { 6984, 1, 'i', -1 },
+    { 6985, 1, 'u', -1 },
+    { 0, 0, ';', 64 },
+    { 6986, 1, 'e', -1 },
+    { 0, 0, ';', 66 },
+    { 6987, 1, 'r', -1 },
+    { 6988, 1, 'u', -1 },
+    { 6989, 1, 'r', -1 },
+    { 0, 0, ';', 74 },
+    { 6990, 1, 'h', -1 },
+    { 0, 0, ';', 80 },
+    { 0, 0, ';', 83 },
+    { 6991, 1, 't', -1 },
+    { 6992, 1, 'd', -1 },
+    { 6993, 1, 'e', -1 },
+    { 0, 0, ';', 97 },
+    { 6994, 1, 'a', -1 },
+    { 6995, 1, 'C', -1 },
+    { 6996, 1, 'D', -1 },
+    { 6997, 2, 'L', -1 },
+    { 6999, 1, 'R', -1 },
+    { 7000, 1, 'U', -1 },
+    { 7001, 1, 'V', -1 },
+    { 7002, 1, 'r', -1 },
+    { 7003, 1, 'e', -1 },
+    { 7004, 1, 'f', -1 },
+    { 7005, 1, 'g', -1 },
+    { 7006, 2, 'e', -1 },
+    { 7008, 1, 'r', -1 },
+    { 0, 0, ';', 128 },
+    { 0, 0, ';', 133 },
+    { 0, 0, ';', 134 },
+    { 0, 0, ';', 141 },
+    { 7009, 1, 't', -1 },
+    { 7010, 1, 'm', -1 },
+    { 7011, 1, 'e', -1 },
+    { 7012, 1, 'n', -1 },
+    { 7013, 1, 'i', -1 },
+    { 7014, 1, 'b', -1 },
+    { 0, 0, ';', 157 },
+    { 7015, 1, 'n', -1 },
+    { 7016, 1, 'S', -1 },
+    { 7017, 1, 'V', -1 },
+    { 0, 0, ';', 164 },
+    { 7018, 1, 'r', -1 },
+    { 0, 0, ';', 171 },
+    { 0, 0, ';', 172 },
+    { 0, 0, ';', 173 },
+    { 7019, 6, 'r', -1 },
+    { 0, 0, ';', 189 },
+    { 7025, 1, 't', -1 },
+    { 7026, 1, 'n', -1 },
+    { 0, 0, ';', 198 },
+    { 7027, 1, 'w', -1 },
+    { 7028, 1, 'u', -1 },
+    { 0, 0, ';', 205 },
+    { 0, 0, ';', 212 },
+    { 7029, 1, 'a', -1 },
+    { 7030, 1, 's', -1 },
+    { 7031, 1, 'a', -1 },
+    { 7032, 1, 'e', -1 },
+    { 7033, 1, 'b', -1 },
+    { 0, 0, ';', 226 },
+    { 0, 0, ';', 235 },
+    { 0, 0, ';', 240 },
+    { 0, 0, ';', 248 },
+    { 0, 0, ';', 249 },
+    { 7034, 1, 'e', -1 },
+    { 0, 0, ';', 253 },
+    { 0, 0, ';', 254 },
+    { 7035, 1, 'g', -1 },
+    { 7036, 1, 'r', -1 },
+    { 7037, 1, 'i', -1 },
+    { 7038, 1, 'u', -1 },
+    { 7039, 1, 'w', -1 },
+    { 7040, 1, 'o', -1 },
+    { 7041, 1, 'g', -1 },
+    { 7042, 3, 'e', -1 },
+    { 7045, 1, 'i', -1 },
+    { 7046, 1, 'D', -1 },
+    { 7047, 1, 'T', -1 },
+    { 7048, 1, 'V', -1 },
+    { 7049, 1, 'c', -1 },
+    { 7050, 1, 'r', -1 },
+    { 7051, 1, 'g', -1 },
+    { 7052, 1, 'u', -1 },
+    { 7053, 1, 'l', -1 },
+    { 7054, 1, 'e', -1 },
+    { 7055, 1, 's', -1 },
+    { 7056, 1, 'a', -1 },
+    { 7057, 1, 'l', -1 },
+    { 7058, 1, 'r', -1 },
+    { 0, 0, ';', 291 },
+    { 7059, 1, 'f', -1 },
+    { 7060, 1, 'g', -1 },
+    { 7061, 1, 'f', -1 },
+    { 7062, 1, 'g', -1 },
+    { 7063, 1, 'e', -1 },
+    { 7064, 1, 'i', -1 },
+    { 0, 0, ';', 303 },
+    { 7065, 1, 'S', -1 },
+    { 7066, 1, 't', -1 },
+    { 7067, 1, 'l', -1 },
+    { 0, 0, ';', 315 },
+    { 0, 0, ';', 316 },
+    { 0, 0, ';', 317 },
+    { 7068, 1, 'v', -1 },
+    { 7069, 1, 'G', -1 },
+    { 7070, 1, 'L', -1 },
+    { 7071, 1, 'e', -1 },
+    { 7072, 1, 'k', -1 },
+    { 7073, 1, 'a', -1 },
+    { 7074, 1, 'g', -1 },
+    { 7075, 1, 'C', -1 },
+    { 7076, 1, 'b', -1 },
+    { 7077, 1, 'm', -1 },
+    { 7078, 1, 'a', -1 },
+    { 7079, 1, 's', -1 },
+    { 7080, 1, 'a', -1 },
+    { 7081, 2, 'p', -1 },
+    { 7083, 1, 't', -1 },
+    { 7084, 6, 's', -1 },
+    { 7090, 1, 't', -1 },
+    { 7091, 1, 'c', -1 },
+    { 7092, 1, 'e', -1 },
+    { 7093, 1, 'h', -1 },
+    { 7094, 1, 'a', -1 },
+    { 7095, 1, 's', -1 },
+    { 7096, 1, 'c', -1 },
+    { 7097, 1, 'e', -1 },
+    { 7098, 1, 'd', -1 },
+    { 7099, 1, 't', -1 },
+    { 0, 0, ';', 384 },
+    { 0, 0, ';', 388 },
+    { 0, 0, ';', 392 },
+    { 0, 0, ';', 395 },
+    { 7100, 1, 'n', -1 },
+    { 7101, 1, 'r', -1 },
+    { 0, 0, ';', 405 },
+    { 0, 0, ';', 407 },
+    { 0, 0, ';', 408 },
+    { 7102, 1, 'r', -1 },
+    { 7103, 1, 'a', -1 },
+    { 7104, 1, 'r', -1 },
+    { 7105, 1, 'l', -1 },
+    { 7106, 1, 'n', -1 },
+    { 7107, 1, 'r', -1 },
+    { 7108, 1, 'e', -1 },
+    { 7109, 1, 't', -1 },
+    { 7110, 1, 't', -1 },
+    { 0, 0, ';', 442 },
+    { 0, 0, ';', 445 },
+    { 0, 0, ';', 446 },
+    { 0, 0, ';', 447 },
+    { 7111, 2, 'e', -1 },
+    { 7113, 1, 'n', -1 },
+    { 7114, 1, 'r', -1 },
+    { 7115, 1, 'e', -1 },
+    { 7116, 2, 'o', -1 },
+    { 7118, 1, 'l', -1 },
+    { 7119, 1, 'e', -1 },
+    { 7120, 1, 'r', -1 },
+    { 7121, 3, 'p', -1 },
+    { 7124, 1, 'e', -1 },
+    { 7125, 1, 'r', -1 },
+    { 7126, 1, 'm', -1 },
+    { 7127, 1, 'a', -1 },
+    { 7128, 1, 'l', -1 },
+    { 0, 0, ';', 484 },
+    { 0, 0, ';', 486 },
+    { 0, 0, ';', 487 },
+    { 0, 0, ';', 489 },
+    { 0, 0, ';', 490 },
+    { 7129, 1, 'o', -1 },
+    { 7130, 1, 'e', -1 },
+    { 7131, 1, 'i', -1 },
+    { 7132, 1, 'p', -1 },
+    { 7133, 1, 'i', -1 },
+    { 0, 0, ';', 502 },
+    { 7134, 1, 'I', -1 },
+    { 7135, 1, 'S', -1 },
+    { 7136, 1, 'U', -1 },
+    { 0, 0, ';', 512 },
+    { 7137, 1, 'E', -1 },
+    { 7138, 1, 'd', -1 },
+    { 7139, 1, 'a', -1 },
+    { 7140, 1, 'e', -1 },
+    { 0, 0, ';', 523 },
+    { 0, 0, ';', 531 },
+    { 0, 0, ';', 532 },
+    { 7141, 1, 'o', -1 },
+    { 7142, 1, 'p', -1 },
+    { 7143, 1, 'a', -1 },
+    { 7144, 1, 'q', -1 },
+    { 7145, 1, 'u', -1 },
+    { 7146, 1, 'i', -1 },
+    { 7147, 1, 'D', -1 },
+    { 0, 0, ';', 546 },
+    { 0, 0, ';', 548 },
+    { 7148, 1, 'i', -1 },
+    { 0, 0, ';', 552 },
+    { 0, 0, ';', 556 },
+    { 0, 0, ';', 559 },
+    { 7149, 1, 'a', -1 },
+    { 7150, 1, 'r', -1 },
+    { 7151, 1, 'a', -1 },
+    { 7152, 1, 'l', -1 },
+    { 7153, 3, 'w', -1 },
+    { 7156, 1, 'A', -1 },
+    { 7157, 1, 'l', -1 },
+    { 7158, 1, 'r', -1 },
+    { 7159, 1, 'w', -1 },
+    { 7160, 1, 'a', -1 },
+    { 7161, 1, 'e', -1 },
+    { 7162, 1, 'i', -1 },
+    { 7163, 1, 'n', -1 },
+    { 0, 0, ';', 584 },
+    { 0, 0, ';', 591 },
+    { 0, 0, ';', 593 },
+    { 7164, 1, 'a', -1 },
+    { 7165, 1, 'i', -1 },
+    { 0, 0, ';', 603 },
+    { 0, 0, ';', 617 },
+    { 0, 0, ';', 625 },
+    { 0, 0, ';', 626 },
+    { 7166, 1, 'd', -1 },
+    { 0, 0, ';', 635 },
+    { 0, 0, ';', 636 },
+    { 0, 0, ';', 650 },
+    { 7167, 1, 'm', -1 },
+    { 0, 0, ';', 659 },
+    { 7168, 1, 'p', -1 },
+    { 0, 0, ';', 666 },
+    { 7169, 8, 'a', -1 },
+    { 7177, 2, 'b', -1 },
+    { 0, 0, ';', 678 },
+    { 7179, 1, 'r', -1 },
+    { 0, 0, ';', 685 },
+    { 0, 0, ';', 689 },
+    { 7180, 1, 'e', -1 },
+    { 7181, 1, 'q', -1 },
+    { 0, 0, ';', 698 },
+    { 7182, 1, 'n', -1 },
+    { 7183, 1, 'n', -1 },
+    { 7184, 1, 's', -1 },
+    { 7185, 1, 'i', -1 },
+    { 7186, 2, 'm', -1 },
+    { 0, 0, ';', 709 },
+    { 0, 0, ';', 710 },
+    { 7188, 1, 'g', -1 },
+    { 7189, 1, 'r', -1 },
+    { 0, 0, ';', 717 },
+    { 7190, 1, 'e', -1 },
+    { 7191, 1, 'v', -1 },
+    { 0, 0, ';', 721 },
+    { 7192, 1, 'n', -1 },
+    { 0, 0, ';', 726 },
+    { 7193, 1, 'c', -1 },
+    { 0, 0, ';', 728 },
+    { 7194, 1, 't', -1 },
+    { 7195, 1, 'u', -1 },
+    { 7196, 1, 'm', -1 },
+    { 7197, 1, 'u', -1 },
+    { 7198, 1, 'r', -1 },
+    { 7199, 1, 'a', -1 },
+    { 7200, 1, 'u', -1 },
+    { 0, 0, ';', 737 },
+    { 7201, 1, 'g', -1 },
+    { 0, 0, ';', 739 },
+    { 7202, 1, 'o', -1 },
+    { 7203, 1, 'q', -1 },
+    { 7204, 1, 'r', -1 },
+    { 7205, 1, 'v', -1 },
+    { 0, 0, ';', 756 },
+    { 0, 0, ';', 757 },
+    { 0, 0, ';', 778 },
+    { 7206, 1, 'u', -1 },
+    { 7207, 1, 's', -1 },
+    { 7208, 1, 'e', -1 },
+    { 0, 0, ';', 802 },
+    { 0, 0, ';', 805 },
+    { 7209, 1, 'u', -1 },
+    { 0, 0, ';', 814 },
+    { 0, 0, ';', 818 },
+    { 0, 0, ';', 819 },
+    { 0, 0, ';', 821 },
+    { 7210, 1, 'u', -1 },
+    { 0, 0, ';', 823 },
+    { 0, 0, ';', 824 },
+    { 0, 0, ';', 825 },
+    { 0, 0, ';', 830 },
+    { 0, 0, ';', 832 },
+    { 7211, 1, 'm', -1 },
+    { 7212, 1, 'v', -1 },
+    { 7213, 1, 'd', -1 },
+    { 7214, 1, 'a', -1 },
+    { 0, 0, ';', 851 },
+    { 7215, 1, 'a', -1 },
+    { 7216, 5, 'd', -1 },
+    { 7221, 1, 'n', -1 },
+    { 0, 0, ';', 861 },
+    { 7222, 1, 'r', -1 },
+    { 7223, 1, 'i', -1 },
+    { 0, 0, ';', 866 },
+    { 7224, 1, 'q', -1 },
+    { 0, 0, ';', 869 },
+    { 0, 0, ';', 871 },
+    { 7225, 1, 'm', -1 },
+    { 7226, 1, 'x', -1 },
+    { 7227, 1, 't', -1 },
+    { 0, 0, ';', 876 },
+    { 0, 0, ';', 878 },
+    { 0, 0, ';', 881 },
+    { 7228, 1, 'l', -1 },
+    { 7229, 1, 'r', -1 },
+    { 0, 0, ';', 894 },
+    { 7230, 1, 'p', -1 },
+    { 7231, 1, 'a', -1 },
+    { 0, 0, ';', 898 },
+    { 0, 0, ';', 899 },
+    { 0, 0, ';', 900 },
+    { 0, 0, ';', 903 },
+    { 7232, 1, 'm', -1 },
+    { 7233, 2, 'q', -1 },
+    { 7235, 1, 'e', -1 },
+    { 7236, 1, 'e', -1 },
+    { 0, 0, ';', 910 },
+    { 7237, 1, 'r', -1 },
+    { 7238, 1, 'n', -1 },
+    { 0, 0, ';', 917 },
+    { 0, 0, ';', 920 },
+    { 0, 0, ';', 921 },
+    { 7239, 1, 'w', -1 },
+    { 0, 0, ';', 927 },
+    { 7240, 1, 'r', -1 },
+    { 7241, 1, 'q', -1 },
+    { 7242, 1, 'v', -1 },
+    { 0, 0, ';', 937 },
+    { 7243, 2, 'd', -1 },
+    { 7245, 1, 'a', -1 },
+    { 0, 0, ';', 950 },
+    { 7246, 1, 'o', -1 },
+    { 0, 0, ';', 952 },
+    { 0, 0, ';', 954 },
+    { 0, 0, ';', 955 },
+    { 0, 0, ';', 956 },
+    { 7247, 1, 'o', -1 },
+    { 7248, 1, 'u', -1 },
+    { 7249, 1, 's', -1 },
+    { 7250, 1, 'a', -1 },
+    { 7251, 1, 'b', -1 },
+    { 7252, 1, 'r', -1 },
+    { 7253, 1, 'w', -1 },
+    { 7254, 1, 'r', -1 },
+    { 7255, 1, 'o', -1 },
+    { 0, 0, ';', 970 },
+    { 0, 0, ';', 971 },
+    { 0, 0, ';', 975 },
+    { 7256, 1, 'e', -1 },
+    { 7257, 1, 'r', -1 },
+    { 0, 0, ';', 987 },
+    { 0, 0, ';', 988 },
+    { 0, 0, ';', 989 },
+    { 0, 0, ';', 993 },
+    { 0, 0, ';', 1001 },
+    { 0, 0, ';', 1003 },
+    { 7258, 1, 'r', -1 },
+    { 0, 0, ';', 1008 },
+    { 7259, 1, 'e', -1 },
+    { 0, 0, ';', 1012 },
+    { 0, 0, ';', 1013 },
+    { 0, 0, ';', 1014 },
+    { 0, 0, ';', 1021 },
+    { 7260, 1, 'n', -1 },
+    { 0, 0, ';', 1026 },
+    { 7261, 1, 'n', -1 },
+    { 7262, 2, 't', -1 },
+    { 0, 0, ';', 1031 },
+    { 0, 0, ';', 1032 },
+    { 7264, 1, 'D', -1 },
+    { 7265, 1, 's', -1 },
+    { 7266, 1, 'a', -1 },
+    { 7267, 1, 'n', -1 },
+    { 7268, 1, 'g', -1 },
+    { 0, 0, ';', 1053 },
+    { 0, 0, ';', 1054 },
+    { 0, 0, ';', 1056 },
+    { 0, 0, ';', 1065 },
+    { 7269, 1, 'n', -1 },
+    { 0, 0, ';', 1070 },
+    { 0, 0, ';', 1071 },
+    { 0, 0, ';', 1073 },
+    { 0, 0, ';', 1074 },
+    { 0, 0, ';', 1075 },
+    { 0, 0, ';', 1076 },
+    { 0, 0, ';', 1077 },
+    { 0, 0, ';', 1078 },
+    { 0, 0, ';', 1080 },
+    { 0, 0, ';', 1081 },
+    { 0, 0, ';', 1082 },
+    { 0, 0, ';', 1083 },
+    { 0, 0, ';', 1084 },
+    { 0, 0, ';', 1085 },
+    { 0, 0, ';', 1086 },
+    { 0, 0, ';', 1092 },
+    { 0, 0, ';', 1094 },
+    { 0, 0, ';', 1096 },
+    { 7270, 1, 'n', -1 },
+    { 0, 0, ';', 1107 },
+    { 7271, 2, 'o', -1 },
+    { 0, 0, ';', 1111 },
+    { 7273, 1, 'o', -1 },
+    { 0, 0, ';', 1139 },
+    { 7274, 1, 't', -1 },
+    { 7275, 1, 'r', -1 },
+    { 0, 0, ';', 1142 },
+    { 0, 0, ';', 1143 },
+    { 7276, 1, 'e', -1 },
+    { 7277, 1, 'l', -1 },
+    { 7278, 1, 's', -1 },
+    { 0, 0, ';', 1147 },
+    { 7279, 1, 'e', -1 },
+    { 0, 0, ';', 1151 },
+    { 0, 0, ';', 1153 },
+    { 0, 0, ';', 1154 },
+    { 7280, 1, 'r', -1 },
+    { 0, 0, ';', 1160 },
+    { 7281, 1, 'u', -1 },
+    { 0, 0, ';', 1162 },
+    { 0, 0, ';', 1163 },
+    { 7282, 1, 'o', -1 },
+    { 7283, 1, 'o', -1 },
+    { 0, 0, ';', 1168 },
+    { 7284, 1, 'f', -1 },
+    { 7285, 1, 'g', -1 },
+    { 0, 0, ';', 1172 },
+    { 0, 0, ';', 1174 },
+    { 0, 0, ';', 1175 },
+    { 0, 0, ';', 1176 },
+    { 0, 0, ';', 1177 },
+    { 0, 0, ';', 1179 },
+    { 0, 0, ';', 1190 },
+    { 0, 0, ';', 1192 },
+    { 0, 0, ';', 1194 },
+    { 7286, 1, 'n', -1 },
+    { 7287, 1, 'r', -1 },
+    { 0, 0, ';', 1205 },
+    { 7288, 1, 'i', -1 },
+    { 0, 0, ';', 1208 },
+    { 0, 0, ';', 1210 },
+    { 7289, 1, 'r', -1 },
+    { 7290, 1, 'a', -1 },
+    { 7291, 1, 'h', -1 },
+    { 7292, 1, 'd', -1 },
+    { 0, 0, ';', 1221 },
+    { 7293, 1, 't', -1 },
+    { 0, 0, ';', 1227 },
+    { 0, 0, ';', 1230 },
+    { 0, 0, ';', 1240 },
+    { 0, 0, ';', 1243 },
+    { 0, 0, ';', 1244 },
+    { 0, 0, ';', 1247 },
+    { 0, 0, ';', 1254 },
+    { 0, 0, ';', 1259 },
+    { 7294, 1, 'y', -1 },
+    { 0, 0, ';', 1261 },
+    { 0, 0, ';', 1262 },
+    { 0, 0, ';', 1265 },
+    { 7295, 1, 's', -1 },
+    { 0, 0, ';', 1272 },
+    { 0, 0, ';', 1273 },
+    { 0, 0, ';', 1274 },
+    { 0, 0, ';', 1275 },
+    { 7296, 1, 'm', -1 },
+    { 0, 0, ';', 1277 },
+    { 0, 0, ';', 1279 },
+    { 0, 0, ';', 1284 },
+    { 0, 0, ';', 1285 },
+    { 7297, 1, 'd', -1 },
+    { 7298, 1, 'u', -1 },
+    { 0, 0, ';', 1289 },
+    { 0, 0, ';', 1290 },
+    { 0, 0, ';', 1296 },
+    { 7299, 1, 'r', -1 },
+    { 7300, 1, 'a', -1 },
+    { 7301, 1, 'r', -1 },
+    { 7302, 1, 'r', -1 },
+    { 7303, 1, 'f', -1 },
+    { 7304, 1, 'g', -1 },
+    { 7305, 1, 'r', -1 },
+    { 7306, 1, 'n', -1 },
+    { 0, 0, ';', 1317 },
+    { 7307, 2, 'o', -1 },
+    { 0, 0, ';', 1321 },
+    { 7309, 1, 'p', -1 },
+    { 7310, 1, 't', -1 },
+    { 7311, 1, 'g', -1 },
+    { 7312, 1, 'q', -1 },
+    { 7313, 1, 'r', -1 },
+    { 7314, 1, 'm', -1 },
+    { 0, 0, ';', 1328 },
+    { 0, 0, ';', 1329 },
+    { 0, 0, ';', 1335 },
+    { 7315, 1, 'e', -1 },
+    { 0, 0, ';', 1341 },
+    { 0, 0, ';', 1343 },
+    { 0, 0, ';', 1344 },
+    { 7316, 1, 'a', -1 },
+    { 7317, 1, 'o', -1 },
+    { 7318, 1, 'f', -1 },
+    { 7319, 1, 'p', -1 },
+    { 7320, 1, 'g', -1 },
+    { 7321, 1, 'r', -1 },
+    { 0, 0, ';', 1364 },
+    { 7322, 1, 's', -1 },
+    { 0, 0, ';', 1366 },
+    { 0, 0, ';', 1367 },
+    { 7323, 1, 'e', -1 },
+    { 0, 0, ';', 1372 },
+    { 7324, 1, 'e', -1 },
+    { 0, 0, ';', 1376 },
+    { 0, 0, ';', 1379 },
+    { 0, 0, ';', 1387 },
+    { 0, 0, ';', 1388 },
+    { 0, 0, ';', 1394 },
+    { 0, 0, ';', 1395 },
+    { 0, 0, ';', 1396 },
+    { 7325, 1, 't', -1 },
+    { 0, 0, ';', 1398 },
+    { 7326, 1, 'a', -1 },
+    { 7327, 1, 'r', -1 },
+    { 7328, 1, 'e', -1 },
+    { 7329, 1, 'e', -1 },
+    { 0, 0, ';', 1413 },
+    { 7330, 1, 'd', -1 },
+    { 7331, 1, 'l', -1 },
+    { 7332, 1, 'u', -1 },
+    { 0, 0, ';', 1417 },
+    { 0, 0, ';', 1418 },
+    { 7333, 1, 'e', -1 },
+    { 0, 0, ';', 1427 },
+    { 0, 0, ';', 1428 },
+    { 0, 0, ';', 1430 },
+    { 0, 0, ';', 1432 },
+    { 0, 0, ';', 1433 },
+    { 7334, 1, 'u', -1 },
+    { 0, 0, ';', 1437 },
+    { 0, 0, ';', 1438 },
+    { 0, 0, ';', 1442 },
+    { 7335, 1, 'a', -1 },
+    { 7336, 1, 'r', -1 },
+    { 7337, 1, 'i', -1 },
+    { 7338, 1, 'a', -1 },
+    { 0, 0, ';', 1455 },
+    { 0, 0, ';', 1456 },
+    { 0, 0, ';', 1458 },
+    { 7339, 1, 'x', -1 },
+    { 7340, 2, 'l', -1 },
+    { 0, 0, ';', 1471 },
+    { 0, 0, ';', 1473 },
+    { 0, 0, ';', 1474 },
+    { 7342, 1, 'o', -1 },
+    { 0, 0, ';', 1482 },
+    { 7343, 1, 'w', -1 },
+    { 0, 0, ';', 1486 },
+    { 0, 0, ';', 1487 },
+    { 0, 0, ';', 1489 },
+    { 7344, 1, 's', -1 },
+    { 7345, 1, 'a', -1 },
+    { 7346, 1, 'r', -1 },
+    { 7347, 1, 'i', -1 },
+    { 7348, 1, 'a', -1 },
+    { 0, 0, ';', 1524 },
+    { 0, 0, ';', 1530 },
+    { 7349, 1, 'o', -1 },
+    { 7350, 1, 'a', -1 },
+    { 7351, 1, 'b', -1 },
+    { 7352, 1, 'c', -1 },
+    { 7353, 1, 'a', -1 },
+    { 7354, 1, 'b', -1 },
+    { 7355, 1, 'c', -1 },
+    { 7356, 1, 'l', -1 },
+    { 0, 0, ';', 1541 },
+    { 7357, 1, 't', -1 },
+    { 0, 0, ';', 1545 },
+    { 7358, 1, 'q', -1 },
+    { 0, 0, ';', 1551 },
+    { 0, 0, ';', 1552 },
+    { 7359, 1, 'a', -1 },
+    { 0, 0, ';', 1555 },
+    { 0, 0, ';', 1557 },
+    { 7360, 1, 'm', -1 },
+    { 7361, 1, 'p', -1 },
+    { 0, 0, ';', 1564 },
+    { 7362, 1, 'e', -1 },
+    { 7363, 1, 'e', -1 },
+    { 7364, 2, 't', -1 },
+    { 7366, 1, 'q', -1 },
+    { 7367, 2, 't', -1 },
+    { 0, 0, ';', 1585 },
+    { 7369, 1, 'g', -1 },
+    { 0, 0, ';', 1593 },
+    { 0, 0, ';', 1595 },
+    { 0, 0, ';', 1596 },
+    { 0, 0, ';', 1598 },
+    { 7370, 1, 'n', -1 },
+    { 0, 0, ';', 1602 },
+    { 7371, 1, 'e', -1 },
+    { 0, 0, ';', 1606 },
+    { 7372, 1, 'e', -1 },
+    { 0, 0, ';', 1610 },
+    { 7373, 1, 'w', -1 },
+    { 0, 0, ';', 1613 },
+    { 0, 0, ';', 1616 },
+    { 0, 0, ';', 1623 },
+    { 0, 0, ';', 1626 },
+    { 0, 0, ';', 1632 },
+    { 7374, 1, 's', -1 },
+    { 7375, 1, 'n', -1 },
+    { 0, 0, ';', 1646 },
+    { 7376, 1, 'f', -1 },
+    { 0, 0, ';', 1660 },
+    { 7377, 1, 'e', -1 },
+    { 0, 0, ';', 1666 },
+    { 0, 0, ';', 1669 },
+    { 0, 0, ';', 1670 },
+    { 7378, 1, 'a', -1 },
+    { 7379, 1, 'e', -1 },
+    { 0, 0, ';', 1679 },
+    { 0, 0, ';', 1683 },
+    { 0, 0, ';', 1684 },
+    { 0, 0, ';', 1685 },
+    { 7380, 1, 'k', -1 },
+    { 0, 0, ';', 1691 },
+    { 7381, 1, 'o', -1 },
+    { 0, 0, ';', 1696 },
+    { 7382, 1, 'h', -1 },
+    { 0, 0, ';', 1698 },
+    { 7383, 1, 'i', -1 },
+    { 7384, 1, 'r', -1 },
+    { 0, 0, ';', 1703 },
+    { 0, 0, ';', 1704 },
+    { 0, 0, ';', 1707 },
+    { 7385, 1, 'm', -1 },
+    { 7386, 1, 'o', -1 },
+    { 7387, 1, 'n', -1 },
+    { 7388, 1, 'p', -1 },
+    { 7389, 1, 'r', -1 },
+    { 0, 0, ';', 1723 },
+    { 7390, 1, 'p', -1 },
+    { 7391, 1, 'q', -1 },
+    { 7392, 1, 'i', -1 },
+    { 7393, 1, 'm', -1 },
+    { 0, 0, ';', 1729 },
+    { 0, 0, ';', 1732 },
+    { 7394, 1, 'a', -1 },
+    { 7395, 1, 'n', -1 },
+    { 7396, 1, 'r', -1 },
+    { 0, 0, ';', 1738 },
+    { 0, 0, ';', 1740 },
+    { 0, 0, ';', 1743 },
+    { 0, 0, ';', 1747 },
+    { 7397, 1, 'n', -1 },
+    { 7398, 1, 't', -1 },
+    { 7399, 1, 'q', -1 },
+    { 0, 0, ';', 1757 },
+    { 0, 0, ';', 1761 },
+    { 7400, 1, 'y', -1 },
+    { 0, 0, ';', 1767 },
+    { 0, 0, ';', 1771 },
+    { 7401, 1, 's', -1 },
+    { 0, 0, ';', 1775 },
+    { 0, 0, ';', 1776 },
+    { 0, 0, ';', 1777 },
+    { 0, 0, ';', 1778 },
+    { 7402, 1, 'm', -1 },
+    { 0, 0, ';', 1780 },
+    { 0, 0, ';', 1782 },
+    { 7403, 1, 'a', -1 },
+    { 0, 0, ';', 1787 },
+    { 0, 0, ';', 1788 },
+    { 7404, 1, 'd', -1 },
+    { 7405, 1, 'u', -1 },
+    { 0, 0, ';', 1792 },
+    { 0, 0, ';', 1793 },
+    { 7406, 1, 'r', -1 },
+    { 0, 0, ';', 1800 },
+    { 7407, 1, 'e', -1 },
+    { 7408, 1, 'r', -1 },
+    { 0, 0, ';', 1809 },
+    { 0, 0, ';', 1810 },
+    { 0, 0, ';', 1814 },
+    { 7409, 1, 'r', -1 },
+    { 7410, 1, 'a', -1 },
+    { 7411, 1, 'e', -1 },
+    { 7412, 1, 'i', -1 },
+    { 7413, 1, 'q', -1 },
+    { 7414, 1, 'h', -1 },
+    { 7415, 1, 'd', -1 },
+    { 0, 0, ';', 1831 },
+    { 7416, 1, 'a', -1 },
+    { 0, 0, ';', 1839 },
+    { 7417, 1, 's', -1 },
+    { 0, 0, ';', 1842 },
+    { 7418, 1, 'n', -1 },
+    { 0, 0, ';', 1845 },
+    { 0, 0, ';', 1850 },
+    { 0, 0, ';', 1851 },
+    { 0, 0, ';', 1852 },
+    { 7419, 1, 'r', -1 },
+    { 7420, 1, 'r', -1 },
+    { 0, 0, ';', 1859 },
+    { 0, 0, ';', 1864 },
+    { 0, 0, ';', 1867 },
+    { 0, 0, ';', 1871 },
+    { 7421, 1, 'n', -1 },
+    { 0, 0, ';', 1879 },
+    { 7422, 1, 'w', -1 },
+    { 0, 0, ';', 1885 },
+    { 7423, 1, 'u', -1 },
+    { 0, 0, ';', 1890 },
+    { 0, 0, ';', 1892 },
+    { 7424, 1, 'i', -1 },
+    { 7425, 1, 'a', -1 },
+    { 0, 0, ';', 1899 },
+    { 0, 0, ';', 1900 },
+    { 0, 0, ';', 1902 },
+    { 7426, 1, 's', -1 },
+    { 7427, 1, 'r', -1 },
+    { 7428, 1, 'e', -1 },
+    { 0, 0, ';', 1914 },
+    { 7429, 1, 's', -1 },
+    { 0, 0, ';', 1921 },
+    { 0, 0, ';', 1924 },
+    { 0, 0, ';', 1926 },
+    { 7430, 1, 'u', -1 },
+    { 0, 0, ';', 1930 },
+    { 0, 0, ';', 1932 },
+    { 0, 0, ';', 1934 },
+    { 7431, 1, 'e', -1 },
+    { 0, 0, ';', 1938 },
+    { 7432, 1, 'e', -1 },
+    { 0, 0, ';', 1942 },
+    { 0, 0, ';', 1943 },
+    { 0, 0, ';', 1947 },
+    { 0, 0, ';', 1948 },
+    { 0, 0, ';', 1949 },
+    { 7433, 1, 'h', -1 },
+    { 0, 0, ';', 1957 },
+    { 7434, 1, 't', -1 },
+    { 7435, 1, 't', -1 },
+    { 7436, 1, 's', -1 },
+    { 7437, 1, 'r', -1 },
+    { 0, 0, ';', 1965 },
+    { 7438, 1, 'e', -1 },
+    { 7439, 1, 'n', -1 },
+    { 0, 0, ';', 1970 },
+    { 0, 0, ';', 1971 },
+    { 0, 0, ';', 1972 },
+    { 7440, 1, 'p', -1 },
+    { 7441, 1, 'r', -1 },
+    { 0, 0, ';', 1976 },
+    { 7442, 1, 'p', -1 },
+    { 7443, 1, 'q', -1 },
+    { 7444, 1, 'i', -1 },
+    { 7445, 1, 'm', -1 },
+    { 0, 0, ';', 1991 },
+    { 7446, 1, 'b', -1 },
+    { 7447, 1, 't', -1 },
+    { 7448, 1, 'l', -1 },
+    { 7449, 1, 'b', -1 },
+    { 7450, 1, 'r', -1 },
+    { 7451, 1, 't', -1 },
+    { 7452, 1, 's', -1 },
+    { 0, 0, ';', 2002 },
+    { 7453, 1, 'e', -1 },
+    { 7454, 1, 'n', -1 },
+    { 0, 0, ';', 2007 },
+    { 0, 0, ';', 2008 },
+    { 0, 0, ';', 2009 },
+    { 0, 0, ';', 2011 },
+    { 7455, 1, 'w', -1 },
+    { 0, 0, ';', 2014 },
+    { 0, 0, ';', 2017 },
+    { 0, 0, ';', 2020 },
+    { 0, 0, ';', 2021 },
+    { 0, 0, ';', 2024 },
+    { 0, 0, ';', 2026 },
+    { 7456, 1, 'o', -1 },
+    { 7457, 1, 'y', -1 },
+    { 0, 0, ';', 2030 },
+    { 7458, 1, 'p', -1 },
+    { 7459, 1, 'i', -1 },
+    { 0, 0, ';', 2033 },
+    { 0, 0, ';', 2035 },
+    { 0, 0, ';', 2041 },
+    { 7460, 1, 'a', -1 },
+    { 0, 0, ';', 2043 },
+    { 0, 0, ';', 2047 },
+    { 0, 0, ';', 2048 },
+    { 7461, 1, 'k', -1 },
+    { 0, 0, ';', 2052 },
+    { 7462, 1, 'l', -1 },
+    { 0, 0, ';', 2061 },
+    { 7463, 1, 'u', -1 },
+    { 7464, 1, 's', -1 },
+    { 7465, 1, 'e', -1 },
+    { 7466, 1, 'u', -1 },
+    { 0, 0, ';', 2071 },
+    { 7467, 2, 'd', -1 },
+    { 0, 0, ';', 2078 },
+    { 0, 0, ';', 2081 },
+    { 0, 0, ';', 2086 },
+    { 0, 0, ';', 2088 },
+    { 0, 0, ';', 2091 },
+    { 0, 0, ';', 2095 },
+    { 7469, 1, 'e', -1 },
+    { 0, 0, ';', 2097 },
+    { 7470, 1, 'w', -1 },
+    { 7471, 1, 'a', -1 },
+    { 7472, 1, 'o', -1 },
+    { 7473, 1, 'n', -1 },
+    { 7474, 1, 'r', -1 },
+    { 0, 0, ';', 2113 },
+    { 7475, 1, 'e', -1 },
+    { 0, 0, ';', 2115 },
+    { 0, 0, ';', 2120 },
+    { 7476, 1, 'e', -1 },
+    { 0, 0, ';', 2131 },
+    { 7477, 1, 'i', -1 },
+    { 7478, 1, 'p', -1 },
+    { 7479, 1, 'h', -1 },
+    { 0, 0, ';', 2135 },
+    { 7480, 1, 'p', -1 },
+    { 0, 0, ';', 2139 },
+    { 7481, 1, 'm', -1 },
+    { 7482, 1, 's', -1 },
+    { 7483, 1, 's', -1 },
+    { 7484, 1, 't', -1 },
+    { 7485, 1, 'a', -1 },
+    { 0, 0, ';', 2151 },
+    { 0, 0, ';', 2153 },
+    { 0, 0, ';', 2154 },
+    { 0, 0, ';', 2164 },
+    { 0, 0, ';', 2165 },
+    { 0, 0, ';', 2166 },
+    { 0, 0, ';', 2167 },
+    { 7486, 1, 'g', -1 },
+    { 0, 0, ';', 2170 },
+    { 0, 0, ';', 2172 },
+    { 0, 0, ';', 2173 },
+    { 0, 0, ';', 2178 },
+    { 0, 0, ';', 2194 },
+    { 0, 0, ';', 2195 },
+    { 0, 0, ';', 2199 },
+    { 0, 0, ';', 2200 },
+    { 0, 0, ';', 2203 },
+    { 0, 0, ';', 2205 },
+    { 0, 0, ';', 2218 },
+    { 0, 0, ';', 2219 },
+    { 0, 0, ';', 2222 },
+    { 7487, 1, 'r', -1 },
+    { 7488, 1, 'n', -1 },
+    { 7489, 1, 's', -1 },
+    { 0, 0, ';', 31 },
+    { 7490, 1, 'l', -1 },
+    { 7491, 1, 'D', -1 },
+    { 0, 0, ';', 45 },
+    { 0, 0, ';', 50 },
+    { 0, 0, ';', 52 },
+    { 7492, 1, 'o', -1 },
+    { 7493, 1, 'o', -1 },
+    { 7494, 1, 'i', -1 },
+    { 7495, 1, 'l', -1 },
+    { 7496, 1, 'i', -1 },
+    { 7497, 1, 's', -1 },
+    { 7498, 1, 'r', -1 },
+    { 7499, 1, 'n', -1 },
+    { 7500, 1, 'I', -1 },
+    { 7501, 1, 'c', -1 },
+    { 7502, 1, 'C', -1 },
+    { 7503, 1, 'd', -1 },
+    { 7504, 1, 'i', -1 },
+    { 0, 0, ';', 93 },
+    { 7505, 1, 'n', -1 },
+    { 7506, 1, 'l', -1 },
+    { 7507, 1, 'o', -1 },
+    { 7508, 2, 'o', -1 },
+    { 7510, 1, 'e', -1 },
+    { 7511, 1, 'o', -1 },
+    { 7512, 1, 'i', -1 },
+    { 7513, 2, 'p', -1 },
+    { 7515, 1, 'e', -1 },
+    { 7516, 1, 'o', -1 },
+    { 7517, 1, 'v', -1 },
+    { 7518, 3, 't', -1 },
+    { 7521, 1, 'h', -1 },
+    { 0, 0, ';', 124 },
+    { 7522, 1, 'A', -1 },
+    { 7523, 1, 'o', -1 },
+    { 0, 0, ';', 142 },
+    { 7524, 1, 'a', -1 },
+    { 7525, 1, 'r', -1 },
+    { 0, 0, ';', 148 },
+    { 7526, 1, 'l', -1 },
+    { 7527, 1, 'r', -1 },
+    { 7528, 1, 't', -1 },
+    { 7529, 1, 'm', -1 },
+    { 7530, 1, 'e', -1 },
+    { 7531, 1, 't', -1 },
+    { 7532, 1, 'E', -1 },
+    { 7533, 1, 'F', -1 },
+    { 7534, 1, 'G', -1 },
+    { 7535, 1, 'L', -1 },
+    { 7536, 1, 'S', -1 },
+    { 7537, 1, 'T', -1 },
+    { 7538, 1, 'S', -1 },
+    { 7539, 1, 't', -1 },
+    { 7540, 1, 'n', -1 },
+    { 7541, 1, 'a', -1 },
+    { 7542, 1, 'r', -1 },
+    { 0, 0, ';', 216 },
+    { 7543, 1, 'l', -1 },
+    { 7544, 1, 'c', -1 },
+    { 7545, 1, 'l', -1 },
+    { 7546, 1, 't', -1 },
+    { 7547, 1, 'l', -1 },
+    { 7548, 1, 'o', -1 },
+    { 7549, 1, 'l', -1 },
+    { 7550, 1, 'b', -1 },
+    { 7551, 2, 'n', -1 },
+    { 7553, 1, 'o', -1 },
+    { 7554, 1, 'h', -1 },
+    { 0, 0, ';', 268 },
+    { 7555, 1, 'A', -1 },
+    { 7556, 1, 'V', -1 },
+    { 7557, 1, 'a', -1 },
+    { 7558, 1, 'o', -1 },
+    { 7559, 1, 'e', -1 },
+    { 7560, 1, 'e', -1 },
+    { 7561, 1, 't', -1 },
+    { 7562, 1, 'o', -1 },
+    { 7563, 1, 'h', -1 },
+    { 7564, 1, 'a', -1 },
+    { 7565, 1, 'l', -1 },
+    { 7566, 1, 'a', -1 },
+    { 7567, 1, 's', -1 },
+    { 7568, 1, 'n', -1 },
+    { 7569, 1, 'd', -1 },
+    { 7570, 1, 'r', -1 },
+    { 7571, 2, 't', -1 },
+    { 7573, 1, 'h', -1 },
+    { 7574, 2, 't', -1 },
+    { 7576, 1, 'h', -1 },
+    { 7577, 1, 'f', -1 },
+    { 7578, 1, 'g', -1 },
+    { 7579, 1, 'p', -1 },
+    { 7580, 1, 'r', -1 },
+    { 7581, 1, 'u', -1 },
+    { 7582, 3, 'e', -1 },
+    { 7585, 1, 'r', -1 },
+    { 7586, 1, 'e', -1 },
+    { 0, 0, ';', 325 },
+    { 0, 0, ';', 327 },
+    { 7587, 1, 'k', -1 },
+    { 7588, 1, 'r', -1 },
+    { 7589, 1, 'a', -1 },
+    { 7590, 1, 'l', -1 },
+    { 7591, 1, 'e', -1 },
+    { 7592, 2, 'l', -1 },
+    { 7594, 1, 't', -1 },
+    { 7595, 1, 't', -1 },
+    { 7596, 1, 'D', -1 },
+    { 7597, 1, 'E', -1 },
+    { 7598, 1, 'T', -1 },
+    { 0, 0, ';', 350 },
+    { 7599, 1, 'E', -1 },
+    { 7600, 1, 'G', -1 },
+    { 7601, 1, 'L', -1 },
+    { 7602, 1, 'S', -1 },
+    { 7603, 1, 'T', -1 },
+    { 7604, 1, 'e', -1 },
+    { 7605, 1, 'e', -1 },
+    { 7606, 1, 'r', -1 },
+    { 7607, 1, 't', -1 },
+    { 7608, 1, 'r', -1 },
+    { 7609, 1, 'e', -1 },
+    { 7610, 1, 'e', -1 },
+    { 7611, 1, 'r', -1 },
+    { 7612, 4, 'e', -1 },
+    { 7616, 1, 'i', -1 },
+    { 0, 0, ';', 398 },
+    { 7617, 1, 'l', -1 },
+    { 0, 0, ';', 411 },
+    { 7618, 2, 'c', -1 },
+    { 7620, 1, 'e', -1 },
+    { 7621, 1, 'D', -1 },
+    { 7622, 1, 'u', -1 },
+    { 7623, 1, 'e', -1 },
+    { 7624, 4, 's', -1 },
+    { 0, 0, ';', 429 },
+    { 7628, 1, 'i', -1 },
+    { 7629, 2, 'E', -1 },
+    { 7631, 1, 'U', -1 },
+    { 7632, 1, 'g', -1 },
+    { 7633, 1, 'r', -1 },
+    { 7634, 1, 'i', -1 },
+    { 7635, 1, 'u', -1 },
+    { 7636, 1, 'w', -1 },
+    { 7637, 1, 'o', -1 },
+    { 7638, 3, 'e', -1 },
+    { 7641, 1, 'i', -1 },
+    { 7642, 1, 'D', -1 },
+    { 7643, 1, 'T', -1 },
+    { 7644, 1, 'V', -1 },
+    { 7645, 1, 'c', -1 },
+    { 7646, 1, 'r', -1 },
+    { 7647, 1, 'p', -1 },
+    { 7648, 1, 'r', -1 },
+    { 7649, 1, 'a', -1 },
+    { 7650, 1, 'w', -1 },
+    { 7651, 1, 'f', -1 },
+    { 7652, 1, 'g', -1 },
+    { 7653, 1, 'A', -1 },
+    { 7654, 1, 'r', -1 },
+    { 7655, 1, 'n', -1 },
+    { 7656, 2, 'u', -1 },
+    { 7658, 1, 'n', -1 },
+    { 7659, 1, 'q', -1 },
+    { 7660, 4, 's', -1 },
+    { 7664, 1, 't', -1 },
+    { 7665, 2, 't', -1 },
+    { 7667, 1, 'r', -1 },
+    { 7668, 1, 'a', -1 },
+    { 7669, 1, 'c', -1 },
+    { 7670, 1, 'u', -1 },
+    { 7671, 1, 'l', -1 },
+    { 7672, 1, 'l', -1 },
+    { 7673, 1, 'o', -1 },
+    { 7674, 1, 'r', -1 },
+    { 7675, 1, 'r', -1 },
+    { 7676, 1, 'a', -1 },
+    { 7677, 1, 'r', -1 },
+    { 7678, 1, 'u', -1 },
+    { 0, 0, ';', 569 },
+    { 7679, 1, 'B', -1 },
+    { 7680, 1, 'D', -1 },
+    { 7681, 1, 'r', -1 },
+    { 7682, 1, 'i', -1 },
+    { 7683, 1, 'r', -1 },
+    { 0, 0, ';', 576 },
+    { 7684, 1, 'r', -1 },
+    { 7685, 1, 'f', -1 },
+    { 7686, 1, 'g', -1 },
+    { 0, 0, ';', 581 },
+    { 7687, 4, 'l', -1 },
+    { 7691, 1, 'n', -1 },
+    { 7692, 1, 't', -1 },
+    { 0, 0, ';', 651 },
+    { 7693, 1, 'e', -1 },
+    { 7694, 1, 'a', -1 },
+    { 7695, 1, 'b', -1 },
+    { 7696, 1, 'c', -1 },
+    { 7697, 1, 'd', -1 },
+    { 7698, 1, 'e', -1 },
+    { 7699, 1, 'f', -1 },
+    { 7700, 1, 'g', -1 },
+    { 7701, 1, 'h', -1 },
+    { 0, 0, ';', 676 },
+    { 7702, 1, 'd', -1 },
+    { 0, 0, ';', 680 },
+    { 7703, 1, 'q', -1 },
+    { 0, 0, ';', 696 },
+    { 7704, 1, 't', -1 },
+    { 7705, 1, 'g', -1 },
+    { 7706, 1, 'i', -1 },
+    { 7707, 1, 'm', -1 },
+    { 0, 0, ';', 707 },
+    { 7708, 1, 'e', -1 },
+    { 7709, 1, 'e', -1 },
+    { 7710, 1, 'k', -1 },
+    { 0, 0, ';', 718 },
+    { 0, 0, ';', 719 },
+    { 0, 0, ';', 724 },
+    { 0, 0, ';', 727 },
+    { 0, 0, ';', 729 },
+    { 7711, 1, 's', -1 },
+    { 7712, 1, 'e', -1 },
+    { 7713, 1, 'p', -1 },
+    { 0, 0, ';', 733 },
+    { 7714, 1, 'n', -1 },
+    { 7715, 1, 's', -1 },
+    { 7716, 1, 'e', -1 },
+    { 7717, 1, 'z', -1 },
+    { 7718, 1, 'u', -1 },
+    { 7719, 1, 'i', -1 },
+    { 0, 0, ';', 752 },
+    { 7720, 1, 's', -1 },
+    { 0, 0, ';', 789 },
+    { 7721, 1, 's', -1 },
+    { 7722, 1, 'b', -1 },
+    { 7723, 1, 'p', -1 },
+    { 0, 0, ';', 835 },
+    { 0, 0, ';', 839 },
+    { 7724, 1, 'o', -1 },
+    { 7725, 1, 'r', -1 },
+    { 7726, 1, 'r', -1 },
+    { 7727, 1, 'R', -1 },
+    { 7728, 1, 'S', -1 },
+    { 7729, 1, 'a', -1 },
+    { 7730, 1, 'c', -1 },
+    { 7731, 1, 'd', -1 },
+    { 7732, 1, 't', -1 },
+    { 0, 0, ';', 862 },
+    { 7733, 1, 't', -1 },
+    { 0, 0, ';', 867 },
+    { 7734, 1, 'e', -1 },
+    { 7735, 1, 'e', -1 },
+    { 0, 0, ';', 875 },
+    { 0, 0, ';', 890 },
+    { 0, 0, ';', 891 },
+    { 0, 0, ';', 895 },
+    { 7736, 1, 'p', -1 },
+    { 0, 0, ';', 904 },
+    { 7737, 1, 'p', -1 },
+    { 7738, 1, 's', -1 },
+    { 7739, 1, 'e', -1 },
+    { 7740, 1, 'd', -1 },
+    { 7741, 1, 'r', -1 },
+    { 7742, 1, 't', -1 },
+    { 0, 0, ';', 925 },
+    { 0, 0, ';', 930 },
+    { 0, 0, ';', 932 },
+    { 0, 0, ';', 936 },
+    { 0, 0, ';', 942 },
+    { 7743, 1, 's', -1 },
+    { 0, 0, ';', 946 },
+    { 7744, 1, 'n', -1 },
+    { 7745, 1, 't', -1 },
+    { 7746, 1, 's', -1 },
+    { 0, 0, ';', 962 },
+    { 7747, 1, 'r', -1 },
+    { 7748, 1, 'a', -1 },
+    { 7749, 1, 'o', -1 },
+    { 7750, 1, 'n', -1 },
+    { 7751, 1, 'p', -1 },
+    { 7752, 1, 'w', -1 },
+    { 0, 0, ';', 981 },
+    { 7753, 1, 'r', -1 },
+    { 7754, 1, 's', -1 },
+    { 7755, 1, 't', -1 },
+    { 0, 0, ';', 1024 },
+    { 0, 0, ';', 1027 },
+    { 7756, 1, 'g', -1 },
+    { 7757, 1, 'l', -1 },
+    { 0, 0, ';', 1034 },
+    { 7758, 1, 'l', -1 },
+    { 7759, 1, 't', -1 },
+    { 7760, 1, 't', -1 },
+    { 7761, 1, 'd', -1 },
+    { 7762, 1, 't', -1 },
+    { 7763, 1, 't', -1 },
+    { 0, 0, ';', 1108 },
+    { 7764, 1, 'l', -1 },
+    { 7765, 1, 'x', -1 },
+    { 0, 0, ';', 1140 },
+    { 7766, 1, 'o', -1 },
+    { 7767, 1, 's', -1 },
+    { 7768, 1, 'e', -1 },
+    { 0, 0, ';', 1146 },
+    { 7769, 1, 'q', -1 },
+    { 0, 0, ';', 1156 },
+    { 7770, 1, 'i', -1 },
+    { 7771, 1, 'w', -1 },
+    { 7772, 1, 'w', -1 },
+    { 7773, 1, 't', -1 },
+    { 7774, 1, 'h', -1 },
+    { 7775, 1, 'e', -1 },
+    { 7776, 1, 't', -1 },
+    { 7777, 1, 'e', -1 },
+    { 7778, 1, 's', -1 },
+    { 7779, 1, 'l', -1 },
+    { 7780, 1, 'k', -1 },
+    { 0, 0, ';', 1214 },
+    { 0, 0, ';', 1225 },
+    { 7781, 1, 'v', -1 },
+    { 0, 0, ';', 1271 },
+    { 0, 0, ';', 1276 },
+    { 0, 0, ';', 1287 },
+    { 0, 0, ';', 1288 },
+    { 0, 0, ';', 1297 },
+    { 7782, 1, 'r', -1 },
+    { 7783, 1, 'o', -1 },
+    { 7784, 1, 'p', -1 },
+    { 7785, 1, 't', -1 },
+    { 7786, 1, 'h', -1 },
+    { 7787, 1, 'e', -1 },
+    { 7788, 1, 't', -1 },
+    { 0, 0, ';', 1318 },
+    { 7789, 1, 'r', -1 },
+    { 7790, 1, 'r', -1 },
+    { 0, 0, ';', 1323 },
+    { 7791, 1, 't', -1 },
+    { 7792, 1, 'g', -1 },
+    { 0, 0, ';', 1326 },
+    { 0, 0, ';', 1327 },
+    { 7793, 1, 'r', -1 },
+    { 7794, 1, 'c', -1 },
+    { 7795, 1, 'x', -1 },
+    { 7796, 2, 't', -1 },
+    { 7798, 1, 's', -1 },
+    { 7799, 1, 'h', -1 },
+    { 7800, 1, 'o', -1 },
+    { 0, 0, ';', 1365 },
+    { 0, 0, ';', 1369 },
+    { 7801, 1, 'r', -1 },
+    { 0, 0, ';', 1397 },
+    { 7802, 1, 'r', -1 },
+    { 0, 0, ';', 1403 },
+    { 7803, 1, 'q', -1 },
+    { 0, 0, ';', 1411 },
+    { 7804, 1, 'o', -1 },
+    { 7805, 1, 'e', -1 },
+    { 7806, 1, 'p', -1 },
+    { 7807, 1, 'd', -1 },
+    { 0, 0, ';', 1434 },
+    { 7808, 1, 'p', -1 },
+    { 7809, 1, 'r', -1 },
+    { 7810, 1, 'g', -1 },
+    { 7811, 1, 'r', -1 },
+    { 0, 0, ';', 1464 },
+    { 0, 0, ';', 1466 },
+    { 7812, 1, 's', -1 },
+    { 7813, 1, 't', -1 },
+    { 0, 0, ';', 1484 },
+    { 0, 0, ';', 1490 },
+    { 7814, 1, 'n', -1 },
+    { 7815, 1, 'r', -1 },
+    { 7816, 1, 'g', -1 },
+    { 7817, 1, 'n', -1 },
+    { 7818, 1, 't', -1 },
+    { 0, 0, ';', 1532 },
+    { 0, 0, ';', 1533 },
+    { 0, 0, ';', 1534 },
+    { 0, 0, ';', 1536 },
+    { 0, 0, ';', 1537 },
+    { 0, 0, ';', 1538 },
+    { 7819, 1, 'e', -1 },
+    { 0, 0, ';', 1543 },
+    { 0, 0, ';', 1548 },
+    { 7820, 1, 'r', -1 },
+    { 7821, 1, 'i', -1 },
+    { 7822, 1, 'a', -1 },
+    { 0, 0, ';', 1567 },
+    { 0, 0, ';', 1568 },
+    { 0, 0, ';', 1572 },
+    { 7823, 1, 'e', -1 },
+    { 0, 0, ';', 1576 },
+    { 0, 0, ';', 1580 },
+    { 7824, 1, 'e', -1 },
+    { 7825, 1, 'l', -1 },
+    { 0, 0, ';', 1601 },
+    { 0, 0, ';', 1605 },
+    { 0, 0, ';', 1607 },
+    { 0, 0, ';', 1612 },
+    { 0, 0, ';', 1639 },
+    { 0, 0, ';', 1644 },
+    { 0, 0, ';', 1655 },
+    { 0, 0, ';', 1662 },
+    { 7826, 1, 's', -1 },
+    { 7827, 1, 'l', -1 },
+    { 0, 0, ';', 1687 },
+    { 7828, 1, 'r', -1 },
+    { 0, 0, ';', 1697 },
+    { 7829, 1, 'r', -1 },
+    { 0, 0, ';', 1702 },
+    { 0, 0, ';', 1708 },
+    { 0, 0, ';', 1709 },
+    { 7830, 1, 't', -1 },
+    { 7831, 1, 'r', -1 },
+    { 7832, 1, 'l', -1 },
+    { 7833, 1, 'p', -1 },
+    { 7834, 1, 'q', -1 },
+    { 7835, 1, 'm', -1 },
+    { 0, 0, ';', 1727 },
+    { 7836, 1, 'r', -1 },
+    { 7837, 1, 'e', -1 },
+    { 7838, 1, 'f', -1 },
+    { 7839, 1, 'i', -1 },
+    { 0, 0, ';', 1750 },
+    { 0, 0, ';', 1752 },
+    { 7840, 1, 'v', -1 },
+    { 0, 0, ';', 1773 },
+    { 0, 0, ';', 1779 },
+    { 7841, 1, 'l', -1 },
+    { 0, 0, ';', 1790 },
+    { 0, 0, ';', 1791 },
+    { 0, 0, ';', 1798 },
+    { 0, 0, ';', 1803 },
+    { 7842, 1, 't', -1 },
+    { 7843, 1, 'r', -1 },
+    { 7844, 1, 'r', -1 },
+    { 7845, 1, 'f', -1 },
+    { 7846, 1, 'g', -1 },
+    { 7847, 1, 'u', -1 },
+    { 7848, 1, 'r', -1 },
+    { 7849, 1, 'o', -1 },
+    { 7850, 1, 'c', -1 },
+    { 0, 0, ';', 1840 },
+    { 7851, 1, 't', -1 },
+    { 7852, 1, 'i', -1 },
+    { 0, 0, ';', 1857 },
+    { 7853, 1, 't', -1 },
+    { 0, 0, ';', 1881 },
+    { 7854, 1, 's', -1 },
+    { 7855, 1, 'd', -1 },
+    { 7856, 1, 'r', -1 },
+    { 0, 0, ';', 1910 },
+    { 0, 0, ';', 1911 },
+    { 7857, 1, 't', -1 },
+    { 7858, 1, 'l', -1 },
+    { 7859, 1, 'i', -1 },
+    { 7860, 2, 't', -1 },
+    { 7862, 2, 't', -1 },
+    { 7864, 2, 't', -1 },
+    { 0, 0, ';', 1959 },
+    { 0, 0, ';', 1960 },
+    { 0, 0, ';', 1963 },
+    { 0, 0, ';', 1964 },
+    { 7866, 2, 'q', -1 },
+    { 7868, 1, 'e', -1 },
+    { 7869, 1, 'r', -1 },
+    { 7870, 1, 'l', -1 },
+    { 7871, 1, 'p', -1 },
+    { 7872, 1, 'q', -1 },
+    { 7873, 1, 'm', -1 },
+    { 0, 0, ';', 1980 },
+    { 0, 0, ';', 1992 },
+    { 0, 0, ';', 1994 },
+    { 0, 0, ';', 1995 },
+    { 0, 0, ';', 1996 },
+    { 0, 0, ';', 1997 },
+    { 0, 0, ';', 1998 },
+    { 0, 0, ';', 2001 },
+    { 7874, 2, 'q', -1 },
+    { 7876, 1, 'e', -1 },
+    { 0, 0, ';', 2013 },
+    { 7877, 1, 'r', -1 },
+    { 7878, 1, 'm', -1 },
+    { 7879, 1, 'p', -1 },
+    { 7880, 1, 'm', -1 },
+    { 7881, 1, 'r', -1 },
+    { 0, 0, ';', 2050 },
+    { 7882, 5, 'e', -1 },
+    { 7887, 1, 's', -1 },
+    { 0, 0, ';', 2064 },
+    { 0, 0, ';', 2066 },
+    { 7888, 1, 'm', -1 },
+    { 7889, 1, 'l', -1 },
+    { 7890, 1, 'r', -1 },
+    { 7891, 1, 'r', -1 },
+    { 0, 0, ';', 2104 },
+    { 7892, 1, 'r', -1 },
+    { 7893, 1, 'o', -1 },
+    { 0, 0, ';', 2111 },
+    { 7894, 1, 'o', -1 },
+    { 7895, 1, 'r', -1 },
+    { 0, 0, ';', 2126 },
+    { 7896, 1, 'l', -1 },
+    { 7897, 1, 'a', -1 },
+    { 7898, 1, 'i', -1 },
+    { 7899, 1, 't', -1 },
+    { 7900, 1, 'a', -1 },
+    { 7901, 1, 'e', -1 },
+    { 7902, 1, 'e', -1 },
+    { 7903, 1, 'a', -1 },
+    { 7904, 1, 'n', -1 },
+    { 0, 0, ';', 2168 },
+    { 0, 0, ';', 2226 },
+    { 7905, 1, 'c', -1 },
+    { 7906, 1, 'h', -1 },
+    { 7907, 1, 'i', -1 },
+    { 7908, 1, 'i', -1 },
+    { 7909, 1, 't', -1 },
+    { 7910, 1, 't', -1 },
+    { 7911, 1, 'n', -1 },
+    { 7912, 1, 'u', -1 },
+    { 7913, 1, 'm', -1 },
+    { 7914, 1, 'e', -1 },
+    { 7915, 1, 'l', -1 },
+    { 7916, 1, 't', -1 },
+    { 7917, 1, 'n', -1 },
+    { 7918, 1, 't', -1 },
+    { 7919, 1, 'l', -1 },
+    { 0, 0, ';', 76 },
+    { 7920, 1, 'c', -1 },
+    { 7921, 1, 't', -1 },
+    { 0, 0, ';', 98 },
+    { 7922, 1, 'n', -1 },
+    { 7923, 1, 't', -1 },
+    { 7924, 1, 'w', -1 },
+    { 7925, 1, 'f', -1 },
+    { 7926, 1, 'n', -1 },
+    { 7927, 1, 'g', -1 },
+    { 7928, 1, 'A', -1 },
+    { 7929, 1, 'D', -1 },
+    { 7930, 1, 'r', -1 },
+    { 7931, 3, 'w', -1 },
+    { 7934, 1, 'e', -1 },
+    { 7935, 1, 'R', -1 },
+    { 7936, 1, 'T', -1 },
+    { 7937, 1, 'V', -1 },
+    { 7938, 2, 't', -1 },
+    { 7940, 1, 'r', -1 },
+    { 7941, 1, 'w', -1 },
+    { 7942, 1, 'l', -1 },
+    { 7943, 1, 'y', -1 },
+    { 7944, 1, 'd', -1 },
+    { 7945, 1, 'i', -1 },
+    { 7946, 1, 'i', -1 },
+    { 7947, 1, 'a', -1 },
+    { 7948, 1, 'r', -1 },
+    { 7949, 1, 'r', -1 },
+    { 7950, 1, 'q', -1 },
+    { 7951, 1, 'u', -1 },
+    { 7952, 1, 'r', -1 },
+    { 7953, 1, 'e', -1 },
+    { 7954, 1, 'l', -1 },
+    { 7955, 1, 'i', -1 },
+    { 7956, 1, 'p', -1 },
+    { 7957, 1, 'a', -1 },
+    { 7958, 1, 'H', -1 },
+    { 7959, 1, 'l', -1 },
+    { 7960, 1, 'y', -1 },
+    { 0, 0, ';', 218 },
+    { 7961, 1, 't', -1 },
+    { 7962, 2, 'e', -1 },
+    { 7964, 1, 'r', -1 },
+    { 7965, 1, 'e', -1 },
+    { 7966, 3, 'w', -1 },
+    { 7969, 1, 'i', -1 },
+    { 7970, 1, 'l', -1 },
+    { 7971, 1, 'T', -1 },
+    { 7972, 1, 'V', -1 },
+    { 7973, 1, 'r', -1 },
+    { 7974, 2, 't', -1 },
+    { 7976, 1, 'r', -1 },
+    { 7977, 1, 'e', -1 },
+    { 7978, 1, 'n', -1 },
+    { 7979, 1, 'w', -1 },
+    { 7980, 1, 'e', -1 },
+    { 7981, 1, 'c', -1 },
+    { 7982, 1, 'o', -1 },
+    { 7983, 1, 'w', -1 },
+    { 7984, 1, 't', -1 },
+    { 7985, 1, 'l', -1 },
+    { 7986, 1, 'E', -1 },
+    { 7987, 1, 't', -1 },
+    { 0, 0, ';', 285 },
+    { 7988, 1, 't', -1 },
+    { 7989, 1, 'e', -1 },
+    { 7990, 1, 'o', -1 },
+    { 7991, 1, 'A', -1 },
+    { 7992, 1, 'R', -1 },
+    { 7993, 1, 't', -1 },
+    { 7994, 1, 'a', -1 },
+    { 7995, 1, 'r', -1 },
+    { 7996, 1, 't', -1 },
+    { 7997, 1, 't', -1 },
+    { 7998, 1, 'h', -1 },
+    { 7999, 1, 'a', -1 },
+    { 8000, 1, 'f', -1 },
+    { 8001, 1, 's', -1 },
+    { 8002, 1, 'M', -1 },
+    { 8003, 1, 'T', -1 },
+    { 8004, 1, 'V', -1 },
+    { 8005, 1, 'e', -1 },
+    { 8006, 1, 's', -1 },
+    { 8007, 1, 'i', -1 },
+    { 8008, 1, 'u', -1 },
+    { 8009, 1, 'p', -1 },
+    { 8010, 1, 'e', -1 },
+    { 8011, 1, 'n', -1 },
+    { 0, 0, ';', 335 },
+    { 8012, 1, 'T', -1 },
+    { 8013, 1, 's', -1 },
+    { 8014, 1, 'e', -1 },
+    { 8015, 1, 'o', -1 },
+    { 8016, 1, 'q', -1 },
+    { 8017, 1, 'r', -1 },
+    { 8018, 1, 'q', -1 },
+    { 8019, 1, 'r', -1 },
+    { 8020, 1, 'e', -1 },
+    { 8021, 1, 'l', -1 },
+    { 8022, 1, 'i', -1 },
+    { 8023, 2, 'd', -1 },
+    { 8025, 1, 'd', -1 },
+    { 8026, 1, 's', -1 },
+    { 8027, 1, 'T', -1 },
+    { 8028, 1, 'e', -1 },
+    { 8029, 2, 't', -1 },
+    { 8031, 1, 'e', -1 },
+    { 8032, 1, 's', -1 },
+    { 0, 0, ';', 377 },
+    { 8033, 1, 'E', -1 },
+    { 8034, 1, 'F', -1 },
+    { 8035, 1, 'T', -1 },
+    { 8036, 1, 'c', -1 },
+    { 8037, 2, 'y', -1 },
+    { 8039, 1, 'e', -1 },
+    { 8040, 1, 'k', -1 },
+    { 8041, 1, 'n', -1 },
+    { 0, 0, ';', 415 },
+    { 8042, 1, 's', -1 },
+    { 8043, 1, 'p', -1 },
+    { 0, 0, ';', 424 },
+    { 8044, 1, 'E', -1 },
+    { 8045, 1, 'S', -1 },
+    { 8046, 1, 'T', -1 },
+    { 8047, 1, 'o', -1 },
+    { 8048, 1, 'l', -1 },
+    { 8049, 1, 'q', -1 },
+    { 8050, 1, 'p', -1 },
+    { 8051, 1, 'l', -1 },
+    { 8052, 1, 'o', -1 },
+    { 8053, 1, 'l', -1 },
+    { 8054, 1, 'b', -1 },
+    { 8055, 2, 'n', -1 },
+    { 8057, 1, 'o', -1 },
+    { 0, 0, ';', 465 },
+    { 8058, 1, 'A', -1 },
+    { 8059, 1, 'V', -1 },
+    { 8060, 1, 'a', -1 },
+    { 8061, 1, 'o', -1 },
+    { 8062, 1, 'e', -1 },
+    { 8063, 1, 'e', -1 },
+    { 8064, 1, 't', -1 },
+    { 8065, 1, 'o', -1 },
+    { 8066, 1, 'l', -1 },
+    { 8067, 1, 'r', -1 },
+    { 8068, 1, 'y', -1 },
+    { 8069, 1, 'n', -1 },
+    { 8070, 1, 't', -1 },
+    { 8071, 1, 'h', -1 },
+    { 8072, 1, 'r', -1 },
+    { 8073, 1, 'c', -1 },
+    { 8074, 1, 't', -1 },
+    { 8075, 1, 'b', -1 },
+    { 8076, 1, 'p', -1 },
+    { 8077, 1, 'i', -1 },
+    { 8078, 1, 'u', -1 },
+    { 0, 0, ';', 514 },
+    { 8079, 1, 'E', -1 },
+    { 8080, 1, 'S', -1 },
+    { 8081, 1, 'T', -1 },
+    { 0, 0, ';', 518 },
+    { 0, 0, ';', 521 },
+    { 8082, 1, 'E', -1 },
+    { 8083, 1, 'e', -1 },
+    { 8084, 1, 'c', -1 },
+    { 8085, 1, 'e', -1 },
+    { 8086, 1, 'a', -1 },
+    { 8087, 1, 'l', -1 },
+    { 8088, 1, 'd', -1 },
+    { 8089, 1, 't', -1 },
+    { 0, 0, ';', 550 },
+    { 0, 0, ';', 561 },
+    { 8090, 2, 'c', -1 },
+    { 8092, 1, 'e', -1 },
+    { 8093, 1, 's', -1 },
+    { 8094, 1, 'a', -1 },
+    { 8095, 1, 'o', -1 },
+    { 8096, 1, 'r', -1 },
+    { 8097, 1, 'b', -1 },
+    { 8098, 1, 'o', -1 },
+    { 8099, 1, 'r', -1 },
+    { 8100, 1, 't', -1 },
+    { 8101, 1, 'h', -1 },
+    { 8102, 1, 'B', -1 },
+    { 8103, 1, 'L', -1 },
+    { 8104, 1, 'S', -1 },
+    { 8105, 1, 'T', -1 },
+    { 8106, 1, 'S', -1 },
+    { 8107, 1, 'h', -1 },
+    { 0, 0, ';', 661 },
+    { 0, 0, ';', 667 },
+    { 0, 0, ';', 668 },
+    { 0, 0, ';', 669 },
+    { 0, 0, ';', 670 },
+    { 0, 0, ';', 671 },
+    { 0, 0, ';', 672 },
+    { 0, 0, ';', 673 },
+    { 0, 0, ';', 674 },
+    { 0, 0, ';', 677 },
+    { 0, 0, ';', 690 },
+    { 0, 0, ';', 701 },
+    { 0, 0, ';', 704 },
+    { 8108, 1, 'l', -1 },
+    { 8109, 1, 'e', -1 },
+    { 8110, 1, 'q', -1 },
+    { 0, 0, ';', 711 },
+    { 0, 0, ';', 713 },
+    { 0, 0, ';', 730 },
+    { 8111, 1, 's', -1 },
+    { 0, 0, ';', 732 },
+    { 8112, 1, 'g', -1 },
+    { 0, 0, ';', 736 },
+    { 0, 0, ';', 738 },
+    { 8113, 1, 'e', -1 },
+    { 8114, 1, 'a', -1 },
+    { 8115, 1, 'a', -1 },
+    { 0, 0, ';', 788 },
+    { 0, 0, ';', 790 },
+    { 0, 0, ';', 812 },
+    { 0, 0, ';', 822 },
+    { 8116, 1, 't', -1 },
+    { 8117, 1, 'k', -1 },
+    { 8118, 1, 'r', -1 },
+    { 0, 0, ';', 854 },
+    { 0, 0, ';', 855 },
+    { 8119, 1, 's', -1 },
+    { 8120, 1, 'i', -1 },
+    { 8121, 1, 'a', -1 },
+    { 0, 0, ';', 860 },
+    { 0, 0, ';', 864 },
+    { 8122, 1, 'n', -1 },
+    { 8123, 1, 's', -1 },
+    { 0, 0, ';', 897 },
+    { 8124, 1, 'r', -1 },
+    { 8125, 1, 'u', -1 },
+    { 0, 0, ';', 907 },
+    { 8126, 1, 'g', -1 },
+    { 8127, 1, 'o', -1 },
+    { 0, 0, ';', 915 },
+    { 8128, 1, 'u', -1 },
+    { 8129, 1, 't', -1 },
+    { 0, 0, ';', 960 },
+    { 0, 0, ';', 961 },
+    { 8130, 1, 'e', -1 },
+    { 8131, 1, 'r', -1 },
+    { 8132, 1, 'w', -1 },
+    { 8133, 1, 'a', -1 },
+    { 8134, 1, 'o', -1 },
+    { 0, 0, ';', 969 },
+    { 0, 0, ';', 983 },
+    { 0, 0, ';', 1005 },
+    { 0, 0, ';', 1011 },
+    { 8135, 1, 't', -1 },
+    { 8136, 1, 'e', -1 },
+    { 0, 0, ';', 1035 },
+    { 8137, 1, 'i', -1 },
+    { 8138, 1, 'i', -1 },
+    { 8139, 1, 'o', -1 },
+    { 0, 0, ';', 1068 },
+    { 0, 0, ';', 1104 },
+    { 0, 0, ';', 1109 },
+    { 0, 0, ';', 1123 },
+    { 8140, 1, 'x', -1 },
+    { 8141, 1, 's', -1 },
+    { 8142, 1, 's', -1 },
+    { 8143, 1, 'q', -1 },
+    { 8144, 1, 't', -1 },
+    { 0, 0, ';', 1165 },
+    { 0, 0, ';', 1166 },
+    { 8145, 1, 'a', -1 },
+    { 8146, 1, 't', -1 },
+    { 0, 0, ';', 1199 },
+    { 0, 0, ';', 1200 },
+    { 0, 0, ';', 1207 },
+    { 0, 0, ';', 1211 },
+    { 0, 0, ';', 1212 },
+    { 0, 0, ';', 1213 },
+    { 0, 0, ';', 1260 },
+    { 0, 0, ';', 1298 },
+    { 8147, 2, 'w', -1 },
+    { 8149, 1, 'o', -1 },
+    { 8150, 1, 'a', -1 },
+    { 8151, 3, 't', -1 },
+    { 8154, 1, 'e', -1 },
+    { 0, 0, ';', 1314 },
+    { 0, 0, ';', 1319 },
+    { 8155, 1, 'o', -1 },
+    { 8156, 1, 'r', -1 },
+    { 8157, 1, 't', -1 },
+    { 0, 0, ';', 1340 },
+    { 8158, 1, 'h', -1 },
+    { 0, 0, ';', 1348 },
+    { 8159, 1, 'a', -1 },
+    { 8160, 1, 'r', -1 },
+    { 8161, 1, 't', -1 },
+    { 8162, 1, 't', -1 },
+    { 8163, 2, 'w', -1 },
+    { 0, 0, ';', 1374 },
+    { 0, 0, ';', 1402 },
+    { 8165, 1, 'q', -1 },
+    { 8166, 1, 'w', -1 },
+    { 8167, 1, 'f', -1 },
+    { 0, 0, ';', 1416 },
+    { 8168, 1, 'a', -1 },
+    { 0, 0, ';', 1444 },
+    { 8169, 1, 'o', -1 },
+    { 8170, 1, 'h', -1 },
+    { 8171, 1, 'r', -1 },
+    { 0, 0, ';', 1467 },
+    { 0, 0, ';', 1476 },
+    { 8172, 1, 't', -1 },
+    { 8173, 1, 'o', -1 },
+    { 8174, 1, 'h', -1 },
+    { 8175, 1, 't', -1 },
+    { 0, 0, ';', 1531 },
+    { 8176, 1, 'l', -1 },
+    { 8177, 1, 'r', -1 },
+    { 8178, 1, 'd', -1 },
+    { 8179, 1, 'r', -1 },
+    { 8180, 2, 'q', -1 },
+    { 8182, 2, 'q', -1 },
+    { 8184, 2, 'e', -1 },
+    { 0, 0, ';', 1671 },
+    { 0, 0, ';', 1678 },
+    { 8186, 1, 'k', -1 },
+    { 0, 0, ';', 1700 },
+    { 0, 0, ';', 1711 },
+    { 8187, 1, 'o', -1 },
+    { 8188, 1, 'y', -1 },
+    { 8189, 1, 'r', -1 },
+    { 0, 0, ';', 1725 },
+    { 0, 0, ';', 1726 },
+    { 0, 0, ';', 1734 },
+    { 0, 0, ';', 1735 },
+    { 0, 0, ';', 1736 },
+    { 8190, 1, 'o', -1 },
+    { 0, 0, ';', 1763 },
+    { 8191, 1, 's', -1 },
+    { 0, 0, ';', 1804 },
+    { 8192, 1, 'o', -1 },
+    { 8193, 1, 'p', -1 },
+    { 8194, 2, 't', -1 },
+    { 8196, 1, 'h', -1 },
+    { 8197, 1, 'i', -1 },
+    { 8198, 1, 'e', -1 },
+    { 8199, 1, 't', -1 },
+    { 8200, 1, 'h', -1 },
+    { 0, 0, ';', 1843 },
+    { 0, 0, ';', 1856 },
+    { 0, 0, ';', 1872 },
+    { 0, 0, ';', 1886 },
+    { 0, 0, ';', 1894 },
+    { 8201, 1, 'a', -1 },
+    { 8202, 1, 'm', -1 },
+    { 0, 0, ';', 1915 },
+    { 8203, 1, 't', -1 },
+    { 0, 0, ';', 1935 },
+    { 8204, 1, 'e', -1 },
+    { 0, 0, ';', 1939 },
+    { 8205, 1, 'e', -1 },
+    { 8206, 1, 'e', -1 },
+    { 8207, 1, 'p', -1 },
+    { 0, 0, ';', 1966 },
+    { 8208, 1, 'q', -1 },
+    { 8209, 2, 'q', -1 },
+    { 8211, 1, 'o', -1 },
+    { 8212, 1, 'y', -1 },
+    { 8213, 1, 'r', -1 },
+    { 0, 0, ';', 1978 },
+    { 0, 0, ';', 1979 },
+    { 0, 0, ';', 2003 },
+    { 8214, 1, 'q', -1 },
+    { 8215, 2, 'q', -1 },
+    { 8217, 1, 'e', -1 },
+    { 0, 0, ';', 2029 },
+    { 8218, 1, 'r', -1 },
+    { 0, 0, ';', 2032 },
+    { 0, 0, ';', 2042 },
+    { 0, 0, ';', 2054 },
+    { 8219, 1, 'd', -1 },
+    { 8220, 1, 'l', -1 },
+    { 8221, 1, 'q', -1 },
+    { 8222, 1, 'r', -1 },
+    { 0, 0, ';', 2063 },
+    { 0, 0, ';', 2067 },
+    { 8223, 1, 'e', -1 },
+    { 8224, 1, 'i', -1 },
+    { 0, 0, ';', 2096 },
+    { 8225, 1, 'r', -1 },
+    { 8226, 2, 'n', -1 },
+    { 8228, 1, 'w', -1 },
+    { 0, 0, ';', 2114 },
+    { 8229, 1, 'o', -1 },
+    { 0, 0, ';', 2133 },
+    { 8230, 1, 'n', -1 },
+    { 8231, 1, 'o', -1 },
+    { 0, 0, ';', 2140 },
+    { 8232, 1, 't', -1 },
+    { 8233, 1, 't', -1 },
+    { 0, 0, ';', 2145 },
+    { 8234, 1, 'g', -1 },
+    { 8235, 1, 't', -1 },
+    { 0, 0, ';', 27 },
+    { 8236, 1, 's', -1 },
+    { 8237, 1, 'f', -1 },
+    { 0, 0, ';', 53 },
+    { 0, 0, ';', 56 },
+    { 8238, 1, 'u', -1 },
+    { 8239, 1, 's', -1 },
+    { 8240, 1, 'e', -1 },
+    { 8241, 1, 'C', -1 },
+    { 8242, 2, 'y', -1 },
+    { 0, 0, ';', 65 },
+    { 8244, 1, 't', -1 },
+    { 0, 0, ';', 69 },
+    { 8245, 1, 'o', -1 },
+    { 8246, 1, 'a', -1 },
+    { 8247, 1, 'i', -1 },
+    { 8248, 1, 't', -1 },
+    { 0, 0, ';', 100 },
+    { 8249, 1, 'n', -1 },
+    { 8250, 3, 't', -1 },
+    { 8253, 2, 'g', -1 },
+    { 8255, 1, 'h', -1 },
+    { 8256, 1, 'r', -1 },
+    { 8257, 1, 'o', -1 },
+    { 8258, 1, 't', -1 },
+    { 0, 0, ';', 113 },
+    { 8259, 1, 'B', -1 },
+    { 8260, 1, 'U', -1 },
+    { 0, 0, ';', 116 },
+    { 8261, 1, 'i', -1 },
+    { 8262, 1, 'e', -1 },
+    { 8263, 1, 'e', -1 },
+    { 8264, 1, 'T', -1 },
+    { 8265, 1, 'V', -1 },
+    { 8266, 1, 'r', -1 },
+    { 0, 0, ';', 126 },
+    { 8267, 1, 'l', -1 },
+    { 8268, 1, 'S', -1 },
+    { 8269, 1, 'e', -1 },
+    { 8270, 1, 'u', -1 },
+    { 8271, 1, 'a', -1 },
+    { 8272, 1, 'l', -1 },
+    { 8273, 1, 'y', -1 },
+    { 8274, 1, 'f', -1 },
+    { 8275, 1, 'u', -1 },
+    { 8276, 1, 'l', -1 },
+    { 8277, 1, 'e', -1 },
+    { 8278, 1, 's', -1 },
+    { 8279, 1, 'a', -1 },
+    { 8280, 1, 'l', -1 },
+    { 8281, 1, 'a', -1 },
+    { 8282, 1, 'l', -1 },
+    { 8283, 1, 'u', -1 },
+    { 0, 0, ';', 200 },
+    { 8284, 1, 'I', -1 },
+    { 8285, 1, 'i', -1 },
+    { 8286, 1, 'C', -1 },
+    { 8287, 1, 'T', -1 },
+    { 8288, 1, 'f', -1 },
+    { 8289, 1, 'B', -1 },
+    { 0, 0, ';', 257 },
+    { 8290, 1, 'B', -1 },
+    { 8291, 1, 'R', -1 },
+    { 8292, 1, 'n', -1 },
+    { 8293, 1, 'e', -1 },
+    { 8294, 1, 'e', -1 },
+    { 8295, 1, 'e', -1 },
+    { 0, 0, ';', 265 },
+    { 8296, 1, 'A', -1 },
+    { 8297, 1, 'V', -1 },
+    { 8298, 1, 'r', -1 },
+    { 8299, 1, 'c', -1 },
+    { 8300, 1, 'g', -1 },
+    { 8301, 1, 'n', -1 },
+    { 8302, 1, 'V', -1 },
+    { 8303, 1, 't', -1 },
+    { 8304, 2, 'r', -1 },
+    { 0, 0, ';', 280 },
+    { 8306, 1, 'a', -1 },
+    { 8307, 1, 'G', -1 },
+    { 8308, 1, 'q', -1 },
+    { 8309, 1, 'e', -1 },
+    { 8310, 1, 'E', -1 },
+    { 0, 0, ';', 287 },
+    { 8311, 1, 'w', -1 },
+    { 8312, 1, 'r', -1 },
+    { 8313, 1, 'i', -1 },
+    { 8314, 1, 'A', -1 },
+    { 8315, 1, 'r', -1 },
+    { 8316, 1, 'i', -1 },
+    { 8317, 1, 'a', -1 },
+    { 8318, 1, 'A', -1 },
+    { 8319, 1, 't', -1 },
+    { 8320, 1, 'c', -1 },
+    { 0, 0, ';', 308 },
+    { 0, 0, ';', 310 },
+    { 8321, 1, 'e', -1 },
+    { 8322, 1, 'h', -1 },
+    { 8323, 1, 'e', -1 },
+    { 8324, 1, 'a', -1 },
+    { 8325, 1, 's', -1 },
+    { 8326, 1, 'n', -1 },
+    { 8327, 1, 'e', -1 },
+    { 0, 0, ';', 332 },
+    { 8328, 1, 'V', -1 },
+    { 8329, 1, 't', -1 },
+    { 8330, 1, 'i', -1 },
+    { 0, 0, ';', 337 },
+    { 8331, 7, 'r', -1 },
+    { 8338, 1, 'w', -1 },
+    { 8339, 1, 'u', -1 },
+    { 8340, 1, 'i', -1 },
+    { 8341, 1, 'u', -1 },
+    { 8342, 1, 'e', -1 },
+    { 8343, 1, 's', -1 },
+    { 8344, 1, 'a', -1 },
+    { 8345, 1, 'l', -1 },
+    { 8346, 1, 'G', -1 },
+    { 8347, 1, 'L', -1 },
+    { 8348, 1, 'e', -1 },
+    { 8349, 1, 'e', -1 },
+    { 8350, 1, 'r', -1 },
+    { 8351, 1, 'S', -1 },
+    { 0, 0, ';', 369 },
+    { 8352, 1, 'E', -1 },
+    { 8353, 1, 'd', -1 },
+    { 8354, 1, 'e', -1 },
+    { 8355, 1, 'q', -1 },
+    { 8356, 1, 'u', -1 },
+    { 8357, 1, 'i', -1 },
+    { 8358, 1, 'a', -1 },
+    { 8359, 1, 'D', -1 },
+    { 8360, 1, 'Q', -1 },
+    { 0, 0, ';', 412 },
+    { 8361, 1, 'e', -1 },
+    { 8362, 1, 't', -1 },
+    { 0, 0, ';', 420 },
+    { 8363, 1, 'l', -1 },
+    { 8364, 1, 'q', -1 },
+    { 8365, 1, 'l', -1 },
+    { 8366, 1, 'i', -1 },
+    { 8367, 2, 'n', -1 },
+    { 8369, 1, 'e', -1 },
+    { 8370, 1, 'u', -1 },
+    { 8371, 1, 'E', -1 },
+    { 8372, 1, 'e', -1 },
+    { 8373, 3, 'w', -1 },
+    { 8376, 1, 'i', -1 },
+    { 8377, 1, 'l', -1 },
+    { 8378, 1, 'T', -1 },
+    { 8379, 1, 'V', -1 },
+    { 8380, 1, 'r', -1 },
+    { 8381, 1, 'r', -1 },
+    { 8382, 1, 'e', -1 },
+    { 8383, 1, 'n', -1 },
+    { 8384, 1, 'w', -1 },
+    { 8385, 1, 'e', -1 },
+    { 8386, 1, 'c', -1 },
+    { 8387, 1, 'o', -1 },
+    { 8388, 1, 'w', -1 },
+    { 8389, 1, 'i', -1 },
+    { 8390, 1, 'o', -1 },
+    { 8391, 1, 'e', -1 },
+    { 8392, 1, 'A', -1 },
+    { 8393, 1, 'A', -1 },
+    { 8394, 1, 't', -1 },
+    { 8395, 1, 'r', -1 },
+    { 8396, 1, 'l', -1 },
+    { 8397, 1, 'e', -1 },
+    { 8398, 1, 's', -1 },
+    { 8399, 1, 'e', -1 },
+    { 8400, 1, 'o', -1 },
+    { 8401, 1, 'a', -1 },
+    { 8402, 1, 'q', -1 },
+    { 8403, 1, 'l', -1 },
+    { 8404, 1, 'i', -1 },
+    { 8405, 1, 'q', -1 },
+    { 0, 0, ';', 535 },
+    { 8406, 1, 'e', -1 },
+    { 0, 0, ';', 538 },
+    { 8407, 1, 'l', -1 },
+    { 8408, 1, 'E', -1 },
+    { 8409, 1, 'e', -1 },
+    { 0, 0, ';', 544 },
+    { 8410, 1, 'e', -1 },
+    { 8411, 1, 'k', -1 },
+    { 8412, 1, 'n', -1 },
+    { 0, 0, ';', 566 },
+    { 8413, 1, 'r', -1 },
+    { 8414, 1, 'w', -1 },
+    { 8415, 1, 'o', -1 },
+    { 8416, 1, 'r', -1 },
+    { 8417, 1, 'w', -1 },
+    { 8418, 1, 'o', -1 },
+    { 8419, 1, 'A', -1 },
+    { 8420, 1, 't', -1 },
+    { 8421, 1, 'a', -1 },
+    { 8422, 1, 'i', -1 },
+    { 8423, 1, 'e', -1 },
+    { 8424, 1, 'i', -1 },
+    { 8425, 1, 'p', -1 },
+    { 8426, 1, 'S', -1 },
+    { 8427, 1, 'o', -1 },
+    { 0, 0, ';', 706 },
+    { 0, 0, ';', 708 },
+    { 0, 0, ';', 731 },
+    { 8428, 1, 'l', -1 },
+    { 8429, 1, 'n', -1 },
+    { 8430, 1, 'r', -1 },
+    { 8431, 1, 'n', -1 },
+    { 0, 0, ';', 842 },
+    { 0, 0, ';', 846 },
+    { 8432, 1, 'o', -1 },
+    { 8433, 1, 't', -1 },
+    { 8434, 1, 'r', -1 },
+    { 8435, 1, 's', -1 },
+    { 8436, 1, 't', -1 },
+    { 0, 0, ';', 873 },
+    { 8437, 1, 'e', -1 },
+    { 8438, 1, 'c', -1 },
+    { 8439, 1, 'e', -1 },
+    { 8440, 2, 'w', -1 },
+    { 8442, 1, 'i', -1 },
+    { 8443, 1, 'i', -1 },
+    { 0, 0, ';', 963 },
+    { 8444, 1, 'w', -1 },
+    { 0, 0, ';', 965 },
+    { 8445, 1, 'r', -1 },
+    { 8446, 1, 'o', -1 },
+    { 8447, 1, 'r', -1 },
+    { 8448, 1, 's', -1 },
+    { 8449, 1, 'o', -1 },
+    { 8450, 1, 'a', -1 },
+    { 8451, 1, 't', -1 },
+    { 0, 0, ';', 1141 },
+    { 0, 0, ';', 1144 },
+    { 8452, 1, 's', -1 },
+    { 0, 0, ';', 1148 },
+    { 0, 0, ';', 1161 },
+    { 8453, 1, 'r', -1 },
+    { 8454, 1, 'a', -1 },
+    { 0, 0, ';', 1301 },
+    { 8455, 1, 't', -1 },
+    { 8456, 1, 'o', -1 },
+    { 8457, 1, 'r', -1 },
+    { 8458, 1, 'a', -1 },
+    { 8459, 1, 'h', -1 },
+    { 8460, 1, 's', -1 },
+    { 8461, 1, 't', -1 },
+    { 8462, 1, 'x', -1 },
+    { 0, 0, ';', 1324 },
+    { 8463, 1, 'r', -1 },
+    { 8464, 1, 'e', -1 },
+    { 8465, 1, 'r', -1 },
+    { 8466, 1, 'i', -1 },
+    { 8467, 1, 'o', -1 },
+    { 8468, 1, 'a', -1 },
+    { 8469, 1, 'l', -1 },
+    { 8470, 1, 'r', -1 },
+    { 0, 0, ';', 1404 },
+    { 8471, 1, 'n', -1 },
+    { 8472, 1, 't', -1 },
+    { 8473, 1, 'n', -1 },
+    { 8474, 1, 'w', -1 },
+    { 8475, 1, 't', -1 },
+    { 8476, 1, 'o', -1 },
+    { 0, 0, ';', 1496 },
+    { 8477, 1, 'w', -1 },
+    { 8478, 1, 't', -1 },
+    { 0, 0, ';', 1518 },
+    { 0, 0, ';', 1540 },
+    { 8479, 1, 'o', -1 },
+    { 0, 0, ';', 1560 },
+    { 8480, 1, 'a', -1 },
+    { 0, 0, ';', 1573 },
+    { 8481, 1, 'q', -1 },
+    { 0, 0, ';', 1581 },
+    { 8482, 1, 'q', -1 },
+    { 8483, 1, 'l', -1 },
+    { 8484, 1, 'r', -1 },
+    { 0, 0, ';', 1694 },
+    { 8485, 1, 'x', -1 },
+    { 8486, 1, 'e', -1 },
+    { 8487, 1, 'o', -1 },
+    { 8488, 1, 'n', -1 },
+    { 0, 0, ';', 1784 },
+    { 8489, 2, 'w', -1 },
+    { 8491, 1, 'o', -1 },
+    { 8492, 1, 'a', -1 },
+    { 8493, 1, 'h', -1 },
+    { 8494, 1, 't', -1 },
+    { 8495, 1, 'g', -1 },
+    { 8496, 1, 'e', -1 },
+    { 8497, 1, 's', -1 },
+    { 8498, 1, 'e', -1 },
+    { 8499, 1, 'l', -1 },
+    { 8500, 1, 'i', -1 },
+    { 0, 0, ';', 1927 },
+    { 8501, 1, 'q', -1 },
+    { 8502, 1, 'q', -1 },
+    { 8503, 1, 'p', -1 },
+    { 8504, 1, 'h', -1 },
+    { 0, 0, ';', 1967 },
+    { 0, 0, ';', 1968 },
+    { 8505, 1, 'q', -1 },
+    { 8506, 1, 'x', -1 },
+    { 8507, 1, 'e', -1 },
+    { 8508, 1, 'o', -1 },
+    { 0, 0, ';', 2004 },
+    { 0, 0, ';', 2005 },
+    { 8509, 1, 'q', -1 },
+    { 0, 0, ';', 2027 },
+    { 8510, 1, 'o', -1 },
+    { 8511, 1, 'o', -1 },
+    { 8512, 1, 'e', -1 },
+    { 0, 0, ';', 2058 },
+    { 8513, 1, 'i', -1 },
+    { 8514, 1, 'f', -1 },
+    { 8515, 1, 'g', -1 },
+    { 8516, 1, 'o', -1 },
+    { 8517, 1, 'l', -1 },
+    { 8518, 1, 'r', -1 },
+    { 8519, 1, 's', -1 },
+    { 8520, 1, 'n', -1 },
+    { 8521, 1, 'g', -1 },
+    { 0, 0, ';', 2137 },
+    { 8522, 1, 'n', -1 },
+    { 8523, 1, 'n', -1 },
+    { 8524, 1, 'l', -1 },
+    { 8525, 1, 'i', -1 },
+    { 0, 0, ';', 32 },
+    { 8526, 1, 'f', -1 },
+    { 8527, 1, 's', -1 },
+    { 0, 0, ';', 58 },
+    { 8528, 1, 's', -1 },
+    { 8529, 1, 'o', -1 },
+    { 8530, 1, 'D', -1 },
+    { 8531, 1, 'Q', -1 },
+    { 8532, 1, 'e', -1 },
+    { 8533, 1, 'c', -1 },
+    { 8534, 4, 'l', -1 },
+    { 8538, 1, 'a', -1 },
+    { 8539, 1, 'o', -1 },
+    { 8540, 1, 'A', -1 },
+    { 8541, 1, 'A', -1 },
+    { 8542, 1, 'R', -1 },
+    { 8543, 1, 'T', -1 },
+    { 8544, 1, 'L', -1 },
+    { 8545, 1, 'R', -1 },
+    { 8546, 2, 't', -1 },
+    { 8548, 1, 'r', -1 },
+    { 8549, 1, 'w', -1 },
+    { 8550, 1, 'i', -1 },
+    { 8551, 1, 'a', -1 },
+    { 8552, 1, 'p', -1 },
+    { 8553, 1, 'g', -1 },
+    { 8554, 1, 'e', -1 },
+    { 8555, 1, 'c', -1 },
+    { 8556, 1, 'e', -1 },
+    { 8557, 1, 'e', -1 },
+    { 8558, 1, 'o', -1 },
+    { 8559, 1, 'S', -1 },
+    { 8560, 1, 'm', -1 },
+    { 0, 0, ';', 150 },
+    { 8561, 1, 'm', -1 },
+    { 8562, 1, 'l', -1 },
+    { 8563, 1, 'l', -1 },
+    { 8564, 1, 'S', -1 },
+    { 0, 0, ';', 165 },
+    { 8565, 1, 'a', -1 },
+    { 8566, 1, 'l', -1 },
+    { 8567, 1, 'a', -1 },
+    { 8568, 1, 's', -1 },
+    { 8569, 1, 'n', -1 },
+    { 8570, 1, 'd', -1 },
+    { 8571, 1, 'c', -1 },
+    { 8572, 1, 'L', -1 },
+    { 8573, 1, 'm', -1 },
+    { 0, 0, ';', 215 },
+    { 8574, 1, 'o', -1 },
+    { 8575, 1, 'o', -1 },
+    { 8576, 1, 'i', -1 },
+    { 0, 0, ';', 251 },
+    { 8577, 1, 'r', -1 },
+    { 8578, 1, 'a', -1 },
+    { 8579, 1, 'i', -1 },
+    { 8580, 1, 'g', -1 },
+    { 8581, 1, 'B', -1 },
+    { 8582, 1, 'e', -1 },
+    { 8583, 1, 'c', -1 },
+    { 8584, 1, 'r', -1 },
+    { 8585, 1, 'e', -1 },
+    { 8586, 1, 'o', -1 },
+    { 8587, 1, 't', -1 },
+    { 8588, 1, 'l', -1 },
+    { 8589, 1, 'V', -1 },
+    { 8590, 1, 'e', -1 },
+    { 8591, 1, 'o', -1 },
+    { 0, 0, ';', 278 },
+    { 8592, 1, 'B', -1 },
+    { 8593, 1, 'r', -1 },
+    { 8594, 1, 'r', -1 },
+    { 8595, 1, 'u', -1 },
+    { 8596, 1, 'r', -1 },
+    { 8597, 1, 'q', -1 },
+    { 0, 0, ';', 290 },
+    { 8598, 1, 'r', -1 },
+    { 8599, 1, 'g', -1 },
+    { 8600, 1, 'r', -1 },
+    { 8601, 1, 'r', -1 },
+    { 8602, 1, 'g', -1 },
+    { 8603, 1, 'r', -1 },
+    { 8604, 1, 'r', -1 },
+    { 8605, 1, 'A', -1 },
+    { 8606, 1, 'e', -1 },
+    { 8607, 1, 'd', -1 },
+    { 8608, 2, 'i', -1 },
+    { 8610, 1, 'r', -1 },
+    { 8611, 1, 't', -1 },
+    { 8612, 1, 'L', -1 },
+    { 8613, 1, 'g', -1 },
+    { 8614, 1, 'n', -1 },
+    { 8615, 1, 'e', -1 },
+    { 0, 0, ';', 334 },
+    { 8616, 1, 'l', -1 },
+    { 0, 0, ';', 338 },
+    { 8617, 1, 'E', -1 },
+    { 8618, 1, 'F', -1 },
+    { 8619, 1, 'G', -1 },
+    { 8620, 1, 'L', -1 },
+    { 8621, 1, 'S', -1 },
+    { 8622, 1, 'T', -1 },
+    { 8623, 1, 'n', -1 },
+    { 8624, 1, 'a', -1 },
+    { 8625, 1, 'a', -1 },
+    { 8626, 1, 'a', -1 },
+    { 8627, 1, 'a', -1 },
+    { 8628, 1, 's', -1 },
+    { 8629, 1, 'n', -1 },
+    { 8630, 1, 'd', -1 },
+    { 8631, 1, 'r', -1 },
+    { 8632, 1, 'e', -1 },
+    { 8633, 3, 's', -1 },
+    { 8636, 1, 'E', -1 },
+    { 8637, 1, 'i', -1 },
+    { 8638, 2, 'u', -1 },
+    { 8640, 1, 'q', -1 },
+    { 8641, 4, 's', -1 },
+    { 8645, 2, 't', -1 },
+    { 8647, 1, 'u', -1 },
+    { 8648, 1, 'l', -1 },
+    { 8649, 1, 'l', -1 },
+    { 8650, 1, 'l', -1 },
+    { 8651, 1, 'o', -1 },
+    { 8652, 1, 'u', -1 },
+    { 8653, 1, 't', -1 },
+    { 8654, 1, 'h', -1 },
+    { 8655, 1, 'a', -1 },
+    { 8656, 1, 'u', -1 },
+    { 8657, 1, 'a', -1 },
+    { 8658, 1, 'l', -1 },
+    { 0, 0, ';', 430 },
+    { 8659, 1, 'a', -1 },
+    { 8660, 1, 'm', -1 },
+    { 8661, 1, 'i', -1 },
+    { 8662, 1, 'q', -1 },
+    { 8663, 1, 'B', -1 },
+    { 0, 0, ';', 456 },
+    { 8664, 1, 'B', -1 },
+    { 8665, 1, 'L', -1 },
+    { 8666, 1, 'n', -1 },
+    { 8667, 1, 'e', -1 },
+    { 8668, 1, 'e', -1 },
+    { 8669, 1, 'e', -1 },
+    { 0, 0, ';', 464 },
+    { 8670, 1, 'r', -1 },
+    { 8671, 1, 'c', -1 },
+    { 8672, 1, 'g', -1 },
+    { 8673, 1, 'n', -1 },
+    { 8674, 1, 'V', -1 },
+    { 8675, 1, 't', -1 },
+    { 8676, 2, 'r', -1 },
+    { 0, 0, ';', 477 },
+    { 8678, 1, 'e', -1 },
+    { 8679, 1, 'w', -1 },
+    { 8680, 1, 'd', -1 },
+    { 8681, 1, 'r', -1 },
+    { 8682, 1, 'r', -1 },
+    { 8683, 1, 'A', -1 },
+    { 8684, 1, 'o', -1 },
+    { 8685, 1, 'e', -1 },
+    { 8686, 1, 'r', -1 },
+    { 8687, 1, 'e', -1 },
+    { 8688, 1, 'r', -1 },
+    { 8689, 1, 'n', -1 },
+    { 8690, 1, 'l', -1 },
+    { 8691, 1, 'u', -1 },
+    { 8692, 1, 'a', -1 },
+    { 8693, 1, 'l', -1 },
+    { 8694, 1, 'u', -1 },
+    { 0, 0, ';', 537 },
+    { 0, 0, ';', 540 },
+    { 8695, 1, 'q', -1 },
+    { 0, 0, ';', 542 },
+    { 0, 0, ';', 562 },
+    { 8696, 1, 'e', -1 },
+    { 8697, 1, 't', -1 },
+    { 0, 0, ';', 570 },
+    { 8698, 1, 'n', -1 },
+    { 8699, 1, 'w', -1 },
+    { 8700, 1, 'i', -1 },
+    { 0, 0, ';', 575 },
+    { 8701, 1, 'w', -1 },
+    { 8702, 1, 'r', -1 },
+    { 8703, 1, 'A', -1 },
+    { 8704, 1, 'r', -1 },
+    { 8705, 1, 'n', -1 },
+    { 8706, 1, 'p', -1 },
+    { 8707, 1, 'l', -1 },
+    { 8708, 1, 'a', -1 },
+    { 8709, 1, 'p', -1 },
+    { 8710, 1, 'n', -1 },
+    { 8711, 2, 'e', -1 },
+    { 8713, 1, 'g', -1 },
+    { 8714, 1, 'e', -1 },
+    { 8715, 1, 'g', -1 },
+    { 8716, 2, 'w', -1 },
+    { 0, 0, ';', 856 },
+    { 8718, 1, 'c', -1 },
+    { 8719, 1, 'h', -1 },
+    { 0, 0, ';', 872 },
+    { 8720, 1, 'c', -1 },
+    { 8721, 1, 'c', -1 },
+    { 0, 0, ';', 908 },
+    { 8722, 1, 'l', -1 },
+    { 8723, 1, 'r', -1 },
+    { 8724, 1, 't', -1 },
+    { 8725, 1, 'm', -1 },
+    { 8726, 1, 'e', -1 },
+    { 8727, 1, 'r', -1 },
+    { 8728, 2, 'n', -1 },
+    { 0, 0, ';', 1029 },
+    { 8730, 1, 's', -1 },
+    { 8731, 1, 'n', -1 },
+    { 8732, 1, 'l', -1 },
+    { 8733, 1, 's', -1 },
+    { 0, 0, ';', 1145 },
+    { 8734, 1, 'r', -1 },
+    { 8735, 1, 'r', -1 },
+    { 8736, 1, 'a', -1 },
+    { 8737, 2, 'n', -1 },
+    { 8739, 1, 'r', -1 },
+    { 8740, 1, 'r', -1 },
+    { 8741, 1, 'a', -1 },
+    { 8742, 1, 'q', -1 },
+    { 8743, 1, 'i', -1 },
+    { 0, 0, ';', 1322 },
+    { 0, 0, ';', 1325 },
+    { 0, 0, ';', 1345 },
+    { 8744, 1, 'r', -1 },
+    { 8745, 1, 'g', -1 },
+    { 0, 0, ';', 1358 },
+    { 8746, 1, 'r', -1 },
+    { 8747, 1, 'e', -1 },
+    { 8748, 1, 'i', -1 },
+    { 0, 0, ';', 1414 },
+    { 0, 0, ';', 1415 },
+    { 8749, 1, 'g', -1 },
+    { 0, 0, ';', 1449 },
+    { 8750, 1, 'a', -1 },
+    { 8751, 1, 'w', -1 },
+    { 0, 0, ';', 1514 },
+    { 8752, 1, 'a', -1 },
+    { 8753, 1, 'w', -1 },
+    { 8754, 1, 'l', -1 },
+    { 0, 0, ';', 1574 },
+    { 0, 0, ';', 1582 },
+    { 8755, 1, 'e', -1 },
+    { 8756, 1, 'i', -1 },
+    { 0, 0, ';', 1721 },
+    { 8757, 1, 'q', -1 },
+    { 8758, 1, 'x', -1 },
+    { 8759, 1, 's', -1 },
+    { 0, 0, ';', 1817 },
+    { 8760, 1, 't', -1 },
+    { 8761, 1, 'o', -1 },
+    { 8762, 1, 'r', -1 },
+    { 8763, 1, 'a', -1 },
+    { 8764, 1, 'a', -1 },
+    { 8765, 1, 'a', -1 },
+    { 8766, 1, 't', -1 },
+    { 8767, 1, 'e', -1 },
+    { 0, 0, ';', 1832 },
+    { 8768, 1, 'l', -1 },
+    { 8769, 1, 'n', -1 },
+    { 0, 0, ';', 1936 },
+    { 0, 0, ';', 1940 },
+    { 8770, 1, 's', -1 },
+    { 8771, 1, 'i', -1 },
+    { 0, 0, ';', 1969 },
+    { 0, 0, ';', 1974 },
+    { 8772, 1, 'q', -1 },
+    { 8773, 1, 'x', -1 },
+    { 0, 0, ';', 2006 },
+    { 8774, 1, 'x', -1 },
+    { 8775, 1, 'w', -1 },
+    { 8776, 1, 'f', -1 },
+    { 8777, 1, 'g', -1 },
+    { 8778, 1, 't', -1 },
+    { 8779, 1, 'h', -1 },
+    { 8780, 1, 'w', -1 },
+    { 8781, 1, 'e', -1 },
+    { 8782, 1, 'i', -1 },
+    { 0, 0, ';', 2112 },
+    { 0, 0, ';', 2132 },
+    { 0, 0, ';', 2134 },
+    { 8783, 1, 'e', -1 },
+    { 8784, 1, 'e', -1 },
+    { 8785, 2, 'e', -1 },
+    { 8787, 1, 'o', -1 },
+    { 8788, 1, 'e', -1 },
+    { 0, 0, ';', 57 },
+    { 0, 0, ';', 59 },
+    { 8789, 1, 'n', -1 },
+    { 8790, 1, 'o', -1 },
+    { 8791, 1, 'u', -1 },
+    { 8792, 1, 'g', -1 },
+    { 8793, 1, 'k', -1 },
+    { 8794, 1, 'A', -1 },
+    { 8795, 1, 'D', -1 },
+    { 8796, 1, 'G', -1 },
+    { 8797, 1, 'T', -1 },
+    { 8798, 1, 'l', -1 },
+    { 8799, 1, 'u', -1 },
+    { 8800, 1, 'r', -1 },
+    { 8801, 1, 'r', -1 },
+    { 8802, 1, 'i', -1 },
+    { 8803, 1, 'e', -1 },
+    { 8804, 1, 'e', -1 },
+    { 8805, 1, 'i', -1 },
+    { 8806, 1, 'A', -1 },
+    { 8807, 1, 'T', -1 },
+    { 8808, 1, 'o', -1 },
+    { 8809, 1, 'n', -1 },
+    { 8810, 1, 'c', -1 },
+    { 8811, 1, 'r', -1 },
+    { 8812, 1, 'A', -1 },
+    { 8813, 1, 'h', -1 },
+    { 8814, 1, 'V', -1 },
+    { 8815, 1, 't', -1 },
+    { 8816, 1, 'e', -1 },
+    { 8817, 1, 'c', -1 },
+    { 8818, 1, 'w', -1 },
+    { 8819, 1, 'q', -1 },
+    { 8820, 1, 'a', -1 },
+    { 0, 0, ';', 151 },
+    { 8821, 1, 'E', -1 },
+    { 8822, 1, 'S', -1 },
+    { 8823, 1, 'm', -1 },
+    { 8824, 2, 'l', -1 },
+    { 8826, 1, 'E', -1 },
+    { 8827, 1, 't', -1 },
+    { 0, 0, ';', 184 },
+    { 8828, 1, 't', -1 },
+    { 8829, 1, 'e', -1 },
+    { 8830, 1, 'e', -1 },
+    { 8831, 1, 'i', -1 },
+    { 8832, 1, 'p', -1 },
+    { 8833, 1, 'n', -1 },
+    { 8834, 1, 'm', -1 },
+    { 8835, 1, 'm', -1 },
+    { 8836, 1, 'a', -1 },
+    { 8837, 1, 'r', -1 },
+    { 8838, 1, 'g', -1 },
+    { 0, 0, ';', 260 },
+    { 8839, 1, 'r', -1 },
+    { 8840, 1, 'V', -1 },
+    { 8841, 1, 't', -1 },
+    { 8842, 1, 'r', -1 },
+    { 8843, 1, 'c', -1 },
+    { 8844, 1, 'w', -1 },
+    { 8845, 1, 'o', -1 },
+    { 8846, 3, 'e', -1 },
+    { 8849, 1, 'e', -1 },
+    { 8850, 1, 'c', -1 },
+    { 8851, 2, 'r', -1 },
+    { 8853, 1, 'a', -1 },
+    { 8854, 1, 'r', -1 },
+    { 8855, 1, 'e', -1 },
+    { 8856, 1, 'a', -1 },
+    { 0, 0, ';', 284 },
+    { 8857, 1, 'u', -1 },
+    { 8858, 1, 'o', -1 },
+    { 8859, 1, 'h', -1 },
+    { 8860, 1, 'r', -1 },
+    { 8861, 1, 'o', -1 },
+    { 8862, 1, 'h', -1 },
+    { 8863, 1, 'r', -1 },
+    { 8864, 1, 'r', -1 },
+    { 8865, 1, 'r', -1 },
+    { 0, 0, ';', 307 },
+    { 8866, 1, 'i', -1 },
+    { 8867, 1, 'c', -1 },
+    { 8868, 1, 'n', -1 },
+    { 8869, 1, 'y', -1 },
+    { 8870, 1, 'e', -1 },
+    { 8871, 1, 'e', -1 },
+    { 8872, 1, 'S', -1 },
+    { 8873, 1, 't', -1 },
+    { 8874, 1, 'r', -1 },
+    { 8875, 1, 'd', -1 },
+    { 8876, 1, 'q', -1 },
+    { 8877, 1, 'u', -1 },
+    { 8878, 1, 'r', -1 },
+    { 8879, 1, 'e', -1 },
+    { 8880, 1, 'l', -1 },
+    { 8881, 1, 'i', -1 },
+    { 8882, 1, 'H', -1 },
+    { 8883, 1, 'l', -1 },
+    { 8884, 1, 'n', -1 },
+    { 8885, 1, 'l', -1 },
+    { 8886, 1, 't', -1 },
+    { 0, 0, ';', 353 },
+    { 8887, 1, 't', -1 },
+    { 8888, 1, 'e', -1 },
+    { 8889, 1, 'e', -1 },
+    { 8890, 1, 's', -1 },
+    { 0, 0, ';', 358 },
+    { 8891, 1, 'E', -1 },
+    { 8892, 1, 'S', -1 },
+    { 8893, 1, 'l', -1 },
+    { 8894, 1, 'a', -1 },
+    { 8895, 1, 'b', -1 },
+    { 8896, 1, 'p', -1 },
+    { 8897, 1, 'u', -1 },
+    { 0, 0, ';', 371 },
+    { 8898, 1, 'E', -1 },
+    { 8899, 1, 'S', -1 },
+    { 8900, 1, 'T', -1 },
+    { 0, 0, ';', 375 },
+    { 8901, 1, 'E', -1 },
+    { 8902, 1, 'a', -1 },
+    { 8903, 1, 'l', -1 },
+    { 8904, 1, 'd', -1 },
+    { 8905, 1, 'B', -1 },
+    { 8906, 1, 'u', -1 },
+    { 8907, 1, 'o', -1 },
+    { 0, 0, ';', 413 },
+    { 8908, 1, 'e', -1 },
+    { 8909, 1, 'n', -1 },
+    { 8910, 1, 'a', -1 },
+    { 8911, 1, 'n', -1 },
+    { 8912, 1, 'd', -1 },
+    { 8913, 1, 'l', -1 },
+    { 8914, 1, 'e', -1 },
+    { 8915, 1, 'l', -1 },
+    { 8916, 1, 'u', -1 },
+    { 8917, 1, 'r', -1 },
+    { 8918, 1, 'a', -1 },
+    { 8919, 1, 'e', -1 },
+    { 8920, 1, 'g', -1 },
+    { 8921, 1, 'B', -1 },
+    { 8922, 1, 'e', -1 },
+    { 8923, 1, 'c', -1 },
+    { 8924, 1, 'o', -1 },
+    { 8925, 1, 't', -1 },
+    { 8926, 1, 'l', -1 },
+    { 8927, 1, 'V', -1 },
+    { 8928, 1, 'e', -1 },
+    { 8929, 1, 'o', -1 },
+    { 0, 0, ';', 475 },
+    { 8930, 1, 'B', -1 },
+    { 8931, 1, 's', -1 },
+    { 0, 0, ';', 480 },
+    { 0, 0, ';', 483 },
+    { 8932, 1, 'r', -1 },
+    { 8933, 1, 'r', -1 },
+    { 8934, 1, 'r', -1 },
+    { 8935, 1, 'w', -1 },
+    { 0, 0, ';', 499 },
+    { 8936, 1, 's', -1 },
+    { 8937, 2, 't', -1 },
+    { 8939, 1, 's', -1 },
+    { 0, 0, ';', 508 },
+    { 0, 0, ';', 513 },
+    { 8940, 1, 'a', -1 },
+    { 8941, 1, 'n', -1 },
+    { 8942, 1, 'd', -1 },
+    { 8943, 1, 'a', -1 },
+    { 8944, 1, 'u', -1 },
+    { 8945, 1, 't', -1 },
+    { 8946, 1, 'h', -1 },
+    { 8947, 1, 'A', -1 },
+    { 0, 0, ';', 572 },
+    { 8948, 1, 'u', -1 },
+    { 0, 0, ';', 577 },
+    { 8949, 1, 'r', -1 },
+    { 8950, 1, 'r', -1 },
+    { 0, 0, ';', 595 },
+    { 8951, 1, 'e', -1 },
+    { 8952, 1, 'a', -1 },
+    { 8953, 1, 'd', -1 },
+    { 8954, 1, 'c', -1 },
+    { 8955, 1, 'a', -1 },
+    { 0, 0, ';', 705 },
+    { 8956, 1, 'd', -1 },
+    { 8957, 1, 'u', -1 },
+    { 8958, 1, 'e', -1 },
+    { 0, 0, ';', 741 },
+    { 8959, 1, 'l', -1 },
+    { 8960, 1, 'l', -1 },
+    { 8961, 1, 'r', -1 },
+    { 0, 0, ';', 857 },
+    { 0, 0, ';', 858 },
+    { 0, 0, ';', 905 },
+    { 0, 0, ';', 906 },
+    { 8962, 1, 'e', -1 },
+    { 8963, 1, 'i', -1 },
+    { 0, 0, ';', 943 },
+    { 8964, 1, 'e', -1 },
+    { 8965, 1, 'd', -1 },
+    { 8966, 1, 'o', -1 },
+    { 8967, 1, 'l', -1 },
+    { 8968, 1, 'r', -1 },
+    { 0, 0, ';', 1030 },
+    { 0, 0, ';', 1049 },
+    { 8969, 1, 'e', -1 },
+    { 8970, 1, 'e', -1 },
+    { 8971, 1, 'o', -1 },
+    { 8972, 1, 'r', -1 },
+    { 8973, 1, 'i', -1 },
+    { 8974, 1, 'd', -1 },
+    { 8975, 1, 'u', -1 },
+    { 8976, 1, 'o', -1 },
+    { 8977, 1, 'r', -1 },
+    { 8978, 1, 'r', -1 },
+    { 8979, 1, 'u', -1 },
+    { 8980, 1, 'm', -1 },
+    { 8981, 1, 'o', -1 },
+    { 8982, 1, 'h', -1 },
+    { 8983, 1, 'r', -1 },
+    { 8984, 1, 'f', -1 },
+    { 8985, 1, 'g', -1 },
+    { 8986, 1, 'l', -1 },
+    { 8987, 1, 'r', -1 },
+    { 0, 0, ';', 1454 },
+    { 8988, 1, 'r', -1 },
+    { 0, 0, ';', 1553 },
+    { 8989, 1, 'l', -1 },
+    { 8990, 1, 'f', -1 },
+    { 8991, 1, 'g', -1 },
+    { 0, 0, ';', 1722 },
+    { 0, 0, ';', 1724 },
+    { 0, 0, ';', 1749 },
+    { 8992, 1, 'a', -1 },
+    { 8993, 2, 'n', -1 },
+    { 8995, 1, 'r', -1 },
+    { 8996, 1, 'r', -1 },
+    { 8997, 1, 'r', -1 },
+    { 8998, 1, 'r', -1 },
+    { 8999, 1, 'i', -1 },
+    { 9000, 1, 'q', -1 },
+    { 9001, 1, 'e', -1 },
+    { 9002, 1, 'u', -1 },
+    { 9003, 1, 'i', -1 },
+    { 0, 0, ';', 1953 },
+    { 0, 0, ';', 1975 },
+    { 0, 0, ';', 1977 },
+    { 0, 0, ';', 2031 },
+    { 9004, 1, 'n', -1 },
+    { 9005, 2, 't', -1 },
+    { 9007, 1, 'h', -1 },
+    { 9008, 1, 'a', -1 },
+    { 9009, 1, 't', -1 },
+    { 0, 0, ';', 2105 },
+    { 9010, 1, 'f', -1 },
+    { 9011, 1, 'g', -1 },
+    { 9012, 2, 'q', -1 },
+    { 9014, 2, 'q', -1 },
+    { 9016, 1, 'l', -1 },
+    { 9017, 1, 'r', -1 },
+    { 9018, 1, 'n', -1 },
+    { 9019, 1, 'r', -1 },
+    { 9020, 1, 't', -1 },
+    { 9021, 1, 'u', -1 },
+    { 9022, 1, 'o', -1 },
+    { 9023, 1, 'r', -1 },
+    { 9024, 1, 'w', -1 },
+    { 9025, 1, 'c', -1 },
+    { 9026, 2, 'o', -1 },
+    { 9028, 1, 'r', -1 },
+    { 9029, 1, 'i', -1 },
+    { 9030, 1, 'D', -1 },
+    { 9031, 1, 'r', -1 },
+    { 9032, 1, 'r', -1 },
+    { 9033, 1, 'r', -1 },
+    { 9034, 1, 'g', -1 },
+    { 9035, 1, 'e', -1 },
+    { 9036, 1, 'f', -1 },
+    { 9037, 1, 'g', -1 },
+    { 9038, 1, 'r', -1 },
+    { 9039, 1, 'e', -1 },
+    { 9040, 1, 'w', -1 },
+    { 9041, 1, 'A', -1 },
+    { 9042, 1, 'a', -1 },
+    { 0, 0, ';', 114 },
+    { 9043, 1, 'r', -1 },
+    { 9044, 1, 't', -1 },
+    { 9045, 1, 'e', -1 },
+    { 9046, 1, 'o', -1 },
+    { 9047, 1, 'V', -1 },
+    { 9048, 1, 't', -1 },
+    { 0, 0, ';', 125 },
+    { 9049, 1, 'u', -1 },
+    { 9050, 1, 'l', -1 },
+    { 0, 0, ';', 158 },
+    { 9051, 1, 'q', -1 },
+    { 9052, 1, 'a', -1 },
+    { 0, 0, ';', 180 },
+    { 9053, 1, 'L', -1 },
+    { 9054, 1, 'q', -1 },
+    { 9055, 1, 'e', -1 },
+    { 9056, 1, 'E', -1 },
+    { 0, 0, ';', 186 },
+    { 0, 0, ';', 194 },
+    { 9057, 1, 'n', -1 },
+    { 0, 0, ';', 199 },
+    { 0, 0, ';', 219 },
+    { 9058, 1, 'm', -1 },
+    { 9059, 1, 'e', -1 },
+    { 9060, 1, 'c', -1 },
+    { 0, 0, ';', 258 },
+    { 9061, 1, 'h', -1 },
+    { 9062, 1, 'a', -1 },
+    { 9063, 1, 'e', -1 },
+    { 9064, 1, 'o', -1 },
+    { 9065, 1, 'o', -1 },
+    { 9066, 1, 't', -1 },
+    { 0, 0, ';', 269 },
+    { 9067, 1, 'r', -1 },
+    { 0, 0, ';', 271 },
+    { 9068, 1, 'B', -1 },
+    { 9069, 1, 'E', -1 },
+    { 9070, 1, 'c', -1 },
+    { 9071, 1, 't', -1 },
+    { 0, 0, ';', 276 },
+    { 9072, 1, 'B', -1 },
+    { 9073, 1, 'r', -1 },
+    { 9074, 1, 'o', -1 },
+    { 9075, 1, 'a', -1 },
+    { 9076, 1, 'l', -1 },
+    { 9077, 1, 'a', -1 },
+    { 9078, 1, 'w', -1 },
+    { 9079, 1, 't', -1 },
+    { 9080, 1, 'o', -1 },
+    { 9081, 1, 'w', -1 },
+    { 9082, 1, 't', -1 },
+    { 9083, 1, 'o', -1 },
+    { 9084, 1, 'o', -1 },
+    { 9085, 1, 'r', -1 },
+    { 9086, 1, 'u', -1 },
+    { 9087, 1, 'k', -1 },
+    { 9088, 1, 'S', -1 },
+    { 9089, 1, 'T', -1 },
+    { 9090, 1, 'r', -1 },
+    { 9091, 1, 's', -1 },
+    { 9092, 1, 'p', -1 },
+    { 0, 0, ';', 331 },
+    { 9093, 1, 't', -1 },
+    { 9094, 1, 'e', -1 },
+    { 9095, 1, 'u', -1 },
+    { 9096, 1, 'l', -1 },
+    { 9097, 1, 'e', -1 },
+    { 9098, 1, 's', -1 },
+    { 9099, 1, 'a', -1 },
+    { 9100, 1, 'l', -1 },
+    { 9101, 1, 'u', -1 },
+    { 0, 0, ';', 346 },
+    { 9102, 1, 'g', -1 },
+    { 0, 0, ';', 351 },
+    { 9103, 1, 'e', -1 },
+    { 9104, 1, 'E', -1 },
+    { 0, 0, ';', 355 },
+    { 9105, 1, 'a', -1 },
+    { 9106, 1, 's', -1 },
+    { 9107, 1, 'q', -1 },
+    { 9108, 1, 'l', -1 },
+    { 9109, 1, 'e', -1 },
+    { 9110, 1, 'n', -1 },
+    { 9111, 1, 's', -1 },
+    { 9112, 1, 'e', -1 },
+    { 9113, 1, 'a', -1 },
+    { 9114, 1, 'q', -1 },
+    { 9115, 1, 'l', -1 },
+    { 9116, 1, 'i', -1 },
+    { 9117, 1, 'q', -1 },
+    { 9118, 1, 'l', -1 },
+    { 9119, 1, 'E', -1 },
+    { 9120, 1, 'e', -1 },
+    { 9121, 1, 'a', -1 },
+    { 9122, 1, 'b', -1 },
+    { 9123, 1, 't', -1 },
+    { 9124, 1, 's', -1 },
+    { 9125, 1, 'e', -1 },
+    { 9126, 1, 'l', -1 },
+    { 9127, 1, 't', -1 },
+    { 9128, 1, 'e', -1 },
+    { 0, 0, ';', 431 },
+    { 9129, 1, 'n', -1 },
+    { 9130, 1, 'i', -1 },
+    { 9131, 1, 'i', -1 },
+    { 9132, 1, 'a', -1 },
+    { 9133, 1, 'r', -1 },
+    { 9134, 1, 'f', -1 },
+    { 0, 0, ';', 459 },
+    { 9135, 1, 'r', -1 },
+    { 9136, 1, 'V', -1 },
+    { 9137, 1, 't', -1 },
+    { 9138, 1, 'w', -1 },
+    { 9139, 1, 'o', -1 },
+    { 9140, 3, 'e', -1 },
+    { 9143, 1, 'e', -1 },
+    { 9144, 1, 'c', -1 },
+    { 9145, 2, 'r', -1 },
+    { 9147, 1, 'a', -1 },
+    { 0, 0, ';', 479 },
+    { 9148, 1, 'o', -1 },
+    { 9149, 1, 'o', -1 },
+    { 9150, 1, 'r', -1 },
+    { 0, 0, ';', 497 },
+    { 9151, 1, 'e', -1 },
+    { 0, 0, ';', 504 },
+    { 9152, 1, 'E', -1 },
+    { 9153, 1, 'e', -1 },
+    { 9154, 1, 'l', -1 },
+    { 9155, 1, 't', -1 },
+    { 9156, 1, 'e', -1 },
+    { 9157, 1, 'l', -1 },
+    { 9158, 1, 'a', -1 },
+    { 0, 0, ';', 563 },
+    { 9159, 1, 'e', -1 },
+    { 9160, 1, 'r', -1 },
+    { 9161, 1, 'm', -1 },
+    { 9162, 1, 'o', -1 },
+    { 9163, 1, 'r', -1 },
+    { 0, 0, ';', 596 },
+    { 9164, 1, 'r', -1 },
+    { 9165, 1, 'e', -1 },
+    { 9166, 1, 'e', -1 },
+    { 9167, 1, 'c', -1 },
+    { 9168, 1, 'o', -1 },
+    { 9169, 1, 'p', -1 },
+    { 0, 0, ';', 740 },
+    { 9170, 4, 'e', -1 },
+    { 9174, 1, 'e', -1 },
+    { 9175, 1, 'i', -1 },
+    { 9176, 1, 'f', -1 },
+    { 9177, 1, 'g', -1 },
+    { 9178, 1, 's', -1 },
+    { 9179, 1, 'g', -1 },
+    { 9180, 1, 'w', -1 },
+    { 9181, 1, 'e', -1 },
+    { 9182, 1, 'i', -1 },
+    { 0, 0, ';', 1050 },
+    { 9183, 1, 'q', -1 },
+    { 9184, 1, 'w', -1 },
+    { 9185, 1, 'o', -1 },
+    { 9186, 1, 'l', -1 },
+    { 9187, 1, 'o', -1 },
+    { 9188, 1, 'p', -1 },
+    { 9189, 1, 'w', -1 },
+    { 9190, 1, 'o', -1 },
+    { 9191, 1, 'p', -1 },
+    { 9192, 1, 'i', -1 },
+    { 9193, 1, 'e', -1 },
+    { 9194, 1, 'w', -1 },
+    { 9195, 1, 't', -1 },
+    { 9196, 1, 'o', -1 },
+    { 9197, 1, 't', -1 },
+    { 9198, 1, 'h', -1 },
+    { 9199, 1, 'e', -1 },
+    { 9200, 1, 'r', -1 },
+    { 9201, 1, 'r', -1 },
+    { 9202, 1, 'e', -1 },
+    { 9203, 2, 't', -1 },
+    { 9205, 1, 'h', -1 },
+    { 9206, 1, 'i', -1 },
+    { 9207, 1, 'd', -1 },
+    { 9208, 1, 'u', -1 },
+    { 9209, 1, 'o', -1 },
+    { 9210, 1, 'p', -1 },
+    { 9211, 1, 'r', -1 },
+    { 9212, 1, 'r', -1 },
+    { 9213, 1, 'm', -1 },
+    { 0, 0, ';', 1827 },
+    { 9214, 1, 'l', -1 },
+    { 9215, 1, 's', -1 },
+    { 9216, 1, 'l', -1 },
+    { 0, 0, ';', 2055 },
+    { 0, 0, ';', 2056 },
+    { 9217, 1, 'e', -1 },
+    { 9218, 2, 't', -1 },
+    { 9220, 1, 'r', -1 },
+    { 9221, 1, 'a', -1 },
+    { 9222, 1, 't', -1 },
+    { 9223, 1, 'h', -1 },
+    { 0, 0, ';', 2141 },
+    { 9224, 1, 'q', -1 },
+    { 0, 0, ';', 2143 },
+    { 9225, 1, 'q', -1 },
+    { 9226, 1, 'e', -1 },
+    { 9227, 1, 'i', -1 },
+    { 0, 0, ';', 18 },
+    { 9228, 1, 'e', -1 },
+    { 9229, 1, 'o', -1 },
+    { 9230, 1, 'b', -1 },
+    { 9231, 1, 't', -1 },
+    { 9232, 1, 'a', -1 },
+    { 9233, 1, 'i', -1 },
+    { 9234, 1, 'u', -1 },
+    { 9235, 1, 't', -1 },
+    { 9236, 1, 'u', -1 },
+    { 9237, 1, 'a', -1 },
+    { 9238, 1, 'l', -1 },
+    { 0, 0, ';', 94 },
+    { 9239, 1, 'I', -1 },
+    { 9240, 1, 'o', -1 },
+    { 9241, 1, 'o', -1 },
+    { 9242, 1, 'h', -1 },
+    { 0, 0, ';', 104 },
+    { 9243, 2, 't', -1 },
+    { 9245, 1, 'h', -1 },
+    { 9246, 1, 'r', -1 },
+    { 9247, 1, 'e', -1 },
+    { 0, 0, ';', 110 },
+    { 9248, 1, 'r', -1 },
+    { 9249, 1, 'l', -1 },
+    { 9250, 1, 'r', -1 },
+    { 9251, 1, 'V', -1 },
+    { 9252, 1, 'c', -1 },
+    { 9253, 2, 'r', -1 },
+    { 9255, 1, 'e', -1 },
+    { 9256, 1, 'o', -1 },
+    { 9257, 1, 'a', -1 },
+    { 9258, 1, 'l', -1 },
+    { 9259, 1, 'u', -1 },
+    { 9260, 1, 'l', -1 },
+    { 9261, 1, 'e', -1 },
+    { 9262, 1, 'u', -1 },
+    { 9263, 1, 'r', -1 },
+    { 9264, 1, 'q', -1 },
+    { 9265, 1, 'e', -1 },
+    { 9266, 1, 'a', -1 },
+    { 9267, 1, 's', -1 },
+    { 9268, 1, 'k', -1 },
+    { 9269, 1, 't', -1 },
+    { 9270, 1, 'c', -1 },
+    { 9271, 1, 'c', -1 },
+    { 9272, 2, 'r', -1 },
+    { 9274, 1, 'w', -1 },
+    { 9275, 1, 'o', -1 },
+    { 0, 0, ';', 270 },
+    { 9276, 1, 'a', -1 },
+    { 9277, 1, 'q', -1 },
+    { 9278, 1, 't', -1 },
+    { 9279, 1, 'o', -1 },
+    { 9280, 1, 'a', -1 },
+    { 0, 0, ';', 279 },
+    { 9281, 1, 'w', -1 },
+    { 9282, 1, 't', -1 },
+    { 0, 0, ';', 283 },
+    { 9283, 1, 'l', -1 },
+    { 0, 0, ';', 292 },
+    { 9284, 1, 'A', -1 },
+    { 9285, 1, 'w', -1 },
+    { 0, 0, ';', 295 },
+    { 9286, 1, 'a', -1 },
+    { 9287, 1, 'w', -1 },
+    { 9288, 1, 'w', -1 },
+    { 9289, 1, 'o', -1 },
+    { 9290, 1, 'm', -1 },
+    { 9291, 1, 'S', -1 },
+    { 9292, 1, 'p', -1 },
+    { 9293, 1, 'h', -1 },
+    { 9294, 1, 'G', -1 },
+    { 9295, 1, 's', -1 },
+    { 9296, 1, 'a', -1 },
+    { 9297, 1, 'i', -1 },
+    { 0, 0, ';', 336 },
+    { 9298, 1, 'a', -1 },
+    { 9299, 1, 'l', -1 },
+    { 9300, 1, 'a', -1 },
+    { 9301, 1, 's', -1 },
+    { 9302, 1, 'n', -1 },
+    { 9303, 1, 'd', -1 },
+    { 9304, 1, 'm', -1 },
+    { 9305, 1, 'l', -1 },
+    { 9306, 1, 'r', -1 },
+    { 9307, 1, 'q', -1 },
+    { 9308, 1, 't', -1 },
+    { 9309, 1, 'L', -1 },
+    { 9310, 1, 'u', -1 },
+    { 9311, 1, 'a', -1 },
+    { 9312, 1, 'm', -1 },
+    { 9313, 1, 'g', -1 },
+    { 9314, 1, 'e', -1 },
+    { 9315, 1, 'r', -1 },
+    { 9316, 1, 'l', -1 },
+    { 9317, 1, 'u', -1 },
+    { 9318, 1, 'a', -1 },
+    { 9319, 1, 'l', -1 },
+    { 9320, 1, 'u', -1 },
+    { 0, 0, ';', 378 },
+    { 9321, 1, 'q', -1 },
+    { 0, 0, ';', 380 },
+    { 9322, 1, 'r', -1 },
+    { 9323, 1, 'l', -1 },
+    { 9324, 1, 'e', -1 },
+    { 9325, 1, 'i', -1 },
+    { 0, 0, ';', 421 },
+    { 0, 0, ';', 425 },
+    { 9326, 1, 'E', -1 },
+    { 0, 0, ';', 427 },
+    { 9327, 1, 't', -1 },
+    { 9328, 1, 'b', -1 },
+    { 9329, 1, 'l', -1 },
+    { 9330, 1, 'c', -1 },
+    { 0, 0, ';', 457 },
+    { 9331, 1, 't', -1 },
+    { 9332, 1, 'a', -1 },
+    { 9333, 1, 'e', -1 },
+    { 9334, 1, 'o', -1 },
+    { 0, 0, ';', 466 },
+    { 9335, 1, 'r', -1 },
+    { 0, 0, ';', 468 },
+    { 9336, 1, 'B', -1 },
+    { 9337, 1, 'E', -1 },
+    { 9338, 1, 'c', -1 },
+    { 9339, 1, 't', -1 },
+    { 0, 0, ';', 473 },
+    { 9340, 1, 'B', -1 },
+    { 9341, 1, 'r', -1 },
+    { 9342, 1, 'w', -1 },
+    { 9343, 1, 'w', -1 },
+    { 9344, 1, 'o', -1 },
+    { 9345, 1, 'c', -1 },
+    { 9346, 1, 'q', -1 },
+    { 9347, 2, 't', -1 },
+    { 0, 0, ';', 515 },
+    { 9349, 1, 'E', -1 },
+    { 0, 0, ';', 517 },
+    { 0, 0, ';', 522 },
+    { 9350, 1, 'l', -1 },
+    { 9351, 1, 's', -1 },
+    { 9352, 1, 'r', -1 },
+    { 0, 0, ';', 573 },
+    { 9353, 1, 'w', -1 },
+    { 9354, 1, 'o', -1 },
+    { 9355, 1, 'a', -1 },
+    { 0, 0, ';', 598 },
+    { 0, 0, ';', 599 },
+    { 9356, 1, 'e', -1 },
+    { 9357, 1, 'w', -1 },
+    { 0, 0, ';', 735 },
+    { 0, 0, ';', 742 },
+    { 9358, 1, 'd', -1 },
+    { 9359, 1, 'l', -1 },
+    { 9360, 1, 'r', -1 },
+    { 9361, 1, 'f', -1 },
+    { 9362, 1, 'g', -1 },
+    { 9363, 1, 't', -1 },
+    { 9364, 1, 'h', -1 },
+    { 0, 0, ';', 951 },
+    { 9365, 1, 'e', -1 },
+    { 9366, 1, 's', -1 },
+    { 9367, 1, 'f', -1 },
+    { 9368, 1, 'g', -1 },
+    { 0, 0, ';', 1051 },
+    { 0, 0, ';', 1169 },
+    { 9369, 1, 'w', -1 },
+    { 0, 0, ';', 1302 },
+    { 9370, 1, 'w', -1 },
+    { 0, 0, ';', 1304 },
+    { 9371, 1, 's', -1 },
+    { 9372, 2, 'w', -1 },
+    { 9374, 1, 'o', -1 },
+    { 9375, 1, 'g', -1 },
+    { 9376, 1, 's', -1 },
+    { 0, 0, ';', 1356 },
+    { 9377, 1, 'a', -1 },
+    { 9378, 1, 'w', -1 },
+    { 0, 0, ';', 1360 },
+    { 9379, 1, 't', -1 },
+    { 0, 0, ';', 1421 },
+    { 9380, 1, 'o', -1 },
+    { 9381, 1, 'o', -1 },
+    { 9382, 1, 'l', -1 },
+    { 0, 0, ';', 1587 },
+    { 9383, 1, 'e', -1 },
+    { 9384, 2, 't', -1 },
+    { 9386, 1, 'l', -1 },
+    { 9387, 1, 'o', -1 },
+    { 9388, 1, 'p', -1 },
+    { 9389, 1, 'w', -1 },
+    { 9390, 1, 'o', -1 },
+    { 9391, 1, 'o', -1 },
+    { 9392, 1, 'o', -1 },
+    { 9393, 1, 'e', -1 },
+    { 0, 0, ';', 1895 },
+    { 0, 0, ';', 1913 },
+    { 9394, 1, 'o', -1 },
+    { 9395, 1, 'q', -1 },
+    { 0, 0, ';', 2059 },
+    { 9396, 1, 'e', -1 },
+    { 9397, 1, 'r', -1 },
+    { 9398, 1, 'r', -1 },
+    { 0, 0, ';', 2106 },
+    { 9399, 1, 't', -1 },
+    { 0, 0, ';', 2142 },
+    { 0, 0, ';', 2144 },
+    { 9400, 1, 'f', -1 },
+    { 9401, 1, 'g', -1 },
+    { 9402, 1, 'n', -1 },
+    { 9403, 1, 'u', -1 },
+    { 9404, 1, 'l', -1 },
+    { 9405, 1, 'e', -1 },
+    { 9406, 1, 'l', -1 },
+    { 9407, 1, 's', -1 },
+    { 9408, 1, 't', -1 },
+    { 0, 0, ';', 89 },
+    { 9409, 1, 'b', -1 },
+    { 9410, 1, 'v', -1 },
+    { 9411, 1, 'd', -1 },
+    { 9412, 1, 'n', -1 },
+    { 9413, 1, 'w', -1 },
+    { 9414, 1, 'w', -1 },
+    { 9415, 1, 't', -1 },
+    { 9416, 1, 'A', -1 },
+    { 9417, 1, 'R', -1 },
+    { 9418, 1, 't', -1 },
+    { 9419, 1, 'o', -1 },
+    { 0, 0, ';', 109 },
+    { 9420, 1, 'r', -1 },
+    { 9421, 1, 'B', -1 },
+    { 9422, 1, 'o', -1 },
+    { 9423, 1, 'e', -1 },
+    { 9424, 1, 't', -1 },
+    { 0, 0, ';', 119 },
+    { 9425, 1, 'B', -1 },
+    { 9426, 1, 'c', -1 },
+    { 9427, 2, 'r', -1 },
+    { 9429, 1, 'r', -1 },
+    { 9430, 1, 'S', -1 },
+    { 9431, 1, 'a', -1 },
+    { 9432, 1, 'l', -1 },
+    { 9433, 1, 's', -1 },
+    { 9434, 1, 'a', -1 },
+    { 0, 0, ';', 183 },
+    { 9435, 1, 'u', -1 },
+    { 0, 0, ';', 196 },
+    { 0, 0, ';', 220 },
+    { 0, 0, ';', 221 },
+    { 9436, 1, 'e', -1 },
+    { 9437, 1, 'A', -1 },
+    { 9438, 1, 'k', -1 },
+    { 9439, 1, 't', -1 },
+    { 0, 0, ';', 263 },
+    { 9440, 1, 'B', -1 },
+    { 0, 0, ';', 266 },
+    { 9441, 1, 'r', -1 },
+    { 9442, 1, 'r', -1 },
+    { 9443, 1, 'u', -1 },
+    { 9444, 1, 'o', -1 },
+    { 9445, 1, 'r', -1 },
+    { 9446, 1, 'r', -1 },
+    { 0, 0, ';', 281 },
+    { 9447, 1, 'e', -1 },
+    { 0, 0, ';', 286 },
+    { 9448, 1, 'r', -1 },
+    { 0, 0, ';', 294 },
+    { 9449, 1, 'r', -1 },
+    { 0, 0, ';', 297 },
+    { 0, 0, ';', 299 },
+    { 9450, 1, 'w', -1 },
+    { 9451, 1, 'S', -1 },
+    { 9452, 1, 'p', -1 },
+    { 9453, 1, 'a', -1 },
+    { 9454, 1, 'i', -1 },
+    { 9455, 1, 'r', -1 },
+    { 0, 0, ';', 324 },
+    { 9456, 1, 'c', -1 },
+    { 9457, 1, 'c', -1 },
+    { 9458, 1, 'l', -1 },
+    { 9459, 1, 'E', -1 },
+    { 9460, 1, 't', -1 },
+    { 0, 0, ';', 342 },
+    { 9461, 1, 't', -1 },
+    { 9462, 1, 'e', -1 },
+    { 9463, 1, 'p', -1 },
+    { 9464, 3, 'e', -1 },
+    { 0, 0, ';', 352 },
+    { 9467, 1, 'u', -1 },
+    { 9468, 1, 'e', -1 },
+    { 9469, 1, 'e', -1 },
+    { 9470, 1, 'a', -1 },
+    { 9471, 1, 'n', -1 },
+    { 9472, 1, 'e', -1 },
+    { 9473, 1, 'l', -1 },
+    { 9474, 2, 't', -1 },
+    { 9476, 1, 's', -1 },
+    { 0, 0, ';', 370 },
+    { 9477, 1, 'a', -1 },
+    { 9478, 1, 'n', -1 },
+    { 9479, 1, 'd', -1 },
+    { 9480, 1, 'a', -1 },
+    { 9481, 1, 'u', -1 },
+    { 0, 0, ';', 381 },
+    { 9482, 1, 'e', -1 },
+    { 0, 0, ';', 401 },
+    { 9483, 1, 's', -1 },
+    { 9484, 1, 'q', -1 },
+    { 0, 0, ';', 450 },
+    { 9485, 1, 'r', -1 },
+    { 9486, 1, 'i', -1 },
+    { 9487, 1, 'k', -1 },
+    { 9488, 1, 'A', -1 },
+    { 9489, 1, 'c', -1 },
+    { 9490, 1, 'c', -1 },
+    { 9491, 2, 'r', -1 },
+    { 0, 0, ';', 467 },
+    { 9493, 1, 'a', -1 },
+    { 9494, 1, 'q', -1 },
+    { 9495, 1, 't', -1 },
+    { 9496, 1, 'o', -1 },
+    { 9497, 1, 'a', -1 },
+    { 0, 0, ';', 476 },
+    { 0, 0, ';', 494 },
+    { 0, 0, ';', 495 },
+    { 9498, 1, 'w', -1 },
+    { 9499, 1, 't', -1 },
+    { 9500, 1, 'u', -1 },
+    { 0, 0, ';', 506 },
+    { 9501, 1, 'E', -1 },
+    { 9502, 1, 'q', -1 },
+    { 0, 0, ';', 541 },
+    { 9503, 1, 'i', -1 },
+    { 9504, 1, 'o', -1 },
+    { 0, 0, ';', 578 },
+    { 9505, 1, 'w', -1 },
+    { 9506, 1, 't', -1 },
+    { 0, 0, ';', 629 },
+    { 9507, 1, 'n', -1 },
+    { 9508, 1, 'o', -1 },
+    { 9509, 1, 'e', -1 },
+    { 9510, 1, 'i', -1 },
+    { 9511, 1, 't', -1 },
+    { 9512, 1, 'h', -1 },
+    { 0, 0, ';', 911 },
+    { 9513, 1, 't', -1 },
+    { 0, 0, ';', 964 },
+    { 0, 0, ';', 966 },
+    { 9514, 1, 't', -1 },
+    { 9515, 1, 'h', -1 },
+    { 0, 0, ';', 1170 },
+    { 9516, 1, 'n', -1 },
+    { 0, 0, ';', 1305 },
+    { 0, 0, ';', 1306 },
+    { 9517, 1, 's', -1 },
+    { 9518, 1, 'o', -1 },
+    { 9519, 1, 'a', -1 },
+    { 0, 0, ';', 1310 },
+    { 9520, 1, 'r', -1 },
+    { 0, 0, ';', 1359 },
+    { 0, 0, ';', 1361 },
+    { 9521, 1, 'w', -1 },
+    { 9522, 1, 'w', -1 },
+    { 0, 0, ';', 1561 },
+    { 9523, 1, 'q', -1 },
+    { 0, 0, ';', 1589 },
+    { 9524, 1, 'e', -1 },
+    { 0, 0, ';', 1818 },
+    { 9525, 1, 'w', -1 },
+    { 0, 0, ';', 1820 },
+    { 9526, 1, 's', -1 },
+    { 9527, 1, 'o', -1 },
+    { 9528, 1, 'w', -1 },
+    { 9529, 1, 'w', -1 },
+    { 9530, 1, 's', -1 },
+    { 9531, 1, 'n', -1 },
+    { 0, 0, ';', 2057 },
+    { 9532, 1, 'q', -1 },
+    { 9533, 1, 'o', -1 },
+    { 9534, 1, 'r', -1 },
+    { 0, 0, ';', 2107 },
+    { 9535, 1, 't', -1 },
+    { 9536, 1, 'h', -1 },
+    { 9537, 1, 't', -1 },
+    { 9538, 1, 'r', -1 },
+    { 9539, 1, 'e', -1 },
+    { 0, 0, ';', 62 },
+    { 0, 0, ';', 67 },
+    { 9540, 1, 'e', -1 },
+    { 9541, 1, 'e', -1 },
+    { 9542, 1, 'l', -1 },
+    { 9543, 1, 'e', -1 },
+    { 9544, 1, 'e', -1 },
+    { 9545, 1, 't', -1 },
+    { 0, 0, ';', 101 },
+    { 0, 0, ';', 102 },
+    { 9546, 1, 'A', -1 },
+    { 9547, 1, 'r', -1 },
+    { 9548, 1, 'i', -1 },
+    { 9549, 1, 'A', -1 },
+    { 9550, 1, 'w', -1 },
+    { 9551, 1, 'o', -1 },
+    { 9552, 1, 'a', -1 },
+    { 9553, 1, 'w', -1 },
+    { 9554, 1, 'c', -1 },
+    { 9555, 1, 'o', -1 },
+    { 9556, 1, 'a', -1 },
+    { 9557, 1, 't', -1 },
+    { 0, 0, ';', 122 },
+    { 9558, 1, 'B', -1 },
+    { 9559, 1, 'e', -1 },
+    { 9560, 1, 'q', -1 },
+    { 9561, 1, 'r', -1 },
+    { 9562, 1, 'S', -1 },
+    { 9563, 1, 's', -1 },
+    { 9564, 1, 'l', -1 },
+    { 9565, 1, 'a', -1 },
+    { 9566, 1, 't', -1 },
+    { 9567, 1, 'r', -1 },
+    { 9568, 1, 'e', -1 },
+    { 9569, 1, 'o', -1 },
+    { 9570, 1, 'a', -1 },
+    { 0, 0, ';', 267 },
+    { 0, 0, ';', 272 },
+    { 9571, 1, 'a', -1 },
+    { 9572, 1, 'r', -1 },
+    { 0, 0, ';', 275 },
+    { 0, 0, ';', 277 },
+    { 9573, 1, 'r', -1 },
+    { 9574, 1, 'r', -1 },
+    { 9575, 1, 'r', -1 },
+    { 0, 0, ';', 300 },
+    { 9576, 1, 'p', -1 },
+    { 9577, 1, 'a', -1 },
+    { 9578, 1, 'c', -1 },
+    { 9579, 1, 'n', -1 },
+    { 9580, 1, 'e', -1 },
+    { 9581, 1, 'e', -1 },
+    { 9582, 1, 'a', -1 },
+    { 0, 0, ';', 339 },
+    { 9583, 1, 'q', -1 },
+    { 9584, 1, 'e', -1 },
+    { 9585, 1, 'E', -1 },
+    { 0, 0, ';', 344 },
+    { 0, 0, ';', 345 },
+    { 0, 0, ';', 347 },
+    { 9586, 1, 'B', -1 },
+    { 9587, 1, 'E', -1 },
+    { 9588, 1, 'a', -1 },
+    { 9589, 1, 'r', -1 },
+    { 9590, 1, 's', -1 },
+    { 9591, 1, 'l', -1 },
+    { 9592, 1, 't', -1 },
+    { 9593, 1, 'n', -1 },
+    { 9594, 3, 'e', -1 },
+    { 0, 0, ';', 365 },
+    { 9597, 1, 'E', -1 },
+    { 9598, 1, 'e', -1 },
+    { 9599, 1, 'l', -1 },
+    { 9600, 1, 't', -1 },
+    { 9601, 1, 'e', -1 },
+    { 9602, 1, 'l', -1 },
+    { 9603, 1, 'a', -1 },
+    { 9604, 1, 'Q', -1 },
+    { 0, 0, ';', 414 },
+    { 9605, 1, 'u', -1 },
+    { 9606, 1, 'i', -1 },
+    { 9607, 1, 'b', -1 },
+    { 9608, 1, 'e', -1 },
+    { 9609, 1, 'r', -1 },
+    { 9610, 1, 'k', -1 },
+    { 9611, 1, 't', -1 },
+    { 0, 0, ';', 462 },
+    { 9612, 1, 'B', -1 },
+    { 9613, 1, 'r', -1 },
+    { 9614, 1, 'u', -1 },
+    { 9615, 1, 'o', -1 },
+    { 9616, 1, 'r', -1 },
+    { 9617, 1, 'r', -1 },
+    { 0, 0, ';', 496 },
+    { 9618, 1, 'i', -1 },
+    { 9619, 1, 'a', -1 },
+    { 9620, 1, 'q', -1 },
+    { 9621, 1, 'u', -1 },
+    { 9622, 1, 's', -1 },
+    { 9623, 1, 'w', -1 },
+    { 0, 0, ';', 579 },
+    { 9624, 1, 'o', -1 },
+    { 0, 0, ';', 734 },
+    { 9625, 1, 'w', -1 },
+    { 9626, 1, 'f', -1 },
+    { 9627, 1, 'g', -1 },
+    { 0, 0, ';', 852 },
+    { 9628, 1, 't', -1 },
+    { 0, 0, ';', 912 },
+    { 0, 0, ';', 967 },
+    { 9629, 1, 't', -1 },
+    { 0, 0, ';', 1303 },
+    { 0, 0, ';', 1307 },
+    { 9630, 1, 'n', -1 },
+    { 9631, 1, 'r', -1 },
+    { 9632, 1, 'r', -1 },
+    { 0, 0, ';', 1450 },
+    { 0, 0, ';', 1515 },
+    { 0, 0, ';', 1588 },
+    { 9633, 1, 'q', -1 },
+    { 9634, 1, 'n', -1 },
+    { 0, 0, ';', 1821 },
+    { 9635, 1, 'n', -1 },
+    { 9636, 1, 's', -1 },
+    { 0, 0, ';', 1824 },
+    { 0, 0, ';', 1825 },
+    { 0, 0, ';', 1952 },
+    { 0, 0, ';', 2060 },
+    { 9637, 1, 'w', -1 },
+    { 9638, 1, 'o', -1 },
+    { 0, 0, ';', 2146 },
+    { 9639, 1, 't', -1 },
+    { 9640, 1, 'i', -1 },
+    { 9641, 1, 'I', -1 },
+    { 9642, 1, 'Q', -1 },
+    { 9643, 1, 'C', -1 },
+    { 0, 0, ';', 88 },
+    { 9644, 1, 'e', -1 },
+    { 0, 0, ';', 91 },
+    { 0, 0, ';', 92 },
+    { 9645, 1, 'e', -1 },
+    { 9646, 1, 'r', -1 },
+    { 9647, 1, 'r', -1 },
+    { 9648, 1, 'g', -1 },
+    { 9649, 1, 'r', -1 },
+    { 0, 0, ';', 108 },
+    { 9650, 1, 'w', -1 },
+    { 9651, 1, 'r', -1 },
+    { 0, 0, ';', 115 },
+    { 9652, 1, 't', -1 },
+    { 9653, 1, 'r', -1 },
+    { 9654, 1, 'r', -1 },
+    { 9655, 1, 'o', -1 },
+    { 9656, 1, 'a', -1 },
+    { 0, 0, ';', 144 },
+    { 9657, 1, 'u', -1 },
+    { 9658, 1, 'e', -1 },
+    { 9659, 1, 'q', -1 },
+    { 0, 0, ';', 181 },
+    { 0, 0, ';', 182 },
+    { 9660, 1, 'l', -1 },
+    { 0, 0, ';', 256 },
+    { 9661, 1, 'r', -1 },
+    { 9662, 1, 't', -1 },
+    { 9663, 1, 'r', -1 },
+    { 9664, 1, 'r', -1 },
+    { 9665, 1, 'l', -1 },
+    { 0, 0, ';', 274 },
+    { 0, 0, ';', 282 },
+    { 9666, 1, 'o', -1 },
+    { 9667, 1, 'o', -1 },
+    { 9668, 1, 'a', -1 },
+    { 9669, 1, 'c', -1 },
+    { 9670, 1, 'e', -1 },
+    { 9671, 1, 'S', -1 },
+    { 9672, 1, 'a', -1 },
+    { 0, 0, ';', 328 },
+    { 9673, 1, 'l', -1 },
+    { 9674, 1, 'u', -1 },
+    { 9675, 1, 'r', -1 },
+    { 9676, 1, 'q', -1 },
+    { 9677, 1, 'a', -1 },
+    { 9678, 1, 'q', -1 },
+    { 9679, 1, 'l', -1 },
+    { 9680, 1, 'G', -1 },
+    { 9681, 1, 's', -1 },
+    { 0, 0, ';', 359 },
+    { 9682, 1, 'E', -1 },
+    { 9683, 1, 't', -1 },
+    { 0, 0, ';', 362 },
+    { 9684, 1, 'B', -1 },
+    { 9685, 1, 'E', -1 },
+    { 9686, 1, 'q', -1 },
+    { 9687, 2, 't', -1 },
+    { 0, 0, ';', 372 },
+    { 9689, 1, 'E', -1 },
+    { 0, 0, ';', 374 },
+    { 0, 0, ';', 376 },
+    { 9690, 1, 'l', -1 },
+    { 9691, 1, 'u', -1 },
+    { 9692, 1, 'a', -1 },
+    { 9693, 1, 'u', -1 },
+    { 9694, 1, 'r', -1 },
+    { 9695, 1, 't', -1 },
+    { 9696, 1, 'r', -1 },
+    { 9697, 1, 'e', -1 },
+    { 9698, 1, 'o', -1 },
+    { 9699, 1, 'a', -1 },
+    { 0, 0, ';', 469 },
+    { 9700, 1, 'a', -1 },
+    { 9701, 1, 'r', -1 },
+    { 0, 0, ';', 472 },
+    { 0, 0, ';', 474 },
+    { 9702, 1, 'o', -1 },
+    { 9703, 1, 'l', -1 },
+    { 9704, 1, 'u', -1 },
+    { 9705, 1, 'a', -1 },
+    { 0, 0, ';', 564 },
+    { 0, 0, ';', 571 },
+    { 9706, 1, 'r', -1 },
+    { 9707, 1, 'n', -1 },
+    { 9708, 1, 't', -1 },
+    { 9709, 1, 'h', -1 },
+    { 0, 0, ';', 853 },
+    { 0, 0, ';', 968 },
+    { 9710, 1, 's', -1 },
+    { 9711, 1, 'r', -1 },
+    { 9712, 1, 'o', -1 },
+    { 0, 0, ';', 1590 },
+    { 0, 0, ';', 1819 },
+    { 9713, 1, 's', -1 },
+    { 0, 0, ';', 1823 },
+    { 0, 0, ';', 2073 },
+    { 9714, 1, 'w', -1 },
+    { 0, 0, ';', 2147 },
+    { 9715, 1, 'a', -1 },
+    { 9716, 1, 'n', -1 },
+    { 9717, 1, 'u', -1 },
+    { 9718, 1, 'o', -1 },
+    { 9719, 1, 'A', -1 },
+    { 9720, 1, 'g', -1 },
+    { 9721, 1, 'r', -1 },
+    { 9722, 1, 'o', -1 },
+    { 9723, 1, 'h', -1 },
+    { 9724, 1, 'r', -1 },
+    { 0, 0, ';', 111 },
+    { 0, 0, ';', 112 },
+    { 9725, 1, 'o', -1 },
+    { 0, 0, ';', 118 },
+    { 0, 0, ';', 120 },
+    { 9726, 1, 'r', -1 },
+    { 9727, 1, 'r', -1 },
+    { 9728, 1, 'a', -1 },
+    { 0, 0, ';', 161 },
+    { 9729, 1, 'u', -1 },
+    { 0, 0, ';', 185 },
+    { 9730, 1, 'o', -1 },
+    { 0, 0, ';', 261 },
+    { 0, 0, ';', 262 },
+    { 0, 0, ';', 264 },
+    { 0, 0, ';', 273 },
+    { 9731, 1, 'w', -1 },
+    { 9732, 1, 'w', -1 },
+    { 9733, 1, 'c', -1 },
+    { 9734, 1, 'e', -1 },
+    { 0, 0, ';', 321 },
+    { 9735, 1, 'p', -1 },
+    { 9736, 1, 't', -1 },
+    { 9737, 1, 'B', -1 },
+    { 9738, 1, 'a', -1 },
+    { 0, 0, ';', 341 },
+    { 9739, 1, 'u', -1 },
+    { 9740, 1, 'r', -1 },
+    { 9741, 1, 'u', -1 },
+    { 0, 0, ';', 354 },
+    { 9742, 1, 'r', -1 },
+    { 0, 0, ';', 357 },
+    { 9743, 1, 'q', -1 },
+    { 0, 0, ';', 361 },
+    { 9744, 1, 'a', -1 },
+    { 9745, 1, 'q', -1 },
+    { 9746, 1, 'u', -1 },
+    { 0, 0, ';', 367 },
+    { 9747, 1, 'E', -1 },
+    { 9748, 1, 'q', -1 },
+    { 0, 0, ';', 379 },
+    { 9749, 1, 'o', -1 },
+    { 9750, 1, 'l', -1 },
+    { 9751, 1, 'm', -1 },
+    { 9752, 1, 'i', -1 },
+    { 0, 0, ';', 455 },
+    { 9753, 1, 'o', -1 },
+    { 9754, 1, 't', -1 },
+    { 9755, 1, 'r', -1 },
+    { 9756, 1, 'r', -1 },
+    { 9757, 1, 'l', -1 },
+    { 0, 0, ';', 471 },
+    { 9758, 1, 'n', -1 },
+    { 0, 0, ';', 505 },
+    { 9759, 1, 'a', -1 },
+    { 9760, 1, 'l', -1 },
+    { 0, 0, ';', 597 },
+    { 0, 0, ';', 743 },
+    { 0, 0, ';', 744 },
+    { 9761, 1, 't', -1 },
+    { 0, 0, ';', 1308 },
+    { 9762, 1, 'o', -1 },
+    { 9763, 1, 'w', -1 },
+    { 0, 0, ';', 1822 },
+    { 0, 0, ';', 2074 },
+    { 9764, 1, 'l', -1 },
+    { 9765, 1, 't', -1 },
+    { 9766, 1, 'o', -1 },
+    { 9767, 1, 'n', -1 },
+    { 9768, 1, 'c', -1 },
+    { 9769, 1, 'r', -1 },
+    { 9770, 1, 'o', -1 },
+    { 9771, 1, 'w', -1 },
+    { 9772, 1, 't', -1 },
+    { 9773, 1, 'o', -1 },
+    { 9774, 1, 'r', -1 },
+    { 0, 0, ';', 121 },
+    { 0, 0, ';', 123 },
+    { 9775, 1, 'r', -1 },
+    { 9776, 1, 'a', -1 },
+    { 9777, 1, 'w', -1 },
+    { 0, 0, ';', 293 },
+    { 0, 0, ';', 296 },
+    { 9778, 1, 'e', -1 },
+    { 0, 0, ';', 320 },
+    { 9779, 1, 'a', -1 },
+    { 9780, 1, 'e', -1 },
+    { 9781, 1, 'a', -1 },
+    { 9782, 1, 'l', -1 },
+    { 9783, 1, 'a', -1 },
+    { 0, 0, ';', 348 },
+    { 9784, 1, 'a', -1 },
+    { 9785, 1, 'e', -1 },
+    { 9786, 1, 'u', -1 },
+    { 9787, 1, 'r', -1 },
+    { 9788, 1, 'u', -1 },
+    { 9789, 1, 'a', -1 },
+    { 9790, 1, 'q', -1 },
+    { 9791, 1, 'u', -1 },
+    { 9792, 1, 't', -1 },
+    { 0, 0, ';', 426 },
+    { 0, 0, ';', 451 },
+    { 9793, 1, 'u', -1 },
+    { 9794, 1, 'w', -1 },
+    { 0, 0, ';', 460 },
+    { 0, 0, ';', 461 },
+    { 0, 0, ';', 463 },
+    { 0, 0, ';', 470 },
+    { 0, 0, ';', 503 },
+    { 9795, 1, 'l', -1 },
+    { 0, 0, ';', 516 },
+    { 0, 0, ';', 745 },
+    { 9796, 1, 'w', -1 },
+    { 0, 0, ';', 1357 },
+    { 9797, 1, 'D', -1 },
+    { 9798, 1, 'e', -1 },
+    { 9799, 1, 't', -1 },
+    { 9800, 1, 't', -1 },
+    { 9801, 1, 'u', -1 },
+    { 9802, 1, 'a', -1 },
+    { 9803, 1, 'w', -1 },
+    { 0, 0, ';', 105 },
+    { 9804, 1, 'A', -1 },
+    { 9805, 1, 'w', -1 },
+    { 0, 0, ';', 117 },
+    { 9806, 1, 'e', -1 },
+    { 9807, 1, 'r', -1 },
+    { 0, 0, ';', 259 },
+    { 0, 0, ';', 319 },
+    { 9808, 1, 'c', -1 },
+    { 9809, 1, 'r', -1 },
+    { 9810, 1, 'r', -1 },
+    { 0, 0, ';', 340 },
+    { 9811, 1, 'l', -1 },
+    { 9812, 1, 'l', -1 },
+    { 9813, 1, 'a', -1 },
+    { 9814, 1, 'a', -1 },
+    { 0, 0, ';', 363 },
+    { 9815, 1, 'a', -1 },
+    { 9816, 1, 'l', -1 },
+    { 9817, 1, 'u', -1 },
+    { 9818, 1, 'a', -1 },
+    { 9819, 1, 'e', -1 },
+    { 9820, 1, 'm', -1 },
+    { 0, 0, ';', 458 },
+    { 0, 0, ';', 507 },
+    { 0, 0, ';', 1309 },
+    { 0, 0, ';', 44 },
+    { 9821, 1, 'g', -1 },
+    { 9822, 1, 'e', -1 },
+    { 9823, 1, 'o', -1 },
+    { 9824, 1, 't', -1 },
+    { 9825, 1, 'l', -1 },
+    { 0, 0, ';', 103 },
+    { 9826, 1, 'r', -1 },
+    { 0, 0, ';', 107 },
+    { 0, 0, ';', 145 },
+    { 9827, 1, 'e', -1 },
+    { 9828, 1, 'e', -1 },
+    { 0, 0, ';', 323 },
+    { 0, 0, ';', 333 },
+    { 0, 0, ';', 343 },
+    { 0, 0, ';', 349 },
+    { 9829, 1, 't', -1 },
+    { 9830, 1, 'l', -1 },
+    { 9831, 1, 'l', -1 },
+    { 0, 0, ';', 366 },
+    { 9832, 1, 'a', -1 },
+    { 9833, 1, 'l', -1 },
+    { 0, 0, ';', 400 },
+    { 0, 0, ';', 452 },
+    { 9834, 1, 'r', -1 },
+    { 0, 0, ';', 61 },
+    { 9835, 1, 'u', -1 },
+    { 9836, 1, 'e', -1 },
+    { 0, 0, ';', 99 },
+    { 9837, 1, 'r', -1 },
+    { 0, 0, ';', 162 },
+    { 0, 0, ';', 322 },
+    { 9838, 1, 'e', -1 },
+    { 0, 0, ';', 360 },
+    { 0, 0, ';', 364 },
+    { 9839, 1, 'l', -1 },
+    { 0, 0, ';', 373 },
+    { 9840, 1, 'a', -1 },
+    { 9841, 1, 'r', -1 },
+    { 0, 0, ';', 90 },
+    { 9842, 1, 'o', -1 },
+    { 9843, 1, 'r', -1 },
+    { 0, 0, ';', 368 },
+    { 9844, 1, 'l', -1 },
+    { 9845, 1, 'I', -1 },
+    { 9846, 1, 'w', -1 },
+    { 0, 0, ';', 356 },
+    { 0, 0, ';', 60 },
+    { 9847, 1, 'n', -1 },
+    { 0, 0, ';', 106 },
+    { 9848, 1, 't', -1 },
+    { 9849, 1, 'e', -1 },
+    { 9850, 1, 'g', -1 },
+    { 9851, 1, 'r', -1 },
+    { 9852, 1, 'a', -1 },
+    { 9853, 1, 'l', -1 },
+    { 0, 0, ';', 70 },
+};
+
+static const int16_t kCommonEntities[32] = {
+    1849, // &rsquo;
+    880, // &copy;
+    -1,
+    -1,
+    688, // &apos;
+    -1,
+    1268, // &laquo;
+    -1,
+    1808, // &reg;
+    1295, // &ldquo;
+    1754, // &quot;
+    -1,
+    -1,
+    2053, // &trade;
+    1769, // &raquo;
+    1135, // &gt;
+    1430, // &middot;
+    1799, // &rdquo;
+    2040, // &times;
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1386, // &lsquo;
+    -1,
+    1479, // &ndash;
+    1390, // &lt;
+    1162, // &hellip;
+    657, // &amp;
+    1420, // &mdash;
+    1469, // &nbsp;
+};
+
+const HTMLEntityTrie::Node* HTMLEntityTrie::Child(const Node *node, UChar c)
+{
+    const Node *left = kNodes + node->firstChild;
+    const Node *right = left + node->childCount;
+    while (left < right)
+    {
+        const Node *probe = left + (right - left) / 2;
+        if (probe->character == c)
+            return probe;
+        if (probe->character < c)
+            left = probe + 1;
+        else
+            right = probe;
+    }
+    return nullptr;
+}
+
+const HTMLEntityTableEntry* HTMLEntityTrie::FindCommonEntity(const LChar *name, unsigned length)
+{
+    if (length < 3 || length > kMaxCommonEntityLength)
+        return nullptr;
+
+    unsigned h = (name[0] * 28 + name[1] * 1 + name[length - 2] + length) & 31;
+    if (kCommonEntities[h] < 0)
+        return nullptr;
+
+    const HTMLEntityTableEntry *entry = HTMLEntityTable::FirstEntry() + kCommonEntities[h];
+    if (entry->length != static_cast<short>(length) || 0 != memcmp(HTMLEntityTable::EntityString(*entry), name, length))
+        return nullptr;
+    return entry;
+}
+
+const HTMLEntityTrie::Node* HTMLEntityTrie::Root(void)
+{
+    return kNodes;
+}
+
+} // namespace blink
@@ -0,0 +1,51 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: html_entity_trie.h
+// Description: HTMLEntityTrie Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_HTML_ENTITY_TRIE_H
+#define BLINKIT_BLINK_HTML_ENTITY_TRIE_H
+
+#pragma once
+
+#include "third_party/blink/renderer/core/html/parser/html_entity_table.h"
+
+namespace blink {
+
+// A trie over the names in HTMLEntityTable, generated by
+// scripts/html_entity_trie.cpp.php. Matching a name takes one step per
+// character, and the deepest node with an entry is the longest match.
+class HTMLEntityTrie
+{
+    STATIC_ONLY(HTMLEntityTrie);
+public:
+    struct Node
+    {
+        uint16_t firstChild;
+        uint8_t childCount;
+        LChar character;
+        int16_t entry; // Index in HTMLEntityTable, or -1.
+    };
+
+    static const Node* Root(void);
+    static const Node* Child(const Node *node, UChar c);
+    static const HTMLEntityTableEntry* Entry(const Node *node)
+    {
+        return node->entry >= 0 ? HTMLEntityTable::FirstEntry() + node->entry : nullptr;
+    }
+
+    // Fast path for the most common entities, looked up with a perfect hash.
+    // |name| must include the trailing ';'.
+    static const HTMLEntityTableEntry* FindCommonEntity(const LChar *name, unsigned length);
+    static constexpr unsigned kMaxCommonEntityLength = 7;
+};
+
+} // namespace blink
+
+#endif // BLINKIT_BLINK_HTML_ENTITY_TRIE_H
@@ -138,70 +138,75 @@ const HTMLQualifiedName &kXmpTag = reinterpret_cast<HTMLQualifiedName *>(&tag_st
 static void* attr_storage[kAttrsCount * ((sizeof(QualifiedName) + sizeof(void *) - 1) / sizeof(void *))];
 const QualifiedName &kAcceptAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[0];
 const QualifiedName &kAcceptCharsetAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[1];
-const QualifiedName &kAlignAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[2];
-const QualifiedName &kAlinkAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[3];
-const QualifiedName &kAxisAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[4];
-const QualifiedName &kBgcolorAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[5];
-const QualifiedName &kCharsetAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[6];
-const QualifiedName &kCheckedAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[7];
-const QualifiedName &kClassAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[8];
-const QualifiedName &kClearAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[9];
-const QualifiedName &kCodetypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[10];
-const QualifiedName &kColorAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[11];
-const QualifiedName &kCompactAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[12];
-const QualifiedName &kContentAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[13];
-const QualifiedName &kDeclareAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[14];
-const QualifiedName &kDeferAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[15];
-const QualifiedName &kDirAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[16];
-const QualifiedName &kDirectionAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[17];
-const QualifiedName &kDisabledAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[18];
-const QualifiedName &kEnctypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[19];
-const QualifiedName &kEventAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[20];
-const QualifiedName &kFaceAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[21];
-const QualifiedName &kForAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[22];
-const QualifiedName &kFormAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[23];
-const QualifiedName &kFrameAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[24];
-const QualifiedName &kHrefAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[25];
-const QualifiedName &kHreflangAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[26];
-const QualifiedName &kHttpEquivAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[27];
-const QualifiedName &kIdAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[28];
-const QualifiedName &kIsAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[29];
-const QualifiedName &kLabelAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[30];
-const QualifiedName &kLangAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[31];
-const QualifiedName &kLanguageAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[32];
-const QualifiedName &kLinkAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[33];
-const QualifiedName &kMediaAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[34];
-const QualifiedName &kMethodAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[35];
-const QualifiedName &kMultipleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[36];
-const QualifiedName &kNameAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[37];
-const QualifiedName &kNohrefAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[38];
-const QualifiedName &kNomoduleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[39];
-const QualifiedName &kNoresizeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[40];
-const QualifiedName &kNoshadeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[41];
-const QualifiedName &kNowrapAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[42];
-const QualifiedName &kObjectAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[43];
-const QualifiedName &kReadonlyAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[44];
-const QualifiedName &kReferrerpolicyAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[45];
-const QualifiedName &kRelAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[46];
-const QualifiedName &kRevAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[47];
-const QualifiedName &kRulesAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[48];
-const QualifiedName &kScopeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[49];
-const QualifiedName &kScrollingAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[50];
-const QualifiedName &kSelectAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[51];
-const QualifiedName &kSelectedAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[52];
-const QualifiedName &kShapeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[53];
-const QualifiedName &kSizeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[54];
-const QualifiedName &kSpanAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[55];
-const QualifiedName &kSrcAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[56];
-const QualifiedName &kStyleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[57];
-const QualifiedName &kSummaryAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[58];
-const QualifiedName &kTargetAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[59];
-const QualifiedName &kTextAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[60];
-const QualifiedName &kTitleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[61];
-const QualifiedName &kTypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[62];
-const QualifiedName &kValignAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[63];
-const QualifiedName &kValuetypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[64];
-const QualifiedName &kVlinkAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[65];
+const QualifiedName &kActionAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[2];
+const QualifiedName &kAlignAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[3];
+const QualifiedName &kAlinkAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[4];
+const QualifiedName &kAsyncAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[5];
+const QualifiedName &kAxisAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[6];
+const QualifiedName &kBgcolorAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[7];
+const QualifiedName &kCharsetAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[8];
+const QualifiedName &kCheckedAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[9];
+const QualifiedName &kClassAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[10];
+const QualifiedName &kClearAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[11];
+const QualifiedName &kCodetypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[12];
+const QualifiedName &kColorAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[13];
+const QualifiedName &kCompactAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[14];
+const QualifiedName &kContentAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[15];
+const QualifiedName &kDeclareAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[16];
+const QualifiedName &kDeferAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[17];
+const QualifiedName &kDirAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[18];
+const QualifiedName &kDirectionAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[19];
+const QualifiedName &kDisabledAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[20];
+const QualifiedName &kEnctypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[21];
+const QualifiedName &kEventAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[22];
+const QualifiedName &kFaceAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[23];
+const QualifiedName &kForAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[24];
+const QualifiedName &kFormAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[25];
+const QualifiedName &kFrameAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[26];
+const QualifiedName &kHiddenAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[27];
+const QualifiedName &kHrefAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[28];
+const QualifiedName &kHreflangAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[29];
+const QualifiedName &kHttpEquivAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[30];
+const QualifiedName &kIdAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[31];
+const QualifiedName &kIsAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[32];
+const QualifiedName &kLabelAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[33];
+const QualifiedName &kLangAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[34];
+const QualifiedName &kLanguageAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[35];
+const QualifiedName &kLinkAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[36];
+const QualifiedName &kMediaAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[37];
+const QualifiedName &kMethodAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[38];
+const QualifiedName &kMultipleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[39];
+const QualifiedName &kNameAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[40];
+const QualifiedName &kNohrefAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[41];
+const QualifiedName &kNomoduleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[42];
+const QualifiedName &kNoresizeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[43];
+const QualifiedName &kNoshadeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[44];
+const QualifiedName &kNowrapAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[45];
+const QualifiedName &kObjectAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[46];
+const QualifiedName &kPosterAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[47];
+const QualifiedName &kReadonlyAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[48];
+const QualifiedName &kReferrerpolicyAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[49];
+const QualifiedName &kRelAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[50];
+const QualifiedName &kRevAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[51];
+const QualifiedName &kRulesAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[52];
+const QualifiedName &kScopeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[53];
+const QualifiedName &kScrollingAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[54];
+const QualifiedName &kSelectAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[55];
+const QualifiedName &kSelectedAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[56];
+const QualifiedName &kShapeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[57];
+const QualifiedName &kSizeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[58];
+const QualifiedName &kSpanAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[59];
+const QualifiedName &kSrcAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[60];
+const QualifiedName &kSrcsetAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[61];
+const QualifiedName &kStyleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[62];
+const QualifiedName &kSummaryAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[63];
+const QualifiedName &kTargetAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[64];
+const QualifiedName &kTextAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[65];
+const QualifiedName &kTitleAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[66];
+const QualifiedName &kTypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[67];
+const QualifiedName &kValignAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[68];
+const QualifiedName &kValuetypeAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[69];
+const QualifiedName &kVlinkAttr = reinterpret_cast<QualifiedName *>(&attr_storage)[70];
 
 void Init(void)
 {
@@ -223,6 +228,7 @@ void Init(void)
         { "a", 9778235, 1, 1, 0 },
         { "accept", 4839857, 6, 0, 1 },
         { "accept-charset", 5192676, 14, 0, 1 },
+        { "action", 14878034, 6, 0, 1 },
         { "address", 10008206, 7, 1, 0 },
         { "align", 10094397, 5, 0, 1 },
         { "alink", 2408650, 5, 0, 1 },
@@ -230,6 +236,7 @@ void Init(void)
         { "area", 7355486, 4, 1, 0 },
         { "article", 2968800, 7, 1, 0 },
         { "aside", 10128566, 5, 1, 0 },
+        { "async", 2556481, 5, 0, 1 },
         { "axis", 14347904, 4, 0, 1 },
         { "b", 7170995, 1, 1, 0 },
         { "base", 4376626, 4, 1, 0 },
@@ -288,6 +295,7 @@ void Init(void)
         { "head", 11457121, 4, 1, 0 },
         { "header", 5896178, 6, 1, 0 },
         { "hgroup", 8927907, 6, 1, 0 },
+        { "hidden", 12930326, 6, 0, 1 },
         { "hr", 7182703, 2, 1, 0 },
         { "href", 5797448, 4, 0, 1 },
         { "hreflang", 12582042, 8, 0, 1 },
@@ -332,6 +340,7 @@ void Init(void)
         { "p", 587733, 1, 1, 0 },
         { "param", 15210019, 5, 1, 0 },
         { "plaintext", 2551274, 9, 1, 0 },
+        { "poster", 2570443, 6, 0, 1 },
         { "pre", 16061734, 3, 1, 0 },
         { "rb", 4749743, 2, 1, 0 },
         { "readonly", 4471832, 8, 0, 1 },
@@ -356,6 +365,7 @@ void Init(void)
         { "source", 341674, 6, 1, 0 },
         { "span", 11168892, 4, 1, 1 },
         { "src", 11517827, 3, 0, 1 },
+        { "srcset", 6236095, 6, 0, 1 },
         { "strike", 15072495, 6, 1, 0 },
         { "strong", 13282129, 6, 1, 0 },
         { "style", 10993676, 5, 1, 1 },
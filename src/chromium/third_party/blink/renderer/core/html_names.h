@@ -143,8 +143,10 @@ constexpr unsigned kTagsCount = 112;
 // Attributes
 extern const blink::QualifiedName &kAcceptAttr;
 extern const blink::QualifiedName &kAcceptCharsetAttr;
+extern const blink::QualifiedName &kActionAttr;
 extern const blink::QualifiedName &kAlignAttr;
 extern const blink::QualifiedName &kAlinkAttr;
+extern const blink::QualifiedName &kAsyncAttr;
 extern const blink::QualifiedName &kAxisAttr;
 extern const blink::QualifiedName &kBgcolorAttr;
 extern const blink::QualifiedName &kCharsetAttr;
@@ -166,6 +168,7 @@ extern const blink::QualifiedName &kFaceAttr;
 extern const blink::QualifiedName &kForAttr;
 extern const blink::QualifiedName &kFormAttr;
 extern const blink::QualifiedName &kFrameAttr;
+extern const blink::QualifiedName &kHiddenAttr;
 extern const blink::QualifiedName &kHrefAttr;
 extern const blink::QualifiedName &kHreflangAttr;
 extern const blink::QualifiedName &kHttpEquivAttr;
@@ -185,6 +188,7 @@ extern const blink::QualifiedName &kNoresizeAttr;
 extern const blink::QualifiedName &kNoshadeAttr;
 extern const blink::QualifiedName &kNowrapAttr;
 extern const blink::QualifiedName &kObjectAttr;
+extern const blink::QualifiedName &kPosterAttr;
 extern const blink::QualifiedName &kReadonlyAttr;
 extern const blink::QualifiedName &kReferrerpolicyAttr;
 extern const blink::QualifiedName &kRelAttr;
@@ -198,6 +202,7 @@ extern const blink::QualifiedName &kShapeAttr;
 extern const blink::QualifiedName &kSizeAttr;
 extern const blink::QualifiedName &kSpanAttr;
 extern const blink::QualifiedName &kSrcAttr;
+extern const blink::QualifiedName &kSrcsetAttr;
 extern const blink::QualifiedName &kStyleAttr;
 extern const blink::QualifiedName &kSummaryAttr;
 extern const blink::QualifiedName &kTargetAttr;
@@ -208,7 +213,7 @@ extern const blink::QualifiedName &kValignAttr;
 extern const blink::QualifiedName &kValuetypeAttr;
 extern const blink::QualifiedName &kVlinkAttr;
 
-constexpr unsigned kAttrsCount = 66;
+constexpr unsigned kAttrsCount = 71;
 
 void Init(void);
 
@@ -15,6 +15,7 @@
 
 #include "base_fetch_context.h"
 
+#include "blinkit/crawler/crawler_impl.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource.h"
 
 using namespace BlinKit;
@@ -83,6 +84,13 @@ std::optional<ResourceRequestBlockedReason> BaseFetchContext::CanRequest(
         }
     }
 
+    if (ResourceType::kMainResource != type)
+    {
+        CrawlerImpl *crawler = resourceRequest.Crawler();
+        if (nullptr != crawler && !crawler->AllowsRequest(type, url))
+            return ResourceRequestBlockedReason::kSubresourceFilter;
+    }
+
     return std::nullopt;
 }
 
@@ -41,6 +41,8 @@
 
 #include "frame_fetch_context.h"
 
+#include "blinkit/crawler/crawler_impl.h"
+#include "blinkit/crawler/crawler_metrics.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/core/frame/local_frame_client.h"
@@ -126,6 +128,12 @@ void FrameFetchContext::DidLoadResource(Resource *resource)
         m_document->CheckCompleted();
 }
 
+void FrameFetchContext::DispatchDidLoadResourceFromMemoryCache(const ResourceRequest &request)
+{
+    if (CrawlerImpl *crawler = request.Crawler())
+        crawler->Metrics().DidLoadFromMemoryCache();
+}
+
 void FrameFetchContext::DispatchDidReceiveResponse(
     unsigned long identifier,
     const ResourceResponse &response,
@@ -85,6 +85,7 @@ private:
     void DispatchDidReceiveResponse(unsigned long identifier, const ResourceResponse &response,
         Resource *resource) override;
     void DidLoadResource(Resource *resource) override;
+    void DispatchDidLoadResourceFromMemoryCache(const ResourceRequest &request) override;
     FetchContext* Detach(void) override;
     // BaseFetchContext overrides
     const FetchClientSettingsObject* GetFetchClientSettingsObject(void) const override { return m_fetchClientSettingsObject.get(); }
@@ -73,18 +73,39 @@ std::shared_ptr<ScriptResource> ScriptResource::Fetch(FetchParameters &params, R
     return ToScriptResource(resource);
 }
 
+std::shared_ptr<const std::string> ScriptResource::DecodedBodyForMemoryCache(void)
+{
+    return SharedSourceText();
+}
+
+std::shared_ptr<const std::string> ScriptResource::SharedSourceText(void)
+{
+    SourceText();
+    return m_sourceText;
+}
+
+void ScriptResource::RestoreFromMemoryCache(const MemoryCache::Entry &entry)
+{
+    TextResource::RestoreFromMemoryCache(entry);
+    m_sourceText = entry.body;
+}
+
 const std::string& ScriptResource::SourceText(void)
 {
     ASSERT(IsLoaded());
 
-    if (m_sourceText.empty() && Data())
+    if (!m_sourceText)
     {
-        String sourceText = DecodedText();
-        ClearData();
-        m_sourceText = sourceText.StdUtf8();
+        std::string sourceText;
+        if (Data())
+        {
+            sourceText = DecodedText().StdUtf8();
+            ClearData();
+        }
+        m_sourceText = std::make_shared<const std::string>(std::move(sourceText));
     }
 
-    return m_sourceText;
+    return *m_sourceText;
 }
 
 }  // namespace blink
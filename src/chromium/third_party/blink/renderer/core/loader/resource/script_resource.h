@@ -56,6 +56,11 @@ public:
     ~ScriptResource(void) override;
 
     const std::string& SourceText(void);
+    // Same as SourceText, for the users which may outlive the resource.
+    std::shared_ptr<const std::string> SharedSourceText(void);
+
+    std::shared_ptr<const std::string> DecodedBodyForMemoryCache(void) override;
+    void RestoreFromMemoryCache(const MemoryCache::Entry &entry) override;
 private:
     class ScriptResourceFactory : public ResourceFactory
     {
@@ -69,7 +74,8 @@ private:
     ScriptResource(const ResourceRequest &resourceRequest, const ResourceLoaderOptions &options,
         const TextResourceDecoderOptions &decoderOptions);
 
-    std::string m_sourceText;
+    // Shared with the memory cache, see DecodedBodyForMemoryCache.
+    std::shared_ptr<const std::string> m_sourceText;
 };
 
 inline bool IsScriptResource(const Resource &resource)
@@ -159,7 +159,8 @@ std::shared_ptr<ClassicPendingScript> ClassicPendingScript::Fetch(
     const BkURL &url,
     Document &elementDocument,
     const WTF::TextEncoding &encoding,
-    ScriptElementBase *element)
+    ScriptElementBase *element,
+    FetchParameters::DeferOption defer)
 {
     ResourceRequest request(url);
     if (elementDocument.ForCrawler())
@@ -167,12 +168,14 @@ std::shared_ptr<ClassicPendingScript> ClassicPendingScript::Fetch(
         CrawlerImpl *crawler = ToCrawlerImpl(elementDocument.GetFrame()->Client());
         request.SetCrawler(crawler);
         request.SetHijackType(HijackType::kScript);
+        request.SetUseSharedCache(crawler->AllowsSharedCache());
     }
 
     ResourceLoaderOptions resourceLoaderOptions;
     resourceLoaderOptions.initiator_info.name = "script";
 
     FetchParameters params(request, resourceLoaderOptions);
+    params.SetDefer(defer);
 
     std::shared_ptr<ClassicPendingScript> pendingScript = base::WrapShared(new ClassicPendingScript(
         element, TextPosition(), ScriptSourceLocationType::kExternalFile,
@@ -321,7 +324,7 @@ void ClassicPendingScript::SetStreamer(std::unique_ptr<ScriptStreamer> &streamer
 
     m_streamer = std::move(streamer);
     m_isCurrentlyStreaming = true;
-    if (streamer && kReady == m_readyState)
+    if (kReady == m_readyState)
         AdvanceReadyState(kReadyStreaming);
 
     CheckState();
@@ -23,6 +23,7 @@
 #include "third_party/blink/renderer/core/script/classic_script.h"
 #include "third_party/blink/renderer/core/script/pending_script.h"
 #include "third_party/blink/renderer/core/loader/resource/script_resource.h"
+#include "third_party/blink/renderer/platform/loader/fetch/fetch_parameters.h"
 
 namespace blink {
 
@@ -45,7 +46,7 @@ public:
     // For a script from an external file, calls ScriptResource::Fetch() and
     // creates ClassicPendingScript. Returns nullptr if Fetch() returns nullptr.
     static std::shared_ptr<ClassicPendingScript> Fetch(const BlinKit::BkURL &url, Document &elementDocument,
-        const WTF::TextEncoding &encoding, ScriptElementBase *element);
+        const WTF::TextEncoding &encoding, ScriptElementBase *element, FetchParameters::DeferOption defer);
     // For an inline script.
     static std::shared_ptr<ClassicPendingScript> CreateInline(ScriptElementBase *element,
         const TextPosition &startingPosition, ScriptSourceLocationType sourceLocationType);
@@ -188,11 +188,8 @@ void HTMLParserScriptRunner::ExecutePendingDeferredScriptAndDispatchEvent(
   pending_script->StopWatchingForLoad();
 
   if (!IsExecutingScript()) {
-    ASSERT(false); // BKTODO: Check this
-#if 0
     // TODO(kouhei, hiroshige): Investigate why we need checkpoint here.
-    Microtask::PerformCheckpoint(V8PerIsolateData::MainThreadIsolate());
-#endif
+    // BKTODO: Microtask::PerformCheckpoint(V8PerIsolateData::MainThreadIsolate());
   }
 
   {
@@ -37,6 +37,11 @@ ScriptElementBase::ScriptElementBase(bool parserInserted, bool alreadyStarted)
 
 ScriptElementBase::~ScriptElementBase(void) = default;
 
+bool ScriptElementBase::AsyncAttributeValue(void) const
+{
+    return GetElement().FastHasAttribute(kAsyncAttr);
+}
+
 String ScriptElementBase::CharsetAttributeValue(void) const
 {
     return GetElement().getAttribute(kCharsetAttr).GetString();
@@ -54,6 +59,11 @@ String ScriptElementBase::ScriptElementBaseEventAttributeValue(void) const
 }
 #endif
 
+bool ScriptElementBase::DeferAttributeValue(void) const
+{
+    return GetElement().FastHasAttribute(kDeferAttr);
+}
+
 void ScriptElementBase::DidNotifySubtreeInsertionsToDocumentImpl(void)
 {
     m_loader->DidNotifySubtreeInsertionsToDocument();
@@ -116,6 +126,8 @@ bool ScriptElementBase::ParseAttributeImpl(const Element::AttributeModificationP
 {
     if (params.name == kSrcAttr)
         m_loader->HandleSourceAttribute(params.newValue);
+    else if (params.name == kAsyncAttr)
+        m_loader->HandleAsyncAttribute();
     else
         return false;
     return true;
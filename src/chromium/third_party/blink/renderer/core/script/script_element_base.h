@@ -42,11 +42,9 @@ class CORE_EXPORT ScriptElementBase : public GarbageCollectedMixin {
 
   ScriptLoader* Loader(void) const { return m_loader.get(); }
 
-  bool AsyncAttributeValue(void) const { return false; } // Seems no need to support `async` scripts.
+  bool AsyncAttributeValue(void) const;
   String CharsetAttributeValue(void) const;
-#if 0 // BKTODO:
-  bool DeferAttributeValue(void) const { return false; }
-#endif
+  bool DeferAttributeValue(void) const;
   String EventAttributeValue(void) const;
   String ForAttributeValue(void) const;
 #if 0 // BKTODO:
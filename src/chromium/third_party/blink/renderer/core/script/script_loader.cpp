@@ -98,7 +98,10 @@ std::unique_ptr<ScriptLoader> ScriptLoader::Create(ScriptElementBase *element, b
 
 void ScriptLoader::DetachPendingScript(void)
 {
-    ASSERT(false); // BKTODO:
+    if (!m_pendingScript)
+        return;
+    m_pendingScript->Dispose();
+    m_pendingScript.reset();
 }
 
 void ScriptLoader::DidNotifySubtreeInsertionsToDocument(void)
@@ -110,13 +113,24 @@ void ScriptLoader::DidNotifySubtreeInsertionsToDocument(void)
 // https://html.spec.whatwg.org/multipage/webappapis.html#fetch-a-classic-script
 void ScriptLoader::FetchClassicScript(const BkURL &url, Document &elementDocument, const WTF::TextEncoding &encoding)
 {
+    FetchParameters::DeferOption defer = FetchParameters::kNoDefer;
+    if (!m_parserInserted || m_element->AsyncAttributeValue() || m_element->DeferAttributeValue())
+        defer = FetchParameters::kLazyLoad;
+
     std::shared_ptr<ClassicPendingScript> pendingScript = ClassicPendingScript::Fetch(url, elementDocument,
-        encoding, m_element);
+        encoding, m_element, defer);
     ResourceClient *resourceClient = pendingScript.get();
     m_preparedPendingScript = pendingScript;
     m_resourceKeepAlive = resourceClient->GetResource();
 }
 
+void ScriptLoader::HandleAsyncAttribute(void)
+{
+    // <spec step="3">... (the "non-blocking" flag is unset) when the async
+    // content attribute is added ...</spec>
+    m_nonBlocking = false;
+}
+
 void ScriptLoader::HandleSourceAttribute(const String &sourceUrl)
 {
     if (IgnoresLoadRequest() || sourceUrl.IsEmpty())
@@ -557,7 +571,6 @@ bool ScriptLoader::PrepareScript(const TextPosition &scriptStartPosition, Legacy
 
     ASSERT(m_preparedPendingScript);
 
-#if 0 // BKTODO: defer
     // <spec step="26">Then, follow the first of the following options that
     // describes the situation:</spec>
 
@@ -576,20 +589,17 @@ bool ScriptLoader::PrepareScript(const TextPosition &scriptStartPosition, Legacy
     // If the script's type is "module", and the element has been flagged as
     // "parser-inserted", and the element does not have an async attribute
     // ...</spec>
-    if ((GetScriptType() == ScriptType::kClassic &&
-        element_->HasSourceAttribute() && element_->DeferAttributeValue() &&
-        parser_inserted_ && !element_->AsyncAttributeValue()) ||
-        (GetScriptType() == ScriptType::kModule && parser_inserted_ &&
-            !element_->AsyncAttributeValue())) {
+    if ((GetScriptType() == ScriptType::kClassic && m_element->HasSourceAttribute() && m_element->DeferAttributeValue() && m_parserInserted && !m_element->AsyncAttributeValue())
+        || (GetScriptType() == ScriptType::kModule && m_parserInserted && !m_element->AsyncAttributeValue()))
+    {
         // This clause is implemented by the caller-side of prepareScript():
         // - HTMLParserScriptRunner::requestDeferredScript(), and
         // - TODO(hiroshige): Investigate XMLDocumentParser::endElementNs()
-        will_execute_when_document_finished_parsing_ = true;
-        will_be_parser_executed_ = true;
+        m_willExecuteWhenDocumentFinishedParsing = true;
+        m_willBeParserExecuted = true;
 
         return true;
     }
-#endif
 
     // <spec step="26.B">If the script's type is "classic", and the element has a
     // src attribute, and the element has been flagged as "parser-inserted", and
@@ -614,23 +624,19 @@ bool ScriptLoader::PrepareScript(const TextPosition &scriptStartPosition, Legacy
     if ((GetScriptType() == ScriptType::kClassic && m_element->HasSourceAttribute() && !m_element->AsyncAttributeValue() && !m_nonBlocking)
         || (GetScriptType() == ScriptType::kModule && !m_element->AsyncAttributeValue() && !m_nonBlocking))
     {
-        ASSERT(false); // BKTODO:
-#if 0
         // <spec step="26.C">... Add the element to the end of the list of scripts
         // that will execute in order as soon as possible associated with the node
         // document of the script element at the time the prepare a script algorithm
         // started. ...</spec>
-        pending_script_ = TakePendingScript(ScriptSchedulingType::kInOrder);
+        m_pendingScript = TakePendingScript(ScriptSchedulingType::kInOrder);
         // TODO(hiroshige): Here |contextDocument| is used as "node document"
         // while Step 14 uses |elementDocument| as "node document". Fix this.
-        context_document->GetScriptRunner()->QueueScriptForExecution(
-            pending_script_);
+        contextDocument->GetScriptRunner()->QueueScriptForExecution(m_pendingScript);
         // Note that watchForLoad can immediately call pendingScriptFinished.
-        pending_script_->WatchForLoad(this);
+        m_pendingScript->WatchForLoad(this);
         // The part "When the script is ready..." is implemented in
         // ScriptRunner::notifyScriptReady().
         // TODO(hiroshige): Annotate it.
-#endif
 
         return true;
     }
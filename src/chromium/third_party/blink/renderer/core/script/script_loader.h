@@ -71,6 +71,7 @@ public:
     static bool BlockForNoModule(ScriptType scriptType, bool nomodule);
 
     void HandleSourceAttribute(const String &sourceUrl);
+    void HandleAsyncAttribute(void);
     void DidNotifySubtreeInsertionsToDocument(void);
     void ChildrenChanged(void);
 
@@ -61,7 +61,9 @@ bool ScriptRunner::DoTryStream(PendingScript *pendingScript)
     // Currently, we stream only async scripts in this function.
     // Note: HTMLParserScriptRunner kicks streaming for deferred or blocking
     // scripts.
-    ASSERT(std::end(m_pendingAsyncScripts) != m_pendingAsyncScripts.find(pendingScript)); // BKTODO: async_scripts_to_execute_soon_
+    ASSERT(std::end(m_pendingAsyncScripts) != m_pendingAsyncScripts.find(pendingScript)
+        || std::any_of(m_asyncScriptsToExecuteSoon.begin(), m_asyncScriptsToExecuteSoon.end(),
+            [pendingScript](const std::shared_ptr<PendingScript> &p) { return p.get() == pendingScript; }));
 
     if (nullptr == pendingScript)
         return false;
@@ -165,14 +167,10 @@ void ScriptRunner::NotifyScriptReady(PendingScript *pendingScript)
             break;
         }
         case ScriptSchedulingType::kInOrder:
-            ASSERT(false); // BKTODO:
-#if 0
-            SECURITY_CHECK(number_of_in_order_scripts_with_pending_notification_ > 0);
-            number_of_in_order_scripts_with_pending_notification_--;
+            ASSERT(m_numberOfInOrderScriptsWithPendingNotification > 0);
+            --m_numberOfInOrderScriptsWithPendingNotification;
 
             ScheduleReadyInOrderScripts();
-#endif
-
             break;
         default:
             NOTREACHED();
@@ -204,11 +202,8 @@ void ScriptRunner::QueueScriptForExecution(std::shared_ptr<PendingScript> &pendi
             break;
 
         case ScriptSchedulingType::kInOrder:
-            ASSERT(false); // BKTODO:
-#if 0
-            pending_in_order_scripts_.push_back(pending_script);
-            number_of_in_order_scripts_with_pending_notification_++;
-#endif
+            m_pendingInOrderScripts.push_back(pendingScript);
+            ++m_numberOfInOrderScriptsWithPendingNotification;
             break;
 
         default:
@@ -217,6 +212,18 @@ void ScriptRunner::QueueScriptForExecution(std::shared_ptr<PendingScript> &pendi
     }
 }
 
+void ScriptRunner::ScheduleReadyInOrderScripts(void)
+{
+    // Scripts are fetched at once, but executed in the order they were
+    // inserted: only a ready prefix of the list can be scheduled.
+    while (!m_pendingInOrderScripts.empty() && m_pendingInOrderScripts.front()->IsReady())
+    {
+        m_inOrderScriptsToExecuteSoon.push_back(m_pendingInOrderScripts.front());
+        m_pendingInOrderScripts.pop_front();
+        PostTask(FROM_HERE);
+    }
+}
+
 void ScriptRunner::TryStream(PendingScript *pendingScript)
 {
     if (!m_isSuspended)
@@ -68,6 +68,7 @@ private:
     explicit ScriptRunner(Document *document);
 
     void PostTask(const base::Location &webTraceLocation);
+    void ScheduleReadyInOrderScripts(void);
 
     void ExecuteTask(void);
     // Execute the first task in in_order_scripts_to_execute_soon_.
@@ -84,6 +85,7 @@ private:
 
     Member<Document> m_document;
 
+    std::deque<std::shared_ptr<PendingScript>> m_pendingInOrderScripts;
     std::unordered_map<PendingScript *, std::shared_ptr<PendingScript>> m_pendingAsyncScripts;
 
     // http://www.whatwg.org/specs/web-apps/current-work/#set-of-scripts-that-will-execute-as-soon-as-possible
@@ -92,6 +94,8 @@ private:
 
     std::shared_ptr<base::SingleThreadTaskRunner> m_taskRunner;
 
+    int m_numberOfInOrderScriptsWithPendingNotification = 0;
+
     bool m_isSuspended = false;
 
 #ifndef NDEBUG
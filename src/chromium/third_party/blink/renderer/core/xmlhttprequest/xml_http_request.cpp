@@ -0,0 +1,492 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: xml_http_request.cpp
+// Description: XMLHttpRequest Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "xml_http_request.h"
+
+#include <algorithm>
+#include "base/single_thread_task_runner.h"
+#include "blinkit/crawler/crawler_impl.h"
+#include "net/http/http_util.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/events/event.h"
+#include "third_party/blink/renderer/core/event_type_names.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
+#include "third_party/blink/renderer/platform/bindings/gc_pool.h"
+#include "third_party/blink/renderer/platform/loader/fetch/fetch_parameters.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
+#include "third_party/blink/renderer/platform/network/http_names.h"
+#include "third_party/blink/renderer/platform/shared_buffer.h"
+
+using namespace BlinKit;
+
+namespace blink {
+
+static bool IsForbiddenMethod(const std::string &method)
+{
+    return "CONNECT" == method || "TRACE" == method || "TRACK" == method;
+}
+
+// Headers controlled by the network engine, which scripts cannot set.
+static bool IsForbiddenHeaderName(const std::string &name)
+{
+    static const char *ForbiddenNames[] = {
+        "accept-charset", "accept-encoding", "access-control-request-headers", "access-control-request-method",
+        "connection", "content-length", "cookie", "cookie2", "date", "dnt", "expect", "host", "keep-alive",
+        "origin", "referer", "te", "trailer", "transfer-encoding", "upgrade", "via"
+    };
+
+    std::string lowerName(name);
+    for (char &ch : lowerName)
+    {
+        if ('A' <= ch && ch <= 'Z')
+            ch += 'a' - 'A';
+    }
+
+    for (const char *forbiddenName : ForbiddenNames)
+    {
+        if (lowerName == forbiddenName)
+            return true;
+    }
+    return 0 == lowerName.compare(0, 6, "proxy-") || 0 == lowerName.compare(0, 4, "sec-");
+}
+
+XMLHttpRequest::XMLHttpRequest(Document &document)
+    : ContextLifecycleObserver(&document)
+    , m_taskRunner(document.GetTaskRunner(TaskType::kNetworking))
+    , m_isAlive(std::make_shared<bool>(true))
+    , m_timeoutTimer(m_taskRunner, this, &XMLHttpRequest::TimeoutTimerFired)
+{
+}
+
+XMLHttpRequest::~XMLHttpRequest(void)
+{
+    *m_isAlive = false;
+    ClearResource();
+    ClearContext();
+}
+
+void XMLHttpRequest::abort(void)
+{
+    const bool wasSending = (kOpened == m_state && m_sendFlag) || kHeadersReceived == m_state || kLoading == m_state;
+    InternalAbort();
+    if (wasSending)
+        HandleRequestError(event_type_names::kAbort);
+    if (kDone == m_state)
+        m_state = kUnsent; // No readystatechange event here.
+}
+
+void XMLHttpRequest::ChangeState(State newState)
+{
+    if (m_state == newState)
+        return;
+    m_state = newState;
+    DispatchEvent(*Event::Create(event_type_names::kReadystatechange));
+}
+
+void XMLHttpRequest::ContextDestroyed(ExecutionContext *)
+{
+    InternalAbort();
+    m_state = kUnsent;
+}
+
+XMLHttpRequest* XMLHttpRequest::Create(Document &document)
+{
+    return GCPool::From(document).Save(new XMLHttpRequest(document));
+}
+
+void XMLHttpRequest::DispatchProgressEvent(const AtomicString &type)
+{
+    DispatchEvent(*Event::Create(type));
+}
+
+String XMLHttpRequest::getAllResponseHeaders(void) const
+{
+    const Resource *resource = ResponseResource();
+    if (nullptr == resource)
+        return g_empty_string;
+
+    std::vector<std::pair<std::string, const std::string *>> headers;
+    for (const auto &it : resource->GetResponse().HttpHeaderFields().GetRawMap())
+    {
+        std::string name(it.first);
+        for (char &ch : name)
+        {
+            if ('A' <= ch && ch <= 'Z')
+                ch += 'a' - 'A';
+        }
+        headers.emplace_back(std::move(name), &it.second);
+    }
+    std::sort(headers.begin(), headers.end());
+
+    std::string ret;
+    for (const auto &it : headers)
+    {
+        ret.append(it.first);
+        ret.append(": ");
+        ret.append(*it.second);
+        ret.append("\r\n");
+    }
+    return String::FromStdUTF8(ret);
+}
+
+Document* XMLHttpRequest::GetDocument(void) const
+{
+    ExecutionContext *executionContext = GetExecutionContext();
+    return nullptr != executionContext ? To<Document>(executionContext) : nullptr;
+}
+
+ExecutionContext* XMLHttpRequest::GetExecutionContext(void) const
+{
+    return ContextLifecycleObserver::GetExecutionContext();
+}
+
+AtomicString XMLHttpRequest::getResponseHeader(const AtomicString &name) const
+{
+    const Resource *resource = ResponseResource();
+    if (nullptr == resource)
+        return g_null_atom;
+    return resource->GetResponse().HttpHeaderField(name);
+}
+
+void XMLHttpRequest::HandleRequestError(const AtomicString &type)
+{
+    const unsigned generation = m_generation;
+
+    m_errorFlag = true;
+    m_sendFlag = false;
+    ClearResource();
+
+    ChangeState(kDone);
+    if (generation != m_generation)
+        return; // Reopened by the handlers.
+    DispatchProgressEvent(type);
+    if (generation != m_generation)
+        return;
+    DispatchProgressEvent(event_type_names::kLoadend);
+}
+
+void XMLHttpRequest::InternalAbort(void)
+{
+    // Responses on the way are dropped when they come.
+    ++m_generation;
+    m_timeoutTimer.Stop();
+    ClearResource();
+}
+
+void XMLHttpRequest::NotifyFinished(Resource *)
+{
+    // May be called synchronously from RawResource::Fetch, for memory cache
+    // hits and blocked requests.
+    std::shared_ptr<bool> isAlive(m_isAlive);
+    const unsigned generation = m_generation;
+    const auto callback = [this, isAlive, generation]
+    {
+        if (*isAlive && generation == m_generation && m_sendFlag)
+            ProcessResponse();
+    };
+    m_taskRunner->PostTask(FROM_HERE, callback);
+}
+
+void XMLHttpRequest::open(const AtomicString &method, const String &url, bool async, ExceptionState &exceptionState)
+{
+    Document *document = GetDocument();
+    if (nullptr == document)
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError, "The document is detached.");
+        return;
+    }
+
+    std::string normalizedMethod = method.UpperASCII().StdUtf8();
+    if (IsForbiddenMethod(normalizedMethod))
+    {
+        exceptionState.ThrowSecurityError("'" + method + "' HTTP method is unsupported.");
+        return;
+    }
+    if (normalizedMethod.empty())
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kSyntaxError, "'" + method + "' is not a valid HTTP method.");
+        return;
+    }
+
+    static const char *StandardMethods[] = { "DELETE", "GET", "HEAD", "OPTIONS", "POST", "PUT" };
+    bool isStandard = false;
+    for (const char *standardMethod : StandardMethods)
+    {
+        if (normalizedMethod == standardMethod)
+        {
+            isStandard = true;
+            break;
+        }
+    }
+
+    BkURL URL = document->CompleteURL(url);
+    if (!URL.IsValid())
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kSyntaxError, "Invalid URL");
+        return;
+    }
+
+    if (!async)
+    {
+        // Synchronous requests would block the only thread of the crawler.
+        exceptionState.ThrowDOMException(DOMExceptionCode::kNotSupportedError,
+            "Synchronous requests are not supported.");
+        return;
+    }
+
+    InternalAbort();
+
+    m_method = isStandard ? AtomicString::FromStdUTF8(normalizedMethod) : method;
+    m_url = URL;
+    m_requestHeaders.Clear();
+    m_mimeTypeOverride = g_null_atom;
+    m_sendFlag = false;
+    m_errorFlag = false;
+
+    if (kOpened != m_state)
+        ChangeState(kOpened);
+    else
+        m_state = kOpened;
+}
+
+void XMLHttpRequest::overrideMimeType(const AtomicString &mimeType, ExceptionState &exceptionState)
+{
+    if (kLoading == m_state || kDone == m_state)
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError,
+            "MimeType cannot be overridden when the state is LOADING or DONE.");
+        return;
+    }
+    m_mimeTypeOverride = mimeType;
+}
+
+void XMLHttpRequest::ProcessResponse(void)
+{
+    m_timeoutTimer.Stop();
+
+    Resource *resource = GetResource();
+    if (nullptr == resource || resource->ErrorOccurred())
+    {
+        HandleRequestError(event_type_names::kError);
+        return;
+    }
+
+    // The whole body is here already, so the states are passed one by one.
+    const unsigned generation = m_generation;
+    m_sendFlag = false;
+    ChangeState(kHeadersReceived);
+    if (generation != m_generation)
+        return;
+    ChangeState(kLoading);
+    if (generation != m_generation)
+        return;
+    ChangeState(kDone);
+    if (generation != m_generation)
+        return;
+    DispatchProgressEvent(event_type_names::kLoad);
+    if (generation != m_generation)
+        return;
+    DispatchProgressEvent(event_type_names::kLoadend);
+}
+
+std::shared_ptr<const SharedBuffer> XMLHttpRequest::ResponseBody(void) const
+{
+    if (kLoading != m_state && kDone != m_state)
+        return nullptr;
+
+    const Resource *resource = ResponseResource();
+    if (nullptr == resource)
+        return nullptr;
+    return resource->ResourceBuffer();
+}
+
+WTF::TextEncoding XMLHttpRequest::ResponseEncoding(void) const
+{
+    AtomicString charset;
+    if (!m_mimeTypeOverride.IsEmpty())
+    {
+        std::string mimeType, overriddenCharset;
+        bool hasCharset = false;
+        net::HttpUtil::ParseContentType(m_mimeTypeOverride.StdUtf8(), &mimeType, &overriddenCharset, &hasCharset,
+            nullptr);
+        if (hasCharset)
+            charset = AtomicString::FromStdUTF8(overriddenCharset);
+    }
+    if (charset.IsEmpty())
+    {
+        if (const Resource *resource = ResponseResource())
+            charset = resource->GetResponse().TextEncodingName();
+    }
+
+    if (charset.IsEmpty())
+        return WTF::UTF8Encoding();
+    WTF::TextEncoding encoding(charset);
+    return encoding.IsValid() ? encoding : WTF::UTF8Encoding();
+}
+
+const Resource* XMLHttpRequest::ResponseResource(void) const
+{
+    if (kUnsent == m_state || kOpened == m_state || m_errorFlag)
+        return nullptr;
+    return GetResource();
+}
+
+String XMLHttpRequest::responseURL(void) const
+{
+    const Resource *resource = ResponseResource();
+    if (nullptr == resource)
+        return g_empty_string;
+    return String::FromStdUTF8(resource->GetResponse().Url().AsString());
+}
+
+void XMLHttpRequest::send(const std::shared_ptr<const std::string> &body, ExceptionState &exceptionState)
+{
+    Document *document = GetDocument();
+    if (nullptr == document || nullptr == document->GetFrame() || nullptr == document->Fetcher())
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError, "The document is detached.");
+        return;
+    }
+    if (kOpened != m_state || m_sendFlag)
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError,
+            "The object's state must be OPENED.");
+        return;
+    }
+
+    ResourceRequest request(m_url);
+    request.SetHTTPMethod(m_method);
+    for (const auto &it : m_requestHeaders.GetRawMap())
+        request.SetHTTPHeaderField(it.first, it.second);
+    if (body && http_names::kGET != m_method && "HEAD" != m_method)
+    {
+        request.SetHTTPBodyData(body);
+        const std::string contentType = http_names::kContentType.StdUtf8();
+        if (m_requestHeaders.Get(contentType).empty())
+            request.SetHTTPHeaderField(contentType, "text/plain;charset=UTF-8");
+    }
+    if (document->ForCrawler())
+    {
+        CrawlerImpl *crawler = ToCrawlerImpl(document->GetFrame()->Client());
+        request.SetCrawler(crawler);
+        // The memory cache is keyed by URLs, but custom headers may vary the
+        // responses.
+        request.SetUseSharedCache(crawler->AllowsSharedCache() && m_requestHeaders.GetRawMap().empty());
+    }
+
+    ResourceLoaderOptions options;
+    options.initiator_info.name = "xmlhttprequest";
+    FetchParameters params(request, options);
+
+    const unsigned generation = m_generation;
+    m_errorFlag = false;
+    m_sendFlag = true;
+    DispatchProgressEvent(event_type_names::kLoadstart);
+    if (generation != m_generation || !m_sendFlag)
+        return; // Aborted or reopened by the handlers.
+
+    RawResource::Fetch(params, document->Fetcher(), this);
+    if (m_timeoutMilliseconds > 0)
+        m_timeoutTimer.StartOneShot(TimeDelta::FromMilliseconds(m_timeoutMilliseconds), FROM_HERE);
+}
+
+void XMLHttpRequest::setRequestHeader(const AtomicString &name, const AtomicString &value, ExceptionState &exceptionState)
+{
+    if (kOpened != m_state || m_sendFlag)
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError,
+            "The object's state must be OPENED.");
+        return;
+    }
+    if (name.IsEmpty())
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kSyntaxError, "'' is not a valid HTTP header field name.");
+        return;
+    }
+
+    const std::string headerName = name.StdUtf8();
+    if (IsForbiddenHeaderName(headerName))
+        return;
+
+    std::string headerValue = m_requestHeaders.Get(headerName);
+    if (!headerValue.empty())
+        headerValue.append(", ");
+    headerValue.append(value.StdUtf8());
+    m_requestHeaders.Set(headerName, headerValue);
+}
+
+void XMLHttpRequest::setTimeout(unsigned timeout, ExceptionState &)
+{
+    // Unlike the spec, the timer is not restarted for a request in flight.
+    m_timeoutMilliseconds = timeout;
+}
+
+void XMLHttpRequest::setWithCredentials(bool value, ExceptionState &exceptionState)
+{
+    if ((kUnsent != m_state && kOpened != m_state) || m_sendFlag)
+    {
+        exceptionState.ThrowDOMException(DOMExceptionCode::kInvalidStateError,
+            "The value may only be set if the object's state is UNSENT or OPENED.");
+        return;
+    }
+    // Cookies of the crawler are always sent, the flag is only kept for
+    // scripts.
+    m_withCredentials = value;
+}
+
+int XMLHttpRequest::status(void) const
+{
+    const Resource *resource = ResponseResource();
+    if (nullptr == resource)
+        return 0;
+    return resource->GetResponse().HttpStatusCode();
+}
+
+String XMLHttpRequest::statusText(void) const
+{
+    // The status lines are not kept by the network engine, so the standard
+    // reason phrases are used instead.
+    switch (status())
+    {
+        case 200: return "OK";
+        case 201: return "Created";
+        case 202: return "Accepted";
+        case 204: return "No Content";
+        case 206: return "Partial Content";
+        case 301: return "Moved Permanently";
+        case 302: return "Found";
+        case 303: return "See Other";
+        case 304: return "Not Modified";
+        case 307: return "Temporary Redirect";
+        case 308: return "Permanent Redirect";
+        case 400: return "Bad Request";
+        case 401: return "Unauthorized";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 429: return "Too Many Requests";
+        case 500: return "Internal Server Error";
+        case 502: return "Bad Gateway";
+        case 503: return "Service Unavailable";
+        case 504: return "Gateway Timeout";
+    }
+    return g_empty_string;
+}
+
+void XMLHttpRequest::TimeoutTimerFired(TimerBase *)
+{
+    ASSERT(m_sendFlag);
+    InternalAbort();
+    HandleRequestError(event_type_names::kTimeout);
+}
+
+} // namespace blink
@@ -0,0 +1,123 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: xml_http_request.h
+// Description: XMLHttpRequest Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_XML_HTTP_REQUEST_H
+#define BLINKIT_BLINK_XML_HTTP_REQUEST_H
+
+#pragma once
+
+#include "blinkit/common/bk_http_header_map.h"
+#include "third_party/blink/renderer/core/dom/context_lifecycle_observer.h"
+#include "third_party/blink/renderer/core/dom/events/event_target.h"
+#include "third_party/blink/renderer/platform/loader/fetch/raw_resource.h"
+#include "third_party/blink/renderer/platform/timer.h"
+#include "third_party/blink/renderer/platform/wtf/text/text_encoding.h"
+
+namespace base {
+class SingleThreadTaskRunner;
+}
+
+namespace blink {
+
+class Document;
+class ExceptionState;
+class SharedBuffer;
+
+// Requests go through the resource fetcher of the document, so they are
+// filtered, scheduled, cached and tracked like the other subresources of the
+// crawler. Only asynchronous requests are supported. Events are always
+// dispatched from tasks, even if the response is ready at once (from the
+// memory cache, or blocked).
+class XMLHttpRequest final : public EventTargetWithInlineData, private RawResourceClient, public ContextLifecycleObserver
+{
+public:
+    static XMLHttpRequest* Create(Document &document);
+    ~XMLHttpRequest(void) override;
+
+    enum State {
+        kUnsent = 0,
+        kOpened = 1,
+        kHeadersReceived = 2,
+        kLoading = 3,
+        kDone = 4
+    };
+
+    // Exports for JS
+    State readyState(void) const { return m_state; }
+    int status(void) const;
+    String statusText(void) const;
+    String responseURL(void) const;
+    unsigned timeout(void) const { return m_timeoutMilliseconds; }
+    void setTimeout(unsigned timeout, ExceptionState &exceptionState);
+    bool withCredentials(void) const { return m_withCredentials; }
+    void setWithCredentials(bool value, ExceptionState &exceptionState);
+
+    void open(const AtomicString &method, const String &url, bool async, ExceptionState &exceptionState);
+    void setRequestHeader(const AtomicString &name, const AtomicString &value, ExceptionState &exceptionState);
+    void overrideMimeType(const AtomicString &mimeType, ExceptionState &exceptionState);
+    // |body| may be nullptr, and is ignored for GET and HEAD.
+    void send(const std::shared_ptr<const std::string> &body, ExceptionState &exceptionState);
+    void abort(void);
+
+    AtomicString getResponseHeader(const AtomicString &name) const;
+    String getAllResponseHeaders(void) const;
+
+    // The body, shared with the resource. Null until loading.
+    std::shared_ptr<const SharedBuffer> ResponseBody(void) const;
+    // The charset to decode the body with, UTF-8 if not specified.
+    WTF::TextEncoding ResponseEncoding(void) const;
+    // Changes each time the request is opened or aborted, so that bindings
+    // could tell whether their cached responses are stale.
+    unsigned RequestGeneration(void) const { return m_generation; }
+    // Whether a request is on the way, which keeps the script object alive.
+    bool HasPendingActivity(void) const { return m_sendFlag; }
+private:
+    explicit XMLHttpRequest(Document &document);
+
+    Document* GetDocument(void) const;
+    // Null unless the response is available to scripts.
+    const Resource* ResponseResource(void) const;
+
+    void InternalAbort(void);
+    void ChangeState(State newState);
+    void DispatchProgressEvent(const AtomicString &type);
+    void HandleRequestError(const AtomicString &type);
+    void ProcessResponse(void);
+    void TimeoutTimerFired(TimerBase *);
+
+    // EventTarget
+    ExecutionContext* GetExecutionContext(void) const override;
+    // ResourceClient
+    void NotifyFinished(Resource *resource) override;
+    // ContextLifecycleObserver
+    void ContextDestroyed(ExecutionContext *executionContext) override;
+
+    std::shared_ptr<base::SingleThreadTaskRunner> m_taskRunner;
+    std::shared_ptr<bool> m_isAlive;
+
+    State m_state = kUnsent;
+    bool m_sendFlag = false;
+    bool m_errorFlag = false;
+    bool m_withCredentials = false;
+    unsigned m_generation = 0;
+
+    AtomicString m_method;
+    BlinKit::BkURL m_url;
+    BlinKit::BkHTTPHeaderMap m_requestHeaders;
+    AtomicString m_mimeTypeOverride;
+
+    unsigned m_timeoutMilliseconds = 0;
+    TaskRunnerTimer<XMLHttpRequest> m_timeoutTimer;
+};
+
+} // namespace blink
+
+#endif // BLINKIT_BLINK_XML_HTTP_REQUEST_H
@@ -35,12 +35,16 @@ void ExceptionState::ThrowException(void)
 
 void ExceptionState::ThrowSecurityError(const String &sanitizedMessage, const String &unsanitizedMessage)
 {
-    assert(false); // BKTODO:
+    m_exceptionCode = ToExceptionCode(DOMExceptionCode::kSecurityError);
+    m_message = sanitizedMessage.StdUtf8();
+    BKLOG("Security Error: %s", m_message.c_str());
 }
 
 void ExceptionState::ThrowTypeError(const String &message)
 {
-    assert(false); // BKTODO:
+    m_exceptionCode = static_cast<ExceptionCode>(ESErrorType::kTypeError);
+    m_message = message.StdUtf8();
+    BKLOG("Type Error: %s", m_message.c_str());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/frame/local_frame.h"
 #include "third_party/blink/renderer/platform/bindings/script_wrappable.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 
 using namespace blink;
 
@@ -21,6 +22,7 @@ namespace BlinKit {
 
 void GCPool::CollectGarbage(void)
 {
+    TRACE_EVENT1("gc", "GCPool::CollectGarbage", "objects", m_objects.size());
     for (ScriptWrappable *object : m_objects)
         object->PreCollectGarbage(*this);
     for (ScriptWrappable *object : m_objects)
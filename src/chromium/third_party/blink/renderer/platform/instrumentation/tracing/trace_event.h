@@ -0,0 +1,19 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: trace_event.h
+// Description: Trace Macros
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_TRACE_EVENT_H
+#define BLINKIT_BLINK_TRACE_EVENT_H
+
+#pragma once
+
+#include "base/trace_event/trace_event.h"
+
+#endif // BLINKIT_BLINK_TRACE_EVENT_H
@@ -102,6 +102,7 @@ public:
     virtual void DispatchDidReceiveData(unsigned long identifier, const char *data, int dataLength) {}
     virtual void DispatchDidFinishLoading(unsigned long identifier) {}
     virtual void DidLoadResource(Resource *resource) {}
+    virtual void DispatchDidLoadResourceFromMemoryCache(const ResourceRequest &request) {}
     virtual void DispatchDidFail(const BlinKit::BkURL &url, unsigned long identifier, const ResourceError &error) {}
 
     virtual bool IsDetached(void) const { return false; }
@@ -75,8 +75,10 @@ public:
     
     SpeculativePreloadType GetSpeculativePreloadType(void) const { return m_speculativePreloadType; }
     bool IsSpeculativePreload(void) const { return SpeculativePreloadType::kNotSpeculative != m_speculativePreloadType; }
+    void SetSpeculativePreloadType(SpeculativePreloadType type) { m_speculativePreloadType = type; }
 
     DeferOption Defer(void) const { return m_defer; }
+    void SetDefer(DeferOption defer) { m_defer = defer; }
 
     bool IsStaleRevalidation(void) const { return m_isStaleRevalidation; }
     void SetStaleRevalidation(bool isStaleRevalidation) { m_isStaleRevalidation = isStaleRevalidation; }
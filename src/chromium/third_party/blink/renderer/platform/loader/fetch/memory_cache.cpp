@@ -0,0 +1,293 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: memory_cache.cpp
+// Description: MemoryCache Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#include "memory_cache.h"
+
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/time/time.h"
+#include "net/cookies/cookie_util.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_request.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_response.h"
+#include "third_party/blink/renderer/platform/network/http_names.h"
+
+using namespace BlinKit;
+
+namespace blink {
+
+// Heuristic freshness for responses which only carry a Last-Modified header
+// (RFC 7234, 4.2.2), capped so that stale scripts are not kept for too long.
+static const double kHeuristicLifetimeFraction = 0.1;
+static const double kMaxHeuristicLifetime = 24 * 60 * 60;
+
+// Part of the capacity reserved for the protected segment.
+static const double kProtectedRatio = 0.8;
+
+static double ParseHTTPDate(const std::string &s)
+{
+    if (s.empty())
+        return 0;
+    return net::cookie_util::ParseCookieTime(s).ToDoubleT();
+}
+
+static double CurrentTimeInSeconds(void)
+{
+    return base::Time::Now().ToDoubleT();
+}
+
+static std::string KeyForURL(const BkURL &URL)
+{
+    if (URL.HasRef())
+        return URL.StripFragmentIdentifier().AsString();
+    return URL.AsString();
+}
+
+void MemoryCache::Add(const BkURL &URL, ResourceType type, const ResourceResponse &response,
+    const std::shared_ptr<const std::string> &body)
+{
+    if (!body || 200 != response.HttpStatusCode())
+        return;
+
+    double now = CurrentTimeInSeconds();
+    double expirationTime = ComputeExpirationTime(response.HttpHeaderFields(), now);
+    if (expirationTime <= now)
+        return;
+
+    Entry *entry = new Entry;
+    entry->type = type;
+    entry->httpStatusCode = response.HttpStatusCode();
+    entry->mimeType = response.MimeType().StdUtf8();
+    entry->textEncodingName = response.TextEncodingName().StdUtf8();
+    entry->body = body;
+    entry->expirationTime = expirationTime;
+
+    std::string key = KeyForURL(URL);
+    size_t size = sizeof(Node) + sizeof(Entry) + 2 * key.length() + entry->mimeType.length()
+        + entry->textEncodingName.length() + body->length();
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    // Never let a single entry flush more than a quarter of the cache.
+    if (size > m_capacity / 4)
+    {
+        delete entry;
+        return;
+    }
+
+    auto it = m_nodes.find(key);
+    if (std::end(m_nodes) != it)
+        RemoveNode(it);
+
+    m_probation.push_front(key);
+
+    Node &node = m_nodes[key];
+    node.entry.reset(entry);
+    node.size = size;
+    node.segment = Segment::kProbation;
+    node.position = m_probation.begin();
+
+    m_size += size;
+    ++m_insertions;
+    Prune(m_capacity);
+}
+
+double MemoryCache::ComputeExpirationTime(const BkHTTPHeaderMap &headers, double responseTime)
+{
+    // The cache is keyed by URL only, so anything varying on request headers
+    // can not be shared, except for the content coding which is always
+    // decoded before reaching here.
+    const std::string vary = base::ToLowerASCII(headers.Get("Vary"));
+    for (const base::StringPiece &field : base::SplitStringPiece(vary, ",", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY))
+    {
+        if (field != "accept-encoding")
+            return 0;
+    }
+
+    bool hasMaxAge = false;
+    int64_t maxAge = 0;
+
+    const std::string cacheControl = base::ToLowerASCII(headers.Get("Cache-Control"));
+    if (!cacheControl.empty())
+    {
+        for (const base::StringPiece &directive : base::SplitStringPiece(cacheControl, ",", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY))
+        {
+            // Every crawler in the process shares this cache, so private
+            // responses are treated the same as non-storable ones.
+            if (directive == "no-store" || directive == "no-cache" || directive == "private")
+                return 0;
+            if (base::StartsWith(directive, "max-age=", base::CompareCase::SENSITIVE))
+                hasMaxAge = base::StringToInt64(directive.substr(8), &maxAge);
+        }
+    }
+    else if (base::ToLowerASCII(headers.Get("Pragma")).find("no-cache") != std::string::npos)
+    {
+        return 0;
+    }
+
+    double dateValue = ParseHTTPDate(headers.Get("Date"));
+    if (0 == dateValue)
+        dateValue = responseTime;
+
+    double freshnessLifetime;
+    if (hasMaxAge)
+    {
+        freshnessLifetime = maxAge;
+    }
+    else
+    {
+        double expires = ParseHTTPDate(headers.Get("Expires"));
+        if (0 != expires)
+        {
+            freshnessLifetime = expires - dateValue;
+        }
+        else
+        {
+            double lastModified = ParseHTTPDate(headers.Get("Last-Modified"));
+            if (0 == lastModified || dateValue <= lastModified)
+                return 0;
+            freshnessLifetime = std::min((dateValue - lastModified) * kHeuristicLifetimeFraction, kMaxHeuristicLifetime);
+        }
+    }
+
+    // RFC 7234, 4.2.3: Calculating Age.
+    double currentAge = std::max(0.0, responseTime - dateValue);
+    int64_t age = 0;
+    if (base::StringToInt64(headers.Get("Age"), &age))
+        currentAge = std::max(currentAge, static_cast<double>(age));
+
+    if (freshnessLifetime <= currentAge)
+        return 0;
+    return responseTime + freshnessLifetime - currentAge;
+}
+
+void MemoryCache::EvictResources(void)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    Prune(0);
+}
+
+MemoryCache::Statistics MemoryCache::GetStatistics(void) const
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    Statistics statistics;
+    statistics.capacity = m_capacity;
+    statistics.size = m_size;
+    statistics.count = m_nodes.size();
+    statistics.hits = m_hits;
+    statistics.misses = m_misses;
+    statistics.evictions = m_evictions;
+    statistics.insertions = m_insertions;
+    return statistics;
+}
+
+bool MemoryCache::IsCacheableRequest(const ResourceRequest &request)
+{
+    if (!request.UseSharedCache())
+        return false;
+    if (request.HttpMethod() != http_names::kGET)
+        return false;
+    return request.Url().SchemeIsHTTPOrHTTPS();
+}
+
+std::shared_ptr<const MemoryCache::Entry> MemoryCache::Lookup(const BkURL &URL)
+{
+    const std::string key = KeyForURL(URL);
+
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    auto it = m_nodes.find(key);
+    if (std::end(m_nodes) == it)
+    {
+        ++m_misses;
+        return nullptr;
+    }
+
+    Node &node = it->second;
+    if (node.entry->expirationTime <= CurrentTimeInSeconds())
+    {
+        RemoveNode(it);
+        ++m_misses;
+        return nullptr;
+    }
+
+    ++m_hits;
+    MoveToFront(node, Segment::kProtected);
+
+    // Demote the least recently used protected entries back to probation, so
+    // new entries always have some room to prove themselves.
+    const size_t protectedCapacity = static_cast<size_t>(m_capacity * kProtectedRatio);
+    while (m_protectedSize > protectedCapacity && m_protected.size() > 1)
+        MoveToFront(m_nodes[m_protected.back()], Segment::kProbation);
+
+    return node.entry;
+}
+
+void MemoryCache::MoveToFront(Node &node, Segment segment)
+{
+    std::list<std::string> &dst = SegmentList(segment);
+    dst.splice(dst.begin(), SegmentList(node.segment), node.position);
+    if (node.segment != segment)
+    {
+        if (Segment::kProtected == segment)
+            m_protectedSize += node.size;
+        else
+            m_protectedSize -= node.size;
+        node.segment = segment;
+    }
+}
+
+void MemoryCache::Prune(size_t capacity)
+{
+    while (m_size > capacity)
+    {
+        std::list<std::string> &victims = m_probation.empty() ? m_protected : m_probation;
+        ASSERT(!victims.empty());
+        RemoveNode(m_nodes.find(victims.back()));
+        ++m_evictions;
+    }
+}
+
+void MemoryCache::Remove(const BkURL &URL)
+{
+    const std::string key = KeyForURL(URL);
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto it = m_nodes.find(key);
+    if (std::end(m_nodes) != it)
+        RemoveNode(it);
+}
+
+void MemoryCache::RemoveNode(NodeMap::iterator it)
+{
+    Node &node = it->second;
+    SegmentList(node.segment).erase(node.position);
+    if (Segment::kProtected == node.segment)
+        m_protectedSize -= node.size;
+    m_size -= node.size;
+    m_nodes.erase(it);
+}
+
+void MemoryCache::SetCapacity(size_t capacity)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    m_capacity = capacity;
+    Prune(m_capacity);
+}
+
+MemoryCache* GetMemoryCache(void)
+{
+    static MemoryCache s_memoryCache;
+    return &s_memoryCache;
+}
+
+} // namespace blink
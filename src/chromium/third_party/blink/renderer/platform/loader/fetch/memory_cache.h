@@ -0,0 +1,115 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: memory_cache.h
+// Description: MemoryCache Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_MEMORY_CACHE_H
+#define BLINKIT_BLINK_MEMORY_CACHE_H
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "blinkit/common/bk_http_header_map.h"
+#include "blinkit/common/bk_url.h"
+
+namespace blink {
+
+class ResourceRequest;
+class ResourceResponse;
+enum class ResourceType : uint8_t;
+
+/**
+ * MemoryCache is shared by all crawlers (and their ResourceFetchers) in the
+ * process. It keeps decoded resource bodies keyed by URL, so identical
+ * resources are neither fetched nor decoded twice while they are fresh.
+ *
+ * Entries are immutable once added, and bodies are held by reference, so a
+ * body is stored only once no matter how many resources are using it.
+ *
+ * The cache is a segmented LRU: new entries go into a probationary segment
+ * and are promoted to the protected segment on their second hit. Eviction
+ * drains the probationary segment first, so one-shot resources can not push
+ * frequently used ones out.
+ */
+class MemoryCache
+{
+public:
+    static constexpr size_t kDefaultCapacity = 64 * 1024 * 1024;
+
+    struct Entry
+    {
+        ResourceType type;
+        int httpStatusCode;
+        std::string mimeType, textEncodingName;
+        std::shared_ptr<const std::string> body;
+        double expirationTime; // Seconds since epoch.
+    };
+
+    struct Statistics
+    {
+        size_t capacity = 0, size = 0, count = 0;
+        uint64_t hits = 0, misses = 0, evictions = 0, insertions = 0;
+    };
+
+    // Returns nullptr if there is no fresh entry for the URL.
+    std::shared_ptr<const Entry> Lookup(const BlinKit::BkURL &URL);
+    void Add(const BlinKit::BkURL &URL, ResourceType type, const ResourceResponse &response,
+        const std::shared_ptr<const std::string> &body);
+    void Remove(const BlinKit::BkURL &URL);
+
+    void EvictResources(void);
+    void SetCapacity(size_t capacity);
+    Statistics GetStatistics(void) const;
+
+    static bool IsCacheableRequest(const ResourceRequest &request);
+private:
+    friend MemoryCache* GetMemoryCache(void);
+    MemoryCache(void) = default;
+
+    // Returns the expiration time for the response, or 0 if it must not be
+    // stored.
+    static double ComputeExpirationTime(const BlinKit::BkHTTPHeaderMap &headers, double responseTime);
+
+    enum class Segment { kProbation, kProtected };
+    struct Node
+    {
+        std::shared_ptr<const Entry> entry;
+        size_t size;
+        Segment segment;
+        std::list<std::string>::iterator position;
+    };
+    using NodeMap = std::unordered_map<std::string, Node>;
+
+    std::list<std::string>& SegmentList(Segment segment)
+    {
+        return Segment::kProbation == segment ? m_probation : m_protected;
+    }
+    void MoveToFront(Node &node, Segment segment);
+    void RemoveNode(NodeMap::iterator it);
+    void Prune(size_t capacity);
+
+    mutable std::mutex m_lock;
+    NodeMap m_nodes;
+    // Both segments are ordered from most to least recently used.
+    std::list<std::string> m_probation, m_protected;
+    size_t m_capacity = kDefaultCapacity;
+    size_t m_size = 0, m_protectedSize = 0;
+    uint64_t m_hits = 0, m_misses = 0, m_evictions = 0, m_insertions = 0;
+};
+
+// Returns the process-wide memory cache.
+MemoryCache* GetMemoryCache(void);
+
+} // namespace blink
+
+#endif // BLINKIT_BLINK_MEMORY_CACHE_H
@@ -39,6 +39,9 @@
 #include "base/memory/ptr_util.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
 #include "third_party/blink/renderer/platform/loader/fetch/source_keyed_cached_metadata_handler.h"
+#include "third_party/blink/renderer/platform/shared_buffer.h"
+
+using namespace BlinKit;
 
 namespace blink {
 
@@ -54,6 +57,22 @@ RawResource::RawResource(const ResourceRequest &resourceRequest, ResourceType ty
 {
 }
 
+std::shared_ptr<const std::string> RawResource::DecodedBodyForMemoryCache(void)
+{
+    // Main resources are parsed while loading, only raw responses are kept.
+    if (ResourceType::kRaw != GetType())
+        return nullptr;
+
+    std::shared_ptr<const SharedBuffer> data = ResourceBuffer();
+    if (!data)
+        return std::make_shared<const std::string>();
+
+    const std::vector<BkSegmentedBuffer::Segment> &segments = data->Segments().Segments();
+    if (1 == segments.size())
+        return segments.front();
+    return std::make_shared<const std::string>(data->Segments().ToString());
+}
+
 void RawResource::DidAddClient(ResourceClient *c)
 {
     // ASSERT()/RevalidationStartForbiddenScope are for
@@ -76,18 +95,19 @@ void RawResource::DidAddClient(ResourceClient *c)
     }
 
     if (!GetResponse().IsNull())
-    {
-        ASSERT(false); // BKTODO:
-#if 0
-        client->ResponseReceived(this, GetResponse(),
-            std::move(data_consumer_handle_));
-#endif
-    }
+        client->ResponseReceived(this, GetResponse());
     if (!HasClient(c))
         return;
     Resource::DidAddClient(c);
 }
 
+std::shared_ptr<RawResource> RawResource::Fetch(FetchParameters &params, ResourceFetcher *fetcher, RawResourceClient *client)
+{
+    RawResourceFactory factory(ResourceType::kRaw);
+    std::shared_ptr<Resource> resource = fetcher->RequestResource(params, factory, client);
+    return ToRawResource(resource);
+}
+
 std::shared_ptr<RawResource> RawResource::FetchMainResource(
     FetchParameters &params,
     ResourceFetcher *fetcher,
@@ -116,4 +136,14 @@ void RawResource::ResponseReceived(const ResourceResponse &response)
         c->ResponseReceived(this, GetResponse());
 }
 
+void RawResource::RestoreFromMemoryCache(const MemoryCache::Entry &entry)
+{
+    Resource::RestoreFromMemoryCache(entry);
+
+    // Shares the cached body, instead of copying it.
+    BkSegmentedBuffer body;
+    body.Append(entry.body);
+    AppendData(body);
+}
+
 }  // namespace blink
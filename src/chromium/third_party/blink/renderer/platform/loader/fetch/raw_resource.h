@@ -48,6 +48,7 @@ class SubstituteData;
 class RawResource final : public Resource, public std::enable_shared_from_this<RawResource>
 {
 public:
+    static std::shared_ptr<RawResource> Fetch(FetchParameters &params, ResourceFetcher *fetcher, RawResourceClient *client);
     static std::shared_ptr<RawResource> FetchMainResource(FetchParameters &params, ResourceFetcher *fetcher,
         RawResourceClient *client, const SubstituteData &substituteData);
 
@@ -69,6 +70,8 @@ private:
 
     // Resource
     void ResponseReceived(const ResourceResponse &response) override;
+    std::shared_ptr<const std::string> DecodedBodyForMemoryCache(void) override;
+    void RestoreFromMemoryCache(const MemoryCache::Entry &entry) override;
     void DidAddClient(ResourceClient *c) override;
 };
 
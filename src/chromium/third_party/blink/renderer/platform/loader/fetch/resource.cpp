@@ -69,6 +69,10 @@ static bool NeedsSynchronousCacheHit(ResourceType type, const ResourceLoaderOpti
         return true;
     if (ResourceType::kFont == type)
         return true;
+    // XHR and fetch responses are restored from the memory cache on the spot,
+    // their clients post the notifications by themselves.
+    if (ResourceType::kRaw == type)
+        return true;
     return false;
 }
 
@@ -129,6 +133,35 @@ void Resource::AppendData(const char *data, size_t length)
         c->DataReceived(this, data, length);
 }
 
+void Resource::AppendData(const BlinKit::BkSegmentedBuffer &data)
+{
+    ASSERT(!m_isRevalidating);
+    ASSERT(!ErrorOccurred());
+    if (data.IsEmpty())
+        return;
+
+    if (m_options.data_buffering_policy == kBufferData)
+    {
+        if (m_data)
+            m_data->Append(data);
+        else
+            m_data = SharedBuffer::Create(data);
+        SetEncodedSize(m_data->size());
+    }
+
+    std::vector<ResourceClient *> clients(Clients().begin(), Clients().end());
+    for (ResourceClient *c : clients)
+    {
+        for (const auto &segment : data.Segments())
+        {
+            c->DataReceived(this, segment->data(), segment->length());
+            // Stop pushing data if the client removed itself.
+            if (!HasClient(c))
+                break;
+        }
+    }
+}
+
 void Resource::ClearData(void)
 {
     m_data.reset();
@@ -138,35 +171,29 @@ void Resource::DidAddClient(ResourceClient *c)
 {
     if (std::shared_ptr<SharedBuffer> data = Data())
     {
-        ASSERT(false); // BKTODO:
-#if 0
-        for (const auto& span : *data) {
-            c->DataReceived(this, span.data(), span.size());
+        for (const auto &segment : data->Segments().Segments())
+        {
+            c->DataReceived(this, segment->data(), segment->length());
             // Stop pushing data if the client removed itself.
             if (!HasClient(c))
                 break;
         }
-#endif
     }
     if (!HasClient(c))
         return;
     if (IsLoaded())
     {
-        ASSERT(false); // BKTODO:
-#if 0
         c->NotifyFinished(this);
-        if (clients_.Contains(c)) {
-            finished_clients_.insert(c);
-            clients_.erase(c);
-        }
-#endif
+        MarkClientFinished(c);
     }
     BKLOG("// BKTODO: Check child classes.");
 }
 
 void Resource::DidChangePriority(ResourceLoadPriority loadPriority, int intraPriorityValue)
 {
-    ASSERT(false); // BKTODO:
+    // Loaders hand requests to the network at once, there is no scheduler to
+    // reorder them, so only the request is updated.
+    m_resourceRequest.SetPriority(loadPriority, intraPriorityValue);
 }
 
 void Resource::DidRemoveClientOrObserver(void)
@@ -224,7 +251,10 @@ void Resource::FinishAsError(const ResourceError &error, base::SingleThreadTaskR
     // BKTODO: CheckResourceIntegrity();
     TriggerNotificationForFinishObservers(taskRunner);
 
-    ASSERT(!failedDuringStart); // BKTODO:
+    // Only blocked requests fail before starting. Their clients are notified
+    // right away, as the resources fetched by crawlers all take synchronous
+    // notifications, the same as for memory cache hits.
+    ASSERT(!failedDuringStart || ResourceType::kMainResource != GetType());
 #if 0
     // Most resource types don't expect to succeed or fail inside
     // ResourceFetcher::RequestResource(). If the request does complete
@@ -366,6 +396,21 @@ void Resource::ResponseReceived(const ResourceResponse &response)
         SetEncoding(encoding);
 }
 
+void Resource::RestoreFromMemoryCache(const MemoryCache::Entry &entry)
+{
+    ASSERT(StillNeedsLoad());
+    ASSERT(entry.type == m_type);
+
+    ResourceResponse response(Url());
+    response.SetHTTPStatusCode(entry.httpStatusCode);
+    response.SetMimeType(AtomicString::FromStdUTF8(entry.mimeType));
+    if (!entry.textEncodingName.empty())
+        response.SetTextEncodingName(AtomicString::FromStdUTF8(entry.textEncodingName));
+    SetResponse(response);
+
+    m_status = ResourceStatus::kCached;
+}
+
 void Resource::SetEncodedSize(size_t encodedSize)
 {
     // BKTODO:
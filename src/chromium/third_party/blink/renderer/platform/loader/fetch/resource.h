@@ -42,6 +42,7 @@
 #include <vector>
 #include "base/auto_reset.h"
 #include "third_party/blink/renderer/platform/heap/handle.h"
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_error.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_loader_options.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_request.h"
@@ -49,6 +50,10 @@
 #include "third_party/blink/renderer/platform/loader/fetch/resource_status.h"
 #include "third_party/blink/renderer/platform/loader/fetch/text_resource_decoder_options.h"
 
+namespace BlinKit {
+class BkSegmentedBuffer;
+}
+
 namespace base {
 class SingleThreadTaskRunner;
 }
@@ -124,6 +129,8 @@ public:
     void SetResponse(const ResourceResponse &response);
 
     virtual void AppendData(const char *data, size_t length);
+    // Keeps the segments of |data| when buffering, instead of copying them.
+    virtual void AppendData(const BlinKit::BkSegmentedBuffer &data);
     virtual void FinishAsError(const ResourceError &error, base::SingleThreadTaskRunner *taskRunner);
 
     bool ShouldBlockLoadEvent(void) const;
@@ -151,6 +158,11 @@ public:
     // Computes the status of an object after loading.
     virtual void Finish(base::SingleThreadTaskRunner *taskRunner);
 
+    // Only resources which keep their decoded bodies can be shared through
+    // the memory cache, see MemoryCache for details.
+    virtual std::shared_ptr<const std::string> DecodedBodyForMemoryCache(void) { return nullptr; }
+    virtual void RestoreFromMemoryCache(const MemoryCache::Entry &entry);
+
     class ProhibitAddRemoveClientInScope : public base::AutoReset<bool>
     {
     public:
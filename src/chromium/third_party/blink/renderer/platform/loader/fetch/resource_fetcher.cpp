@@ -40,6 +40,7 @@
 
 #include "third_party/blink/renderer/platform/bindings/script_forbidden_scope.h"
 #include "third_party/blink/renderer/platform/loader/fetch/fetch_context.h"
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_client.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_loader.h"
@@ -58,6 +59,18 @@ ResourceFetcher::ResourceFetcher(std::unique_ptr<FetchContext> &context)
 
 ResourceFetcher::~ResourceFetcher(void) = default;
 
+#ifdef BLINKIT_CRAWLER_ONLY
+void ResourceFetcher::AddToMemoryCacheIfNeeded(Resource *resource)
+{
+    if (resource->ErrorOccurred() || !MemoryCache::IsCacheableRequest(resource->GetResourceRequest()))
+        return;
+
+    std::shared_ptr<const std::string> body = resource->DecodedBodyForMemoryCache();
+    if (body)
+        GetMemoryCache()->Add(resource->Url(), resource->GetType(), resource->GetResponse(), body);
+}
+#endif
+
 int ResourceFetcher::BlockingRequestCount(void) const
 {
     return m_loaders.size();
@@ -67,7 +80,7 @@ void ResourceFetcher::ClearContext(void)
 {
     ASSERT(m_resourcesFromPreviousFetcher.empty());
     // BKTODO: m_scheduler->Shutdown();
-    // BKTODO: ClearPreloads(ResourceFetcher::kClearAllPreloads);
+    ClearPreloads();
     FetchContext *detachedContext = Context().Detach();
     if (detachedContext != m_context.get())
         m_context.reset(detachedContext);
@@ -286,6 +299,9 @@ void ResourceFetcher::HandleLoaderFinish(Resource *resource, LoaderFinishType ty
     if (kDidFinishLoading == type)
     {
         resource->Finish(Context().GetLoadingTaskRunner().get());
+#ifdef BLINKIT_CRAWLER_ONLY
+        AddToMemoryCacheIfNeeded(resource);
+#endif
 #if 0 // BKTODO:
         resource->Finish(finish_time, Context().GetLoadingTaskRunner().get());
 #endif
@@ -308,20 +324,53 @@ void ResourceFetcher::HandleLoaderFinish(Resource *resource, LoaderFinishType ty
     HandleLoadCompletion(resource);
 }
 
-void ResourceFetcher::InsertAsPreloadIfNecessary(Resource *resource, const FetchParameters &params, ResourceType type)
+static BkURL RemoveFragmentIdentifierIfNeeded(const BkURL &originalUrl)
+{
+    if (!originalUrl.HasRef() || !originalUrl.SchemeIsHTTPOrHTTPS())
+        return originalUrl;
+    return originalUrl.StripFragmentIdentifier();
+}
+
+void ResourceFetcher::ClearPreloads(void)
+{
+    // In-flight resources are kept alive by their loaders.
+    m_preloads.clear();
+}
+
+void ResourceFetcher::InsertAsPreloadIfNecessary(
+    const std::shared_ptr<Resource> &resource,
+    const FetchParameters &params,
+    ResourceType type)
 {
     if (!params.IsSpeculativePreload() && !params.IsLinkPreload())
         return;
-    ASSERT(false); // BKTODO:
+
+    m_preloads.emplace(RemoveFragmentIdentifierIfNeeded(params.Url()).AsString(), resource);
 }
 
-static BkURL RemoveFragmentIdentifierIfNeeded(const BkURL &originalUrl)
+std::shared_ptr<Resource> ResourceFetcher::MatchPreload(const FetchParameters &params, ResourceType type)
 {
-    if (!originalUrl.HasRef() || !originalUrl.SchemeIsHTTPOrHTTPS())
-        return originalUrl;
-    BkURL url = originalUrl;
-    ASSERT(false); // BKTODO: url.RemoveFragmentIdentifier();
-    return url;
+    auto it = m_preloads.find(RemoveFragmentIdentifierIfNeeded(params.Url()).AsString());
+    if (std::end(m_preloads) == it)
+        return nullptr;
+
+    std::shared_ptr<Resource> resource = it->second;
+    // Kept for the request of its own type, e.g. a script preloaded before an
+    // XHR for the same URL.
+    if (resource->GetType() != type)
+        return nullptr;
+    if (resource->ErrorOccurred())
+    {
+        // Let the request load it again.
+        m_preloads.erase(it);
+        return nullptr;
+    }
+
+    // Another preload for the same URL shares the entry, a real request takes
+    // it over.
+    if (!params.IsSpeculativePreload() && !params.IsLinkPreload())
+        m_preloads.erase(it);
+    return resource;
 }
 
 std::optional<ResourceRequestBlockedReason> ResourceFetcher::PrepareRequest(
@@ -424,7 +473,13 @@ std::shared_ptr<Resource> ResourceFetcher::RequestResource(
     RevalidationPolicy policy = kLoad;
 
 #ifdef BLINKIT_CRAWLER_ONLY
-    resource = CreateResourceForLoading(params, factory);
+    resource = MatchPreload(params, resourceType);
+    if (!resource)
+        resource = ResourceFromMemoryCache(params, factory);
+    if (resource)
+        policy = kUse;
+    else
+        resource = CreateResourceForLoading(params, factory);
 #else
     bool is_data_url = resource_request.Url().ProtocolIsData();
     bool is_static_data = is_data_url || substitute_data.IsValid() || archive_;
@@ -539,7 +594,7 @@ std::shared_ptr<Resource> ResourceFetcher::RequestResource(
     }
 
     if (policy != kUse)
-        InsertAsPreloadIfNecessary(resource.get(), params, resourceType);
+        InsertAsPreloadIfNecessary(resource, params, resourceType);
 
     return resource;
 }
@@ -556,15 +611,31 @@ std::shared_ptr<Resource> ResourceFetcher::ResourceForBlockedRequest(
         params.DecoderOptions());
     if (nullptr != client)
         client->SetResource(resource, taskRunner.get());
-    ASSERT(false); // BKTODO:
-#if 0
-    resource->FinishAsError(ResourceError::CancelledDueToAccessCheckError(
-        params.Url(), blocked_reason),
-        Context().GetLoadingTaskRunner().get());
-#endif
+    resource->FinishAsError(ResourceError(BK_ERR_FORBIDDEN, params.Url()), taskRunner.get());
     return resource;
 }
 
+#ifdef BLINKIT_CRAWLER_ONLY
+std::shared_ptr<Resource> ResourceFetcher::ResourceFromMemoryCache(
+    const FetchParameters &params,
+    const ResourceFactory &factory)
+{
+    const ResourceRequest &request = params.GetResourceRequest();
+    if (!MemoryCache::IsCacheableRequest(request))
+        return nullptr;
+
+    std::shared_ptr<const MemoryCache::Entry> entry = GetMemoryCache()->Lookup(request.Url());
+    if (!entry || entry->type != factory.GetType())
+        return nullptr;
+
+    std::shared_ptr<Resource> resource = factory.Create(request, params.Options(), params.DecoderOptions());
+    resource->SetLinkPreload(params.IsLinkPreload());
+    resource->RestoreFromMemoryCache(*entry);
+    Context().DispatchDidLoadResourceFromMemoryCache(request);
+    return resource;
+}
+#endif
+
 #ifndef BLINKIT_CRAWLER_ONLY
 void ResourceFetcher::RequestLoadStarted(
     unsigned long identifier,
@@ -628,6 +699,7 @@ bool ResourceFetcher::StartLoad(std::shared_ptr<Resource> &resource)
     ASSERT(resource->StillNeedsLoad());
 
     ResourceRequest request(resource->GetResourceRequest());
+    request.SetResourceType(resource->GetType());
     ResourceLoader *loader = nullptr;
 
     {
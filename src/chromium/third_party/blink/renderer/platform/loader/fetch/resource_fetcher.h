@@ -41,6 +41,7 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 #include "base/memory/ptr_util.h"
 #include "third_party/blink/public/platform/resource_request_blocked_reason.h"
@@ -94,10 +95,17 @@ public:
     void HandleLoaderError(Resource *resource, const ResourceError &error);
 
     int BlockingRequestCount(void) const;
+
+    // Drops the speculative preloads which have not been requested for real.
+    void ClearPreloads(void);
 private:
     ResourceFetcher(std::unique_ptr<FetchContext> &context);
 
     std::shared_ptr<Resource> CreateResourceForLoading(const FetchParameters &params, const ResourceFactory &factory);
+#ifdef BLINKIT_CRAWLER_ONLY
+    std::shared_ptr<Resource> ResourceFromMemoryCache(const FetchParameters &params, const ResourceFactory &factory);
+    void AddToMemoryCacheIfNeeded(Resource *resource);
+#endif
 
     ResourceLoadPriority ComputeLoadPriority(ResourceType type, const ResourceRequest &resourceRequest,
         ResourcePriority::VisibilityStatus visibility, FetchParameters::DeferOption deferOption = FetchParameters::kNoDefer,
@@ -110,7 +118,12 @@ private:
     std::shared_ptr<Resource> ResourceForBlockedRequest(const FetchParameters &params, const ResourceFactory &factory,
         ResourceRequestBlockedReason blockedReason, ResourceClient *client);
 
-    void InsertAsPreloadIfNecessary(Resource *resource, const FetchParameters &params, ResourceType type);
+    // Preloads are keyed by their URLs without fragments. A later request for
+    // the same URL and type takes the preloaded resource over, whether it is
+    // still in flight or already finished.
+    std::shared_ptr<Resource> MatchPreload(const FetchParameters &params, ResourceType type);
+    void InsertAsPreloadIfNecessary(const std::shared_ptr<Resource> &resource, const FetchParameters &params,
+        ResourceType type);
 
     enum RevalidationPolicy { kUse, kRevalidate, kReload, kLoad };
 
@@ -138,6 +151,8 @@ private:
     // the previous page. Unpopulated unless experiment is enabled.
     std::unordered_set<Resource *> m_resourcesFromPreviousFetcher;
 
+    std::unordered_map<std::string, std::shared_ptr<Resource>> m_preloads;
+
     bool m_imageFetched : 1;
 
     uint32_t m_inflightKeepaliveBytes = 0;
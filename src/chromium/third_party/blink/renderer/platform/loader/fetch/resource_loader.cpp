@@ -138,6 +138,13 @@ void ResourceLoader::DidFinishLoading(void)
 #endif
 }
 
+void ResourceLoader::DidReceiveBuffer(const BlinKit::BkSegmentedBuffer &data)
+{
+    for (const auto &segment : data.Segments())
+        Context().DispatchDidReceiveData(m_resource->Identifier(), segment->data(), segment->length());
+    m_resource->AppendData(data);
+}
+
 void ResourceLoader::DidReceiveData(const char *data, int length)
 {
     ASSERT(length >= 0);
@@ -201,7 +208,8 @@ void ResourceLoader::HandleError(const ResourceError &error)
 
 void ResourceLoader::ScheduleCancel(void)
 {
-    ASSERT(false); // BKTODO:
+    // Network tasks cannot be stopped yet. The load goes on, and its response
+    // is dropped as nobody is waiting for it.
 }
 
 void ResourceLoader::SetDefersLoading(bool defers)
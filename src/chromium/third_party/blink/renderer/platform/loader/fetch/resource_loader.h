@@ -80,6 +80,7 @@ private:
     // WebURLLoaderClient
     void DidReceiveResponse(const ResourceResponse &response) override;
     void DidReceiveData(const char *data, int length) override;
+    void DidReceiveBuffer(const BlinKit::BkSegmentedBuffer &data) override;
     void DidFinishLoading(void) override;
     void DidFail(const ResourceError &error) override;
 
@@ -50,6 +50,7 @@
 namespace blink {
 
 class EncodedFormData;
+enum class ResourceType : uint8_t;
 
 enum class HijackType {
     kNotForCrawler = 0,
@@ -78,11 +79,16 @@ public:
     void SetSiteForCookies(const BlinKit::BkURL &siteForCookies) { m_siteForCookies = siteForCookies; }
 
     const AtomicString& HttpMethod(void) const { return m_httpMethod; }
+    void SetHTTPMethod(const AtomicString &httpMethod) { m_httpMethod = httpMethod; }
 
     const BlinKit::BkHTTPHeaderMap& AllHeaders(void) const { return m_headers; }
+    void SetHTTPHeaderField(const std::string &name, const std::string &value) { m_headers.Set(name, value); }
     void SetHTTPUserAgent(const String &httpUserAgent);
 
     EncodedFormData* HttpBody(void) const;
+    // Raw bytes to send, shared by the copies of the request.
+    const std::shared_ptr<const std::string>& HttpBodyData(void) const { return m_httpBodyData; }
+    void SetHTTPBodyData(const std::shared_ptr<const std::string> &data) { m_httpBodyData = data; }
 
     bool DownloadToBlob(void) const { return m_downloadToBlob; }
     bool GetKeepalive(void) const { return m_keepalive; }
@@ -100,20 +106,32 @@ public:
     HijackType GetHijackType(void) const { return m_hijackType; }
     void SetHijackType(HijackType hijackType) { m_hijackType = hijackType; }
 
+    // Whether the response may be served from, and stored into, the memory
+    // cache shared by all crawlers.
+    bool UseSharedCache(void) const { return m_useSharedCache; }
+    void SetUseSharedCache(bool useSharedCache) { m_useSharedCache = useSharedCache; }
+
+    // Set by ResourceFetcher when the load starts, for the crawler metrics.
+    ResourceType GetResourceType(void) const { return m_resourceType; }
+    void SetResourceType(ResourceType resourceType) { m_resourceType = resourceType; }
+
     RedirectStatus GetRedirectStatus(void) const { return m_redirectStatus; }
 private:
     BkCrawler m_crawler = nullptr;
     BlinKit::BkURL m_URL, m_siteForCookies;
     AtomicString m_httpMethod;
     BlinKit::BkHTTPHeaderMap m_headers;
+    std::shared_ptr<const std::string> m_httpBodyData;
     bool m_downloadToBlob : 1;
     bool m_keepalive : 1;
     ResourceLoadPriority m_priority = ResourceLoadPriority::kLowest;
     int m_intraPriorityValue = 0;
     bool m_didSetHttpReferrer = false;
     bool m_wasDiscarded = false;
+    bool m_useSharedCache = false;
     RedirectStatus m_redirectStatus = RedirectStatus::kNoRedirect;
     HijackType m_hijackType = HijackType::kNotForCrawler;
+    ResourceType m_resourceType {};
 };
 
 }  // namespace blink
@@ -77,6 +77,8 @@ public:
     AtomicString HttpContentType(void) const;
 
     AtomicString HttpHeaderField(const AtomicString &name) const;
+    const BlinKit::BkHTTPHeaderMap& HttpHeaderFields(void) const { return m_httpHeaderFields; }
+    void SetHTTPHeaderFields(const BlinKit::BkHTTPHeaderMap &headers) { m_httpHeaderFields = headers; }
 
     // This method doesn't compare the all members.
     static bool Compare(const ResourceResponse &a, const ResourceResponse &b);
@@ -43,8 +43,7 @@ namespace blink {
 
 SharedBuffer::Iterator& SharedBuffer::Iterator::operator++()
 {
-    ASSERT(nullptr != m_data);
-    m_data = nullptr;
+    ++m_it;
     return *this;
 }
 
@@ -57,15 +56,22 @@ SharedBuffer::SharedBuffer(const char *data, size_t length)
 void SharedBuffer::Append(const char *data, size_t length)
 {
     ASSERT(length > 0);
+    m_data.Append(data, length);
+}
 
-    size_t oldLength = m_data.size();
-    m_data.resize(oldLength + length);
-    memcpy(m_data.data() + oldLength, data, length);
+void SharedBuffer::Append(const BlinKit::BkSegmentedBuffer &data)
+{
+    m_data.Append(data);
 }
 
 SharedBuffer::Iterator SharedBuffer::begin(void) const
 {
-    return Iterator(&m_data);
+    return Iterator(m_data.Segments().begin());
+}
+
+std::shared_ptr<SharedBuffer> SharedBuffer::Create(void)
+{
+    return base::WrapShared(new SharedBuffer);
 }
 
 std::shared_ptr<SharedBuffer> SharedBuffer::Create(const char *data, size_t length)
@@ -73,18 +79,36 @@ std::shared_ptr<SharedBuffer> SharedBuffer::Create(const char *data, size_t leng
     return base::WrapShared(new SharedBuffer(data, length));
 }
 
+std::shared_ptr<SharedBuffer> SharedBuffer::Create(const BlinKit::BkSegmentedBuffer &data)
+{
+    std::shared_ptr<SharedBuffer> ret = Create();
+    ret->Append(data);
+    return ret;
+}
+
 SharedBuffer::Iterator SharedBuffer::end(void) const
 {
-    return Iterator(nullptr);
+    return Iterator(m_data.Segments().end());
 }
 
 bool SharedBuffer::GetBytes(void *dest, size_t destSize) const
 {
     if (nullptr == dest)
         return false;
-    if (m_data.size() < destSize)
+    if (m_data.Size() < destSize)
         return false;
-    memcpy(dest, m_data.data(), destSize);
+
+    char *p = reinterpret_cast<char *>(dest);
+    for (const auto &segment : m_data.Segments())
+    {
+        if (0 == destSize)
+            break;
+
+        size_t n = std::min(destSize, segment->length());
+        memcpy(p, segment->data(), n);
+        p += n;
+        destSize -= n;
+    }
     return true;
 }
 
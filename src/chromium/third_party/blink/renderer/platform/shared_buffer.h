@@ -40,14 +40,16 @@
 
 #pragma once
 
-#include <vector>
+#include "blinkit/common/bk_segmented_buffer.h"
 
 namespace blink {
 
 class SharedBuffer : public std::enable_shared_from_this<SharedBuffer>
 {
 public:
+    static std::shared_ptr<SharedBuffer> Create(void);
     static std::shared_ptr<SharedBuffer> Create(const char *data, size_t length);
+    static std::shared_ptr<SharedBuffer> Create(const BlinKit::BkSegmentedBuffer &data);
 
     // Iterator for ShreadBuffer contents. An Iterator will get invalid once the
     // associated SharedBuffer is modified (e.g., Append() is called). An Iterator
@@ -58,30 +60,36 @@ public:
         ~Iterator(void) = default;
 
         Iterator& operator++();
-        bool operator==(const Iterator &o) const { return m_data == o.m_data; }
+        bool operator==(const Iterator &o) const { return m_it == o.m_it; }
         bool operator!=(const Iterator &o) const { return !(*this == o); }
-        const std::vector<char>& operator*() const { return *m_data; }
+        const std::string& operator*() const { return **m_it; }
 
-        const char* data(void) const { return m_data->data(); }
-        size_t size(void) const { return m_data->size(); }
+        const char* data(void) const { return (*m_it)->data(); }
+        size_t size(void) const { return (*m_it)->size(); }
     private:
         friend class SharedBuffer;
-        Iterator(const std::vector<char> *data) : m_data(data) {}
+        using SegmentIterator = std::vector<BlinKit::BkSegmentedBuffer::Segment>::const_iterator;
+        Iterator(SegmentIterator it) : m_it(it) {}
 
-        const std::vector<char> *m_data = nullptr;
+        SegmentIterator m_it;
     };
 
     Iterator begin(void) const;
     Iterator end(void) const;
-    size_t size(void) const { return m_data.size(); }
+    size_t size(void) const { return m_data.Size(); }
 
     void Append(const char *data, size_t length);
+    // Shares the segments of |data| instead of copying them.
+    void Append(const BlinKit::BkSegmentedBuffer &data);
+
+    const BlinKit::BkSegmentedBuffer& Segments(void) const { return m_data; }
 
     bool GetBytes(void *dest, size_t destSize) const;
 private:
+    SharedBuffer(void) = default;
     SharedBuffer(const char *data, size_t length);
 
-    std::vector<char> m_data;
+    BlinKit::BkSegmentedBuffer m_data;
 };
 
 }  // namespace blink
@@ -158,6 +158,43 @@ void SegmentedString::Advance(unsigned count, UChar* consumed_characters) {
   }
 }
 
+template <typename CharType>
+static inline int LastNewlineOffset(const CharType* characters,
+                                    unsigned count,
+                                    int* newlines) {
+  int last = -1;
+  for (unsigned i = 0; i < count; ++i) {
+    if (characters[i] == '\n') {
+      ++*newlines;
+      last = i;
+    }
+  }
+  return last;
+}
+
+void SegmentedString::AdvanceWithinSubstringAndUpdateLineNumbers(
+    unsigned count) {
+  DCHECK_LT(count, CurrentSubstringLength());
+  if (!count)
+    return;
+
+  if (LIKELY(current_string_.DoNotExcludeLineNumbers())) {
+    int newlines = 0;
+    int last_newline =
+        current_string_.Is8Bit()
+            ? LastNewlineOffset(current_string_.Characters8(), count,
+                                &newlines)
+            : LastNewlineOffset(current_string_.Characters16(), count,
+                                &newlines);
+    if (newlines) {
+      current_line_ += newlines;
+      number_of_characters_consumed_prior_to_current_line_ =
+          NumberOfCharactersConsumed() + last_newline + 1;
+    }
+  }
+  current_string_.Skip(count);
+}
+
 OrdinalNumber SegmentedString::CurrentLine() const {
   return OrdinalNumber::FromZeroBasedInt(current_line_);
 }
@@ -115,6 +115,25 @@ class PLATFORM_EXPORT SegmentedSubstring {
     --length_;
   }
 
+  // Raw access to the characters not consumed yet, the current one included.
+  ALWAYS_INLINE bool Is8Bit() const { return is8_bit_; }
+  ALWAYS_INLINE const LChar* Characters8() const { return data_.string8_ptr; }
+  ALWAYS_INLINE const UChar* Characters16() const {
+    return data_.string16_ptr;
+  }
+
+  ALWAYS_INLINE void Skip(int count) {
+    DCHECK_LT(count, length_);
+    if (is8_bit_) {
+      data_.string8_ptr += count;
+      current_char_ = *data_.string8_ptr;
+    } else {
+      data_.string16_ptr += count;
+      current_char_ = *data_.string16_ptr;
+    }
+    length_ -= count;
+  }
+
   String CurrentSubString(unsigned length) {
     int offset = string_.length() - length_;
     return string_.Substring(offset, length);
@@ -249,6 +268,21 @@ class PLATFORM_EXPORT SegmentedString {
     }
   }
 
+  // Lets scanners look ahead within the current substring without copying.
+  // The span starts with the current character.
+  bool CurrentSubstringIs8Bit() const { return current_string_.Is8Bit(); }
+  const LChar* CurrentSubstringCharacters8() const {
+    return current_string_.Characters8();
+  }
+  const UChar* CurrentSubstringCharacters16() const {
+    return current_string_.Characters16();
+  }
+  unsigned CurrentSubstringLength() const { return current_string_.length(); }
+
+  // Same as calling AdvanceAndUpdateLineNumber() |count| times, but the
+  // characters must not reach the end of the current substring.
+  void AdvanceWithinSubstringAndUpdateLineNumbers(unsigned count);
+
   // Writes the consumed characters into consumedCharacters, which must
   // have space for at least |count| characters.
   void Advance(unsigned count, UChar* consumed_characters);
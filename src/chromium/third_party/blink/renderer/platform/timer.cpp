@@ -66,6 +66,20 @@ void TimerBase::Start(TimeDelta nextFireInterval, TimeDelta repeatInterval, cons
     SetNextFireTime(base::TimeTicks::Now(), nextFireInterval);
 }
 
+void TimerBase::Stop(void)
+{
+#if DCHECK_IS_ON()
+    ASSERT(CurrentThread() == m_thread);
+#endif
+
+    // Tasks already posted are dropped as if the timer was gone.
+    *m_isAlive = false;
+    m_isAlive = std::make_shared<bool>(true);
+    m_isActive = false;
+    m_nextFireTime = TimeTicks();
+    m_repeatInterval = TimeDelta();
+}
+
 void TimerBase::SetNextFireTime(TimeTicks now, TimeDelta delay)
 {
 #if DCHECK_IS_ON()
@@ -37,6 +37,7 @@ public:
     void Start(TimeDelta nextFireInterval, TimeDelta repeatInterval, const base::Location &caller);
 
     void StartOneShot(TimeDelta interval, const base::Location &caller) { Start(interval, TimeDelta(), caller); }
+    void Stop(void);
 private:
     void SetNextFireTime(TimeTicks now, TimeDelta delay);
     void RunInternal(void);
@@ -25,6 +25,7 @@
 #include "third_party/blink/renderer/platform/wtf/allocator/partition_allocator.h"
 #include "third_party/blink/renderer/platform/wtf/construct_traits.h"
 #include "third_party/blink/renderer/platform/wtf/hash_table.h"
+#include "third_party/blink/renderer/platform/wtf/swiss_hash_table.h"
 
 namespace WTF {
 
@@ -77,13 +78,21 @@ class HashMap {
 
   typedef HashArg HashFunctions;
 
-  typedef HashTable<KeyType,
-                    ValueType,
-                    KeyValuePairKeyExtractor,
-                    HashFunctions,
-                    ValueTraits,
-                    KeyTraits,
-                    Allocator>
+  typedef typename std::conditional<KeyTraits::kUseSwissTable,
+                                    SwissHashTable<KeyType,
+                                                   ValueType,
+                                                   KeyValuePairKeyExtractor,
+                                                   HashFunctions,
+                                                   ValueTraits,
+                                                   KeyTraits,
+                                                   Allocator>,
+                                    HashTable<KeyType,
+                                              ValueType,
+                                              KeyValuePairKeyExtractor,
+                                              HashFunctions,
+                                              ValueTraits,
+                                              KeyTraits,
+                                              Allocator>>::type
       HashTableType;
 
   class HashMapKeysProxy;
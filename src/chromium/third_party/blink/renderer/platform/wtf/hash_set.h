@@ -24,6 +24,7 @@
 #include <initializer_list>
 #include "third_party/blink/renderer/platform/wtf/allocator/partition_allocator.h"
 #include "third_party/blink/renderer/platform/wtf/hash_table.h"
+#include "third_party/blink/renderer/platform/wtf/swiss_hash_table.h"
 #include "third_party/blink/renderer/platform/wtf/wtf_size_t.h"
 
 namespace WTF {
@@ -51,13 +52,21 @@ class HashSet {
   using value_type = ValueType;
 
  private:
-  typedef HashTable<ValueType,
-                    ValueType,
-                    IdentityExtractor,
-                    HashFunctions,
-                    ValueTraits,
-                    ValueTraits,
-                    Allocator>
+  typedef typename std::conditional<ValueTraits::kUseSwissTable,
+                                    SwissHashTable<ValueType,
+                                                   ValueType,
+                                                   IdentityExtractor,
+                                                   HashFunctions,
+                                                   ValueTraits,
+                                                   ValueTraits,
+                                                   Allocator>,
+                                    HashTable<ValueType,
+                                              ValueType,
+                                              IdentityExtractor,
+                                              HashFunctions,
+                                              ValueTraits,
+                                              ValueTraits,
+                                              Allocator>>::type
       HashTableType;
 
  public:
@@ -55,6 +55,10 @@ struct GenericHashTraitsBase<false, T> {
   // need them.
   static const bool kHasIsEmptyValueFunction = false;
 
+  // The useSwissTable flag makes HashMaps and HashSets use SwissHashTable
+  // instead of HashTable. See SwissHashTraits.
+  static const bool kUseSwissTable = false;
+
 // The starting table size. Can be overridden when we know beforehand that a
 // hash table will have at least N entries.
 #if defined(MEMORY_SANITIZER_INITIAL_SIZE)
@@ -460,11 +464,19 @@ struct NullableHashTraits : public HashTraits<T> {
   static T EmptyValue() { return reinterpret_cast<T>(1); }
 };
 
+// Traits for the keys of the HashMaps and HashSets which are hot enough to
+// use SwissHashTable, which probes several slots at once with SIMD.
+template <typename Traits>
+struct SwissHashTraits : Traits {
+  static const bool kUseSwissTable = true;
+};
+
 }  // namespace WTF
 
 using WTF::HashTraits;
 using WTF::PairHashTraits;
 using WTF::NullableHashTraits;
 using WTF::SimpleClassHashTraits;
+using WTF::SwissHashTraits;
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_HASH_TRAITS_H_
@@ -0,0 +1,603 @@
+// -------------------------------------------------
+// BlinKit - blink Library
+// -------------------------------------------------
+//   File Name: swiss_hash_table.h
+// Description: SwissHashTable Class
+//      Author: Ziming Li
+//     Created: 2026-10-19
+// -------------------------------------------------
+// Copyright (C) 2026 MingYang Software Technology.
+// -------------------------------------------------
+
+#ifndef BLINKIT_BLINK_SWISS_HASH_TABLE_H
+#define BLINKIT_BLINK_SWISS_HASH_TABLE_H
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <utility>
+#include "build/build_config.h"
+#include "third_party/blink/renderer/platform/wtf/hash_table.h"
+
+#if defined(ARCH_CPU_X86_FAMILY)
+#include <emmintrin.h>
+#if defined(COMPILER_MSVC)
+#include <intrin.h>
+#endif
+#elif defined(ARCH_CPU_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace WTF {
+
+// The control bytes of a group of slots of a SwissHashTable. A control byte is
+// kEmpty, kDeleted, or, for a full slot, 7 bits of the hash of its value, so
+// the high bit tells the full slots from the others. The Match functions
+// return a mask with bit i set for each byte i of the group which matches.
+class SwissTableGroup {
+  DISALLOW_NEW();
+
+ public:
+  static const unsigned kWidth = 16;
+  static const int8_t kEmpty = -128;
+  static const int8_t kDeleted = -2;
+
+  explicit SwissTableGroup(const int8_t* ctrl) {
+#if defined(ARCH_CPU_X86_FAMILY)
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#elif defined(ARCH_CPU_ARM64)
+    ctrl_ = vld1q_s8(ctrl);
+#else
+    memcpy(ctrl_, ctrl, kWidth);
+#endif
+  }
+
+  ALWAYS_INLINE unsigned Match(int8_t h2) const {
+#if defined(ARCH_CPU_X86_FAMILY)
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+#elif defined(ARCH_CPU_ARM64)
+    return ToMask(vceqq_s8(vdupq_n_s8(h2), ctrl_));
+#else
+    unsigned mask = 0;
+    for (unsigned i = 0; i < kWidth; ++i) {
+      if (ctrl_[i] == h2)
+        mask |= 1u << i;
+    }
+    return mask;
+#endif
+  }
+
+  ALWAYS_INLINE unsigned MatchEmpty() const { return Match(kEmpty); }
+
+  ALWAYS_INLINE unsigned MatchEmptyOrDeleted() const {
+#if defined(ARCH_CPU_X86_FAMILY)
+    return _mm_movemask_epi8(ctrl_);
+#elif defined(ARCH_CPU_ARM64)
+    return ToMask(vcltzq_s8(ctrl_));
+#else
+    unsigned mask = 0;
+    for (unsigned i = 0; i < kWidth; ++i) {
+      if (ctrl_[i] < 0)
+        mask |= 1u << i;
+    }
+    return mask;
+#endif
+  }
+
+  static ALWAYS_INLINE unsigned FirstSetBit(unsigned mask) {
+#if defined(COMPILER_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+  }
+
+ private:
+#if defined(ARCH_CPU_ARM64)
+  // NEON has no movemask, so weigh the lanes of the comparison by their bits
+  // and add up each half.
+  static ALWAYS_INLINE unsigned ToMask(uint8x16_t m) {
+    static const uint8_t kBits[kWidth] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                          1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t bits = vandq_u8(m, vld1q_u8(kBits));
+    return vaddv_u8(vget_low_u8(bits)) |
+           (static_cast<unsigned>(vaddv_u8(vget_high_u8(bits))) << 8);
+  }
+#endif
+
+#if defined(ARCH_CPU_X86_FAMILY)
+  __m128i ctrl_;
+#elif defined(ARCH_CPU_ARM64)
+  int8x16_t ctrl_;
+#else
+  int8_t ctrl_[kWidth];
+#endif
+};
+
+template <typename Value, typename Traits>
+class SwissHashTableIterator;
+
+template <typename Value, typename Traits>
+class SwissHashTableConstIterator final {
+  DISALLOW_NEW();
+
+ public:
+  typedef typename Traits::IteratorConstGetType GetType;
+
+  SwissHashTableConstIterator() = default;
+  SwissHashTableConstIterator(const int8_t* ctrl,
+                              const int8_t* ctrl_end,
+                              const Value* slot)
+      : ctrl_(ctrl), ctrl_end_(ctrl_end), slot_(slot) {}
+
+  GetType Get() const { return const_cast<GetType>(slot_); }
+  typename Traits::IteratorConstReferenceType operator*() const {
+    return Traits::GetToReferenceConstConversion(Get());
+  }
+  GetType operator->() const { return Get(); }
+
+  SwissHashTableConstIterator& operator++() {
+    DCHECK(ctrl_ != ctrl_end_);
+    ++ctrl_;
+    ++slot_;
+    SkipEmptySlots();
+    return *this;
+  }
+
+  bool operator==(const SwissHashTableConstIterator& other) const {
+    return ctrl_ == other.ctrl_;
+  }
+  bool operator!=(const SwissHashTableConstIterator& other) const {
+    return ctrl_ != other.ctrl_;
+  }
+
+  void SkipEmptySlots() {
+    while (ctrl_ != ctrl_end_ && *ctrl_ < 0) {
+      ++ctrl_;
+      ++slot_;
+    }
+  }
+
+ private:
+  const int8_t* ctrl_ = nullptr;
+  const int8_t* ctrl_end_ = nullptr;
+  const Value* slot_ = nullptr;
+};
+
+template <typename Value, typename Traits>
+class SwissHashTableIterator final {
+  DISALLOW_NEW();
+
+ public:
+  typedef SwissHashTableConstIterator<Value, Traits> const_iterator;
+  typedef typename Traits::IteratorGetType GetType;
+
+  SwissHashTableIterator() = default;
+  SwissHashTableIterator(const int8_t* ctrl,
+                         const int8_t* ctrl_end,
+                         const Value* slot)
+      : iterator_(ctrl, ctrl_end, slot) {}
+
+  GetType Get() const { return const_cast<GetType>(iterator_.Get()); }
+  typename Traits::IteratorReferenceType operator*() const {
+    return Traits::GetToReferenceConversion(Get());
+  }
+  GetType operator->() const { return Get(); }
+
+  SwissHashTableIterator& operator++() {
+    ++iterator_;
+    return *this;
+  }
+
+  bool operator==(const SwissHashTableIterator& other) const {
+    return iterator_ == other.iterator_;
+  }
+  bool operator!=(const SwissHashTableIterator& other) const {
+    return iterator_ != other.iterator_;
+  }
+  bool operator==(const const_iterator& other) const {
+    return iterator_ == other;
+  }
+  bool operator!=(const const_iterator& other) const {
+    return iterator_ != other;
+  }
+
+  operator const_iterator() const { return iterator_; }
+
+ private:
+  const_iterator iterator_;
+};
+
+// An open addressing hash table in the manner of Abseil's Swiss tables, for
+// the HashMaps and HashSets which opt in with SwissHashTraits. It has the
+// interface of HashTable which they use.
+//
+// Slots are probed a group at a time, by comparing the control bytes of the
+// group with 7 bits of the hash of the key at once: a miss usually compares no
+// key at all, and a hit usually compares one. Groups are probed
+// quadratically, and the table grows at 7/8 full. Erasing leaves a tombstone
+// only if the group of the slot has no empty slot, which is rare, so probe
+// sequences stay short in tables with many erasures.
+//
+// Only tables which are not garbage collected are supported, and the table
+// does not shrink until cleared.
+template <typename Key,
+          typename Value,
+          typename Extractor,
+          typename HashFunctions,
+          typename Traits,
+          typename KeyTraits,
+          typename Allocator>
+class SwissHashTable final {
+  DISALLOW_NEW();
+  static_assert(!Allocator::kIsGarbageCollected,
+                "SwissHashTable does not support garbage collected backings.");
+  static_assert(alignof(Value) <= SwissTableGroup::kWidth,
+                "The slots are aligned by the control bytes before them.");
+
+ public:
+  typedef SwissHashTableIterator<Value, Traits> iterator;
+  typedef SwissHashTableConstIterator<Value, Traits> const_iterator;
+  typedef Traits ValueTraits;
+  typedef Key KeyType;
+  typedef typename KeyTraits::PeekInType KeyPeekInType;
+  typedef Value ValueType;
+  typedef Extractor ExtractorType;
+  typedef KeyTraits KeyTraitsType;
+  typedef IdentityHashTranslator<HashFunctions, Traits, Allocator>
+      IdentityTranslatorType;
+  typedef HashTableAddResult<SwissHashTable, ValueType> AddResult;
+
+  SwissHashTable() = default;
+  SwissHashTable(const SwissHashTable& other);
+  SwissHashTable(SwissHashTable&& other) { swap(other); }
+  ~SwissHashTable() { DeleteAllSlotsAndDeallocate(); }
+
+  SwissHashTable& operator=(const SwissHashTable& other) {
+    SwissHashTable tmp(other);
+    swap(tmp);
+    return *this;
+  }
+  SwissHashTable& operator=(SwissHashTable&& other) {
+    SwissHashTable tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+
+  void swap(SwissHashTable& other) {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+  }
+
+  iterator begin() { return MakeIterator(FirstFullSlot()); }
+  iterator end() { return MakeIterator(capacity_); }
+  const_iterator begin() const { return MakeConstIterator(FirstFullSlot()); }
+  const_iterator end() const { return MakeConstIterator(capacity_); }
+
+  unsigned size() const { return size_; }
+  unsigned Capacity() const { return capacity_; }
+  bool IsEmpty() const { return !size_; }
+
+  void ReserveCapacityForSize(unsigned size) {
+    unsigned new_capacity = CapacityForSize(size);
+    if (new_capacity > capacity_)
+      Rehash(new_capacity);
+  }
+
+  AddResult insert(ValueType&& value) {
+    return insert<IdentityTranslatorType>(Extractor::Extract(value),
+                                          std::move(value));
+  }
+  AddResult insert(const ValueType& value) {
+    return insert<IdentityTranslatorType>(Extractor::Extract(value), value);
+  }
+
+  // A special version of insert() that finds the object by hashing and
+  // comparing with some other type, to avoid the cost of type conversion if
+  // the object is already in the table.
+  template <typename HashTranslator, typename T, typename Extra>
+  AddResult insert(T&& key, Extra&& extra) {
+    ValueType* slot;
+    if (!PrepareInsert<HashTranslator>(key, HashTranslator::GetHash(key),
+                                       slot))
+      return AddResult(this, slot, false);
+    HashTranslator::Translate(*slot, std::forward<T>(key),
+                              std::forward<Extra>(extra));
+    return AddResult(this, slot, true);
+  }
+  template <typename HashTranslator, typename T, typename Extra>
+  AddResult InsertPassingHashCode(T&& key, Extra&& extra) {
+    const unsigned hash = HashTranslator::GetHash(key);
+    ValueType* slot;
+    if (!PrepareInsert<HashTranslator>(key, hash, slot))
+      return AddResult(this, slot, false);
+    HashTranslator::Translate(*slot, std::forward<T>(key),
+                              std::forward<Extra>(extra), hash);
+    return AddResult(this, slot, true);
+  }
+
+  iterator find(KeyPeekInType key) { return Find<IdentityTranslatorType>(key); }
+  const_iterator find(KeyPeekInType key) const {
+    return Find<IdentityTranslatorType>(key);
+  }
+  bool Contains(KeyPeekInType key) const {
+    return Contains<IdentityTranslatorType>(key);
+  }
+
+  template <typename HashTranslator, typename T>
+  iterator Find(const T& key) {
+    ValueType* slot = Lookup<HashTranslator, T>(key);
+    return slot ? MakeIterator(slot - slots_) : end();
+  }
+  template <typename HashTranslator, typename T>
+  const_iterator Find(const T& key) const {
+    const ValueType* slot = Lookup<HashTranslator, T>(key);
+    return slot ? MakeConstIterator(slot - slots_) : end();
+  }
+  template <typename HashTranslator, typename T>
+  bool Contains(const T& key) const {
+    return Lookup<HashTranslator, T>(key);
+  }
+
+  void erase(KeyPeekInType key) {
+    if (ValueType* slot = Lookup<IdentityTranslatorType>(key))
+      EraseSlot(slot);
+  }
+  void erase(iterator it) {
+    if (it != end())
+      EraseSlot(it.Get());
+  }
+  void erase(const_iterator it) {
+    if (it != end())
+      EraseSlot(const_cast<ValueType*>(it.Get()));
+  }
+  void clear() {
+    DeleteAllSlotsAndDeallocate();
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = size_ = growth_left_ = 0;
+  }
+
+  template <typename HashTranslator, typename T>
+  ValueType* Lookup(const T& key) {
+    return const_cast<ValueType*>(
+        const_cast<const SwissHashTable*>(this)->Lookup<HashTranslator>(key));
+  }
+  template <typename HashTranslator, typename T>
+  const ValueType* Lookup(const T& key) const {
+    if (!size_)
+      return nullptr;
+    return LookupWithHash<HashTranslator>(
+        key, MixHash(HashTranslator::GetHash(key)));
+  }
+  ValueType* Lookup(KeyPeekInType key) {
+    return Lookup<IdentityTranslatorType, KeyPeekInType>(key);
+  }
+  const ValueType* Lookup(KeyPeekInType key) const {
+    return Lookup<IdentityTranslatorType, KeyPeekInType>(key);
+  }
+
+  // Modifications are not counted, since nothing checks them outside of
+  // HashTable.
+  int64_t Modifications() const { return 0; }
+
+ private:
+  static const unsigned kWidth = SwissTableGroup::kWidth;
+
+  // Hashes from StringHasher have only 24 bits, so multiply them out to 64
+  // bits: the high 32 bits pick the first group to probe, and the top 7 the
+  // control byte.
+  static ALWAYS_INLINE uint64_t MixHash(unsigned hash) {
+    return hash * UINT64_C(0x9E3779B97F4A7C15);
+  }
+  static ALWAYS_INLINE unsigned H1(uint64_t hash) {
+    return static_cast<unsigned>(hash >> 32);
+  }
+  static ALWAYS_INLINE int8_t H2(uint64_t hash) {
+    return static_cast<int8_t>(hash >> 57);
+  }
+
+  static unsigned MaxLoad(unsigned capacity) {
+    return capacity - capacity / 8;
+  }
+  static unsigned CapacityForSize(unsigned size) {
+    unsigned capacity = kWidth;
+    while (MaxLoad(capacity) < size) {
+      CHECK_LE(capacity, std::numeric_limits<unsigned>::max() / 2);
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  iterator MakeIterator(unsigned index) {
+    return iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+  }
+  const_iterator MakeConstIterator(unsigned index) const {
+    return const_iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+  }
+  unsigned FirstFullSlot() const {
+    unsigned index = 0;
+    while (index < capacity_ && ctrl_[index] < 0)
+      ++index;
+    return index;
+  }
+
+  template <typename HashTranslator, typename T>
+  const ValueType* LookupWithHash(const T& key, uint64_t hash) const {
+    const unsigned group_mask = capacity_ / kWidth - 1;
+    const int8_t h2 = H2(hash);
+    unsigned group = H1(hash) & group_mask;
+    for (unsigned step = 1;; ++step) {
+      const unsigned offset = group * kWidth;
+      SwissTableGroup g(ctrl_ + offset);
+      for (unsigned mask = g.Match(h2); mask; mask &= mask - 1) {
+        const ValueType* slot =
+            slots_ + offset + SwissTableGroup::FirstSetBit(mask);
+        if (HashTranslator::Equal(Extractor::Extract(*slot), key))
+          return slot;
+      }
+      if (g.MatchEmpty())
+        return nullptr;
+      DCHECK_LE(step, group_mask);
+      group = (group + step) & group_mask;
+    }
+  }
+
+  // The first slot which is empty or deleted on the probe sequence of |hash|.
+  unsigned FindFirstNonFull(uint64_t hash) const {
+    const unsigned group_mask = capacity_ / kWidth - 1;
+    unsigned group = H1(hash) & group_mask;
+    for (unsigned step = 1;; ++step) {
+      const unsigned offset = group * kWidth;
+      if (unsigned mask = SwissTableGroup(ctrl_ + offset).MatchEmptyOrDeleted())
+        return offset + SwissTableGroup::FirstSetBit(mask);
+      DCHECK_LE(step, group_mask);
+      group = (group + step) & group_mask;
+    }
+  }
+
+  // Returns true with an initialized slot for the new value, or false with
+  // the slot of the value which is already in the table.
+  template <typename HashTranslator, typename T>
+  bool PrepareInsert(const T& key, unsigned hash, ValueType*& slot) {
+    const uint64_t mixed = MixHash(hash);
+    if (size_) {
+      if (const ValueType* found =
+              LookupWithHash<HashTranslator>(key, mixed)) {
+        slot = const_cast<ValueType*>(found);
+        return false;
+      }
+    }
+    if (!growth_left_)
+      Grow();
+
+    const unsigned index = FindFirstNonFull(mixed);
+    if (ctrl_[index] == SwissTableGroup::kEmpty)
+      --growth_left_;
+    ctrl_[index] = H2(mixed);
+    ++size_;
+    slot = slots_ + index;
+    HashTableBucketInitializer<Traits::kEmptyValueIsZero>::template Initialize<
+        Traits, Allocator>(*slot);
+    return true;
+  }
+
+  void EraseSlot(ValueType* slot) {
+    const unsigned index = slot - slots_;
+    DCHECK_LT(index, capacity_);
+    DCHECK_GE(ctrl_[index], 0);
+    slot->~ValueType();
+    // A probe stops at the first group with an empty slot, so if this group
+    // has one, no probe can have gone past it and the slot can be empty too.
+    const unsigned offset = index & ~(kWidth - 1);
+    if (SwissTableGroup(ctrl_ + offset).MatchEmpty()) {
+      ctrl_[index] = SwissTableGroup::kEmpty;
+      ++growth_left_;
+    } else {
+      ctrl_[index] = SwissTableGroup::kDeleted;
+    }
+    --size_;
+  }
+
+  void Grow() {
+    // Tombstones take up the rest of the growth, so clear them out instead if
+    // there are many.
+    if (capacity_ && size_ <= MaxLoad(capacity_) / 2)
+      Rehash(capacity_);
+    else
+      Rehash(capacity_ ? capacity_ * 2 : CapacityForSize(0));
+  }
+
+  void Rehash(unsigned new_capacity) {
+    DCHECK_GE(MaxLoad(new_capacity), size_);
+    int8_t* old_ctrl = ctrl_;
+    ValueType* old_slots = slots_;
+    const unsigned old_capacity = capacity_;
+
+    Allocate(new_capacity);
+    for (unsigned i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] < 0)
+        continue;
+      ValueType& value = old_slots[i];
+      const uint64_t hash =
+          MixHash(HashFunctions::GetHash(Extractor::Extract(value)));
+      const unsigned index = FindFirstNonFull(hash);
+      ctrl_[index] = H2(hash);
+      new (NotNull, slots_ + index) ValueType(std::move(value));
+      value.~ValueType();
+    }
+    growth_left_ -= size_;
+    if (old_ctrl)
+      Allocator::FreeHashTableBacking(old_ctrl);
+  }
+
+  // The control bytes come first in the backing, followed by the slots.
+  void Allocate(unsigned capacity) {
+    DCHECK_EQ(capacity % kWidth, 0u);
+    size_t slots_size = base::CheckMul(capacity, sizeof(ValueType))
+                            .ValueOrDie<size_t>();
+    char* backing = Allocator::template AllocateHashTableBacking<
+        char, SwissHashTable>(capacity + slots_size);
+    ctrl_ = reinterpret_cast<int8_t*>(backing);
+    slots_ = reinterpret_cast<ValueType*>(backing + capacity);
+    memset(ctrl_, SwissTableGroup::kEmpty, capacity);
+    capacity_ = capacity;
+    growth_left_ = MaxLoad(capacity);
+  }
+
+  void DeleteAllSlotsAndDeallocate() {
+    if (!ctrl_)
+      return;
+    if (!IsTriviallyDestructible<ValueType>::value) {
+      for (unsigned i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] >= 0)
+          slots_[i].~ValueType();
+      }
+    }
+    Allocator::FreeHashTableBacking(ctrl_);
+  }
+
+  int8_t* ctrl_ = nullptr;
+  ValueType* slots_ = nullptr;
+  unsigned capacity_ = 0;
+  unsigned size_ = 0;
+  // The number of empty slots which may yet be filled before the table grows.
+  unsigned growth_left_ = 0;
+};
+
+template <typename Key,
+          typename Value,
+          typename Extractor,
+          typename HashFunctions,
+          typename Traits,
+          typename KeyTraits,
+          typename Allocator>
+SwissHashTable<Key,
+               Value,
+               Extractor,
+               HashFunctions,
+               Traits,
+               KeyTraits,
+               Allocator>::SwissHashTable(const SwissHashTable& other) {
+  if (!other.size_)
+    return;
+  // Copy the layout as it is, tombstones included, which saves rehashing.
+  Allocate(other.capacity_);
+  memcpy(ctrl_, other.ctrl_, capacity_);
+  for (unsigned i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0)
+      new (NotNull, slots_ + i) ValueType(other.slots_[i]);
+  }
+  size_ = other.size_;
+  growth_left_ = other.growth_left_;
+}
+
+}  // namespace WTF
+
+#endif  // BLINKIT_BLINK_SWISS_HASH_TABLE_H
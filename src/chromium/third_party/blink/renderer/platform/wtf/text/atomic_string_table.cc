@@ -4,16 +4,45 @@
 
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string_table.h"
 
+#include <atomic>
+#include <mutex>
 #include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
 #include "third_party/blink/renderer/platform/wtf/text/utf8.h"
 
 namespace WTF {
 
-AtomicStringTable::AtomicStringTable() {
-  for (StringImpl* string : StringImpl::AllStaticStrings().Values())
-    Add(string);
+namespace {
+
+// Process-wide set of static strings. Before freezing, it is written in place
+// and every access takes the lock. After freezing, readers use the published
+// set without locking, and writers publish an updated copy instead. The
+// replaced sets are leaked on purpose, as readers may still be walking them.
+struct StaticStringTable {
+  std::mutex lock;
+  std::atomic<bool> frozen{false};
+  std::atomic<AtomicStringTable::StringSet*> strings{
+      new AtomicStringTable::StringSet};
+};
+
+StaticStringTable& GetStaticStringTable() {
+  static StaticStringTable* table = new StaticStringTable;
+  return *table;
+}
+
+template <typename Function>
+StringImpl* LookupStaticStringTable(const Function& lookup) {
+  StaticStringTable& table = GetStaticStringTable();
+  if (table.frozen.load(std::memory_order_acquire))
+    return lookup(*table.strings.load(std::memory_order_acquire));
+
+  std::lock_guard<std::mutex> guard(table.lock);
+  return lookup(*table.strings.load(std::memory_order_relaxed));
 }
 
+}  // namespace
+
+AtomicStringTable::AtomicStringTable() = default;
+
 AtomicStringTable::~AtomicStringTable() {
   for (StringImpl* string : table_) {
     if (!string->IsStatic()) {
@@ -24,12 +53,66 @@ AtomicStringTable::~AtomicStringTable() {
 }
 
 void AtomicStringTable::ReserveCapacity(unsigned size) {
-  table_.ReserveCapacityForSize(size);
+  StaticStringTable& table = GetStaticStringTable();
+  std::lock_guard<std::mutex> guard(table.lock);
+  DCHECK(!table.frozen.load(std::memory_order_relaxed));
+  table.strings.load(std::memory_order_relaxed)->ReserveCapacityForSize(size);
+}
+
+void AtomicStringTable::FreezeStaticStrings() {
+  DCHECK(IsMainThread());
+  StaticStringTable& table = GetStaticStringTable();
+  std::lock_guard<std::mutex> guard(table.lock);
+  table.frozen.store(true, std::memory_order_release);
+}
+
+StringImpl* AtomicStringTable::AddStaticString(StringImpl* string) {
+  DCHECK(string->IsStatic());
+
+  StaticStringTable& table = GetStaticStringTable();
+  std::lock_guard<std::mutex> guard(table.lock);
+
+  StringSet* strings = table.strings.load(std::memory_order_relaxed);
+  if (table.frozen.load(std::memory_order_relaxed)) {
+    auto it = strings->find(string);
+    if (it != strings->end())
+      return *it;
+
+    // Readers may be walking the current set, so publish an updated copy.
+    string->SetIsAtomic(true);
+    StringSet* copy = new StringSet(*strings);
+    copy->insert(string);
+    table.strings.store(copy, std::memory_order_release);
+    return string;
+  }
+
+  StringImpl* result = *strings->insert(string).stored_value;
+  if (!result->IsAtomic())
+    result->SetIsAtomic(true);
+  return result;
+}
+
+template <typename T, typename HashTranslator>
+StringImpl* AtomicStringTable::FindStaticString(const T& value) {
+  return LookupStaticStringTable([&value](const StringSet& strings) {
+    auto it = strings.template Find<HashTranslator>(value);
+    return it != strings.end() ? *it : nullptr;
+  });
+}
+
+StringImpl* AtomicStringTable::FindStaticString(StringImpl* string) {
+  return LookupStaticStringTable([string](const StringSet& strings) {
+    auto it = strings.find(string);
+    return it != strings.end() ? *it : nullptr;
+  });
 }
 
 template <typename T, typename HashTranslator>
 scoped_refptr<StringImpl> AtomicStringTable::AddToStringTable(const T& value) {
-  HashSet<StringImpl*>::AddResult add_result =
+  if (StringImpl* static_string = FindStaticString<T, HashTranslator>(value))
+    return static_string;
+
+  StringSet::AddResult add_result =
       table_.AddWithTranslator<HashTranslator>(value);
 
   // If the string is newly-translated, then we need to adopt it.
@@ -196,12 +279,20 @@ StringImpl* AtomicStringTable::Add(StringImpl* string) {
   if (!string->length())
     return StringImpl::empty_;
 
+  if (StringImpl* static_string = FindStaticString(string))
+    return static_string;
+
+  if (string->IsStatic()) {
+    // Keep the identity of an equal atom this thread created before the
+    // static string existed.
+    auto it = table_.find(string);
+    return it != table_.end() ? *it : AddStaticString(string);
+  }
+
   StringImpl* result = *table_.insert(string).stored_value;
 
   if (!result->IsAtomic())
     result->SetIsAtomic(true);
-
-  DCHECK(!string->IsStatic() || result->IsStatic());
   return result;
 }
 
@@ -222,6 +313,7 @@ scoped_refptr<StringImpl> AtomicStringTable::AddUTF8(
 
 void AtomicStringTable::Remove(StringImpl* string) {
   DCHECK(string->IsAtomic());
+  DCHECK(!string->IsStatic());
   auto iterator = table_.find(string);
   CHECK_NE(iterator, table_.end());
   table_.erase(iterator);
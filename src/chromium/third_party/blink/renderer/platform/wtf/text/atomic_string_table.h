@@ -17,10 +17,23 @@ namespace WTF {
 
 // The underlying storage that keeps the map of unique AtomicStrings. This is
 // not thread safe and each WTFThreadData has one.
+//
+// Static strings (the generated names such as html_names and
+// event_type_names) are immortal, so they are not copied into every thread's
+// table. They are interned once in a process-wide table which is looked up
+// before the per-thread one, and which is read without locking once
+// FreezeStaticStrings() has been called. The per-thread table only keeps the
+// atoms created at runtime, and acts as a front cache for them.
 class WTF_EXPORT AtomicStringTable final {
   USING_FAST_MALLOC(AtomicStringTable);
 
  public:
+  // Every atomization looks the tables up, so they use SwissHashTable.
+  typedef HashSet<StringImpl*,
+                  DefaultHash<StringImpl*>::Hash,
+                  SwissHashTraits<HashTraits<StringImpl*>>>
+      StringSet;
+
   AtomicStringTable();
   ~AtomicStringTable();
 
@@ -31,7 +44,11 @@ class WTF_EXPORT AtomicStringTable final {
 
   // Used by system initialization to preallocate enough storage for all of
   // the static strings.
-  void ReserveCapacity(unsigned size);
+  static void ReserveCapacity(unsigned size);
+  // Called on the main thread once the static strings of the engine have
+  // been created. Static strings added later are still accepted, but are
+  // expected to be rare.
+  static void FreezeStaticStrings();
 
   // Inserting strings into the table. Note that the return value from adding
   // a UChar string may be an LChar string as the table will attempt to
@@ -54,7 +71,12 @@ class WTF_EXPORT AtomicStringTable final {
   template <typename T, typename HashTranslator>
   inline scoped_refptr<StringImpl> AddToStringTable(const T& value);
 
-  HashSet<StringImpl*> table_;
+  template <typename T, typename HashTranslator>
+  static StringImpl* FindStaticString(const T& value);
+  static StringImpl* FindStaticString(StringImpl* string);
+  static StringImpl* AddStaticString(StringImpl* string);
+
+  StringSet table_;
 
   DISALLOW_COPY_AND_ASSIGN(AtomicStringTable);
 };